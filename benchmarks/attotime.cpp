@@ -0,0 +1,51 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "emucore.h"
+#include "eminline.h"
+#include "attotime.h"
+
+static void BM_attotime_add(benchmark::State& state) {
+	attotime total = attotime::zero;
+	attotime delta = attotime::from_nsec(3333);
+	while (state.KeepRunning()) {
+		total += delta;
+	}
+	(void)total;
+}
+// Register the function as a benchmark
+BENCHMARK(BM_attotime_add);
+
+static void BM_attotime_compare(benchmark::State& state) {
+	attotime left = attotime::from_usec(100);
+	attotime right = attotime::from_nsec(99999);
+	int result = 0;
+	while (state.KeepRunning()) {
+		result += (left < right) ? 1 : -1;
+		left += attotime::from_nsec(1);
+	}
+	(void)result;
+}
+BENCHMARK(BM_attotime_compare);
+
+static void BM_attotime_as_ticks(benchmark::State& state) {
+	attotime value = attotime::from_usec(1297);
+	u64 total = 0;
+	while (state.KeepRunning()) {
+		total += value.as_ticks(XTAL(14'318'181));
+		value += attotime::from_nsec(7);
+	}
+	(void)total;
+}
+BENCHMARK(BM_attotime_as_ticks);
+
+static void BM_attotime_from_ticks(benchmark::State& state) {
+	u64 ticks = 0;
+	attotime total = attotime::zero;
+	while (state.KeepRunning()) {
+		total += attotime::from_ticks(ticks, XTAL(14'318'181));
+		ticks += 977;
+	}
+	(void)total;
+}
+BENCHMARK(BM_attotime_from_ticks);
@@ -0,0 +1,45 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcomm.h"
+#include "osdcore.h"
+#include "delegate.h"
+
+namespace {
+
+struct target
+{
+	virtual ~target() { }
+	int member(int x) { return m_total += x; }
+	virtual int vmember(int x) { return m_total += x; }
+	int m_total = 0;
+};
+
+} // anonymous namespace
+
+static void BM_delegate_member(benchmark::State& state) {
+	target object;
+	delegate<int (int)> cb(&target::member, &object);
+	while (state.KeepRunning()) {
+		(void)cb(1);
+	}
+}
+// Register the function as a benchmark
+BENCHMARK(BM_delegate_member);
+
+static void BM_delegate_lambda(benchmark::State& state) {
+	target object;
+	delegate<int (int)> cb([&object] (int x) { return object.member(x); });
+	while (state.KeepRunning()) {
+		(void)cb(1);
+	}
+}
+BENCHMARK(BM_delegate_lambda);
+
+// virtual dispatch on the same target, as a baseline for the delegate overhead
+static void BM_virtual_member(benchmark::State& state) {
+	target object;
+	target *objptr = &object;
+	while (state.KeepRunning()) {
+		(void)objptr->vmember(1);
+	}
+}
+BENCHMARK(BM_virtual_member);
@@ -11,3 +11,43 @@ static void BM_count_leading_zeros_native(benchmark::State& state) {
 }
 // Register the function as a benchmark
 BENCHMARK(BM_count_leading_zeros_native);
+static void BM_count_leading_zeros_64_native(benchmark::State& state) {
+	uint64_t cnt = 0x3325330000ULL;
+	while (state.KeepRunning()) {
+		(void)count_leading_zeros_64(cnt);
+		cnt++;
+	}
+}
+BENCHMARK(BM_count_leading_zeros_64_native);
+static void BM_maddu_64x64_native(benchmark::State& state) {
+	uint64_t lo = 0;
+	uint64_t hi = 0;
+	uint64_t cnt = 0x123456789abcdefULL;
+	while (state.KeepRunning()) {
+		lo = maddu_64x64(cnt, 0x100000001ULL, lo, hi);
+		cnt++;
+	}
+	benchmark::DoNotOptimize(lo);
+	benchmark::DoNotOptimize(hi);
+}
+BENCHMARK(BM_maddu_64x64_native);
+static void BM_add_sat_32_native(benchmark::State& state) {
+	int32_t acc = 0;
+	int32_t cnt = 0x332533;
+	while (state.KeepRunning()) {
+		acc = add_sat_32(acc, cnt);
+		cnt++;
+	}
+	benchmark::DoNotOptimize(acc);
+}
+BENCHMARK(BM_add_sat_32_native);
+static void BM_add_sat_64_native(benchmark::State& state) {
+	int64_t acc = 0;
+	int64_t cnt = 0x33253300000000LL;
+	while (state.KeepRunning()) {
+		acc = add_sat_64(acc, cnt);
+		cnt++;
+	}
+	benchmark::DoNotOptimize(acc);
+}
+BENCHMARK(BM_add_sat_64_native);
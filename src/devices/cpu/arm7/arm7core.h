@@ -492,6 +492,30 @@ enum
 	COND_NV               /*  0           never                   */
 };
 
+/* Bitmask of the flag states (NZCV, as delivered by CPSR >> 28) under which
+ * each condition passes; index with the condition code, test the bit for the
+ * current flag nibble.
+ */
+static const uint16_t sConditionPassed[16] =
+{
+	0xf0f0,  /* EQ */
+	0x0f0f,  /* NE */
+	0xcccc,  /* CS */
+	0x3333,  /* CC */
+	0xff00,  /* MI */
+	0x00ff,  /* PL */
+	0xaaaa,  /* VS */
+	0x5555,  /* VC */
+	0x0c0c,  /* HI */
+	0xf3f3,  /* LS */
+	0xaa55,  /* GE */
+	0x55aa,  /* LT */
+	0x0a05,  /* GT */
+	0xf5fa,  /* LE */
+	0xffff,  /* AL */
+	0x0000   /* NV */
+};
+
 /* Convenience Macros */
 #define R15                     m_r[eR15]
 #define SPSR                    17                     // SPSR is always the 18th register in our 0 based array sRegisterTable[][18]
@@ -1670,6 +1670,18 @@ void arm7_cpu_device::arm7ops_0123(uint32_t insn)
 //case 1:
 //case 2:
 //case 3:
+	/* Data Processing fast path: by far the most common case.  BX, PSR
+	 * transfers and all the v5+ extended opcodes live in the TST/TEQ/CMP/CMN
+	 * encoding hole (bits 24-23 = 10 with the S bit clear), and multiplies,
+	 * swaps and halfword transfers are register-form ops with bits 7 and 4
+	 * both set; everything else is a plain ALU op, so dispatch it without
+	 * walking the chain of rare pattern checks below.
+	 */
+	if ((insn & 0x01900000) != 0x01000000 && (insn & 0x02000090) != 0x00000090)
+	{
+		HandleALU(insn);
+	}
+	else
 	/* Branch and Exchange (BX) */
 	if ((insn & 0x0ffffff0) == 0x012fff10)     // bits 27-4 == 000100101111111111110001
 	{
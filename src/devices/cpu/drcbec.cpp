@@ -124,7 +124,9 @@ enum
 	OP_FFRI4,
 	OP_FFRI8,
 	OP_FFRFS,
-	OP_FFRFD
+	OP_FFRFD,
+	OP_CMPJMP,
+	OP_TESTJMP
 };
 
 
@@ -342,6 +344,45 @@ void drcbe_c::generate(drcuml_block &block, const instruction *instlist, uint32_
 
 		// handle most instructions generally, but a few special cases
 		opcode_t opcode = inst.opcode();
+
+		// fuse an unconditional CMP or TEST followed by a conditional JMP
+		// into a single dispatch; this is by far the most common pair in
+		// generated UML and saves a trip through the dispatch loop
+		if ((opcode == OP_CMP || opcode == OP_TEST) && inst.condition() == COND_ALWAYS &&
+			inum + 1 < numinst && instlist[inum + 1].opcode() == OP_JMP &&
+			instlist[inum + 1].condition() != COND_ALWAYS)
+		{
+			const instruction &jmpinst = instlist[inum + 1];
+
+			// count how many bytes of immediates we need
+			int immedbytes = 0;
+			for (int pnum = 0; pnum < inst.numparams(); pnum++)
+				if (inst.param(pnum).is_mapvar() ||
+					(inst.param(pnum).is_immediate() && inst.param(pnum).immediate() != 0))
+					immedbytes += inst.size();
+			int immedwords = (immedbytes + sizeof(drcbec_instruction) - 1) / sizeof(drcbec_instruction);
+
+			// the opcode word carries the branch condition; the compare
+			// parameters are followed by the jump target
+			(dst++)->i = MAKE_OPCODE_FULL((opcode == OP_CMP) ? OP_CMPJMP : OP_TESTJMP, inst.size(), jmpinst.condition(), inst.flags(), inst.numparams() + 1 + immedwords);
+
+			// immediates start after the parameters and the jump target
+			void *immed = dst + inst.numparams() + 1;
+
+			// output each of the parameters, then the jump target
+			for (int pnum = 0; pnum < inst.numparams(); pnum++)
+				output_parameter(&dst, &immed, inst.size(), inst.param(pnum));
+			dst->inst = (drcbec_instruction *)m_labels.get_codeptr(jmpinst.param(0).label(), m_fixup_delegate, dst);
+			dst++;
+
+			// point past the end of the immediates
+			dst += immedwords;
+
+			// the JMP has been consumed as well
+			inum++;
+			continue;
+		}
+
 		switch (opcode)
 		{
 			// when we hit a HANDLE opcode, register the current pointer for the handle
@@ -953,6 +994,18 @@ int drcbe_c::execute(code_handle &entry)
 //                printf("CMP: %08x - %08x = flags %x\n", PARAM0, PARAM1, flags);
 				break;
 
+			case MAKE_OPCODE_SHORT(OP_CMPJMP, 4, 1):    // CMP     src1,src2 / JMP imm,c (fused)
+				temp32 = PARAM0 - PARAM1;
+				flags = FLAGS32_NZCV_SUB(temp32, PARAM0, PARAM1);
+				if (OPCODE_PASS_CONDITION(opcode, flags))
+				{
+					newinst = inst[2].inst;
+					assert_in_cache(m_cache, newinst);
+					inst = newinst;
+					continue;
+				}
+				break;
+
 			case MAKE_OPCODE_SHORT(OP_MULU, 4, 0):      // MULU    dst,edst,src1,src2[,f]
 				temp64 = (uint64_t)(uint32_t)PARAM2 * (uint64_t)(uint32_t)PARAM3;
 				PARAM1 = temp64 >> 32;
@@ -1041,6 +1094,18 @@ int drcbe_c::execute(code_handle &entry)
 				flags = FLAGS32_NZ(temp32);
 				break;
 
+			case MAKE_OPCODE_SHORT(OP_TESTJMP, 4, 1):   // TEST    src1,src2 / JMP imm,c (fused)
+				temp32 = PARAM0 & PARAM1;
+				flags = FLAGS32_NZ(temp32);
+				if (OPCODE_PASS_CONDITION(opcode, flags))
+				{
+					newinst = inst[2].inst;
+					assert_in_cache(m_cache, newinst);
+					inst = newinst;
+					continue;
+				}
+				break;
+
 			case MAKE_OPCODE_SHORT(OP_OR, 4, 0):        // OR      dst,src1,src2[,f]
 				PARAM0 = PARAM1 | PARAM2;
 				break;
@@ -1581,6 +1646,18 @@ int drcbe_c::execute(code_handle &entry)
 				flags = FLAGS64_NZCV_SUB(temp64, DPARAM0, DPARAM1);
 				break;
 
+			case MAKE_OPCODE_SHORT(OP_CMPJMP, 8, 1):    // DCMP    src1,src2 / JMP imm,c (fused)
+				temp64 = DPARAM0 - DPARAM1;
+				flags = FLAGS64_NZCV_SUB(temp64, DPARAM0, DPARAM1);
+				if (OPCODE_PASS_CONDITION(opcode, flags))
+				{
+					newinst = inst[2].inst;
+					assert_in_cache(m_cache, newinst);
+					inst = newinst;
+					continue;
+				}
+				break;
+
 			case MAKE_OPCODE_SHORT(OP_MULU, 8, 0):      // DMULU   dst,edst,src1,src2[,f]
 				dmulu(*inst[0].puint64, *inst[1].puint64, DPARAM2, DPARAM3, false);
 				break;
@@ -1654,6 +1731,18 @@ int drcbe_c::execute(code_handle &entry)
 				flags = FLAGS64_NZ(temp64);
 				break;
 
+			case MAKE_OPCODE_SHORT(OP_TESTJMP, 8, 1):   // DTEST   src1,src2 / JMP imm,c (fused)
+				temp64 = DPARAM0 & DPARAM1;
+				flags = FLAGS64_NZ(temp64);
+				if (OPCODE_PASS_CONDITION(opcode, flags))
+				{
+					newinst = inst[2].inst;
+					assert_in_cache(m_cache, newinst);
+					inst = newinst;
+					continue;
+				}
+				break;
+
 			case MAKE_OPCODE_SHORT(OP_OR, 8, 0):        // DOR     dst,src1,src2[,f]
 				DPARAM0 = DPARAM1 | DPARAM2;
 				break;
@@ -1924,6 +2013,14 @@ int drcbe_c::execute(code_handle &entry)
 				FSPARAM0 = FSPARAM1 / FSPARAM2;
 				break;
 
+			case MAKE_OPCODE_SHORT(OP_FMADD, 4, 0):     // FSMADD  dst,src1,src2,src3
+				FSPARAM0 = FSPARAM1 * FSPARAM2 + FSPARAM3;
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_FMSUB, 4, 0):     // FSMSUB  dst,src1,src2,src3
+				FSPARAM0 = FSPARAM1 * FSPARAM2 - FSPARAM3;
+				break;
+
 			case MAKE_OPCODE_SHORT(OP_FNEG, 4, 0):      // FSNEG   dst,src1
 				FSPARAM0 = -FSPARAM1;
 				break;
@@ -2071,6 +2168,14 @@ int drcbe_c::execute(code_handle &entry)
 				FDPARAM0 = FDPARAM1 / FDPARAM2;
 				break;
 
+			case MAKE_OPCODE_SHORT(OP_FMADD, 8, 0):     // FDMADD  dst,src1,src2,src3
+				FDPARAM0 = FDPARAM1 * FDPARAM2 + FDPARAM3;
+				break;
+
+			case MAKE_OPCODE_SHORT(OP_FMSUB, 8, 0):     // FDMSUB  dst,src1,src2,src3
+				FDPARAM0 = FDPARAM1 * FDPARAM2 - FDPARAM3;
+				break;
+
 			case MAKE_OPCODE_SHORT(OP_FNEG, 8, 0):      // FDNEG   dst,src1
 				FDPARAM0 = -FDPARAM1;
 				break;
@@ -395,6 +395,8 @@ const drcbe_x64::opcode_table_entry drcbe_x64::s_opcode_table_source[] =
 	{ uml::OP_FCMP,    &drcbe_x64::op_fcmp },       // FCMP    src1,src2
 	{ uml::OP_FMUL,    &drcbe_x64::op_fmul },       // FMUL    dst,src1,src2
 	{ uml::OP_FDIV,    &drcbe_x64::op_fdiv },       // FDIV    dst,src1,src2
+	{ uml::OP_FMADD,   &drcbe_x64::op_fmadd },      // FMADD   dst,src1,src2,src3
+	{ uml::OP_FMSUB,   &drcbe_x64::op_fmsub },      // FMSUB   dst,src1,src2,src3
 	{ uml::OP_FNEG,    &drcbe_x64::op_fneg },       // FNEG    dst,src1
 	{ uml::OP_FABS,    &drcbe_x64::op_fabs },       // FABS    dst,src1
 	{ uml::OP_FSQRT,   &drcbe_x64::op_fsqrt },      // FSQRT   dst,src1
@@ -4778,6 +4780,112 @@ void drcbe_x64::op_fdiv(Assembler &a, const instruction &inst)
 }
 
 
+//-------------------------------------------------
+//  op_fmadd - process a FMADD opcode
+//-------------------------------------------------
+
+void drcbe_x64::op_fmadd(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MF);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MF);
+	be_parameter src3p(*this, inst.param(3), PTYPE_MF);
+	normalize_commutative(src1p, src2p);
+
+	// pick a target register for the general case
+	Xmm dstreg = dstp.select_register(xmm0, src2p, src3p);
+
+	// 32-bit form
+	if (inst.size() == 4)
+	{
+		movss_r128_p32(a, dstreg, src1p);                                               // movss dstreg,src1p
+		if (src2p.is_memory())
+			a.mulss(dstreg, MABS(src2p.memory()));                                      // mulss dstreg,[src2p]
+		else if (src2p.is_float_register())
+			a.mulss(dstreg, Xmm(src2p.freg()));                                         // mulss dstreg,src2p
+		if (src3p.is_memory())
+			a.addss(dstreg, MABS(src3p.memory()));                                      // addss dstreg,[src3p]
+		else if (src3p.is_float_register())
+			a.addss(dstreg, Xmm(src3p.freg()));                                         // addss dstreg,src3p
+		movss_p32_r128(a, dstp, dstreg);                                                // movss dstp,dstreg
+	}
+
+	// 64-bit form
+	else if (inst.size() == 8)
+	{
+		movsd_r128_p64(a, dstreg, src1p);                                               // movsd dstreg,src1p
+		if (src2p.is_memory())
+			a.mulsd(dstreg, MABS(src2p.memory()));                                      // mulsd dstreg,[src2p]
+		else if (src2p.is_float_register())
+			a.mulsd(dstreg, Xmm(src2p.freg()));                                         // mulsd dstreg,src2p
+		if (src3p.is_memory())
+			a.addsd(dstreg, MABS(src3p.memory()));                                      // addsd dstreg,[src3p]
+		else if (src3p.is_float_register())
+			a.addsd(dstreg, Xmm(src3p.freg()));                                         // addsd dstreg,src3p
+		movsd_p64_r128(a, dstp, dstreg);                                                // movsd dstp,dstreg
+	}
+}
+
+
+//-------------------------------------------------
+//  op_fmsub - process a FMSUB opcode
+//-------------------------------------------------
+
+void drcbe_x64::op_fmsub(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MF);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MF);
+	be_parameter src3p(*this, inst.param(3), PTYPE_MF);
+	normalize_commutative(src1p, src2p);
+
+	// pick a target register for the general case
+	Xmm dstreg = dstp.select_register(xmm0, src2p, src3p);
+
+	// 32-bit form
+	if (inst.size() == 4)
+	{
+		movss_r128_p32(a, dstreg, src1p);                                               // movss dstreg,src1p
+		if (src2p.is_memory())
+			a.mulss(dstreg, MABS(src2p.memory()));                                      // mulss dstreg,[src2p]
+		else if (src2p.is_float_register())
+			a.mulss(dstreg, Xmm(src2p.freg()));                                         // mulss dstreg,src2p
+		if (src3p.is_memory())
+			a.subss(dstreg, MABS(src3p.memory()));                                      // subss dstreg,[src3p]
+		else if (src3p.is_float_register())
+			a.subss(dstreg, Xmm(src3p.freg()));                                         // subss dstreg,src3p
+		movss_p32_r128(a, dstp, dstreg);                                                // movss dstp,dstreg
+	}
+
+	// 64-bit form
+	else if (inst.size() == 8)
+	{
+		movsd_r128_p64(a, dstreg, src1p);                                               // movsd dstreg,src1p
+		if (src2p.is_memory())
+			a.mulsd(dstreg, MABS(src2p.memory()));                                      // mulsd dstreg,[src2p]
+		else if (src2p.is_float_register())
+			a.mulsd(dstreg, Xmm(src2p.freg()));                                         // mulsd dstreg,src2p
+		if (src3p.is_memory())
+			a.subsd(dstreg, MABS(src3p.memory()));                                      // subsd dstreg,[src3p]
+		else if (src3p.is_float_register())
+			a.subsd(dstreg, Xmm(src3p.freg()));                                         // subsd dstreg,src3p
+		movsd_p64_r128(a, dstp, dstreg);                                                // movsd dstp,dstreg
+	}
+}
+
+
 //-------------------------------------------------
 //  op_fneg - process a FNEG opcode
 //-------------------------------------------------
@@ -276,6 +276,8 @@ const drcbe_x86::opcode_table_entry drcbe_x86::s_opcode_table_source[] =
 	{ uml::OP_FCMP,    &drcbe_x86::op_fcmp },       // FCMP    src1,src2
 	{ uml::OP_FMUL,    &drcbe_x86::op_fmul },       // FMUL    dst,src1,src2
 	{ uml::OP_FDIV,    &drcbe_x86::op_fdiv },       // FDIV    dst,src1,src2
+	{ uml::OP_FMADD,   &drcbe_x86::op_fmadd },      // FMADD   dst,src1,src2,src3
+	{ uml::OP_FMSUB,   &drcbe_x86::op_fmsub },      // FMSUB   dst,src1,src2,src3
 	{ uml::OP_FNEG,    &drcbe_x86::op_fneg },       // FNEG    dst,src1
 	{ uml::OP_FABS,    &drcbe_x86::op_fabs },       // FABS    dst,src1
 	{ uml::OP_FSQRT,   &drcbe_x86::op_fsqrt },      // FSQRT   dst,src1
@@ -5815,6 +5817,62 @@ void drcbe_x86::op_fdiv(Assembler &a, const instruction &inst)
 }
 
 
+//-------------------------------------------------
+//  op_fmadd - process a FMADD opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_fmadd(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MF);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MF);
+	be_parameter src3p(*this, inst.param(3), PTYPE_MF);
+	normalize_commutative(src1p, src2p);
+
+	// general case
+	emit_fld_p(a, inst.size(), src1p);                                                  // fld   src1p
+	emit_fld_p(a, inst.size(), src2p);                                                  // fld   src2p
+	a.fmulp();                                                                          // fmulp
+	emit_fld_p(a, inst.size(), src3p);                                                  // fld   src3p
+	a.faddp();                                                                          // faddp
+	emit_fstp_p(a, inst.size(), dstp);                                                  // fstp  dstp
+}
+
+
+//-------------------------------------------------
+//  op_fmsub - process a FMSUB opcode
+//-------------------------------------------------
+
+void drcbe_x86::op_fmsub(Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MF);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MF);
+	be_parameter src3p(*this, inst.param(3), PTYPE_MF);
+	normalize_commutative(src1p, src2p);
+
+	// general case
+	emit_fld_p(a, inst.size(), src1p);                                                  // fld   src1p
+	emit_fld_p(a, inst.size(), src2p);                                                  // fld   src2p
+	a.fmulp();                                                                          // fmulp
+	emit_fld_p(a, inst.size(), src3p);                                                  // fld   src3p
+	a.fsubp();                                                                          // fsubp
+	emit_fstp_p(a, inst.size(), dstp);                                                  // fstp  dstp
+}
+
+
 //-------------------------------------------------
 //  op_fneg - process a FNEG opcode
 //-------------------------------------------------
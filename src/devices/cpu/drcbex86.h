@@ -202,6 +202,8 @@ private:
 	void op_fcmp(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_fmul(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_fdiv(asmjit::x86::Assembler &a, const uml::instruction &inst);
+	void op_fmadd(asmjit::x86::Assembler &a, const uml::instruction &inst);
+	void op_fmsub(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_fneg(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_fabs(asmjit::x86::Assembler &a, const uml::instruction &inst);
 	void op_fsqrt(asmjit::x86::Assembler &a, const uml::instruction &inst);
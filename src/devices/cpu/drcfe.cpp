@@ -27,6 +27,16 @@ namespace {
 
 constexpr u32 MAX_STACK_DEPTH = 100;
 
+// blocks described this many times (i.e. recompiled after repeated cache
+// flushes) are considered hot and get a wider forward code window so that
+// chains of blocks are described and compiled as a single superblock with
+// direct intrablock branches instead of dispatcher round trips
+constexpr u32 HOT_BLOCK_THRESHOLD = 16;
+constexpr u32 HOT_WINDOW_FACTOR = 4;
+
+// cap on the hot-block tracking table before it is recycled
+constexpr size_t MAX_DESCRIBE_COUNTS = 16384;
+
 
 
 //**************************************************************************
@@ -59,7 +69,7 @@ drc_frontend::drc_frontend(device_t &cpu, u32 window_start, u32 window_end, u32
 	, m_cpudevice(downcast<cpu_device &>(cpu))
 	, m_program(m_cpudevice.space(AS_PROGRAM))
 	, m_pageshift(m_cpudevice.space_config(AS_PROGRAM)->page_shift())
-	, m_desc_array(window_end + window_start + 2, nullptr)
+	, m_desc_array(window_end * HOT_WINDOW_FACTOR + window_start + 2, nullptr)
 {
 }
 
@@ -86,6 +96,14 @@ const opcode_desc *drc_frontend::describe_code(offs_t startpc)
 	// release any descriptions we've accumulated
 	release_descriptions();
 
+	// track how often this block is described; repeatedly recompiled blocks
+	// are hot, so widen their forward window to absorb successor blocks
+	if (m_describe_counts.size() >= MAX_DESCRIBE_COUNTS)
+		m_describe_counts.clear();
+	u32 window_end = m_window_end;
+	if (++m_describe_counts[startpc] >= HOT_BLOCK_THRESHOLD)
+		window_end = m_window_end * HOT_WINDOW_FACTOR;
+
 	// add the initial PC to the stack
 	pc_stack_entry pcstack[MAX_STACK_DEPTH];
 	pc_stack_entry *pcstackptr = &pcstack[0];
@@ -95,7 +113,7 @@ const opcode_desc *drc_frontend::describe_code(offs_t startpc)
 
 	// loop while we still have a stack
 	offs_t const minpc = startpc - (std::min)(m_window_start, startpc);
-	offs_t const maxpc = startpc + (std::min)(m_window_end, 0xffffffff - startpc);
+	offs_t const maxpc = startpc + (std::min)(window_end, 0xffffffff - startpc);
 	while (pcstackptr != &pcstack[0])
 	{
 		// if we've already hit this PC, just mark it a branch target and continue
@@ -33,6 +33,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -159,6 +161,9 @@ private:
 	simple_list<opcode_desc> m_desc_live_list;      // list of live descriptions
 	fixed_allocator<opcode_desc> m_desc_allocator;  // fixed allocator for descriptions
 	std::vector<opcode_desc *> m_desc_array;        // array of descriptions in PC order
+
+	// hot block tracking
+	std::unordered_map<offs_t, u32> m_describe_counts; // number of times each start PC has been described
 };
 
 #endif // MAME_CPU_DRCFE_H
@@ -148,7 +148,11 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
+	, m_optimize_enabled(device.machine().options().drc_optimize())
+	, m_warm_enabled(device.machine().options().drc_warm_list())
 {
+	if (m_warm_enabled)
+		load_warm_list();
 }
 
 
@@ -158,6 +162,8 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 
 drcuml_state::~drcuml_state()
 {
+	if (m_warm_enabled)
+		save_warm_list();
 }
 
 
@@ -291,6 +297,77 @@ void drcuml_state::log_vprintf(util::format_argument_pack<std::ostream> const &a
 }
 
 
+//-------------------------------------------------
+//  record_hashes - note the (mode,pc) pairs of
+//  any HASH opcodes in a block being generated
+//-------------------------------------------------
+
+void drcuml_state::record_hashes(uml::instruction const *instructions, u32 count)
+{
+	for (u32 instnum = 0; instnum < count; instnum++)
+	{
+		uml::instruction const &inst = instructions[instnum];
+		if (inst.opcode() == uml::OP_HASH)
+		{
+			u32 const mode = u32(inst.param(0).immediate());
+			u32 const pc = u32(inst.param(1).immediate());
+			if (m_warm_seen.insert((u64(mode) << 32) | pc).second)
+				m_warm_list.emplace_back(mode, pc);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  warm_list_filename - name of the file holding
+//  translated PCs from previous sessions
+//-------------------------------------------------
+
+std::string drcuml_state::warm_list_filename() const
+{
+	return util::string_format("drcwarm_%s_%s.txt", m_device.machine().system().name, m_device.shortname());
+}
+
+
+//-------------------------------------------------
+//  load_warm_list - read back the list of PCs
+//  translated in previous sessions
+//-------------------------------------------------
+
+void drcuml_state::load_warm_list()
+{
+	std::ifstream file(warm_list_filename());
+	if (!file)
+		return;
+
+	u32 mode, pc;
+	while (file >> std::hex >> mode >> pc)
+	{
+		if (m_warm_seen.insert((u64(mode) << 32) | pc).second)
+			m_warm_list.emplace_back(mode, pc);
+	}
+}
+
+
+//-------------------------------------------------
+//  save_warm_list - write out the list of PCs
+//  translated this session
+//-------------------------------------------------
+
+void drcuml_state::save_warm_list() const
+{
+	if (m_warm_list.empty())
+		return;
+
+	std::ofstream file(warm_list_filename());
+	if (!file)
+		return;
+
+	for (auto const &entry : m_warm_list)
+		util::stream_format(file, "%x %x\n", entry.first, entry.second);
+}
+
+
 
 //**************************************************************************
 //  DRCUML BLOCK
@@ -396,6 +473,11 @@ void drcuml_block::optimize()
 {
 	u32 mapvar[uml::MAPVAR_COUNT] = { 0 };
 
+	// propagate register copies first so the flag and simplification pass
+	// below sees the final operands
+	if (m_drcuml.optimize_enabled())
+		propagate_copies();
+
 	// iterate over instructions
 	for (int instnum = 0; instnum < m_nextinst; instnum++)
 	{
@@ -434,6 +516,103 @@ void drcuml_block::optimize()
 }
 
 
+//-------------------------------------------------
+//  propagate_copies - forward unconditional
+//  register-to-register copies to later readers
+//  within straight-line stretches of the block,
+//  turning many intermediate moves into dead
+//  moves that simplify() then removes
+//-------------------------------------------------
+
+void drcuml_block::propagate_copies()
+{
+	using namespace uml;
+
+	// known copy source per register; size 0 means no valid entry
+	struct copy_source { parameter src; u8 size = 0; };
+	copy_source iregs[REG_I_COUNT];
+	copy_source fregs[REG_F_COUNT];
+
+	// drop everything we know
+	auto const reset_all = [&] ()
+	{
+		for (copy_source &entry : iregs)
+			entry.size = 0;
+		for (copy_source &entry : fregs)
+			entry.size = 0;
+	};
+
+	// a write to a register invalidates its entry and any entry sourced from it
+	auto const invalidate = [&] (parameter const &dst)
+	{
+		if (dst.is_int_register())
+		{
+			iregs[dst.ireg() - REG_I0].size = 0;
+			for (copy_source &entry : iregs)
+				if (entry.size != 0 && entry.src == dst)
+					entry.size = 0;
+		}
+		else if (dst.is_float_register())
+		{
+			fregs[dst.freg() - REG_F0].size = 0;
+			for (copy_source &entry : fregs)
+				if (entry.size != 0 && entry.src == dst)
+					entry.size = 0;
+		}
+	};
+
+	// iterate over instructions
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		instruction &inst(m_inst[instnum]);
+		opcode_t const op = inst.opcode();
+
+		// join points and anything that can execute other code (handles,
+		// C callbacks, the debugger, state restores) invalidate everything
+		if (op == OP_HANDLE || op == OP_HASH || op == OP_LABEL || op == OP_DEBUG || op == OP_EXIT
+			|| op == OP_HASHJMP || op == OP_EXH || op == OP_CALLH || op == OP_RET || op == OP_CALLC
+			|| op == OP_RESTORE)
+		{
+			reset_all();
+			continue;
+		}
+		if (op == OP_NOP || op == OP_COMMENT || op == OP_MAPVAR || op == OP_JMP)
+			continue;
+
+		// rewrite pure inputs that read a register with a known copy source;
+		// a 4-byte copy leaves the upper half of the register undefined, so
+		// it is only propagated into 4-byte instructions
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+		{
+			if (!inst.param_is_input(pnum) || inst.param_is_output(pnum))
+				continue;
+			parameter const &p = inst.param(pnum);
+			copy_source const *entry = nullptr;
+			if (p.is_int_register())
+				entry = &iregs[p.ireg() - REG_I0];
+			else if (p.is_float_register())
+				entry = &fregs[p.freg() - REG_F0];
+			if (entry != nullptr && entry->size != 0 && (entry->size == 8 || inst.size() == 4))
+				inst.set_param(pnum, entry->src);
+		}
+
+		// process writes, whether conditional or not
+		for (int pnum = 0; pnum < inst.numparams(); pnum++)
+			if (inst.param_is_output(pnum))
+				invalidate(inst.param(pnum));
+
+		// unconditional register-to-register moves establish new copies
+		if (inst.condition() == COND_ALWAYS)
+		{
+			if (op == OP_MOV && inst.param(0).is_int_register() && inst.param(1).is_int_register() && inst.param(0) != inst.param(1))
+				iregs[inst.param(0).ireg() - REG_I0] = { inst.param(1), inst.size() };
+			else if (op == OP_FMOV && inst.param(0).is_float_register() && inst.param(1).is_float_register() && inst.param(0) != inst.param(1))
+				fregs[inst.param(0).freg() - REG_F0] = { inst.param(1), inst.size() };
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  disassemble - disassemble a block of
 //  instructions to the log
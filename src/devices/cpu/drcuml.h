@@ -18,6 +18,8 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 
@@ -113,6 +115,7 @@ public:
 private:
 	// internal helpers
 	void optimize();
+	void propagate_copies();
 	void disassemble();
 	char const *get_comment_text(uml::instruction const &inst, std::string &comment);
 
@@ -176,7 +179,17 @@ public:
 	// back-end interface
 	void get_backend_info(drcbe_info &info) { m_beintf->get_info(info); }
 	bool hash_exists(u32 mode, u32 pc) { return m_beintf->hash_exists(mode, pc); }
-	void generate(drcuml_block &block, uml::instruction *instructions, u32 count) { m_beintf->generate(block, instructions, count); }
+	void generate(drcuml_block &block, uml::instruction *instructions, u32 count)
+	{
+		if (m_warm_enabled)
+			record_hashes(instructions, count);
+		m_beintf->generate(block, instructions, count);
+	}
+
+	// warm list: (mode, pc) pairs translated in previous sessions, for
+	// cores that want to precompile at startup instead of faulting in
+	// blocks one at a time
+	std::vector<std::pair<u32, u32>> const &warm_list() const { return m_warm_list; }
 
 	// handle management
 	uml::code_handle *handle_alloc(char const *name);
@@ -185,6 +198,9 @@ public:
 	void symbol_add(void *base, u32 length, char const *name);
 	char const *symbol_find(void *base, u32 *offset = nullptr);
 
+	// optimization
+	bool optimize_enabled() const { return m_optimize_enabled; }
+
 	// logging
 	bool logging() const { return bool(m_umllog); }
 	template <typename Format, typename... Params>
@@ -220,6 +236,12 @@ private:
 		std::string m_name;     // name of the symbol
 	};
 
+	// warm list helpers
+	void record_hashes(uml::instruction const *instructions, u32 count);
+	void load_warm_list();
+	void save_warm_list() const;
+	std::string warm_list_filename() const;
+
 	// internal state
 	device_t &                              m_device;           // CPU device we are associated with
 	drc_cache &                             m_cache;            // pointer to the codegen cache
@@ -228,6 +250,10 @@ private:
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
+	bool                                    m_optimize_enabled; // apply the UML optimization passes?
+	bool                                    m_warm_enabled;     // persist translated PCs across sessions?
+	std::vector<std::pair<u32, u32>>        m_warm_list;        // (mode, pc) pairs seen translated
+	std::unordered_set<u64>                 m_warm_seen;        // dedup set for the warm list
 };
 
 
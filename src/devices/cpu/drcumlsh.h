@@ -152,6 +152,8 @@
 #define UML_FSCMP(block, src1, src2)                        do { using namespace uml; block.append().fscmp(src1, src2); } while (0)
 #define UML_FSMUL(block, dst, src1, src2)                   do { using namespace uml; block.append().fsmul(dst, src1, src2); } while (0)
 #define UML_FSDIV(block, dst, src1, src2)                   do { using namespace uml; block.append().fsdiv(dst, src1, src2); } while (0)
+#define UML_FSMADD(block, dst, src1, src2, src3)            do { using namespace uml; block.append().fsmadd(dst, src1, src2, src3); } while (0)
+#define UML_FSMSUB(block, dst, src1, src2, src3)            do { using namespace uml; block.append().fsmsub(dst, src1, src2, src3); } while (0)
 #define UML_FSNEG(block, dst, src1)                         do { using namespace uml; block.append().fsneg(dst, src1); } while (0)
 #define UML_FSABS(block, dst, src1)                         do { using namespace uml; block.append().fsabs(dst, src1); } while (0)
 #define UML_FSSQRT(block, dst, src1)                        do { using namespace uml; block.append().fssqrt(dst, src1); } while (0)
@@ -177,6 +179,8 @@
 #define UML_FDCMP(block, src1, src2)                        do { using namespace uml; block.append().fdcmp(src1, src2); } while (0)
 #define UML_FDMUL(block, dst, src1, src2)                   do { using namespace uml; block.append().fdmul(dst, src1, src2); } while (0)
 #define UML_FDDIV(block, dst, src1, src2)                   do { using namespace uml; block.append().fddiv(dst, src1, src2); } while (0)
+#define UML_FDMADD(block, dst, src1, src2, src3)            do { using namespace uml; block.append().fdmadd(dst, src1, src2, src3); } while (0)
+#define UML_FDMSUB(block, dst, src1, src2, src3)            do { using namespace uml; block.append().fdmsub(dst, src1, src2, src3); } while (0)
 #define UML_FDNEG(block, dst, src1)                         do { using namespace uml; block.append().fdneg(dst, src1); } while (0)
 #define UML_FDABS(block, dst, src1)                         do { using namespace uml; block.append().fdabs(dst, src1); } while (0)
 #define UML_FDSQRT(block, dst, src1)                        do { using namespace uml; block.append().fdsqrt(dst, src1); } while (0)
@@ -249,6 +249,7 @@ protected:
 	u32 m_nmi_pending;
 
 	const u16 *m_state_table;
+	std::unique_ptr<opcode_handler_ptr []> m_resolved_handlers; /* per-opcode handlers with the state table lookup folded in */
 	const u8* m_cyc_instruction;
 	const u8* m_cyc_exception;
 
@@ -839,6 +839,17 @@ void m68000_base_device::execute_run()
 {
 	m_initial_cycles = m_icount;
 
+	/* Resolve the per-opcode handlers on first run.  The state table for
+	   the selected CPU type never changes afterwards, so folding the
+	   state lookup into a single table removes a dependent load from the
+	   dispatch loop. */
+	if (!m_resolved_handlers)
+	{
+		m_resolved_handlers = std::make_unique<opcode_handler_ptr []>(0x10000);
+		for (u32 opcode = 0; opcode < 0x10000; opcode++)
+			m_resolved_handlers[opcode] = m68k_handler_table[m_state_table[opcode]];
+	}
+
 	if (m_reset_cycles) {
 		/* Read the initial stack pointer and program counter */
 		REG_SP() = m68ki_read_imm_32();
@@ -906,8 +917,7 @@ void m68000_base_device::execute_run()
 				m_run_mode = RUN_MODE_NORMAL;
 				/* Read an instruction and call its handler */
 				m_ir = m68ki_read_imm_16();
-				u16 state = m_state_table[m_ir];
-				(this->*m68k_handler_table[state])();
+				(this->*m_resolved_handlers[m_ir])();
 				m_icount -= m_cyc_instruction[m_ir];
 			}
 			else
@@ -929,8 +939,7 @@ void m68000_base_device::execute_run()
 
 				if (!m_mmu_tmp_buserror_occurred)
 				{
-					u16 state = m_state_table[m_ir];
-					(this->*m68k_handler_table[state])();
+					(this->*m_resolved_handlers[m_ir])();
 					m_icount -= m_cyc_instruction[m_ir];
 				}
 
@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "debug/debugcpu.h"
 #include "mips3.h"
 #include "mips3com.h"
 #include "mips3dsm.h"
@@ -173,6 +174,7 @@ mips3_device::mips3_device(const machine_config &mconfig, device_type type, cons
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
 	, m_drc_cache_dirty(0)
+	, m_drc_wpgen(0)
 	, m_entry(nullptr)
 	, m_nocode(nullptr)
 	, m_out_of_cycles(nullptr)
@@ -5053,6 +5055,14 @@ void mips3_device::execute_run()
 	{
 		int execute_result;
 
+		/* a changed watchpoint set invalidates the fastram shortcuts
+		   compiled into existing blocks */
+		if ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0 && debug()->watchpoint_generation() != m_drc_wpgen)
+		{
+			m_drc_wpgen = debug()->watchpoint_generation();
+			m_drc_cache_dirty = true;
+		}
+
 		/* reset the cache if dirty */
 		if (m_drc_cache_dirty)
 			code_flush_cache();
@@ -479,6 +479,7 @@ protected:
 
 												/* internal stuff */
 	uint8_t         m_drc_cache_dirty;          /* true if we need to flush the cache */
+	uint32_t        m_drc_wpgen;                /* watchpoint generation the cache was compiled against */
 
 												/* tables */
 	uint8_t         m_fpmode[4];                /* FPU mode table */
@@ -593,6 +594,7 @@ private:
 	void sdr_le(uint32_t op);
 	void load_fast_iregs(drcuml_block &block);
 	void save_fast_iregs(drcuml_block &block);
+	bool fastram_watched(int ramnum, int iswrite) const;
 	void code_flush_cache();
 	void code_compile_block(uint8_t mode, offs_t pc);
 public:
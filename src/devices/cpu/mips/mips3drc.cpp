@@ -25,6 +25,7 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "debug/debugcpu.h"
 #include "mips3com.h"
 #include "mips3fe.h"
 #include "mips3dsm.h"
@@ -189,6 +190,21 @@ void mips3_device::add_fastram(offs_t start, offs_t end, uint8_t readonly, void
 	}
 }
 
+/*-------------------------------------------------
+    fastram_watched - return true if an enabled
+    watchpoint overlaps the given fastram region,
+    forcing accesses through the memory system so
+    the watchpoint stays visible
+-------------------------------------------------*/
+
+bool mips3_device::fastram_watched(int ramnum, int iswrite) const
+{
+	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
+		return false;
+	return debug()->watchpoint_overlaps(AS_PROGRAM, iswrite ? read_or_write::WRITE : read_or_write::READ,
+			m_fastram[ramnum].start, m_fastram[ramnum].end);
+}
+
 
 /*-------------------------------------------------
     mips3drc_add_hotspot - add a new hotspot
@@ -854,101 +870,115 @@ void mips3_device::static_generate_memory_accessor(int mode, int size, int iswri
 		UML_LABEL(block, addrok);                                               // addrok:
 	}
 
+	/* kernel mode: kseg0/kseg1 are fixed direct-mapped segments, so skip the TLB lookup */
+	int donetranslate = 0;
+	if (mode == MODE_KERNEL)
+	{
+		int translate;
+		UML_XOR(block, I3, I0, 0x80000000);                                 // xor     i3,i0,0x80000000
+		UML_TEST(block, I3, 0xc0000000);                                    // test    i3,0xc0000000
+		UML_JMPc(block, COND_NZ, translate = label++);                              // jmp     translate,nz
+		UML_AND(block, I0, I0, 0x1fffffff);                                 // and     i0,i0,0x1fffffff
+		UML_JMP(block, donetranslate = label++);                                    // jmp     donetranslate
+		UML_LABEL(block, translate);                                            // translate:
+	}
+
 	/* general case: assume paging and perform a translation */
 	UML_SHR(block, I3, I0, 12);                                     // shr     i3,i0,12
 	UML_LOAD(block, I3, (void *)vtlb_table(), I3, SIZE_DWORD, SCALE_x4);// load    i3,[vtlb_table],i3,dword
 	UML_TEST(block, I3, iswrite ? VTLB_WRITE_ALLOWED : VTLB_READ_ALLOWED);// test    i3,iswrite ? VTLB_WRITE_ALLOWED : VTLB_READ_ALLOWED
 	UML_JMPc(block, COND_Z, tlbmiss = label++);                                     // jmp     tlbmiss,z
 	UML_ROLINS(block, I0, I3, 0, 0xfffff000);                   // rolins  i0,i3,0,0xfffff000
+	if (donetranslate != 0)
+		UML_LABEL(block, donetranslate);                                        // donetranslate:
 
-	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) == 0)
-		for (ramnum = 0; ramnum < m_fastram_select; ramnum++)
-			if (!(iswrite && m_fastram[ramnum].readonly))
+	for (ramnum = 0; ramnum < m_fastram_select; ramnum++)
+		if (!(iswrite && m_fastram[ramnum].readonly) && !fastram_watched(ramnum, iswrite))
+		{
+			void *fastbase = (uint8_t *)m_fastram[ramnum].base - m_fastram[ramnum].start;
+			uint32_t skip = label++;
+			if (m_fastram[ramnum].end != 0xffffffff)
 			{
-				void *fastbase = (uint8_t *)m_fastram[ramnum].base - m_fastram[ramnum].start;
-				uint32_t skip = label++;
-				if (m_fastram[ramnum].end != 0xffffffff)
+				UML_CMP(block, I0, m_fastram[ramnum].end);   // cmp     i0,end
+				UML_JMPc(block, COND_A, skip);                                      // ja      skip
+			}
+			if (m_fastram[ramnum].start != 0x00000000)
+			{
+				UML_CMP(block, I0, m_fastram[ramnum].start);// cmp     i0,fastram_start
+				UML_JMPc(block, COND_B, skip);                                      // jb      skip
+			}
+			if (!iswrite)
+			{
+				if (size == 1)
 				{
-					UML_CMP(block, I0, m_fastram[ramnum].end);   // cmp     i0,end
-					UML_JMPc(block, COND_A, skip);                                      // ja      skip
+					UML_XOR(block, I0, I0, m_bigendian ? BYTE4_XOR_BE(0) : BYTE4_XOR_LE(0));
+																					// xor     i0,i0,bytexor
+					UML_LOAD(block, I0, fastbase, I0, SIZE_BYTE, SCALE_x1);             // load    i0,fastbase,i0,byte
 				}
-				if (m_fastram[ramnum].start != 0x00000000)
+				else if (size == 2)
 				{
-					UML_CMP(block, I0, m_fastram[ramnum].start);// cmp     i0,fastram_start
-					UML_JMPc(block, COND_B, skip);                                      // jb      skip
+					UML_XOR(block, I0, I0, m_bigendian ? WORD_XOR_BE(0) : WORD_XOR_LE(0));
+																					// xor     i0,i0,wordxor
+					UML_LOAD(block, I0, fastbase, I0, SIZE_WORD, SCALE_x1);         // load    i0,fastbase,i0,word_x1
 				}
-				if (!iswrite)
+				else if (size == 4)
 				{
-					if (size == 1)
-					{
-						UML_XOR(block, I0, I0, m_bigendian ? BYTE4_XOR_BE(0) : BYTE4_XOR_LE(0));
-																						// xor     i0,i0,bytexor
-						UML_LOAD(block, I0, fastbase, I0, SIZE_BYTE, SCALE_x1);             // load    i0,fastbase,i0,byte
-					}
-					else if (size == 2)
-					{
-						UML_XOR(block, I0, I0, m_bigendian ? WORD_XOR_BE(0) : WORD_XOR_LE(0));
-																						// xor     i0,i0,wordxor
-						UML_LOAD(block, I0, fastbase, I0, SIZE_WORD, SCALE_x1);         // load    i0,fastbase,i0,word_x1
-					}
-					else if (size == 4)
-					{
-						UML_LOAD(block, I0, fastbase, I0, SIZE_DWORD, SCALE_x1);            // load    i0,fastbase,i0,dword_x1
-					}
-					else if (size == 8)
-					{
-						UML_DLOAD(block, I0, fastbase, I0, SIZE_QWORD, SCALE_x1);           // dload   i0,fastbase,i0,qword_x1
-						UML_DROR(block, I0, I0, 32 * (m_bigendian ? BYTE_XOR_BE(0) : BYTE_XOR_LE(0)));
-																						// dror    i0,i0,32*bytexor
-					}
-					UML_RET(block);                                                     // ret
+					UML_LOAD(block, I0, fastbase, I0, SIZE_DWORD, SCALE_x1);            // load    i0,fastbase,i0,dword_x1
 				}
-				else
+				else if (size == 8)
 				{
-					if (size == 1)
-					{
-						UML_XOR(block, I0, I0, m_bigendian ? BYTE4_XOR_BE(0) : BYTE4_XOR_LE(0));
-																						// xor     i0,i0,bytexor
-						UML_STORE(block, fastbase, I0, I1, SIZE_BYTE, SCALE_x1);// store   fastbase,i0,i1,byte
-					}
-					else if (size == 2)
-					{
-						UML_XOR(block, I0, I0, m_bigendian ? WORD_XOR_BE(0) : WORD_XOR_LE(0));
-																						// xor     i0,i0,wordxor
-						UML_STORE(block, fastbase, I0, I1, SIZE_WORD, SCALE_x1);// store   fastbase,i0,i1,word_x1
-					}
-					else if (size == 4)
-					{
-						if (ismasked)
-						{
-							UML_LOAD(block, I3, fastbase, I0, SIZE_DWORD, SCALE_x1);        // load    i3,fastbase,i0,dword_x1
-							UML_ROLINS(block, I3, I1, 0, I2);       // rolins  i3,i1,0,i2
-							UML_STORE(block, fastbase, I0, I3, SIZE_DWORD, SCALE_x1);       // store   fastbase,i0,i3,dword_x1
-						}
-						else
-							UML_STORE(block, fastbase, I0, I1, SIZE_DWORD, SCALE_x1);       // store   fastbase,i0,i1,dword_x1
-					}
-					else if (size == 8)
+					UML_DLOAD(block, I0, fastbase, I0, SIZE_QWORD, SCALE_x1);           // dload   i0,fastbase,i0,qword_x1
+					UML_DROR(block, I0, I0, 32 * (m_bigendian ? BYTE_XOR_BE(0) : BYTE_XOR_LE(0)));
+																					// dror    i0,i0,32*bytexor
+				}
+				UML_RET(block);                                                     // ret
+			}
+			else
+			{
+				if (size == 1)
+				{
+					UML_XOR(block, I0, I0, m_bigendian ? BYTE4_XOR_BE(0) : BYTE4_XOR_LE(0));
+																					// xor     i0,i0,bytexor
+					UML_STORE(block, fastbase, I0, I1, SIZE_BYTE, SCALE_x1);// store   fastbase,i0,i1,byte
+				}
+				else if (size == 2)
+				{
+					UML_XOR(block, I0, I0, m_bigendian ? WORD_XOR_BE(0) : WORD_XOR_LE(0));
+																					// xor     i0,i0,wordxor
+					UML_STORE(block, fastbase, I0, I1, SIZE_WORD, SCALE_x1);// store   fastbase,i0,i1,word_x1
+				}
+				else if (size == 4)
+				{
+					if (ismasked)
 					{
-						UML_DROR(block, I1, I1, 32 * (m_bigendian ? BYTE_XOR_BE(0) : BYTE_XOR_LE(0)));
-																						// dror    i1,i1,32*bytexor
-						if (ismasked)
-						{
-							UML_DROR(block, I2, I2, 32 * (m_bigendian ? BYTE_XOR_BE(0) : BYTE_XOR_LE(0)));
-																						// dror    i2,i2,32*bytexor
-							UML_DLOAD(block, I3, fastbase, I0, SIZE_QWORD, SCALE_x1);       // dload   i3,fastbase,i0,qword_x1
-							UML_DROLINS(block, I3, I1, 0, I2);      // drolins i3,i1,0,i2
-							UML_DSTORE(block, fastbase, I0, I3, SIZE_QWORD, SCALE_x1);  // dstore  fastbase,i0,i3,qword_x1
-						}
-						else
-							UML_DSTORE(block, fastbase, I0, I1, SIZE_QWORD, SCALE_x1);  // dstore  fastbase,i0,i1,qword_x1
+						UML_LOAD(block, I3, fastbase, I0, SIZE_DWORD, SCALE_x1);        // load    i3,fastbase,i0,dword_x1
+						UML_ROLINS(block, I3, I1, 0, I2);       // rolins  i3,i1,0,i2
+						UML_STORE(block, fastbase, I0, I3, SIZE_DWORD, SCALE_x1);       // store   fastbase,i0,i3,dword_x1
 					}
-					UML_RET(block);                                                     // ret
+					else
+						UML_STORE(block, fastbase, I0, I1, SIZE_DWORD, SCALE_x1);       // store   fastbase,i0,i1,dword_x1
 				}
-
-				UML_LABEL(block, skip);                                             // skip:
+				else if (size == 8)
+				{
+					UML_DROR(block, I1, I1, 32 * (m_bigendian ? BYTE_XOR_BE(0) : BYTE_XOR_LE(0)));
+																					// dror    i1,i1,32*bytexor
+					if (ismasked)
+					{
+						UML_DROR(block, I2, I2, 32 * (m_bigendian ? BYTE_XOR_BE(0) : BYTE_XOR_LE(0)));
+																					// dror    i2,i2,32*bytexor
+						UML_DLOAD(block, I3, fastbase, I0, SIZE_QWORD, SCALE_x1);       // dload   i3,fastbase,i0,qword_x1
+						UML_DROLINS(block, I3, I1, 0, I2);      // drolins i3,i1,0,i2
+						UML_DSTORE(block, fastbase, I0, I3, SIZE_QWORD, SCALE_x1);  // dstore  fastbase,i0,i3,qword_x1
+					}
+					else
+						UML_DSTORE(block, fastbase, I0, I1, SIZE_QWORD, SCALE_x1);  // dstore  fastbase,i0,i1,qword_x1
+				}
+				UML_RET(block);                                                     // ret
 			}
 
+			UML_LABEL(block, skip);                                             // skip:
+		}
+
 	switch (size)
 	{
 		case 1:
@@ -2412,6 +2412,11 @@ void sh_common_execution::code_compile_block(uint8_t mode, offs_t pc)
 					generate_sequence_instruction(block, compiler, curdesc, 0xffffffff);
 				}
 
+				/* if this sequence is a tight memory polling loop, overcharge each iteration */
+				/* so the loop exhausts its timeslice quickly instead of spinning at full cost */
+				if (m_drcoptions & SH2DRC_IDLE_LOOPS)
+					compiler.cycles += idle_loop_cycle_boost(seqhead, seqlast);
+
 				/* if we need to return to the start, do it */
 				if (seqlast->flags & OPFLAG_RETURN_TO_START)
 				{
@@ -4296,3 +4301,42 @@ void sh_common_execution::sh2drc_add_pcflush(offs_t address)
 	if (m_pcfsel < std::size(m_pcflushes))
 		m_pcflushes[m_pcfsel++] = address;
 }
+
+
+/*-------------------------------------------------
+    idle_loop_cycle_boost - return the extra
+    cycles to charge per iteration if a sequence
+    is a tight loop polling a memory location
+-------------------------------------------------*/
+
+uint32_t sh_common_execution::idle_loop_cycle_boost(const opcode_desc *seqhead, const opcode_desc *seqlast) const
+{
+	/* must close with a conditional branch back to the head of the sequence */
+	if (!(seqlast->flags & OPFLAG_IS_CONDITIONAL_BRANCH) || seqlast->targetpc != seqhead->pc)
+		return 0;
+
+	/* scan the body, including any delay slot; only a handful of instructions */
+	/* that read memory but have no other side effects qualify as a poll loop */
+	const uint32_t reject = OPFLAG_WRITES_MEMORY | OPFLAG_PRIVILEGED | OPFLAG_CAN_CHANGE_MODES | OPFLAG_CAN_TRIGGER_SW_INT | OPFLAG_MODIFIES_TRANSLATION;
+	bool reads = false;
+	int length = 0;
+	for (const opcode_desc *curdesc = seqhead; curdesc != nullptr; curdesc = curdesc->next())
+	{
+		uint32_t flags = curdesc->flags;
+		for (const opcode_desc *delaydesc = curdesc->delay.first(); delaydesc != nullptr; delaydesc = delaydesc->next())
+		{
+			flags |= delaydesc->flags;
+			length++;
+		}
+		if (flags & reject)
+			return 0;
+		if (flags & OPFLAG_READS_MEMORY)
+			reads = true;
+		length++;
+		if (curdesc == seqlast)
+			break;
+	}
+	if (!reads || length > 4)
+		return 0;
+	return SH2DRC_IDLE_LOOP_CYCLES;
+}
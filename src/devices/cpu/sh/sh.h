@@ -34,12 +34,16 @@
 #define SH2DRC_STRICT_VERIFY    0x0001          /* verify all instructions */
 #define SH2DRC_FLUSH_PC         0x0002          /* flush the PC value before each memory access */
 #define SH2DRC_STRICT_PCREL     0x0004          /* do actual loads on MOVLI/MOVWI instead of collapsing to immediates */
+#define SH2DRC_IDLE_LOOPS       0x0008          /* overcharge detected memory polling loops so they yield the timeslice */
 
 #define SH2DRC_COMPATIBLE_OPTIONS   (SH2DRC_STRICT_VERIFY | SH2DRC_FLUSH_PC | SH2DRC_STRICT_PCREL)
 #define SH2DRC_FASTEST_OPTIONS  (0)
 
 #define SH2_MAX_FASTRAM       4
 
+/* extra cycles charged per iteration of a detected polling loop */
+#define SH2DRC_IDLE_LOOP_CYCLES     64
+
 /* map variables */
 #define MAPVAR_PC                   M0
 #define MAPVAR_CYCLES               M1
@@ -468,6 +472,7 @@ public:
 	void log_opcode_desc(const opcode_desc *desclist, int indent);
 	void log_add_disasm_comment(drcuml_block &block, uint32_t pc, uint32_t op);
 	void generate_delay_slot(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t ovrpc);
+	uint32_t idle_loop_cycle_boost(const opcode_desc *seqhead, const opcode_desc *seqlast) const;
 	void generate_checksum_block(drcuml_block &block, compiler_state &compiler, const opcode_desc *seqhead, const opcode_desc *seqlast);
 	void generate_sequence_instruction(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc, uint32_t ovrpc);
 	void static_generate_nocode_handler();
@@ -213,6 +213,8 @@ namespace uml
 		OP_FCMP,                    // FCMP    src1,src2
 		OP_FMUL,                    // FMUL    dst,src1,src2
 		OP_FDIV,                    // FDIV    dst,src1,src2
+		OP_FMADD,                   // FMADD   dst,src1,src2,src3
+		OP_FMSUB,                   // FMSUB   dst,src1,src2,src3
 		OP_FNEG,                    // FNEG    dst,src1
 		OP_FABS,                    // FABS    dst,src1
 		OP_FSQRT,                   // FSQRT   dst,src1
@@ -405,6 +407,11 @@ namespace uml
 		// setters
 		void set_flags(u8 flags) { m_flags = flags; }
 		void set_mapvar(int paramnum, u32 value) { assert(paramnum < m_numparams); assert(m_param[paramnum].is_mapvar()); m_param[paramnum] = value; }
+		void set_param(int paramnum, parameter const &param) { assert(paramnum < m_numparams); m_param[paramnum] = param; }
+
+		// parameter direction queries
+		bool param_is_input(int paramnum) const;
+		bool param_is_output(int paramnum) const;
 
 		// misc
 		std::string disasm(drcuml_state *drcuml = nullptr) const;
@@ -539,6 +546,8 @@ namespace uml
 		void fscmp(parameter src1, parameter src2) { configure(OP_FCMP, 4, src1, src2); }
 		void fsmul(parameter dst, parameter src1, parameter src2) { configure(OP_FMUL, 4, dst, src1, src2); }
 		void fsdiv(parameter dst, parameter src1, parameter src2) { configure(OP_FDIV, 4, dst, src1, src2); }
+		void fsmadd(parameter dst, parameter src1, parameter src2, parameter src3) { configure(OP_FMADD, 4, dst, src1, src2, src3); }
+		void fsmsub(parameter dst, parameter src1, parameter src2, parameter src3) { configure(OP_FMSUB, 4, dst, src1, src2, src3); }
 		void fsneg(parameter dst, parameter src1) { configure(OP_FNEG, 4, dst, src1); }
 		void fsabs(parameter dst, parameter src1) { configure(OP_FABS, 4, dst, src1); }
 		void fssqrt(parameter dst, parameter src1) { configure(OP_FSQRT, 4, dst, src1); }
@@ -563,6 +572,8 @@ namespace uml
 		void fdcmp(parameter src1, parameter src2) { configure(OP_FCMP, 8, src1, src2); }
 		void fdmul(parameter dst, parameter src1, parameter src2) { configure(OP_FMUL, 8, dst, src1, src2); }
 		void fddiv(parameter dst, parameter src1, parameter src2) { configure(OP_FDIV, 8, dst, src1, src2); }
+		void fdmadd(parameter dst, parameter src1, parameter src2, parameter src3) { configure(OP_FMADD, 8, dst, src1, src2, src3); }
+		void fdmsub(parameter dst, parameter src1, parameter src2, parameter src3) { configure(OP_FMSUB, 8, dst, src1, src2, src3); }
 		void fdneg(parameter dst, parameter src1) { configure(OP_FNEG, 8, dst, src1); }
 		void fdabs(parameter dst, parameter src1) { configure(OP_FABS, 8, dst, src1); }
 		void fdsqrt(parameter dst, parameter src1) { configure(OP_FSQRT, 8, dst, src1); }
@@ -1261,6 +1261,33 @@ inline void z80_device::ldir()
 		PC -= 2;
 		WZ = PC + 1;
 		CC(ex, 0xb0);
+
+		/* Run further iterations here instead of going back through the
+		   fetch/dispatch loop.  R, WZ, PC and the cycle count advance
+		   exactly as if each iteration were refetched; the loop falls
+		   back to normal fetching as soon as an interrupt or wait state
+		   could be observed, the debugger is active, or the copy
+		   overwrites the instruction itself. */
+		if (!(machine().debug_flags & DEBUG_FLAG_ENABLED))
+		{
+			while (BC != 0 && m_icount > 0 && !m_wait_state
+					&& !m_nmi_pending && !interrupt_pending()
+					&& DE != PC && DE != uint16_t(PC + 1))
+			{
+				PRVPC = PCD;
+				m_r += 2;
+				CC(op, 0xed);
+				CC(ed, 0xb0);
+				ldi();
+				if (BC != 0)
+				{
+					WZ = PC + 1;
+					CC(ex, 0xb0);
+				}
+				else
+					PC += 2;
+			}
+		}
 	}
 }
 
@@ -1315,6 +1342,28 @@ inline void z80_device::lddr()
 		PC -= 2;
 		WZ = PC + 1;
 		CC(ex, 0xb8);
+
+		/* batched iterations, as in ldir() above */
+		if (!(machine().debug_flags & DEBUG_FLAG_ENABLED))
+		{
+			while (BC != 0 && m_icount > 0 && !m_wait_state
+					&& !m_nmi_pending && !interrupt_pending()
+					&& DE != PC && DE != uint16_t(PC + 1))
+			{
+				PRVPC = PCD;
+				m_r += 2;
+				CC(op, 0xed);
+				CC(ed, 0xb8);
+				ldd();
+				if (BC != 0)
+				{
+					WZ = PC + 1;
+					CC(ex, 0xb8);
+				}
+				else
+					PC += 2;
+			}
+		}
 	}
 }
 
@@ -3535,6 +3584,15 @@ void z80_device::check_interrupts()
 		take_interrupt();
 }
 
+/****************************************************************************
+ * Would check_interrupts() take an interrupt right now?  Used to break out
+ * of batched block instruction iterations; NMIs are checked separately.
+ ****************************************************************************/
+bool z80_device::interrupt_pending() const
+{
+	return m_irq_state != CLEAR_LINE && m_iff1;
+}
+
 void z80_device::execute_set_input(int inputnum, int state)
 {
 	switch (inputnum)
@@ -3578,6 +3636,13 @@ void nsc800_device::check_interrupts()
 		take_interrupt();
 }
 
+bool nsc800_device::interrupt_pending() const
+{
+	if (z80_device::interrupt_pending())
+		return true;
+	return (m_nsc800_irq_state[NSC800_RSTA] != CLEAR_LINE || m_nsc800_irq_state[NSC800_RSTB] != CLEAR_LINE || m_nsc800_irq_state[NSC800_RSTC] != CLEAR_LINE) && m_iff1;
+}
+
 void nsc800_device::execute_set_input(int inputnum, int state)
 {
 	switch (inputnum)
@@ -230,6 +230,7 @@ protected:
 	void ei();
 
 	virtual void check_interrupts();
+	virtual bool interrupt_pending() const;
 	void take_interrupt();
 	void take_nmi();
 
@@ -303,6 +304,7 @@ protected:
 	virtual void execute_set_input(int inputnum, int state) override;
 
 	virtual void check_interrupts() override;
+	virtual bool interrupt_pending() const override;
 	void take_interrupt_nsc800();
 	uint8_t m_nsc800_irq_state[4]; /* state of NSC800 restart interrupts A, B, C */
 };
@@ -254,6 +254,8 @@ floppy_image_device::floppy_image_device(const machine_config &mconfig, device_t
 		input_format(nullptr),
 		output_format(nullptr),
 		image(),
+		m_load_pending(false),
+		m_load_result(false),
 		index_timer(nullptr),
 		tracks(0),
 		sides(0),
@@ -286,6 +288,8 @@ floppy_image_device::floppy_image_device(const machine_config &mconfig, device_t
 
 floppy_image_device::~floppy_image_device()
 {
+	if(m_load_pending)
+		m_load_task.join();
 	for(floppy_image_format_t *format : fif_list)
 		delete format;
 }
@@ -394,6 +398,8 @@ void floppy_image_device::setup_write(floppy_image_format_t *_output_format)
 
 void floppy_image_device::commit_image()
 {
+	load_sync();
+
 	if(FLUX_SCREEN && track_dirty) {
 		flux_image_compute_for_track(((cyl << 2) | subcyl) >> (2 - image->get_resolution()), ss);
 		track_dirty = false;
@@ -589,6 +595,45 @@ void floppy_image_device::init_floppy_load(bool write_supported)
 		dskchg = 1;
 }
 
+void floppy_image_device::load_sync()
+{
+	if(!m_load_pending)
+		return;
+
+	m_load_task.join();
+	m_load_pending = false;
+
+	if(!m_load_result) {
+		// Surface the failure through the image error machinery and
+		// eject the image once the current access completes, rather
+		// than presenting partial garbage to the emulated machine.
+		osd_printf_error("%s: Incompatible image format or corrupted data\n", tag());
+		seterror(image_error::UNSUPPORTED, "Incompatible image format or corrupted data");
+		// Whatever was decoded before the failure must never be
+		// written back over the original file.
+		output_format = nullptr;
+		image_dirty = false;
+		machine().scheduler().synchronize(timer_expired_delegate(FUNC(floppy_image_device::load_error_eject), this));
+	}
+}
+
+
+//-------------------------------------------------
+//  load_error_eject - deferred ejection of an
+//  image whose background decode failed; runs
+//  outside the access that joined the decode so
+//  callers never see the image disappear under
+//  them
+//-------------------------------------------------
+
+TIMER_CALLBACK_MEMBER(floppy_image_device::load_error_eject)
+{
+	if(image) {
+		unload();
+		popmessage("%s: Incompatible image format or corrupted data", tag());
+	}
+}
+
 image_init_result floppy_image_device::call_load()
 {
 	check_for_file();
@@ -614,13 +659,30 @@ image_init_result floppy_image_device::call_load()
 	}
 
 	image = std::make_unique<floppy_image>(tracks, sides, form_factor);
-	if (!best_format->load(*io, form_factor, variants, image.get())) {
-		seterror(image_error::UNSUPPORTED, "Incompatible image format or corrupted data");
-		image.reset();
-		return image_init_result::FAIL;
-	}
 	output_format = is_readonly() ? nullptr : best_format;
 
+	if (!has_running_machine() || machine().phase() == machine_phase::INIT) {
+		// Mounts requested at startup (command line or software list)
+		// stay synchronous so a bad image still fails the launch loudly.
+		if (!best_format->load(*io, form_factor, variants, image.get())) {
+			seterror(image_error::UNSUPPORTED, "Incompatible image format or corrupted data");
+			image.reset();
+			output_format = nullptr;
+			return image_init_result::FAIL;
+		}
+	} else {
+		// Decode the image on a worker thread so that mounting returns
+		// quickly, which matters when swapping disks mid-session.  The
+		// decode is joined by load_sync() before the flux data is first
+		// needed, so the emulation itself sees no difference.
+		m_load_result = false;
+		m_load_pending = true;
+		m_load_task = std::thread(
+				[this, io = std::move(io), best_format] {
+					m_load_result = best_format->load(*io, form_factor, variants, image.get());
+				});
+	}
+
 	image_dirty = false;
 
 	init_floppy_load(output_format != nullptr);
@@ -638,6 +700,8 @@ void floppy_image_device::flux_image_prepare()
 	if(!FLUX_SCREEN)
 		return;
 
+	load_sync();
+
 	int tracks = 0, heads = 0, rez = 0;
 	image->get_maximal_geometry(tracks, heads);
 	rez = image->get_resolution();
@@ -679,6 +743,8 @@ void floppy_image_device::flux_image_prepare()
 
 void floppy_image_device::flux_image_compute_for_track(int track, int head)
 {
+	load_sync();
+
 	auto *pcti = m_flux_per_combined_track_infos.data() + track;
 	const std::vector<uint32_t> &buffer = image->get_buffer(pcti->m_track, head, pcti->m_subtrack);
 	int sz = buffer.size();
@@ -733,6 +799,7 @@ void floppy_image_device::flux_image_compute_for_track(int track, int head)
 uint32_t floppy_image_device::flux_screen_update(screen_device &device, bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
 	if(image.get()) {
+		load_sync();
 		int ctrack = ((cyl << 2) | subcyl) >> (2 - image->get_resolution());
 		if(mon)
 			ctrack = -1;
@@ -771,6 +838,7 @@ uint32_t floppy_image_device::flux_screen_update(screen_device &device, bitmap_r
 
 void floppy_image_device::call_unload()
 {
+	load_sync();
 	cache_clear();
 	dskchg = 0;
 
@@ -973,7 +1041,10 @@ bool floppy_image_device::twosid_r()
 {
 	int tracks = 0, heads = 0;
 
-	if (image) image->get_actual_geometry(tracks, heads);
+	if (image) {
+		load_sync();
+		image->get_actual_geometry(tracks, heads);
+	}
 
 	return heads == 1;
 }
@@ -1173,6 +1244,8 @@ void floppy_image_device::cache_clear()
 
 void floppy_image_device::cache_fill(const attotime &when)
 {
+	load_sync();
+
 	std::vector<uint32_t> &buf = image->get_buffer(cyl, ss, subcyl);
 	uint32_t cells = buf.size();
 	if(cells <= 1) {
@@ -1267,6 +1340,8 @@ void floppy_image_device::write_flux(const attotime &start, const attotime &end,
 	if(writing_disabled())
 		return;
 
+	load_sync();
+
 	image_dirty = true;
 	track_dirty = true;
 	cache_clear();
@@ -1433,6 +1508,7 @@ void floppy_image_device::write_zone(uint32_t *buf, int &cells, int &index, uint
 void floppy_image_device::set_write_splice(const attotime &when)
 {
 	if(image && !mon) {
+		load_sync();
 		image_dirty = true;
 		attotime base;
 		int splice_pos = find_position(base, when);
@@ -1447,6 +1523,7 @@ uint32_t floppy_image_device::get_form_factor() const
 
 uint32_t floppy_image_device::get_variant() const
 {
+	const_cast<floppy_image_device *>(this)->load_sync();
 	return image ? image->get_variant() : 0;
 }
 
@@ -3057,6 +3134,8 @@ bool mfd75w_device::is_2m() const
 	if(!image)
 		return false;
 
+	const_cast<mfd75w_device *>(this)->load_sync();
+
 	if(image->get_variant() == floppy_image::SSDD || image->get_variant() == floppy_image::DSDD)
 		return true;
 
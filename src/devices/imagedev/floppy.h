@@ -17,6 +17,8 @@
 #include "softlist_dev.h"
 #include "screen.h"
 
+#include <thread>
+
 class floppy_sound_device;
 
 /***************************************************************************
@@ -183,11 +185,20 @@ protected:
 
 	void init_floppy_load(bool write_supported);
 
+	// Image decoding happens on a worker thread started at mount time;
+	// everything that needs the flux data proper goes through load_sync()
+	// first, which waits for the decode to complete.
+	void load_sync();
+	TIMER_CALLBACK_MEMBER(load_error_eject);
+
 	std::function<void (format_registration &fr)> format_registration_cb;
 	floppy_image_format_t *input_format;
 	floppy_image_format_t *output_format;
 	std::vector<uint32_t> variants;
 	std::unique_ptr<floppy_image> image;
+	std::thread           m_load_task;
+	bool                  m_load_pending;
+	bool                  m_load_result;
 	char                  extension_list[256];
 	std::vector<floppy_image_format_t *> fif_list;
 	std::vector<fs_info>  m_create_fs, m_io_fs;
@@ -37,6 +37,8 @@ midiout_device::midiout_device(const machine_config &mconfig, const char *tag, d
 void midiout_device::device_start()
 {
 	m_midi.reset();
+	m_anchor_machine = attotime::never;
+	m_anchor_host = 0;
 }
 
 void midiout_device::device_reset()
@@ -54,6 +56,7 @@ void midiout_device::device_reset()
 image_init_result midiout_device::call_load()
 {
 	m_midi = machine().osd().create_midi_device();
+	m_anchor_machine = attotime::never;
 
 	if (!m_midi->open_output(filename()))
 	{
@@ -84,6 +87,22 @@ void midiout_device::rcv_complete()    // Rx completed receiving byte
 
 	if (m_midi)
 	{
-		m_midi->write(data);
+		// translate the emulated transmission time into a host-clock offset
+		// so dense streams keep their byte spacing instead of bunching up
+		// at frame boundaries
+		const attotime mtime = machine().time();
+		const osd_ticks_t htime = osd_ticks();
+		double ahead = 0.0;
+		if (m_anchor_machine != attotime::never)
+			ahead = (mtime - m_anchor_machine).as_double() - double(htime - m_anchor_host) / double(osd_ticks_per_second());
+		if (ahead < 0.0 || ahead > 0.25)
+		{
+			// freshly started, unthrottled or badly behind; re-anchor and
+			// send immediately
+			m_anchor_machine = mtime;
+			m_anchor_host = htime;
+			ahead = 0.0;
+		}
+		m_midi->write_at(data, int(ahead * 1000.0));
 	}
 }
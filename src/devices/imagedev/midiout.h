@@ -54,6 +54,8 @@ protected:
 
 private:
 	std::unique_ptr<osd_midi_device> m_midi;
+	attotime m_anchor_machine;          // machine time the host clock was anchored at
+	osd_ticks_t m_anchor_host;          // host tick count at the anchor point
 };
 
 // device type definition
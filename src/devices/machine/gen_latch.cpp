@@ -35,6 +35,7 @@ generic_latch_base_device::generic_latch_base_device(const machine_config &mconf
 	device_t(mconfig, type, tag, owner, clock),
 	m_separate_acknowledge(false),
 	m_latch_written(false),
+	m_coalesce_window(attotime::zero),
 	m_data_pending_cb(*this)
 {
 }
@@ -112,7 +113,8 @@ void generic_latch_base_device::acknowledge_w(u8 data)
 
 generic_latch_8_device::generic_latch_8_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock) :
 	generic_latch_base_device(mconfig, GENERIC_LATCH_8, tag, owner, clock),
-	m_latched_value(0)
+	m_latched_value(0),
+	m_sync_timer(nullptr)
 {
 }
 
@@ -125,7 +127,19 @@ u8 generic_latch_8_device::read()
 
 void generic_latch_8_device::write(u8 data)
 {
-	machine().scheduler().synchronize(timer_expired_delegate(FUNC(generic_latch_8_device::sync_callback), this), data);
+	// with a coalesce window configured, fold writes landing inside the
+	// window into one pending update carrying the most recent value; this
+	// spares a scheduler synchronization (and the quantum abort it implies)
+	// per write for drivers that hammer the latch
+	if (coalesce_window() != attotime::zero)
+	{
+		if (m_sync_timer->enabled())
+			m_sync_timer->set_param(data);
+		else
+			m_sync_timer->adjust(coalesce_window(), data);
+	}
+	else
+		machine().scheduler().synchronize(timer_expired_delegate(FUNC(generic_latch_8_device::sync_callback), this), data);
 }
 
 void generic_latch_8_device::preset_w(u8 data)
@@ -175,6 +189,9 @@ void generic_latch_8_device::device_start()
 	// register for state saving
 	generic_latch_base_device::device_start();
 	save_item(NAME(m_latched_value));
+
+	// persistent timer for coalesced writes
+	m_sync_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(generic_latch_8_device::sync_callback), this));
 }
 
 //-------------------------------------------------
@@ -183,7 +200,8 @@ void generic_latch_8_device::device_start()
 
 generic_latch_16_device::generic_latch_16_device(const machine_config &mconfig, const char *tag, device_t *owner, u32 clock) :
 	generic_latch_base_device(mconfig, GENERIC_LATCH_16, tag, owner, clock),
-	m_latched_value(0)
+	m_latched_value(0),
+	m_sync_timer(nullptr)
 {
 }
 
@@ -196,7 +214,16 @@ u16 generic_latch_16_device::read()
 
 void generic_latch_16_device::write(u16 data)
 {
-	machine().scheduler().synchronize(timer_expired_delegate(FUNC(generic_latch_16_device::sync_callback), this), data);
+	// see generic_latch_8_device::write for the coalescing rationale
+	if (coalesce_window() != attotime::zero)
+	{
+		if (m_sync_timer->enabled())
+			m_sync_timer->set_param(data);
+		else
+			m_sync_timer->adjust(coalesce_window(), data);
+	}
+	else
+		machine().scheduler().synchronize(timer_expired_delegate(FUNC(generic_latch_16_device::sync_callback), this), data);
 }
 
 void generic_latch_16_device::preset_w(u16 data)
@@ -246,4 +273,7 @@ void generic_latch_16_device::device_start()
 	// register for state saving
 	generic_latch_base_device::device_start();
 	save_item(NAME(m_latched_value));
+
+	// persistent timer for coalesced writes
+	m_sync_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(generic_latch_16_device::sync_callback), this));
 }
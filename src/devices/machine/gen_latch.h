@@ -34,6 +34,14 @@ public:
 	auto data_pending_callback() { return m_data_pending_cb.bind(); }
 	void set_separate_acknowledge(bool ack) { m_separate_acknowledge = ack; }
 
+	// opt-in write coalescing: writes arriving within the given window are
+	// collapsed into a single delayed update carrying the last value, instead
+	// of forcing a scheduler synchronization per write; only suitable where
+	// the reader reacts on a coarser timescale than the window (e.g. a sound
+	// CPU polling per-frame commands), since intermediate values are lost and
+	// the pending line rises up to a window later than on real hardware
+	void set_coalesce_window(const attotime &window) { m_coalesce_window = window; }
+
 	DECLARE_READ_LINE_MEMBER(pending_r);
 
 	u8 acknowledge_r(address_space &space);
@@ -49,12 +57,14 @@ protected:
 	bool has_separate_acknowledge() const { return m_separate_acknowledge; }
 	bool is_latch_written() const { return m_latch_written; }
 	void set_latch_written(bool latch_written);
+	const attotime &coalesce_window() const { return m_coalesce_window; }
 
 private:
 	void init_callback(void *ptr, s32 param);
 
 	bool                    m_separate_acknowledge;
 	bool                    m_latch_written;
+	attotime                m_coalesce_window;
 	devcb_write_line        m_data_pending_cb;
 };
 
@@ -82,6 +92,7 @@ protected:
 
 private:
 	u8 m_latched_value;
+	emu_timer *m_sync_timer;
 };
 
 
@@ -108,6 +119,7 @@ protected:
 
 private:
 	u16 m_latched_value;
+	emu_timer *m_sync_timer;
 };
 
 #endif  // MAME_MACHINE_GEN_LATCH_H
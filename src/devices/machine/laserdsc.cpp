@@ -685,6 +685,11 @@ void laserdisc_device::init_disc()
 		err = m_disc->read_metadata(AV_LD_METADATA_TAG, 0, m_vbidata);
 		if (err || (m_vbidata.size() != totalhunks * VBI_PACKED_BYTES))
 			throw emu_fatalerror("Precomputed VBI metadata missing or incorrect size");
+
+		// set up buffering and background decoding so sequential fields are
+		// decoded ahead of playback
+		m_queued_rawdata.resize(m_disc->hunk_bytes());
+		m_disc->set_readahead(4);
 	}
 	m_maxtrack = std::max(m_maxtrack, VIRTUAL_LEAD_IN_TRACKS + VIRTUAL_LEAD_OUT_TRACKS + m_chdtracks);
 }
@@ -959,17 +964,14 @@ void laserdisc_device::read_track_data()
 		m_metadata[m_fieldnum].line17 = m_metadata[m_fieldnum].line18 = m_metadata[m_fieldnum].line1718 = VBI_CODE_LEADIN;
 	}
 
-	// configure the codec and then read
+	// configure the decoder and then read
 	m_readresult = std::errc::no_such_file_or_directory;
 	if (m_disc && !m_videosquelch)
 	{
-		m_readresult = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &m_avhuff_config);
-		if (!m_readresult)
-		{
-			m_queued_hunknum = readhunk;
-			m_readresult = chd_file::error::OPERATION_PENDING;
-			osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
-		}
+		m_avhuff_decoder.configure(m_avhuff_config);
+		m_queued_hunknum = readhunk;
+		m_readresult = chd_file::error::OPERATION_PENDING;
+		osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
 	}
 }
 
@@ -982,7 +984,18 @@ void laserdisc_device::read_track_data()
 void *laserdisc_device::read_async_static(void *param, int threadid)
 {
 	laserdisc_device &ld = *reinterpret_cast<laserdisc_device *>(param);
-	ld.m_readresult = ld.m_disc->read_hunk(ld.m_queued_hunknum, nullptr);
+
+	// read the raw A/V data - when the readahead pipeline has decoded the
+	// hunk already this is just a copy out of the cache
+	ld.m_readresult = ld.m_disc->read_hunk(ld.m_queued_hunknum, &ld.m_queued_rawdata[0]);
+
+	// unpack it into the configured frame/audio buffers
+	if (!ld.m_readresult)
+	{
+		avhuff_error averr = ld.m_avhuff_decoder.unpack_data(&ld.m_queued_rawdata[0], ld.m_queued_rawdata.size());
+		if (averr != AVHERR_NONE)
+			ld.m_readresult = chd_file::error::DECOMPRESSION_ERROR;
+	}
 	return nullptr;
 }
 
@@ -285,10 +285,12 @@ private:
 	uint32_t            m_chdtracks;            // number of tracks in the CHD
 	bitmap_yuy16        m_avhuff_video;         // decompresed frame buffer
 	avhuff_decoder::config m_avhuff_config;     // decompression configuration
+	avhuff_decoder      m_avhuff_decoder;       // decoder for unpacking raw A/V data
 
 	// async operations
 	osd_work_queue *    m_work_queue;           // work queue
 	uint32_t            m_queued_hunknum;       // queued hunk
+	std::vector<uint8_t> m_queued_rawdata;      // raw A/V data for the queued hunk
 
 	// core states
 	uint8_t             m_audiosquelch;         // audio squelch state: bit 0 = audio 1, bit 1 = audio 2
@@ -451,7 +451,14 @@ void vrender0soc_device::dmac_w(offs_t offset, uint32_t data, uint32_t mem_mask)
 		if ((CTR & 0xd4) != 0)
 			popmessage("DMA%d with unhandled mode %02x, contact MAMEdev",Which,CTR);
 
-		if (CTR & 0x2)  //32 bits
+		const int width = (CTR & 0x2) ? 4 : (CTR & 0x1) ? 2 : 1;
+		if (src_inc == width && dst_inc == width)
+		{
+			// contiguous transfer; let the memory system copy whole ranges,
+			// dispatching at the programmed width where handlers are involved
+			m_host_space->copy_block(DST, SRC, size_t(CNT) * width, 1, 0, 0, -1, u8(width));
+		}
+		else if (CTR & 0x2)  //32 bits
 		{
 			for (int i = 0; i < CNT; ++i)
 			{
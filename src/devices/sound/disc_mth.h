@@ -174,8 +174,10 @@ DISCRETE_CLASS_STEP_RESET(dst_mixer, 1,
 	int             m_r_node_bit_flag;
 	int             m_c_bit_flag;
 	double          m_r_total;
+	double          m_r_total_recip;        /* 1.0 / m_r_total, valid when no resistor nodes are connected */
 	const double *  m_r_node[DISC_MIXER_MAX_INPS];      /* Either pointer to resistance node output OR nullptr */
 	double          m_r_last[DISC_MIXER_MAX_INPS];
+	double          m_r_recip[DISC_MIXER_MAX_INPS];     /* 1.0 / r for fixed resistor inputs */
 	double          m_exponent_rc[DISC_MIXER_MAX_INPS]; /* For high pass filtering cause by cIn */
 	double          m_v_cap[DISC_MIXER_MAX_INPS];       /* cap voltage of each input */
 	double          m_exponent_c_f;         /* Low pass on mixed inputs */
@@ -1102,7 +1102,7 @@ DISCRETE_STEP(dst_mixer)
 					m_v_cap[bit] += (vTemp - v_ref - m_v_cap[bit]) * m_exponent_rc[bit];
 					vTemp -= m_v_cap[bit];
 				}
-				i += ((type == DISC_MIXER_IS_OP_AMP) ? v_ref - vTemp : vTemp) / info->r[bit];
+				i += ((type == DISC_MIXER_IS_OP_AMP) ? v_ref - vTemp : vTemp) * m_r_recip[bit];
 			}
 		}
 		else
@@ -1111,19 +1111,23 @@ DISCRETE_STEP(dst_mixer)
 			if (UNEXPECTED(type == DISC_MIXER_IS_OP_AMP))
 			{
 				for (bit = 0; bit < m_size; bit++)
-					i += ( v_ref - DST_MIXER__IN(bit) ) / info->r[bit];
+					i += ( v_ref - DST_MIXER__IN(bit) ) * m_r_recip[bit];
 			}
 			else
 			{
 				for (bit = 0; bit < m_size; bit++)
-					i += DST_MIXER__IN(bit) / info->r[bit];
+					i += DST_MIXER__IN(bit) * m_r_recip[bit];
 			}
 		}
 
 		if (UNEXPECTED(type == DISC_MIXER_IS_OP_AMP_WITH_RI))
 			i += v_ref / rI;
 
-		r_total = 1.0 / r_total;
+		/* the parallel resistance is only recomputed when resistor nodes changed it */
+		if (UNEXPECTED(r_node_bit_flag != 0))
+			r_total = 1.0 / r_total;
+		else
+			r_total = m_r_total_recip;
 
 		/* If resistor network or has rI then Millman is used.
 		 * If op-amp then summing formula is used. */
@@ -1201,9 +1205,11 @@ DISCRETE_RESET(dst_mixer)
 	m_r_total = 0;
 	for(bit = 0; bit < m_size; bit++)
 	{
+		m_r_recip[bit] = 0;
 		if ((info->r[bit] != 0) && !info->r_node[bit] )
 		{
-			m_r_total += 1.0 / info->r[bit];
+			m_r_recip[bit] = 1.0 / info->r[bit];
+			m_r_total += m_r_recip[bit];
 		}
 
 		m_v_cap[bit]       = 0;
@@ -1239,6 +1245,9 @@ DISCRETE_RESET(dst_mixer)
 	}
 	if (m_type == DISC_MIXER_IS_OP_AMP_WITH_RI) m_r_total += 1.0 / info->rI;
 
+	/* the parallel resistance only varies when resistor nodes are connected */
+	m_r_total_recip = 1.0 / m_r_total;
+
 	m_v_cap_f      = 0;
 	m_exponent_c_f = 0;
 	if (info->cF != 0)
@@ -137,7 +137,9 @@ qsound_device::qsound_device(machine_config const &mconfig, char const *tag, dev
 	, m_dsp(*this, "dsp"), m_stream(nullptr)
 	, m_rom_bank(0U), m_rom_offset(0U), m_cmd_addr(0U), m_cmd_data(0U), m_new_data(0U), m_cmd_pending(0U), m_dsp_ready(1U)
 	, m_samples{ 0, 0 }, m_sr(0U), m_fsr(0U), m_ock(1U), m_old(1U), m_ready(0U), m_channel(0U)
+	, m_fifo_rd(0U), m_fifo_wr(0U), m_out{ 0, 0 }
 {
+	std::fill(std::begin(m_fifo), std::end(m_fifo), 0);
 }
 
 
@@ -226,6 +228,10 @@ void qsound_device::device_start()
 	save_item(NAME(m_old));
 	save_item(NAME(m_ready));
 	save_item(NAME(m_channel));
+	save_item(NAME(m_fifo));
+	save_item(NAME(m_fifo_rd));
+	save_item(NAME(m_fifo_wr));
+	save_item(NAME(m_out));
 }
 
 //-------------------------------------------------
@@ -256,8 +262,20 @@ void qsound_device::device_reset()
 
 void qsound_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
 {
-	outputs[0].fill(stream_buffer::sample_t(m_samples[0]) * (1.0 / 32768.0));
-	outputs[1].fill(stream_buffer::sample_t(m_samples[1]) * (1.0 / 32768.0));
+	// drain the FIFO of recovered sample pairs - the DSP produces them at
+	// exactly the stream's sample rate, so this stays balanced on average
+	for (int i = 0; outputs[0].samples() > i; ++i)
+	{
+		if (m_fifo_rd != m_fifo_wr)
+		{
+			u16 const slot(m_fifo_rd & (FIFO_SIZE - 1));
+			m_out[0] = m_fifo[slot << 1];
+			m_out[1] = m_fifo[(slot << 1) | 1];
+			++m_fifo_rd;
+		}
+		outputs[0].put_int(i, m_out[0], 32768);
+		outputs[1].put_int(i, m_out[1], 32768);
+	}
 }
 
 
@@ -314,7 +332,17 @@ WRITE_LINE_MEMBER(qsound_device::dsp_ock_w)
 		{
 			LOGSAMPLE("QSound: recovered channel %u sample %04X\n", m_channel, m_sr);
 			if (!m_channel)
-				m_stream->update();
+			{
+				// queue the completed pair rather than synchronising the
+				// stream on every sample - the FIFO is drained at the
+				// equivalent rate in sound_stream_update
+				if (u16(m_fifo_wr - m_fifo_rd) == FIFO_SIZE)
+					++m_fifo_rd; // overflow - drop the oldest pair
+				u16 const slot(m_fifo_wr & (FIFO_SIZE - 1));
+				m_fifo[slot << 1] = m_samples[0];
+				m_fifo[(slot << 1) | 1] = m_samples[1];
+				++m_fifo_wr;
+			}
 			m_samples[m_channel] = m_sr;
 #if 0 // enable to log PCM to a file - can be imported with "ffmpeg -f s16be -ar 24038 -ac 2 -i qsound.pcm qsound.wav"
 			static std::ofstream logfile("qsound.pcm", std::ios::binary);
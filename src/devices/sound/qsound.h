@@ -63,6 +63,12 @@ private:
 	s16 m_samples[2];
 	u16 m_sr, m_fsr;
 	u8 m_ock, m_old, m_ready, m_channel;
+
+	// sample pairs recovered since the last stream update
+	static constexpr u16 FIFO_SIZE = 1024; // must be a power of two
+	s16 m_fifo[2 * FIFO_SIZE];
+	u16 m_fifo_rd, m_fifo_wr;
+	s16 m_out[2];
 };
 
 DECLARE_DEVICE_TYPE(QSOUND, qsound_device)
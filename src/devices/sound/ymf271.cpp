@@ -572,7 +572,9 @@ void ymf271_device::sound_stream_update(sound_stream &stream, std::vector<read_s
 	int op;
 	int32_t *mixp;
 
-	std::fill(m_mix_buffer.begin(), m_mix_buffer.end(), 0);
+	// only clear the part of the mix buffer this update will use; the buffer
+	// is sized for a full second of output
+	std::fill_n(m_mix_buffer.begin(), outputs[0].samples() * 4, 0);
 
 	for (j = 0; j < 12; j++)
 	{
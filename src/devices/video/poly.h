@@ -332,8 +332,11 @@ private:
 	// number of profiling ticks before we consider a wait "long"
 	static constexpr osd_ticks_t POLY_LOG_WAIT_THRESHOLD = 1000;
 
-	static constexpr int SCANLINES_PER_BUCKET = 32;
-	static constexpr int TOTAL_BUCKETS        = (512 / SCANLINES_PER_BUCKET);
+	// finer buckets produce more independently schedulable units and fewer
+	// false dependencies from bucket aliasing on screens taller than the
+	// bucket span; the span covers 1024 scanlines before wrapping
+	static constexpr int SCANLINES_PER_BUCKET = 16;
+	static constexpr int TOTAL_BUCKETS        = (1024 / SCANLINES_PER_BUCKET);
 
 	// primitive_info describes a single primitive
 	struct primitive_info
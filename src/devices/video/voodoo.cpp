@@ -1037,6 +1037,9 @@ void voodoo_1_device::device_start()
 void voodoo_1_device::device_stop()
 {
 	m_renderer->wait("device_stop");
+
+	// report any heavily-used generic fallbacks as specialization candidates
+	m_renderer->dump_fallback_stats();
 }
 
 
@@ -1253,11 +1253,6 @@ voodoo_renderer::voodoo_renderer(running_machine &machine, u16 tmu_config, const
 	// add all predefined rasterizers
 	for (static_rasterizer_info const *info = s_predef_raster_table; info->params.generic() != 0xffffffff; info++)
 		add_rasterizer(info->params, info->mfp, false);
-
-	// create entries for the generic rasterizers as well
-	rasterizer_params dummy_params;
-	for (int index = 0; index < std::size(m_generic_rasterizer); index++)
-		m_generic_rasterizer[index] = add_rasterizer(dummy_params, generic_rasterizer(index), true);
 }
 
 
@@ -1344,15 +1339,10 @@ u32 voodoo_renderer::enqueue_triangle(poly_data &poly, vertex_t const *vert)
 			break;
 		}
 
-	// determine the index of the generic rasterizer
+	// if we don't have a specialized one, add a tracked entry with the
+	// appropriate generic rasterizer so the fallback shows up in the stats
 	if (info == nullptr)
-	{
-		// add a new one if we're logging usage
-		if (LOG_RASTERIZERS)
-			info = add_rasterizer(poly.raster, generic_rasterizer(poly.raster.generic()), true);
-		else
-			info = m_generic_rasterizer[poly.raster.generic()];
-	}
+		info = add_rasterizer(poly.raster, generic_rasterizer(poly.raster.generic()), true);
 
 	// set the info and render the triangle
 	info->polys++;
@@ -2528,11 +2518,8 @@ rasterizer_info *voodoo_renderer::add_rasterizer(rasterizer_params const &params
 
 	// hook us into the hash table
 	u32 hash = info.fullhash % RASTER_HASH_SIZE;
-	if (!is_generic || LOG_RASTERIZERS)
-	{
-		info.next = m_raster_hash[hash];
-		m_raster_hash[hash] = &info;
-	}
+	info.next = m_raster_hash[hash];
+	m_raster_hash[hash] = &info;
 
 	if (LOG_RASTERIZERS && params.fbzcp().raw() != 0)
 	{
@@ -2614,6 +2601,43 @@ void voodoo_renderer::dump_rasterizer_stats()
 }
 
 
+//-------------------------------------------------
+//  dump_fallback_stats - report the most-used
+//  parameter tuples that fell back to a generic
+//  rasterizer, ready to paste into the
+//  predefined table
+//-------------------------------------------------
+
+void voodoo_renderer::dump_fallback_stats()
+{
+	// gather all the generic entries that actually rendered something
+	std::vector<rasterizer_info const *> fallbacks;
+	for (rasterizer_info const &info : m_rasterizer_list)
+		if (info.is_generic && info.scanlines != 0)
+			fallbacks.push_back(&info);
+	if (fallbacks.empty())
+		return;
+
+	// sort by scanline count and emit the top entries
+	std::sort(fallbacks.begin(), fallbacks.end(), [](rasterizer_info const *a, rasterizer_info const *b) { return a->scanlines > b->scanlines; });
+	osd_printf_verbose("voodoo: top states hitting the generic rasterizer; add to s_predef_raster_table to specialize:\n");
+	for (size_t index = 0; index < fallbacks.size() && index < 15; index++)
+	{
+		rasterizer_info const &info = *fallbacks[index];
+		osd_printf_verbose("RASTERIZER( 0x%02X, 0x%08X, 0x%08X, 0x%08X, 0x%08X, 0x%08X, 0x%08X ) // %8d %10d\n",
+			info.params.generic(),
+			info.params.fbzcp().raw(),
+			info.params.alphamode().raw(),
+			info.params.fogmode().raw(),
+			info.params.fbzmode().raw(),
+			info.params.texmode0().raw(),
+			info.params.texmode1().raw(),
+			info.polys,
+			info.scanlines);
+	}
+}
+
+
 //**************************************************************************
 //  GAME-SPECIFIC RASTERIZERS
 //**************************************************************************
@@ -574,6 +574,9 @@ public:
 	// dump rasterizer statistics if enabled
 	void dump_rasterizer_stats();
 
+	// report tuples that fell back to a generic rasterizer
+	void dump_fallback_stats();
+
 private:
 	// pipeline stages, in order
 	bool stipple_test(thread_stats_block &threadstats, voodoo::reg_fbz_mode const fbzmode, s32 x, s32 y, u32 &stipple);
@@ -609,7 +612,6 @@ private:
 	poly_array<voodoo::rasterizer_texture, 2> m_textures;
 	poly_array<voodoo::rasterizer_palette, 8> m_palettes;
 	voodoo::rasterizer_info *m_raster_hash[RASTER_HASH_SIZE]; // hash table of rasterizers
-	voodoo::rasterizer_info *m_generic_rasterizer[16];
 	std::list<voodoo::rasterizer_info> m_rasterizer_list;
 	std::vector<thread_stats_block> m_thread_stats;
 };
@@ -38,6 +38,22 @@ attotime &attotime::operator*=(u32 factor)
 	if (factor == 0)
 		return *this = zero;
 
+#ifdef __SIZEOF_INT128__
+	// flatten to a 128-bit attosecond count and scale with a single multiply
+	if (m_seconds >= 0)
+	{
+		unsigned __int128 total = (unsigned __int128)u64(m_seconds) * ATTOSECONDS_PER_SECOND + u64(m_attoseconds);
+		total *= factor;
+
+		u64 secs = u64(total / ATTOSECONDS_PER_SECOND);
+		if (secs >= ATTOTIME_MAX_SECONDS)
+			return *this = never;
+		m_seconds = seconds_t(secs);
+		m_attoseconds = attoseconds_t(u64(total % ATTOSECONDS_PER_SECOND));
+		return *this;
+	}
+#endif
+
 	// split attoseconds into upper and lower halves which fit into 32 bits
 	u32 attolo;
 	u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, attolo);
@@ -78,6 +94,21 @@ attotime &attotime::operator/=(u32 factor)
 	if (factor == 0)
 		return *this;
 
+#ifdef __SIZEOF_INT128__
+	// flatten to a 128-bit attosecond count and divide once, rounding to nearest
+	if (m_seconds >= 0)
+	{
+		unsigned __int128 total = (unsigned __int128)u64(m_seconds) * ATTOSECONDS_PER_SECOND + u64(m_attoseconds);
+		unsigned __int128 result = total / factor;
+		if (u32(total % factor) >= factor / 2)
+			result++;
+
+		m_seconds = seconds_t(u64(result / ATTOSECONDS_PER_SECOND));
+		m_attoseconds = attoseconds_t(u64(result % ATTOSECONDS_PER_SECOND));
+		return *this;
+	}
+#endif
+
 	// split attoseconds into upper and lower halves which fit into 32 bits
 	u32 attolo;
 	u32 attohi = divu_64x32_rem(m_attoseconds, ATTOSECONDS_PER_SECOND_SQRT, attolo);
@@ -99,7 +99,7 @@ public:
 	constexpr attotime(const attotime& that) noexcept : m_seconds(that.m_seconds), m_attoseconds(that.m_attoseconds) { }
 
 	// assignment
-	attotime &operator=(const attotime& that) noexcept
+	constexpr attotime &operator=(const attotime& that) noexcept
 	{
 		this->m_seconds = that.m_seconds;
 		this->m_attoseconds = that.m_attoseconds;
@@ -142,8 +142,8 @@ public:
 	/** Create an attotime from an integer count of nanoseconds @p nsec */
 	static constexpr attotime from_nsec(s64 nsec) { return attotime(nsec / 1000000000, (nsec % 1000000000) * (ATTOSECONDS_PER_SECOND / 1000000000)); }
 	/** Create an attotime from at the given frequency @p frequency */
-	static attotime from_hz(u32 frequency) { return (frequency > 1) ? attotime(0, HZ_TO_ATTOSECONDS(frequency)) : (frequency == 1) ? attotime(1, 0) : attotime::never; }
-	static attotime from_hz(int frequency) { return (frequency > 0) ? from_hz(u32(frequency)) : attotime::never; }
+	static constexpr attotime from_hz(u32 frequency) { return (frequency > 1) ? attotime(0, HZ_TO_ATTOSECONDS(frequency)) : (frequency == 1) ? attotime(1, 0) : attotime(ATTOTIME_MAX_SECONDS, 0); }
+	static constexpr attotime from_hz(int frequency) { return (frequency > 0) ? from_hz(u32(frequency)) : attotime(ATTOTIME_MAX_SECONDS, 0); }
 	static attotime from_hz(const XTAL &xtal) { return (xtal.dvalue() > 1.0) ? attotime(0, HZ_TO_ATTOSECONDS(xtal)) : from_hz(xtal.dvalue()); }
 	static attotime from_hz(double frequency)
 	{
@@ -159,8 +159,8 @@ public:
 	}
 
 	// math
-	attotime &operator+=(const attotime &right) noexcept;
-	attotime &operator-=(const attotime &right) noexcept;
+	constexpr attotime &operator+=(const attotime &right) noexcept;
+	constexpr attotime &operator-=(const attotime &right) noexcept;
 	attotime &operator*=(u32 factor);
 	attotime &operator/=(u32 factor);
 
@@ -180,13 +180,13 @@ public:
 //**************************************************************************
 
 /** handle addition between two attotimes */
-inline attotime operator+(const attotime &left, const attotime &right) noexcept
+inline constexpr attotime operator+(const attotime &left, const attotime &right) noexcept
 {
 	attotime result;
 
 	// if one of the items is never, return never
 	if (left.m_seconds >= ATTOTIME_MAX_SECONDS || right.m_seconds >= ATTOTIME_MAX_SECONDS)
-		return attotime::never;
+		return attotime(ATTOTIME_MAX_SECONDS, 0);
 
 	// add the seconds and attoseconds
 	result.m_attoseconds = left.m_attoseconds + right.m_attoseconds;
@@ -201,15 +201,15 @@ inline attotime operator+(const attotime &left, const attotime &right) noexcept
 
 	// overflow
 	if (result.m_seconds >= ATTOTIME_MAX_SECONDS)
-		return attotime::never;
+		return attotime(ATTOTIME_MAX_SECONDS, 0);
 	return result;
 }
 
-inline attotime &attotime::operator+=(const attotime &right) noexcept
+inline constexpr attotime &attotime::operator+=(const attotime &right) noexcept
 {
 	// if one of the items is never, return never
 	if (this->m_seconds >= ATTOTIME_MAX_SECONDS || right.m_seconds >= ATTOTIME_MAX_SECONDS)
-		return *this = never;
+		return *this = attotime(ATTOTIME_MAX_SECONDS, 0);
 
 	// add the seconds and attoseconds
 	m_attoseconds += right.m_attoseconds;
@@ -224,19 +224,19 @@ inline attotime &attotime::operator+=(const attotime &right) noexcept
 
 	// overflow
 	if (this->m_seconds >= ATTOTIME_MAX_SECONDS)
-		return *this = never;
+		return *this = attotime(ATTOTIME_MAX_SECONDS, 0);
 	return *this;
 }
 
 
 /** handle subtraction between two attotimes */
-inline attotime operator-(const attotime &left, const attotime &right) noexcept
+inline constexpr attotime operator-(const attotime &left, const attotime &right) noexcept
 {
 	attotime result;
 
 	// if time1 is never, return never
 	if (left.m_seconds >= ATTOTIME_MAX_SECONDS)
-		return attotime::never;
+		return attotime(ATTOTIME_MAX_SECONDS, 0);
 
 	// add the seconds and attoseconds
 	result.m_attoseconds = left.m_attoseconds - right.m_attoseconds;
@@ -251,11 +251,11 @@ inline attotime operator-(const attotime &left, const attotime &right) noexcept
 	return result;
 }
 
-inline attotime &attotime::operator-=(const attotime &right) noexcept
+inline constexpr attotime &attotime::operator-=(const attotime &right) noexcept
 {
 	// if time1 is never, return never
 	if (this->m_seconds >= ATTOTIME_MAX_SECONDS)
-		return *this = never;
+		return *this = attotime(ATTOTIME_MAX_SECONDS, 0);
 
 	// add the seconds and attoseconds
 	m_attoseconds -= right.m_attoseconds;
@@ -341,7 +341,12 @@ inline constexpr attoseconds_t attotime::as_attoseconds() const noexcept
 /** as_ticks - convert to ticks at @p frequency */
 inline u64 attotime::as_ticks(u32 frequency) const
 {
+#ifdef __SIZEOF_INT128__
+	// compute the fractional ticks in 128 bits rather than through an intermediate attotime
+	u64 fracticks = u64(((unsigned __int128)u64(m_attoseconds) * frequency) / ATTOSECONDS_PER_SECOND);
+#else
 	u32 fracticks = (attotime(0, m_attoseconds) * frequency).m_seconds;
+#endif
 	return mulu_32x32(m_seconds, frequency) + fracticks;
 }
 
@@ -1466,9 +1466,14 @@ debug_disasm_buffer::debug_disasm_buffer(device_t &device) :
 
 void debug_disasm_buffer::disassemble(offs_t pc, std::string &instruction, offs_t &next_pc, offs_t &size, u32 &info) const
 {
-	std::ostringstream out;
-	u32 result = m_dintf.disassemble(out, pc, m_buf_opcodes, m_buf_params.active() ? m_buf_params : m_buf_opcodes);
-	instruction = out.str();
+	// reuse the vector stream so tracing doesn't allocate per line
+	m_dasm_stream.clear();
+	m_dasm_stream.seekp(0);
+	u32 result = m_dintf.disassemble(m_dasm_stream, pc, m_buf_opcodes, m_buf_params.active() ? m_buf_params : m_buf_opcodes);
+	auto const len = m_dasm_stream.tellp();
+	instruction.clear();
+	if (len > 0)
+		instruction.assign(&m_dasm_stream.vec()[0], size_t(len));
 	size = result & util::disasm_interface::LENGTHMASK;
 	next_pc = m_next_pc(pc, size);
 	info = result;
@@ -1477,8 +1482,10 @@ void debug_disasm_buffer::disassemble(offs_t pc, std::string &instruction, offs_
 
 u32 debug_disasm_buffer::disassemble_info(offs_t pc) const
 {
-	std::ostringstream out;
-	return m_dintf.disassemble(out, pc, m_buf_opcodes, m_buf_params.active() ? m_buf_params : m_buf_opcodes);
+	// the text is discarded, but the stream is still cheaper to reuse
+	m_dasm_stream.clear();
+	m_dasm_stream.seekp(0);
+	return m_dintf.disassemble(m_dasm_stream, pc, m_buf_opcodes, m_buf_params.active() ? m_buf_params : m_buf_opcodes);
 }
 
 std::string debug_disasm_buffer::pc_to_string(offs_t pc) const
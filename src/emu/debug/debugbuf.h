@@ -85,6 +85,7 @@ private:
 	std::function<std::string (offs_t)> m_pc_to_string;
 
 	debug_data_buffer m_buf_raw, m_buf_opcodes, m_buf_params;
+	mutable util::ovectorstream m_dasm_stream;  // reused across disassemble calls
 	u32 const m_flags;
 	offs_t m_page_mask, m_pc_mask;
 };
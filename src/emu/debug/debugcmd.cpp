@@ -3681,6 +3681,7 @@ void debugger_commands::execute_trace(const std::vector<std::string> &params, bo
 	const char *action = nullptr;
 	bool detect_loops = true;
 	bool logerror = false;
+	bool binary = false;
 	device_t *cpu;
 	const char *mode;
 	std::string filename = params[0];
@@ -3703,6 +3704,8 @@ void debugger_commands::execute_trace(const std::vector<std::string> &params, bo
 				detect_loops = false;
 			else if (!core_stricmp(flag.c_str(), "logerror"))
 				logerror = true;
+			else if (!core_stricmp(flag.c_str(), "bin"))
+				binary = true;
 			else
 			{
 				m_console.printf("Invalid flag '%s'\n", flag);
@@ -3717,12 +3720,12 @@ void debugger_commands::execute_trace(const std::vector<std::string> &params, bo
 	FILE *f = nullptr;
 	if (core_stricmp(filename.c_str(), "off") != 0)
 	{
-		mode = "w";
+		mode = binary ? "wb" : "w";
 
 		// opening for append?
 		if ((filename[0] == '>') && (filename[1] == '>'))
 		{
-			mode = "a";
+			mode = binary ? "ab" : "a";
 			filename = filename.substr(2);
 		}
 
@@ -3735,7 +3738,7 @@ void debugger_commands::execute_trace(const std::vector<std::string> &params, bo
 	}
 
 	// do it
-	cpu->debug()->trace(f, trace_over, detect_loops, logerror, action);
+	cpu->debug()->trace(f, trace_over, detect_loops, logerror, binary, action);
 	if (f)
 		m_console.printf("Tracing CPU '%s' to file %s\n", cpu->tag(), filename);
 	else
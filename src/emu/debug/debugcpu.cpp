@@ -436,6 +436,8 @@ device_debug::device_debug(device_t &device)
 	, m_pc_history_index(0)
 	, m_pc_history_valid(0)
 	, m_bplist()
+	, m_bp_page_filter(0)
+	, m_wpgen(0)
 	, m_rplist(std::make_unique<std::forward_list<debug_registerpoint>>())
 	, m_triggered_breakpoint(nullptr)
 	, m_triggered_watchpoint(nullptr)
@@ -1193,6 +1195,7 @@ int device_debug::watchpoint_set(address_space &space, read_or_write type, offs_
 	// allocate a new one
 	u32 id = m_device.machine().debugger().cpu().get_watchpoint_index();
 	m_wplist[space.spacenum()].emplace_back(std::make_unique<debug_watchpoint>(this, *m_symtable, id, space, type, address, length, condition, action));
+	m_wpgen++;
 
 	return id;
 }
@@ -1212,6 +1215,7 @@ bool device_debug::watchpoint_clear(int index)
 			if ((*wpi)->index() == index)
 			{
 				wpl.erase(wpi);
+				m_wpgen++;
 				return true;
 			}
 	}
@@ -1229,6 +1233,7 @@ void device_debug::watchpoint_clear_all()
 {
 	for (auto &wpl : m_wplist)
 		wpl.clear();
+	m_wpgen++;
 }
 
 
@@ -1245,6 +1250,7 @@ bool device_debug::watchpoint_enable(int index, bool enable)
 			if (wp->index() == index)
 			{
 				wp->setEnabled(enable);
+				m_wpgen++;
 				return true;
 			}
 
@@ -1264,6 +1270,25 @@ void device_debug::watchpoint_enable_all(bool enable)
 	for (auto &wpl : m_wplist)
 		for (auto &wp : wpl)
 			wp->setEnabled(enable);
+	m_wpgen++;
+}
+
+
+//-------------------------------------------------
+//  watchpoint_overlaps - return true if an enabled
+//  watchpoint of the given type intersects the
+//  address range in the given space
+//-------------------------------------------------
+
+bool device_debug::watchpoint_overlaps(int spacenum, read_or_write type, offs_t start, offs_t end) const
+{
+	if (spacenum >= int(m_wplist.size()))
+		return false;
+	for (auto &wp : m_wplist[spacenum])
+		if (wp->enabled() && (u32(wp->type()) & u32(type)) != 0 &&
+				wp->address() <= end && (wp->address() + wp->length() - 1) >= start)
+			return true;
+	return false;
 }
 
 
@@ -1549,14 +1574,14 @@ u32 device_debug::compute_opcode_crc32(offs_t pc) const
 //  trace - trace execution of a given device
 //-------------------------------------------------
 
-void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+void device_debug::trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, bool binary, const char *action)
 {
 	// delete any existing tracers
 	m_trace = nullptr;
 
 	// if we have a new file, make a new tracer
 	if (file != nullptr)
-		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, action);
+		m_trace = std::make_unique<tracer>(*this, *file, trace_over, detect_loops, logerror, binary, action);
 }
 
 
@@ -1666,13 +1691,15 @@ void device_debug::prepare_for_step_overout(offs_t pc)
 
 void device_debug::breakpoint_update_flags()
 {
-	// see if there are any enabled breakpoints
+	// see if there are any enabled breakpoints, rebuilding the PC page
+	// filter as we go
 	m_flags &= ~DEBUG_FLAG_LIVE_BP;
+	m_bp_page_filter = 0;
 	for (auto &bpp : m_bplist)
 		if (bpp.second->m_enabled)
 		{
 			m_flags |= DEBUG_FLAG_LIVE_BP;
-			break;
+			m_bp_page_filter |= u64(1) << ((bpp.second->address() >> BP_PAGE_SHIFT) & 63);
 		}
 
 	if (!(m_flags & DEBUG_FLAG_LIVE_BP))
@@ -1703,27 +1730,32 @@ void device_debug::breakpoint_check(offs_t pc)
 {
 	debugger_cpu& debugcpu = m_device.machine().debugger().cpu();
 
-	// see if we match
-	auto bpitp = m_bplist.equal_range(pc);
-	for (auto bpit = bpitp.first; bpit != bpitp.second; ++bpit)
+	// one test against the page filter rejects PCs that share no page with
+	// any enabled breakpoint, without touching the breakpoint map
+	if ((m_bp_page_filter & (u64(1) << ((pc >> BP_PAGE_SHIFT) & 63))) != 0)
 	{
-		debug_breakpoint &bp = *bpit->second;
-		if (bp.hit(pc))
+		// see if we match
+		auto bpitp = m_bplist.equal_range(pc);
+		for (auto bpit = bpitp.first; bpit != bpitp.second; ++bpit)
 		{
-			// halt in the debugger by default
-			debugcpu.set_execution_stopped();
+			debug_breakpoint &bp = *bpit->second;
+			if (bp.hit(pc))
+			{
+				// halt in the debugger by default
+				debugcpu.set_execution_stopped();
 
-			// if we hit, evaluate the action
-			if (!bp.m_action.empty())
-				m_device.machine().debugger().console().execute_command(bp.m_action, false);
+				// if we hit, evaluate the action
+				if (!bp.m_action.empty())
+					m_device.machine().debugger().console().execute_command(bp.m_action, false);
 
-			// print a notification, unless the action made us go again
-			if (debugcpu.is_stopped())
-			{
-				m_device.machine().debugger().console().printf("Stopped at breakpoint %X\n", bp.m_index);
-				m_triggered_breakpoint = &bp;
+				// print a notification, unless the action made us go again
+				if (debugcpu.is_stopped())
+				{
+					m_device.machine().debugger().console().printf("Stopped at breakpoint %X\n", bp.m_index);
+					m_triggered_breakpoint = &bp;
+				}
+				break;
 			}
-			break;
 		}
 	}
 
@@ -1761,18 +1793,30 @@ void device_debug::breakpoint_check(offs_t pc)
 //  tracer - constructor
 //-------------------------------------------------
 
-device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action)
+device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, bool binary, const char *action)
 	: m_debug(debug)
 	, m_file(file)
 	, m_action((action != nullptr) ? action : "")
 	, m_detect_loops(detect_loops)
 	, m_logerror(logerror)
+	, m_binary(binary)
 	, m_loops(0)
 	, m_nextdex(0)
 	, m_trace_over(trace_over)
 	, m_trace_over_target(~0)
+	, m_record_active(0)
+	, m_record_count(0)
+	, m_record_queue(nullptr)
 {
 	memset(m_history, 0, sizeof(m_history));
+
+	// binary mode buffers records and writes them from a background queue
+	if (m_binary)
+	{
+		m_record_buffer[0].resize(TRACE_BUFFER_RECORDS);
+		m_record_buffer[1].resize(TRACE_BUFFER_RECORDS);
+		m_record_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	}
 }
 
 
@@ -1782,6 +1826,13 @@ device_debug::tracer::tracer(device_debug &debug, FILE &file, bool trace_over, b
 
 device_debug::tracer::~tracer()
 {
+	// drain any buffered binary records before closing
+	if (m_record_queue != nullptr)
+	{
+		flush_records(true);
+		osd_work_queue_free(m_record_queue);
+	}
+
 	// make sure we close the file if we can
 	fclose(&m_file);
 }
@@ -1802,6 +1853,13 @@ void device_debug::tracer::update(offs_t pc)
 		m_trace_over_target = ~0;
 	}
 
+	// binary mode logs a raw record and skips text formatting entirely
+	if (m_binary)
+	{
+		update_binary(pc);
+		return;
+	}
+
 	if (m_detect_loops)
 	{
 		// check for a loop condition
@@ -1856,12 +1914,100 @@ void device_debug::tracer::update(offs_t pc)
 }
 
 
+//-------------------------------------------------
+//  update_binary - log a raw binary record for a
+//  given instruction
+//-------------------------------------------------
+
+void device_debug::tracer::update_binary(offs_t pc)
+{
+	// execute any trace actions first
+	if (!m_action.empty())
+		m_debug.m_device.machine().debugger().console().execute_command(m_action, false);
+
+	debug_disasm_buffer buffer(m_debug.device());
+	u32 dasmresult = buffer.disassemble_info(pc);
+	offs_t size = dasmresult & util::disasm_interface::LENGTHMASK;
+
+	// fill in the record; no text is formatted here, rendering is done
+	// offline by the tracedump tool
+	trace_record &record = m_record_buffer[m_record_active][m_record_count++];
+	record.pc = pc;
+	record.cycles = (m_debug.m_exec != nullptr) ? u64(m_debug.m_exec->total_cycles()) : 0;
+	buffer.data_get(pc, size, true, m_record_opbytes);
+	record.length = u8(std::min<std::size_t>(m_record_opbytes.size(), sizeof(record.opbytes)));
+	memset(record.opbytes, 0, sizeof(record.opbytes));
+	if (record.length != 0)
+		memcpy(record.opbytes, &m_record_opbytes[0], record.length);
+
+	// hand the buffer to the background writer when it fills up
+	if (m_record_count == TRACE_BUFFER_RECORDS)
+		flush_records(false);
+
+	// do we need to step the trace over this instruction?
+	if (m_trace_over && (dasmresult & util::disasm_interface::SUPPORTED) != 0 && (dasmresult & util::disasm_interface::STEP_OVER) != 0)
+	{
+		int extraskip = (dasmresult & util::disasm_interface::OVERINSTMASK) >> util::disasm_interface::OVERINSTSHIFT;
+		offs_t trace_over_target = buffer.next_pc_wrap(pc, dasmresult & util::disasm_interface::LENGTHMASK);
+
+		// if we need to skip additional instructions, advance as requested
+		while (extraskip-- > 0)
+			trace_over_target = buffer.next_pc_wrap(trace_over_target, buffer.disassemble_info(trace_over_target) & util::disasm_interface::LENGTHMASK);
+
+		m_trace_over_target = trace_over_target;
+	}
+}
+
+
+//-------------------------------------------------
+//  flush_records - queue the active record buffer
+//  for writing, optionally waiting for completion
+//-------------------------------------------------
+
+void device_debug::tracer::flush_records(bool wait)
+{
+	// wait for any in-flight write so the other buffer is free for filling
+	osd_work_queue_wait(m_record_queue, osd_ticks_per_second() * 10);
+
+	// queue the active buffer and swap to the other one
+	if (m_record_count != 0)
+	{
+		m_flush_request.file = &m_file;
+		m_flush_request.records = &m_record_buffer[m_record_active][0];
+		m_flush_request.count = m_record_count;
+		osd_work_item_queue(m_record_queue, record_flush_callback, &m_flush_request, WORK_ITEM_FLAG_AUTO_RELEASE);
+		m_record_active ^= 1;
+		m_record_count = 0;
+	}
+
+	if (wait)
+		osd_work_queue_wait(m_record_queue, osd_ticks_per_second() * 10);
+}
+
+
+//-------------------------------------------------
+//  record_flush_callback - background write of a
+//  full record buffer
+//-------------------------------------------------
+
+void *device_debug::tracer::record_flush_callback(void *param, int threadid)
+{
+	auto *request = reinterpret_cast<flush_request *>(param);
+	fwrite(request->records, sizeof(trace_record), request->count, request->file);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  vprintf - generic print to the trace file
 //-------------------------------------------------
 
 void device_debug::tracer::vprintf(const char *format, va_list va)
 {
+	// text output would corrupt a binary trace
+	if (m_binary)
+		return;
+
 	// pass through to the file
 	vfprintf(&m_file, format, va);
 	fflush(&m_file);
@@ -1875,6 +2021,8 @@ void device_debug::tracer::vprintf(const char *format, va_list va)
 
 void device_debug::tracer::flush()
 {
+	if (m_binary)
+		flush_records(true);
 	fflush(&m_file);
 }
 
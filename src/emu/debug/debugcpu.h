@@ -15,6 +15,7 @@
 
 #include <set>
 #include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -111,6 +112,12 @@ public:
 	void set_triggered_watchpoint(debug_watchpoint *wp) { m_triggered_watchpoint = wp; }
 	debug_watchpoint *triggered_watchpoint() { debug_watchpoint *ret = m_triggered_watchpoint; m_triggered_watchpoint = nullptr; return ret; }
 
+	// watchpoint queries for recompilers; the generation counter is bumped
+	// whenever the watchpoint set changes, so cached code that bypasses the
+	// memory system for unwatched ranges knows when to regenerate
+	u32 watchpoint_generation() const noexcept { return m_wpgen; }
+	bool watchpoint_overlaps(int spacenum, read_or_write type, offs_t start, offs_t end) const;
+
 	// registerpoints
 	const std::forward_list<debug_registerpoint> &registerpoint_list() const { return *m_rplist; }
 	int registerpoint_set(const char *condition, const char *action = nullptr);
@@ -146,7 +153,7 @@ public:
 	void track_mem_data_clear() { m_track_mem_set.clear(); }
 
 	// tracing
-	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+	void trace(FILE *file, bool trace_over, bool detect_loops, bool logerror, bool binary, const char *action);
 	void trace_printf(const char *fmt, ...) ATTR_PRINTF(2,3);
 	void trace_flush() { if (m_trace != nullptr) m_trace->flush(); }
 
@@ -205,7 +212,9 @@ private:
 
 	// breakpoints and watchpoints
 	std::multimap<offs_t, std::unique_ptr<debug_breakpoint>> m_bplist;     // list of breakpoints
+	u64                     m_bp_page_filter;           // one bit per 2^BP_PAGE_SHIFT-byte page holding an enabled breakpoint
 	std::vector<std::vector<std::unique_ptr<debug_watchpoint>>> m_wplist;  // watchpoint lists for each address space
+	u32                     m_wpgen;                    // generation counter for watchpoint changes
 	std::unique_ptr<std::forward_list<debug_registerpoint>> m_rplist;      // list of registerpoints
 
 	debug_breakpoint *      m_triggered_breakpoint;     // latest breakpoint that was triggered
@@ -215,7 +224,7 @@ private:
 	class tracer
 	{
 	public:
-		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, const char *action);
+		tracer(device_debug &debug, FILE &file, bool trace_over, bool detect_loops, bool logerror, bool binary, const char *action);
 		~tracer();
 
 		void update(offs_t pc);
@@ -225,6 +234,29 @@ private:
 
 	private:
 		static const int TRACE_LOOPS = 64;
+		static const u32 TRACE_BUFFER_RECORDS = 65536;
+
+		// a binary trace record, written raw to the trace file; the layout
+		// must match the reader in src/tools/tracedump.cpp
+		struct trace_record
+		{
+			u64             pc;                 // program counter
+			u64             cycles;             // total cycles at the time of the fetch
+			u8              length;             // opcode length in bytes
+			u8              opbytes[15];        // raw opcode bytes, zero-padded
+		};
+
+		// pending background write of a full record buffer
+		struct flush_request
+		{
+			FILE *          file;               // file to write to
+			const trace_record *records;        // first record to write
+			u32             count;              // number of records
+		};
+
+		void update_binary(offs_t pc);
+		void flush_records(bool wait);
+		static void *record_flush_callback(void *param, int threadid);
 
 		device_debug &      m_debug;                    // reference to our owner
 		FILE &              m_file;                     // tracing file for this CPU
@@ -232,12 +264,19 @@ private:
 		offs_t              m_history[TRACE_LOOPS];     // history of recent PCs
 		bool                m_detect_loops;             // whether or not we should detect loops
 		bool                m_logerror;                 // whether or not we should collect logerror output
+		bool                m_binary;                   // whether we log binary records instead of text
 		int                 m_loops;                    // number of instructions in a loop
 		int                 m_nextdex;                  // next index
 		bool                m_trace_over;               // true if we're tracing over
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+		std::vector<trace_record> m_record_buffer[2];   // double-buffered binary records
+		int                 m_record_active;            // buffer currently being filled
+		u32                 m_record_count;             // number of records in the active buffer
+		std::vector<u8>     m_record_opbytes;           // scratch buffer for opcode fetches
+		osd_work_queue *    m_record_queue;             // queue performing background writes
+		flush_request       m_flush_request;            // parameters for the in-flight write
 	};
 	std::unique_ptr<tracer>                m_trace;                    // tracer state
 
@@ -323,6 +362,10 @@ private:
 	static constexpr u32 DEBUG_FLAG_LIVE_BP         = 0x00010000;       // there are live breakpoints for this CPU
 	static constexpr u32 DEBUG_FLAG_STOP_PRIVILEGE  = 0x00020000;       // run until execution level changes
 
+	// page granularity of the breakpoint PC filter; pages alias modulo 64,
+	// so a false positive just falls through to the breakpoint map lookup
+	static constexpr int BP_PAGE_SHIFT = 8;
+
 	static constexpr u32 DEBUG_FLAG_STEPPING_ANY    = DEBUG_FLAG_STEPPING | DEBUG_FLAG_STEPPING_OVER | DEBUG_FLAG_STEPPING_OUT;
 	static constexpr u32 DEBUG_FLAG_TRACING_ANY     = DEBUG_FLAG_TRACING | DEBUG_FLAG_TRACING_OVER;
 	static constexpr u32 DEBUG_FLAG_TRANSIENT       = DEBUG_FLAG_STEPPING_ANY | DEBUG_FLAG_STOP_PC |
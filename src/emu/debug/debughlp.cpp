@@ -1065,7 +1065,7 @@ const help_item f_static_help_list[] =
 	{
 		"trace",
 		"\n"
-		"  trace {<filename>|off}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  trace {<filename>|off}[,<CPU>[,[noloop|logerror|bin][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing of the execution of the specified <CPU>, or the currently visible "
 		"CPU if no CPU is specified.  To enable tracing, specify the trace log file name in the "
@@ -1077,7 +1077,10 @@ const help_item f_static_help_list[] =
 		"'logerror'.  Multiple flags must be separated by | (pipe) characters.  By default, loops "
 		"are detected and condensed to a single line.  If the 'noloop' flag is specified, loops "
 		"will not be detected and every instruction will be logged as executed.  If the 'logerror' "
-		"flag is specified, error log output will be included in the trace log.\n"
+		"flag is specified, error log output will be included in the trace log.  If the 'bin' flag "
+		"is specified, compact binary records (PC, opcode bytes and cycle count) are buffered and "
+		"written in the background instead of formatted text, which is much faster for very long "
+		"captures; the resulting file can be rendered to text with the tracedump tool.\n"
 		"\n"
 		"The optional <action> parameter is a debugger command to execute before each trace message "
 		"is logged.  Generally, this will include a 'tracelog' or 'tracesym' command to include "
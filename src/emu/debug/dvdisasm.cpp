@@ -222,6 +222,31 @@ void debug_view_disasm::view_click(const int button, const debug_view_xy& pos)
 	end_update();
 }
 
+void debug_view_disasm::disassemble_cached(debug_disasm_buffer &buffer, offs_t address, std::string &dasm, offs_t &next_address, offs_t &size)
+{
+	// reuse the previous decode when the underlying bytes are unchanged;
+	// rendering the bytes to text is much cheaper than disassembling them,
+	// so stepping through a loop decodes nothing new
+	auto const i = m_dasm_cache.find(address);
+	if(i != m_dasm_cache.end()
+			&& buffer.data_to_string(address, i->second.m_size, true) == i->second.m_topcodes
+			&& buffer.data_to_string(address, i->second.m_size, false) == i->second.m_tparams) {
+		dasm = i->second.m_dasm;
+		size = i->second.m_size;
+		next_address = i->second.m_next_address;
+		return;
+	}
+
+	u32 info;
+	buffer.disassemble(address, dasm, next_address, size, info);
+
+	// keep the cache bounded; dropping it wholesale is fine, it refills on
+	// the next update
+	if(m_dasm_cache.size() >= DASM_CACHE_MAX)
+		m_dasm_cache.clear();
+	m_dasm_cache[address] = cached_line{ buffer.data_to_string(address, size, true), buffer.data_to_string(address, size, false), dasm, size, next_address };
+}
+
 void debug_view_disasm::generate_from_address(debug_disasm_buffer &buffer, offs_t address)
 {
 	m_dasm.clear();
@@ -229,8 +254,7 @@ void debug_view_disasm::generate_from_address(debug_disasm_buffer &buffer, offs_
 		std::string dasm;
 		offs_t size;
 		offs_t next_address;
-		u32 info;
-		buffer.disassemble(address, dasm, next_address, size, info);
+		disassemble_cached(buffer, address, dasm, next_address, size);
 		m_dasm.emplace_back(address, size, dasm);
 		address = next_address;
 	}
@@ -265,8 +289,7 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 			std::string dasm;
 			offs_t size;
 			offs_t next_address;
-			u32 info;
-			buffer.disassemble(address, dasm, next_address, size, info);
+			disassemble_cached(buffer, address, dasm, next_address, size);
 			m_dasm.emplace_back(address, size, dasm);
 			if(intf.pc_real_to_linear(address) > intf.pc_real_to_linear(next_address))
 				return false;
@@ -278,8 +301,7 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 			std::string dasm;
 			offs_t size;
 			offs_t next_address;
-			u32 info;
-			buffer.disassemble(address, dasm, next_address, size, info);
+			disassemble_cached(buffer, address, dasm, next_address, size);
 			m_dasm.emplace_back(address, size, dasm);
 			if(address > next_address)
 				return false;
@@ -297,8 +319,7 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 		std::string dasm;
 		offs_t size;
 		offs_t next_address;
-		u32 info;
-		buffer.disassemble(address, dasm, next_address, size, info);
+		disassemble_cached(buffer, address, dasm, next_address, size);
 		m_dasm.emplace_back(address, size, dasm);
 		address = next_address;
 	}
@@ -574,6 +595,7 @@ void debug_view_disasm::set_source(const debug_view_source &source)
 {
 	if(&source != m_source) {
 		m_recompute = true;
+		m_dasm_cache.clear();
 		debug_view::set_source(source);
 	}
 }
@@ -111,7 +111,18 @@ private:
 		dasm_line(offs_t address, offs_t size, std::string dasm) : m_address(address), m_size(size), m_dasm(dasm), m_is_pc(false), m_is_bp(false), m_is_visited(false) {}
 	};
 
+	// a previously decoded line, reusable while the underlying bytes are
+	// unchanged
+	struct cached_line {
+		std::string m_topcodes;                 // textual opcode bytes, used for validation
+		std::string m_tparams;                  // textual parameter bytes, used for validation
+		std::string m_dasm;                     // disassembly
+		offs_t m_size;                          // size of the instruction
+		offs_t m_next_address;                  // address of the following instruction
+	};
+
 	// internal helpers
+	void disassemble_cached(debug_disasm_buffer &buffer, offs_t address, std::string &dasm, offs_t &next_address, offs_t &size);
 	void generate_from_address(debug_disasm_buffer &buffer, offs_t address);
 	bool generate_with_pc(debug_disasm_buffer &buffer, offs_t pc);
 	int address_position(offs_t pc) const;
@@ -129,11 +140,13 @@ private:
 	offs_t                 m_previous_pc;          // previous pc, to detect whether it changed
 	debug_view_expression  m_expression;           // expression-related information
 	std::vector<dasm_line> m_dasm;                 // disassembled instructions
+	std::unordered_map<offs_t, cached_line> m_dasm_cache; // decoded lines keyed by address
 
 	// constants
 	static constexpr int DEFAULT_DASM_LINES = 1000;
 	static constexpr int DEFAULT_DASM_WIDTH = 50;
 	static constexpr int DASM_MAX_BYTES = 16;
+	static constexpr size_t DASM_CACHE_MAX = 8192;
 };
 
 #endif // MAME_EMU_DEBUG_DVDISASM_H
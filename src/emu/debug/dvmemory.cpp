@@ -119,7 +119,13 @@ debug_view_memory::debug_view_memory(running_machine &machine, debug_view_osd_up
 		m_address_radix(16),
 		m_maxaddr(0),
 		m_bytes_per_row(16),
-		m_byte_offset(0)
+		m_byte_offset(0),
+		m_write_tap(nullptr),
+		m_tap_space(nullptr),
+		m_tap_notifier(-1),
+		m_tap_offset(0),
+		m_rows_valid(false),
+		m_rendered_cursor_visible(false)
 {
 	// hack: define some sane init values
 	// that don't hurt the initial computation of top_left
@@ -138,6 +144,18 @@ debug_view_memory::debug_view_memory(running_machine &machine, debug_view_osd_up
 }
 
 
+//-------------------------------------------------
+//  ~debug_view_memory - destructor
+//-------------------------------------------------
+
+debug_view_memory::~debug_view_memory()
+{
+	remove_write_tap();
+	if (m_tap_space != nullptr)
+		m_tap_space->remove_change_notifier(m_tap_notifier);
+}
+
+
 //-------------------------------------------------
 //  enumerate_sources - enumerate all possible
 //  sources for a memory view
@@ -409,11 +427,53 @@ void debug_view_memory::view_update()
 
 	// if we need to recompute, do it now
 	if (needs_recompute())
+	{
 		recompute();
+		m_rows_valid = false;
+	}
+
+	// rows from the previous update can only be reused if the write tap was
+	// watching them and the window has not moved or been resized
+	bool full_update = !m_rows_valid
+		|| m_topleft.x != m_rendered_topleft.x || m_topleft.y != m_rendered_topleft.y
+		|| m_visible.x != m_rendered_visible.x || m_visible.y != m_rendered_visible.y;
+
+	// a moved cursor only dirties the rows it left and entered
+	if (!full_update && (m_cursor_visible != m_rendered_cursor_visible || m_cursor.x != m_rendered_cursor.x || m_cursor.y != m_rendered_cursor.y))
+	{
+		if (m_rendered_cursor_visible && u32(m_rendered_cursor.y - m_topleft.y) < m_visible.y)
+			m_row_dirty[m_rendered_cursor.y - m_topleft.y] = true;
+		if (m_cursor_visible && u32(m_cursor.y - m_topleft.y) < m_visible.y)
+			m_row_dirty[m_cursor.y - m_topleft.y] = true;
+	}
+
+	// on a full update, dirty everything and move the tap to the new window
+	if (full_update)
+	{
+		m_row_dirty.assign(m_visible.y, true);
+		m_row_snapshot.assign(size_t(m_visible.y) * m_chunks_per_row, 0);
+		install_write_tap();
+	}
 
 	// loop over visible rows
 	for (u32 row = 0; row < m_visible.y; row++)
 	{
+		// the tap only sees writes through the viewed space; shared RAM
+		// can be written through another CPU's space or directly via a
+		// memory_share pointer, so verify the underlying data against
+		// what was rendered before reusing a clean row
+		if (!m_row_dirty[row])
+		{
+			u32 cleanrow = m_topleft.y + row;
+			if (cleanrow >= m_total.y)
+				continue;
+			offs_t cleanbyte = m_byte_offset + cleanrow * m_bytes_per_row;
+			offs_t cleanaddr = (source.m_space != nullptr) ? source.m_space->byte_to_address(cleanbyte) : cleanbyte;
+			if (row_unchanged(cleanaddr, &m_row_snapshot[size_t(row) * m_chunks_per_row]))
+				continue;
+		}
+		m_row_dirty[row] = false;
+
 		debug_view_char *destmin = &m_viewdata[row * m_visible.x];
 		debug_view_char *destmax = destmin + m_visible.x;
 		debug_view_char *destrow = destmin - m_topleft.x;
@@ -439,8 +499,155 @@ void debug_view_memory::view_update()
 			offs_t addrbyte = m_byte_offset + effrow * m_bytes_per_row;
 			offs_t address = (source.m_space != nullptr) ? source.m_space->byte_to_address(addrbyte) : addrbyte;
 			generate_row(destmin, destmax, destrow, address);
+
+			// capture what the row now shows for later verification
+			u64 *snapshot = &m_row_snapshot[size_t(row) * m_chunks_per_row];
+			for (int chunknum = 0; chunknum < m_chunks_per_row; chunknum++)
+				snapshot[chunknum] = read_chunk_digest(address, chunknum);
 		}
 	}
+
+	// remember what this update rendered; only space-backed sources generate
+	// write notifications, anything else gets a full update every time
+	m_rows_valid = (m_write_tap != nullptr);
+	m_rendered_topleft = m_topleft;
+	m_rendered_visible = m_visible;
+	m_rendered_cursor = m_cursor;
+	m_rendered_cursor_visible = m_cursor_visible;
+}
+
+
+//-------------------------------------------------
+//  install_write_tap - install a write tap and
+//  change notifier covering the visible window
+//-------------------------------------------------
+
+void debug_view_memory::install_write_tap()
+{
+	const debug_view_memory_source &source = downcast<const debug_view_memory_source &>(*m_source);
+	address_space *space = source.m_space;
+
+	// move the change notifier if the source space changed
+	if (space != m_tap_space)
+	{
+		remove_write_tap();
+		if (m_tap_space != nullptr)
+			m_tap_space->remove_change_notifier(m_tap_notifier);
+		m_tap_space = space;
+		if (space != nullptr)
+		{
+			// a map change can alter what any address reads back as, and it
+			// drops installed taps, so invalidate everything and re-tap
+			m_tap_notifier = space->add_change_notifier(
+					[this] (read_or_write mode)
+					{
+						m_rows_valid = false;
+						if (u32(mode) & u32(read_or_write::WRITE))
+							install_write_tap();
+					});
+		}
+	}
+
+	// only address space sources generate write notifications
+	if (space == nullptr)
+	{
+		remove_write_tap();
+		return;
+	}
+
+	// clamp the visible window to the addressable range
+	u64 firstbyte = u64(m_byte_offset) + u64(m_topleft.y) * m_bytes_per_row;
+	u64 lastbyte = firstbyte + u64(m_visible.y) * m_bytes_per_row - 1;
+	if (firstbyte > m_maxaddr)
+	{
+		remove_write_tap();
+		return;
+	}
+	lastbyte = std::min<u64>(lastbyte, m_maxaddr);
+	m_tap_offset = offs_t(firstbyte);
+
+	// install the tap, recycling the previous handler when possible
+	offs_t addrstart = space->byte_to_address(offs_t(firstbyte));
+	offs_t addrend = space->byte_to_address_end(offs_t(lastbyte));
+	switch (space->data_width())
+	{
+	case  8: m_write_tap = space->install_write_tap(addrstart, addrend, "dvmemory", [this, space] (offs_t address, u8  &, u8 ) { watch_write(*space, address); }, m_write_tap); break;
+	case 16: m_write_tap = space->install_write_tap(addrstart, addrend, "dvmemory", [this, space] (offs_t address, u16 &, u16) { watch_write(*space, address); }, m_write_tap); break;
+	case 32: m_write_tap = space->install_write_tap(addrstart, addrend, "dvmemory", [this, space] (offs_t address, u32 &, u32) { watch_write(*space, address); }, m_write_tap); break;
+	case 64: m_write_tap = space->install_write_tap(addrstart, addrend, "dvmemory", [this, space] (offs_t address, u64 &, u64) { watch_write(*space, address); }, m_write_tap); break;
+	}
+}
+
+
+//-------------------------------------------------
+//  remove_write_tap - remove the write tap
+//-------------------------------------------------
+
+void debug_view_memory::remove_write_tap()
+{
+	if (m_write_tap != nullptr)
+		m_write_tap->remove();
+	m_write_tap = nullptr;
+}
+
+
+//-------------------------------------------------
+//  read_chunk_digest - reduce one displayed chunk
+//  to a value that changes whenever its rendering
+//  would
+//-------------------------------------------------
+
+u64 debug_view_memory::read_chunk_digest(offs_t address, int chunknum)
+{
+	constexpr u64 UNMAPPED_DIGEST = 0xbad0bad0bad0bad0;
+
+	if (m_shift_bits != 0 || m_data_format != data_format::FLOAT_80BIT)
+	{
+		u64 chunkdata = 0;
+		bool ismapped = (m_shift_bits != 0)
+				? read_chunk(address, chunknum, chunkdata)
+				: read(m_bytes_per_chunk, address + chunknum * m_steps_per_chunk, chunkdata);
+		return ismapped ? chunkdata : UNMAPPED_DIGEST;
+	}
+	else
+	{
+		extFloat80_t chunkdata80 = { 0, 0 };
+		bool ismapped = read(m_bytes_per_chunk, address + chunknum * m_steps_per_chunk, chunkdata80);
+		return ismapped ? (chunkdata80.signif ^ (u64(chunkdata80.signExp) << 48)) : UNMAPPED_DIGEST;
+	}
+}
+
+
+//-------------------------------------------------
+//  row_unchanged - verify that a visible row
+//  still renders the same data it did last time
+//-------------------------------------------------
+
+bool debug_view_memory::row_unchanged(offs_t address, const u64 *snapshot)
+{
+	for (int chunknum = 0; chunknum < m_chunks_per_row; chunknum++)
+		if (read_chunk_digest(address, chunknum) != snapshot[chunknum])
+			return false;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  watch_write - mark the rows touched by a write
+//  as needing to be re-rendered
+//-------------------------------------------------
+
+void debug_view_memory::watch_write(address_space &space, offs_t address)
+{
+	// the tap covers exactly the visible rows, so map bytes to rows directly
+	offs_t firstbyte = space.address_to_byte(address);
+	offs_t lastbyte = firstbyte + space.data_width() / 8 - 1;
+	if (lastbyte < m_tap_offset)
+		return;
+	u32 firstrow = (firstbyte >= m_tap_offset) ? (firstbyte - m_tap_offset) / m_bytes_per_row : 0;
+	u32 lastrow = (lastbyte - m_tap_offset) / m_bytes_per_row;
+	for (u32 row = firstrow; row <= lastrow && row < m_row_dirty.size(); row++)
+		m_row_dirty[row] = true;
 }
 
 
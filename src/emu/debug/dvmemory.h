@@ -54,6 +54,7 @@ class debug_view_memory : public debug_view
 
 	// construction/destruction
 	debug_view_memory(running_machine &machine, debug_view_osd_update_func osdupdate, void *osdprivate);
+	virtual ~debug_view_memory();
 
 	struct memory_view_pos;
 
@@ -118,6 +119,11 @@ private:
 	void recompute();
 	bool needs_recompute();
 
+	// incremental update helpers
+	void install_write_tap();
+	void remove_write_tap();
+	void watch_write(address_space &space, offs_t address);
+
 	// cursor position management
 	cursor_pos get_cursor_pos(const debug_view_xy& cursor);
 	void set_cursor_pos(cursor_pos pos);
@@ -129,6 +135,8 @@ private:
 	void write(u8 size, offs_t offs, u64 data);
 	bool read(u8 size, offs_t offs, extFloat80_t &data);
 	bool read_chunk(offs_t address, int chunknum, u64 &chunkdata);
+	u64 read_chunk_digest(offs_t address, int chunknum);
+	bool row_unchanged(offs_t address, const u64 *snapshot);
 	void generate_row(debug_view_char *destmin, debug_view_char *destmax, debug_view_char *destrow, offs_t address);
 
 	// internal state
@@ -148,6 +156,20 @@ private:
 	u32                 m_byte_offset;          // (derived) offset of starting visible byte
 	std::string         m_addrformat;           // (derived) format string to use to print addresses
 
+	// incremental update state; rows already in m_viewdata are reused when a
+	// write tap on the visible window shows they cannot have changed
+	memory_passthrough_handler *m_write_tap;    // write tap covering the visible window
+	address_space *     m_tap_space;            // space the tap and notifier are installed in
+	int                 m_tap_notifier;         // change notifier for the tapped space
+	offs_t              m_tap_offset;           // first byte offset covered by the tap
+	std::vector<bool>   m_row_dirty;            // per-visible-row dirty flags
+	std::vector<u64>    m_row_snapshot;         // per-chunk digests of what each row last rendered
+	bool                m_rows_valid;           // true if clean rows can be reused
+	debug_view_xy       m_rendered_topleft;     // top-left when rows were last rendered
+	debug_view_xy       m_rendered_visible;     // visible size when rows were last rendered
+	debug_view_xy       m_rendered_cursor;      // cursor position when rows were last rendered
+	bool                m_rendered_cursor_visible; // cursor visibility when rows were last rendered
+
 	struct section
 	{
 		bool contains(int x) const { return x >= m_pos && x < m_pos + m_width; }
@@ -1056,6 +1056,9 @@ void parsed_expression::parse(std::string_view expression)
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// flatten the postfix program for execution
+	compile_tokens();
 }
 
 
@@ -1809,6 +1812,22 @@ void parsed_expression::infix_to_postfix()
 }
 
 
+//-------------------------------------------------
+//  compile_tokens - flatten the postfix token
+//  list into a contiguous program for execution
+//-------------------------------------------------
+
+void parsed_expression::compile_tokens()
+{
+	// the token list is kept as a std::list because conversion to postfix
+	// order is splice-heavy; execution iterates the program many times
+	// (e.g. conditional watchpoints evaluated on every access), so copy it
+	// into a flat array once and execute from that
+	m_compiled.assign(m_tokenlist.begin(), m_tokenlist.end());
+	m_token_stack.reserve(m_compiled.size());
+}
+
+
 //-------------------------------------------------
 //  push_token - push a token onto the stack
 //-------------------------------------------------
@@ -1886,9 +1905,13 @@ u64 parsed_expression::execute_tokens()
 	// reset the token stack
 	m_token_stack.clear();
 
+	// make sure the flattened program is up to date
+	if (m_compiled.size() != m_tokenlist.size())
+		compile_tokens();
+
 	// loop over the entire sequence
 	parse_token t1, t2, result;
-	for (parse_token &token : m_tokenlist)
+	for (parse_token &token : m_compiled)
 	{
 		// symbols/numbers/strings just get pushed
 		if (!token.is_operator())
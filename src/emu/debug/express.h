@@ -15,11 +15,11 @@
 
 #include "emucore.h"
 
-#include <deque>
 #include <functional>
 #include <list>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -360,6 +360,7 @@ private:
 	void pop_token_rval(parse_token &token);
 	u64 execute_tokens();
 	void execute_function(parse_token &token);
+	void compile_tokens();
 
 	// constants
 	static const int MAX_FUNCTION_PARAMS = 16;
@@ -369,8 +370,9 @@ private:
 	int                 m_default_base;                 // default base
 	std::string         m_original_string;              // original string (prior to parsing)
 	std::list<parse_token> m_tokenlist;                 // token list
+	std::vector<parse_token> m_compiled;                // flattened postfix program executed at runtime
 	std::list<std::string> m_stringlist;                // string list
-	std::deque<parse_token> m_token_stack;              // token stack (used during execution)
+	std::vector<parse_token> m_token_stack;             // token stack (used during execution)
 };
 
 #endif // MAME_EMU_DEBUG_EXPRESS_H
@@ -822,6 +822,7 @@ private:
 
 	std::vector<func_t> m_functions;
 	std::vector<typename creator::ptr> m_creators;
+	func_t m_single; // cached copy of the sole function in the common single-target case
 
 public:
 	template <unsigned Count>
@@ -871,6 +872,7 @@ void devcb_read<Result, DefaultMask>::reset()
 {
 	assert(m_functions.empty());
 	m_creators.clear();
+	m_single = nullptr;
 }
 
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
@@ -898,6 +900,10 @@ void devcb_read<Result, DefaultMask>::resolve()
 	for (typename creator::ptr const &c : m_creators)
 		m_functions.emplace_back(c->create());
 	m_creators.clear();
+
+	// in the overwhelmingly common single-target case, keep an inline copy
+	// of the composed function so calls bypass the vector walk entirely
+	m_single = (m_functions.size() == 1) ? m_functions.front() : func_t();
 }
 
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
@@ -905,13 +911,18 @@ void devcb_read<Result, DefaultMask>::resolve_safe(Result dflt)
 {
 	resolve();
 	if (m_functions.empty())
+	{
 		m_functions.emplace_back([dflt] (offs_t offset, std::make_unsigned_t<Result> mem_mask) { return dflt; });
+		m_single = m_functions.front();
+	}
 }
 
 template <typename Result, std::make_unsigned_t<Result> DefaultMask>
 Result devcb_read<Result, DefaultMask>::operator()(offs_t offset, std::make_unsigned_t<Result> mem_mask)
 {
 	assert(m_creators.empty() && !m_functions.empty());
+	if (m_single)
+		return m_single(offset, mem_mask);
 	typename std::vector<func_t>::const_iterator it(m_functions.begin());
 	std::make_unsigned_t<Result> result((*it)(offset, mem_mask));
 	while (m_functions.end() != ++it)
@@ -2291,6 +2302,7 @@ private:
 
 	std::vector<func_t> m_functions;
 	std::vector<typename creator::ptr> m_creators;
+	func_t m_single; // cached copy of the sole function in the common single-target case
 
 public:
 	template <unsigned Count>
@@ -2340,6 +2352,7 @@ void devcb_write<Input, DefaultMask>::reset()
 {
 	assert(m_functions.empty());
 	m_creators.clear();
+	m_single = nullptr;
 }
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
@@ -2358,6 +2371,10 @@ void devcb_write<Input, DefaultMask>::resolve()
 	for (typename creator::ptr const &c : m_creators)
 		m_functions.emplace_back(c->create());
 	m_creators.clear();
+
+	// in the overwhelmingly common single-target case, keep an inline copy
+	// of the composed function so calls bypass the vector walk entirely
+	m_single = (m_functions.size() == 1) ? m_functions.front() : func_t();
 }
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
@@ -2365,13 +2382,21 @@ void devcb_write<Input, DefaultMask>::resolve_safe()
 {
 	resolve();
 	if (m_functions.empty())
+	{
 		m_functions.emplace_back([] (offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask) { });
+		m_single = m_functions.front();
+	}
 }
 
 template <typename Input, std::make_unsigned_t<Input> DefaultMask>
 void devcb_write<Input, DefaultMask>::operator()(offs_t offset, Input data, std::make_unsigned_t<Input> mem_mask)
 {
 	assert(m_creators.empty() && !m_functions.empty());
+	if (m_single)
+	{
+		m_single(offset, data, mem_mask);
+		return;
+	}
 	typename std::vector<func_t>::const_iterator it(m_functions.begin());
 	(*it)(offset, data, mem_mask);
 	while (m_functions.end() != ++it)
@@ -52,6 +52,20 @@ void finder_base::set_tag(char const *tag)
 	assert(!m_resolved);
 	m_base = m_base.get().mconfig().current_device();
 	m_tag = tag;
+	m_fulltag.clear();
+}
+
+
+//-------------------------------------------------
+//  finder_fulltag - get the fully-qualified
+//  search tag, computing it on first use
+//-------------------------------------------------
+
+std::string const &finder_base::finder_fulltag() const
+{
+	if (m_fulltag.empty())
+		m_fulltag = m_base.get().subtag(m_tag);
+	return m_fulltag;
 }
 
 
@@ -61,8 +75,10 @@ void finder_base::set_tag(char const *tag)
 
 void *finder_base::find_memregion(u8 width, size_t &length, bool required) const
 {
-	// look up the region and return nullptr if not found
-	memory_region *const region(m_base.get().memregion(m_tag));
+	// look up the region by precomputed full path and return nullptr if not found
+	auto const &regions(m_base.get().machine().memory().regions());
+	auto const found(regions.find(finder_fulltag()));
+	memory_region *const region((regions.end() != found) ? found->second.get() : nullptr);
 	if (!region)
 	{
 		length = 0;
@@ -92,7 +108,7 @@ bool finder_base::validate_memregion(bool required) const
 {
 	// make sure we can resolve the full path to the region
 	size_t bytes_found = 0;
-	std::string const region_fulltag(m_base.get().subtag(m_tag));
+	std::string const &region_fulltag(finder_fulltag());
 
 	// look for the region
 	for (device_t const &dev : device_enumerator(m_base.get().mconfig().root_device()))
@@ -119,8 +135,10 @@ bool finder_base::validate_memregion(bool required) const
 
 void *finder_base::find_memshare(u8 width, size_t &bytes, bool required) const
 {
-	// look up the share and return nullptr if not found
-	memory_share *const share(m_base.get().memshare(m_tag));
+	// look up the share by precomputed full path and return nullptr if not found
+	auto const &shares(m_base.get().machine().memory().shares());
+	auto const found(shares.find(finder_fulltag()));
+	memory_share *const share((shares.end() != found) ? found->second.get() : nullptr);
 	if (!share)
 		return nullptr;
 
@@ -229,7 +247,7 @@ bool finder_base::report_missing(bool found, const char *objname, bool required)
 	else
 	{
 		// otherwise, report
-		std::string const region_fulltag(m_base.get().subtag(m_tag));
+		std::string const &region_fulltag(finder_fulltag());
 		if (required)
 			osd_printf_error("Required %s '%s' not found\n", objname, region_fulltag);
 		else if (DUMMY_TAG != m_tag)
@@ -305,7 +323,7 @@ template <bool Required>
 bool ioport_finder<Required>::findit(validity_checker *valid)
 {
 	if (valid)
-		return finder_base::report_missing(!valid->ioport_missing(this->m_base.get().subtag(this->m_tag).c_str()), "I/O port", Required);
+		return finder_base::report_missing(!valid->ioport_missing(this->finder_fulltag().c_str()), "I/O port", Required);
 
 	assert(!this->m_resolved);
 	this->m_resolved = true;
@@ -353,7 +371,7 @@ bool memory_bank_creator::findit(validity_checker *valid)
 
 	device_t &dev = m_base.get();
 	memory_manager &manager = dev.machine().memory();
-	std::string const tag = dev.subtag(m_tag);
+	std::string const &tag = finder_fulltag();
 	memory_bank *const bank = manager.bank_find(tag);
 	m_target = bank ? bank : manager.bank_alloc(dev, tag);
 	return true;
@@ -389,7 +407,7 @@ bool memory_share_creator<PointerType>::findit(validity_checker *valid)
 
 	device_t &dev = m_base.get();
 	memory_manager &manager = dev.machine().memory();
-	std::string const tag = dev.subtag(m_tag);
+	std::string const &tag = finder_fulltag();
 	memory_share *const share = manager.share_find(tag);
 	if (share)
 	{
@@ -267,6 +267,16 @@ public:
 	///   relative to and the relative tag.
 	std::pair<device_t &, char const *> finder_target() const { return std::make_pair(m_base, m_tag); }
 
+	/// \brief Get fully-qualified search tag
+	///
+	/// Returns the fully-qualified search tag, computing and caching
+	/// it on first use so repeated resolution and validation passes
+	/// don't rebuild the path.  The cache is invalidated if the search
+	/// base or tag changes.
+	/// \return The fully-qualified version of the object tag this
+	///   helper will search for.
+	std::string const &finder_fulltag() const;
+
 	/// \brief Set search tag
 	///
 	/// Allows search tag to be changed after construction.  Note that
@@ -282,6 +292,7 @@ public:
 		assert(!m_resolved);
 		m_base = base;
 		m_tag = tag;
+		m_fulltag.clear();
 	}
 
 	/// \brief Set search tag
@@ -305,6 +316,7 @@ public:
 	{
 		assert(!m_resolved);
 		std::tie(m_base, m_tag) = finder.finder_target();
+		m_fulltag.clear();
 	}
 
 	/// \brief Dummy tag always treated as not found
@@ -432,6 +444,12 @@ protected:
 	/// \brief Object tag to search for
 	char const *m_tag;
 
+	/// \brief Cached fully-qualified tag
+	///
+	/// Lazily populated by finder_fulltag and cleared when the search
+	/// base or tag changes.
+	mutable std::string m_fulltag;
+
 	/// \brief Set when object resolution completes
 	bool m_resolved;
 };
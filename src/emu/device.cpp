@@ -911,6 +911,16 @@ device_t *device_t::subdevice_slow(std::string_view tag) const
 		}
 	}
 
+	// at runtime, memoize successful lookups in the quick map so repeated
+	// string lookups from handlers resolve with a single hash; results are
+	// not cached at configuration time because slot devices can still be
+	// replaced or removed
+	if (curdevice != nullptr && m_machine != nullptr)
+	{
+		m_subdevices.m_tagmap.emplace(machine().arena().intern(tag), std::ref(*curdevice));
+		osd_printf_verbose("Caching slow device lookup of '%s' from '%s'\n", std::string(tag), this->tag());
+	}
+
 	return curdevice;
 }
 
@@ -520,7 +520,7 @@ class device_t : public delegate_late_bind
 
 		// private state
 		simple_list<device_t>   m_list;         // list of sub-devices we own
-		std::unordered_map<std::string_view, std::reference_wrapper<device_t>> m_tagmap;      // map of devices looked up and found by subtag
+		mutable std::unordered_map<std::string_view, std::reference_wrapper<device_t>> m_tagmap;      // map of devices looked up and found by subtag; also memoizes slow path lookups at runtime
 	};
 
 	class interface_list
@@ -45,7 +45,9 @@ const int TRIGGER_SUSPENDTIME   = -4000;
 device_execute_interface::device_execute_interface(const machine_config &mconfig, device_t &device)
 	: device_interface(device, "execute")
 	, m_scheduler(nullptr)
+	, m_debug_flags(nullptr)
 	, m_disabled(false)
+	, m_parallel_safe(false)
 	, m_vblank_interrupt(device)
 	, m_vblank_interrupt_screen(nullptr)
 	, m_timed_interrupt(device)
@@ -63,6 +65,10 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_nexteatcycles(0)
 	, m_trigger(0)
 	, m_inttrigger(0)
+	, m_account_cost(false)
+	, m_cost_ticks(0)
+	, m_cost_emutime(0)
+	, m_cost_index(0)
 	, m_totalcycles(0)
 	, m_divisor(0)
 	, m_divshift(0)
@@ -70,6 +76,7 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_attoseconds_per_cycle(0)
 {
 	memset(&m_localtime, 0, sizeof(m_localtime));
+	memset(m_cost_history, 0, sizeof(m_cost_history));
 
 	// configure the fast accessor
 	assert(!device.interfaces().m_execute);
@@ -237,6 +244,60 @@ u64 device_execute_interface::total_cycles() const noexcept
 }
 
 
+//-------------------------------------------------
+//  set_cost_accounting - enable or disable host
+//  execution cost accounting for this device
+//-------------------------------------------------
+
+void device_execute_interface::set_cost_accounting(bool enabled)
+{
+	// reset the accumulators and history on any transition
+	if (enabled != m_account_cost)
+	{
+		m_cost_ticks = 0;
+		m_cost_emutime = 0;
+		m_cost_index = 0;
+		memset(m_cost_history, 0, sizeof(m_cost_history));
+	}
+	m_account_cost = enabled;
+}
+
+
+//-------------------------------------------------
+//  run_cost_history - return a completed cost
+//  window; index 0 is the most recent
+//-------------------------------------------------
+
+u64 device_execute_interface::run_cost_history(int index) const
+{
+	if (index < 0 || index >= RUN_COST_HISTORY || u32(index) >= m_cost_index)
+		return 0;
+	return m_cost_history[(m_cost_index - 1 - index) % RUN_COST_HISTORY];
+}
+
+
+//-------------------------------------------------
+//  account_run_cost - fold the host time spent in
+//  a timeslice into the current accounting window,
+//  rolling the window at each emulated second
+//-------------------------------------------------
+
+void device_execute_interface::account_run_cost(osd_ticks_t ticks, int ran)
+{
+	m_cost_ticks += ticks;
+	m_cost_emutime += m_attoseconds_per_cycle * attoseconds_t(ran);
+	while (m_cost_emutime >= ATTOSECONDS_PER_SECOND)
+	{
+		// scale the accumulated ticks to host nanoseconds; the window's
+		// entire cost is attributed to the second it completes
+		u64 nsec = u64(double(m_cost_ticks) * 1e9 / double(osd_ticks_per_second()));
+		m_cost_history[m_cost_index++ % RUN_COST_HISTORY] = nsec;
+		m_cost_ticks = 0;
+		m_cost_emutime -= ATTOSECONDS_PER_SECOND;
+	}
+}
+
+
 //-------------------------------------------------
 //  execute_clocks_to_cycles - convert the number
 //  of clocks to cycles, rounding down if necessary
@@ -372,6 +433,7 @@ void device_execute_interface::interface_validity_check(validity_checker &valid)
 void device_execute_interface::interface_pre_start()
 {
 	m_scheduler = &device().machine().scheduler();
+	m_debug_flags = &device().machine().debug_flags;
 
 	// bind delegates
 	m_vblank_interrupt.resolve();
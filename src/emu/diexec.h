@@ -116,6 +116,12 @@ public:
 	// inline configuration helpers
 	void set_disable() { m_disabled = true; }
 
+	// mark this device as safe to execute on a worker thread when the
+	// scheduler's parallel mode is enabled; only appropriate for loosely-
+	// coupled devices that never touch shared state mid-timeslice
+	void set_parallel_safe(bool safe) { m_parallel_safe = safe; }
+	bool parallel_safe() const { return m_parallel_safe; }
+
 	template <typename... T> void set_vblank_int(const char *tag, T &&... args)
 	{
 		m_vblank_interrupt.set(std::forward<T>(args)...);
@@ -186,6 +192,15 @@ public:
 	attotime local_time() const noexcept;
 	u64 total_cycles() const noexcept;
 
+	// host execution cost accounting; when enabled (explicitly or via the
+	// -profile overlay), tracks host nanoseconds spent in run() per emulated
+	// second, with a short ring-buffer history of completed windows
+	static constexpr int RUN_COST_HISTORY = 16;
+	void set_cost_accounting(bool enabled);
+	bool cost_accounting() const { return m_account_cost; }
+	u64 run_cost_per_second() const { return run_cost_history(0); }
+	u64 run_cost_history(int index) const;
+
 	// required operation overrides
 	void run() { execute_run(); }
 
@@ -228,7 +243,9 @@ protected:
 	bool debugger_enabled() const { return bool(device().machine().debug_flags & DEBUG_FLAG_ENABLED); }
 	void debugger_instruction_hook(offs_t curpc)
 	{
-		if (device().machine().debug_flags & DEBUG_FLAG_CALL_HOOK)
+		// called once per emulated instruction, so go through a cached
+		// pointer to the flags rather than device().machine() each time
+		if (UNEXPECTED(*m_debug_flags & DEBUG_FLAG_CALL_HOOK))
 			device().debug()->instruction_hook(curpc);
 	}
 	void debugger_exception_hook(int exception)
@@ -286,9 +303,11 @@ private:
 
 	// scheduler
 	device_scheduler *      m_scheduler;                // pointer to the machine scheduler
+	const u32 *             m_debug_flags;              // cached pointer to the machine's debug flags
 
 	// configuration
 	bool                    m_disabled;                 // disabled from executing?
+	bool                    m_parallel_safe;            // safe to run on a worker thread in parallel mode?
 	device_interrupt_delegate m_vblank_interrupt;       // for interrupts tied to VBLANK
 	const char *            m_vblank_interrupt_screen;  // the screen that causes the VBLANK interrupt
 	device_interrupt_delegate m_timed_interrupt;        // for interrupts not tied to VBLANK
@@ -316,6 +335,15 @@ private:
 	s32                     m_trigger;                  // pending trigger to release a trigger suspension
 	s32                     m_inttrigger;               // interrupt trigger index
 
+	// host execution cost accounting
+	void account_run_cost(osd_ticks_t ticks, int ran);
+
+	bool                    m_account_cost;             // accumulate host time spent in run()?
+	osd_ticks_t             m_cost_ticks;               // host ticks accumulated in the current window
+	attoseconds_t           m_cost_emutime;             // emulated attoseconds covered by the current window
+	u64                     m_cost_history[RUN_COST_HISTORY]; // completed windows, host ns per emulated second
+	u32                     m_cost_index;               // number of completed windows
+
 	// clock and timing information
 	u64                     m_totalcycles;              // total device cycles executed
 	attotime                m_localtime;                // local time, relative to the timer system's global time
@@ -267,6 +267,28 @@ void device_gfx_interface::decode_gfx(const gfx_decode_entry *gfxdecodeinfo)
 	}
 
 	m_decoded = true;
+
+	// decode everything up front so the first frame doesn't stall on a
+	// mass decode; elements whose sources change later are simply
+	// re-marked dirty and decoded again on demand
+	predecode_all();
+}
+
+
+//-------------------------------------------------
+//  predecode_all - decode all elements of all
+//  gfx up front, spread across a transient
+//  work queue
+//-------------------------------------------------
+
+void device_gfx_interface::predecode_all()
+{
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	for (u8 curgfx = 0; curgfx < MAX_GFX_ELEMENTS; curgfx++)
+		if (m_gfx[curgfx] != nullptr)
+			m_gfx[curgfx]->decode_all(queue);
+	if (queue != nullptr)
+		osd_work_queue_free(queue);
 }
 
 
@@ -911,8 +911,8 @@ done:
 
 image_init_result device_image_interface::load(std::string_view path)
 {
-	// is this a reset on load item?
-	if (is_reset_on_load() && !init_phase())
+	// is this a reset on load item without hot-mount support?
+	if (is_reset_on_load() && !hot_mount_supported() && !init_phase())
 	{
 		reset_and_load(path);
 		return image_init_result::PASS;
@@ -929,7 +929,7 @@ image_init_result device_image_interface::load(std::string_view path)
 image_init_result device_image_interface::load_software(std::string_view software_identifier)
 {
 	// Is this a software part that forces a reset and we're at runtime?  If so, get this loaded through reset_and_load
-	if (is_reset_on_load() && !init_phase())
+	if (is_reset_on_load() && !hot_mount_supported() && !init_phase())
 	{
 		reset_and_load(software_identifier);
 		return image_init_result::PASS;
@@ -140,6 +140,11 @@ public:
 	virtual bool is_creatable() const noexcept = 0;
 	virtual bool must_be_loaded() const noexcept = 0;
 	virtual bool is_reset_on_load() const noexcept = 0;
+	// a reset-on-load device may override this to declare that images can
+	// also be mounted or unmounted at runtime without a machine-wide reset,
+	// e.g. when its call_load performs the full reconfiguration rather than
+	// relying on work done at machine startup
+	virtual bool hot_mount_supported() const noexcept { return false; }
 	virtual bool support_command_line_image_creation() const noexcept;
 	virtual const char *image_interface() const noexcept { return nullptr; }
 	virtual const char *file_extensions() const noexcept = 0;
@@ -33,3 +33,27 @@ device_nvram_interface::device_nvram_interface(const machine_config &mconfig, de
 device_nvram_interface::~device_nvram_interface()
 {
 }
+
+
+//-------------------------------------------------
+//  nvram_image - capture the current NVRAM
+//  contents as they would be written to disk
+//-------------------------------------------------
+
+bool device_nvram_interface::nvram_image(std::vector<u8> &data)
+{
+	// serialize the NVRAM into a growable RAM-backed file
+	emu_file file(OPEN_FLAG_WRITE);
+	if (file.open_ram_write())
+		return false;
+	nvram_write(file);
+
+	// copy the accumulated contents out
+	util::core_file &core = file;
+	const u8 *const bytes = reinterpret_cast<const u8 *>(core.buffer());
+	const u64 length = file.size();
+	if (bytes == nullptr && length != 0)
+		return false;
+	data.assign(bytes, bytes + length);
+	return true;
+}
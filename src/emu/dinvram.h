@@ -38,6 +38,8 @@ public:
 	void nvram_load(emu_file &file) { nvram_read(file); }
 	void nvram_save(emu_file &file) { nvram_write(file); }
 	bool nvram_can_save() { return nvram_can_write(); }
+	bool nvram_image(std::vector<u8> &data);
+	std::vector<u8> &nvram_shadow() { return m_nvram_shadow; }
 
 protected:
 	// derived class overrides
@@ -45,6 +47,10 @@ protected:
 	virtual void nvram_read(emu_file &file) = 0;
 	virtual void nvram_write(emu_file &file) = 0;
 	virtual bool nvram_can_write() { return true; }
+
+private:
+	// last image known to match the on-disk base, used for NVRAM journaling
+	std::vector<u8> m_nvram_shadow;
 };
 
 // iterator
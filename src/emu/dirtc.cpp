@@ -29,7 +29,9 @@ static const int DAYS_PER_MONTH[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31,
 //-------------------------------------------------
 
 device_rtc_interface::device_rtc_interface(const machine_config &mconfig, device_t &device)
-	: device_interface(device, "rtc")
+	: device_interface(device, "rtc"),
+		m_lazy_clock_base(attotime::zero),
+		m_lazy_clock_enabled(false)
 {
 }
 
@@ -219,6 +221,66 @@ void device_rtc_interface::advance_days()
 }
 
 
+//-------------------------------------------------
+//  interface_post_start - register lazy clocking
+//  state for saving
+//-------------------------------------------------
+
+void device_rtc_interface::interface_post_start()
+{
+	device().save_item(NAME(m_lazy_clock_base));
+	device().save_item(NAME(m_lazy_clock_enabled));
+}
+
+
+//-------------------------------------------------
+//  lazy_clock_start - begin counting emulated
+//  time from now; replaces a per-second timer for
+//  devices whose state is only observed on access
+//-------------------------------------------------
+
+void device_rtc_interface::lazy_clock_start()
+{
+	m_lazy_clock_base = device().machine().time();
+	m_lazy_clock_enabled = true;
+}
+
+
+//-------------------------------------------------
+//  lazy_clock_stop - freeze the lazy clock (e.g.
+//  while the host holds the clock for an update)
+//-------------------------------------------------
+
+void device_rtc_interface::lazy_clock_stop()
+{
+	lazy_clock_catch_up();
+	m_lazy_clock_enabled = false;
+}
+
+
+//-------------------------------------------------
+//  lazy_clock_catch_up - advance the clock
+//  registers by the emulated seconds elapsed
+//  since the last catch-up; call before any
+//  register access
+//-------------------------------------------------
+
+void device_rtc_interface::lazy_clock_catch_up()
+{
+	if (!m_lazy_clock_enabled)
+		return;
+
+	seconds_t elapsed = (device().machine().time() - m_lazy_clock_base).seconds();
+	if (elapsed <= 0)
+		return;
+
+	// keep the sub-second remainder in the base so no time is lost
+	m_lazy_clock_base += attotime(elapsed, 0);
+	while (elapsed-- > 0)
+		advance_seconds();
+}
+
+
 //-------------------------------------------------
 //  adjust_seconds -
 //-------------------------------------------------
@@ -65,6 +65,18 @@ protected:
 	void advance_days();
 	void adjust_seconds();
 
+	// lazy clocking: an implementation that exposes no sub-second state can
+	// call lazy_clock_start() once instead of scheduling a per-second timer,
+	// then lazy_clock_catch_up() from each register access; the clock
+	// registers are advanced by however many emulated seconds have elapsed
+	// since the last catch-up
+	void lazy_clock_start();
+	void lazy_clock_stop();
+	void lazy_clock_catch_up();
+
+	// device_interface overrides
+	virtual void interface_post_start() override;
+
 	// derived class overrides
 	virtual bool rtc_feature_y2k() const { return false; }
 	virtual bool rtc_feature_leap_year() const { return false; }
@@ -72,6 +84,11 @@ protected:
 	virtual void rtc_clock_updated(int year, int month, int day, int day_of_week, int hour, int minute, int second) = 0;
 
 	int m_register[7];
+
+private:
+	// lazy clocking state
+	attotime m_lazy_clock_base;
+	bool m_lazy_clock_enabled;
 };
 
 // iterator
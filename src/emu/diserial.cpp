@@ -226,8 +226,9 @@ WRITE_LINE_MEMBER(device_serial_interface::rx_w)
 	{
 		LOGMASKED(LOG_RX, "Receiver is synchronized\n");
 		if(m_rcv_clock && !(m_rcv_rate.is_never()))
-			// make start delay just a bit longer to make sure we are called after the sender
-			m_rcv_clock->adjust(((m_rcv_rate*3)/2), 0, m_rcv_rate);
+			// sample once per bit; the first sample is delayed a bit longer
+			// to make sure we are called after the sender
+			m_rcv_clock->adjust(((m_rcv_rate*5)/2), 0, m_rcv_rate*2);
 		else if(m_start_bit_hack_for_external_clocks)
 			m_rcv_bit_count_received--;
 	}
@@ -370,7 +371,8 @@ void device_serial_interface::transmit_register_setup(u8 data_byte)
 	u8 transmit_data;
 
 	if(m_tra_clock && !m_tra_rate.is_never())
-		m_tra_clock->adjust(m_tra_rate, 0, m_tra_rate);
+		// output once per bit, half a bit period in as before
+		m_tra_clock->adjust(m_tra_rate, 0, m_tra_rate*2);
 
 	m_tra_bit_count_transmitted = 0;
 	m_tra_bit_count = 0;
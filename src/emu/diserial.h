@@ -129,8 +129,11 @@ protected:
 	const char *stop_bits_tostring(stop_bits_t stop_bits);
 
 private:
-	TIMER_CALLBACK_MEMBER(rcv_clock) { rx_clock_w(!m_rcv_clock_state); }
-	TIMER_CALLBACK_MEMBER(tra_clock) { tx_clock_w(!m_tra_clock_state); }
+	// the internal baud timers fire once per bit and drive the shifters
+	// directly; the half-bit clock toggling is only synthesized for genuine
+	// external clocks coming in through tx_clock_w/rx_clock_w
+	TIMER_CALLBACK_MEMBER(rcv_clock) { rcv_edge(); }
+	TIMER_CALLBACK_MEMBER(tra_clock) { tra_edge(); }
 
 	u8 m_serial_parity_table[256];
 
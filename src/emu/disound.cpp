@@ -505,6 +505,10 @@ void device_mixer_interface::sound_stream_update(sound_stream &stream, std::vect
 		if (input.gain() == 0)
 			continue;
 
+		// skip if the source has produced nothing but silence for a while
+		if (stream.input(inputnum).valid() && stream.input(inputnum).source().stream().output_silent())
+			continue;
+
 		// either store or accumulate
 		int outputnum = m_outputmap[inputnum];
 		auto &output = outputs[outputnum];
@@ -238,6 +238,15 @@ void device_vtlb_interface::vtlb_load(int entrynum, int numpages, offs_t address
 	osd_printf_debug("vtlb_load %d for %d pages at %08X == %08X\n", entrynum, numpages, address, value);
 #endif
 
+	// if the identical mapping is already loaded, nothing needs to change;
+	// CPU cores remap all non-global entries on guest context switches, and
+	// most of those reloads (including repeated unmaps) are no-ops - but
+	// only trust this for mappings of at most one page, since
+	// vtlb_flush_address can knock out a middle page of a larger mapping
+	if (numpages <= 1 && m_live[liveindex] == tableindex + 1 && m_fixedpages[entrynum] == numpages
+			&& (numpages == 0 || m_table[tableindex] == (value | VTLB_FLAG_FIXED)))
+		return;
+
 	// if an entry already exists at this index, free it
 	if (m_live[liveindex] != 0)
 	{
@@ -339,6 +339,62 @@ void gfx_element::decode(u32 code)
 }
 
 
+//-------------------------------------------------
+//  decode_all - decode every dirty element up
+//  front, optionally spreading the work across
+//  a queue; each element decodes into its own
+//  slice of the data, pen usage and dirty
+//  arrays, so ranges of codes are independent
+//-------------------------------------------------
+
+void gfx_element::decode_all(osd_work_queue *queue)
+{
+	// for large elements, carve the codes into ranges and queue one work
+	// item per range
+	const u32 batchsize = 1024;
+	if (queue != nullptr && m_total_elements >= 2 * batchsize)
+	{
+		std::vector<decode_batch> batches((m_total_elements + batchsize - 1) / batchsize);
+		u32 first = 0;
+		for (decode_batch &batch : batches)
+		{
+			batch.gfx = this;
+			batch.first = first;
+			batch.count = std::min(batchsize, m_total_elements - first);
+			first += batch.count;
+		}
+		for (decode_batch &batch : batches)
+			osd_work_item_queue(queue, decode_work, &batch, WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+			;
+	}
+
+	// otherwise just walk the dirty array on this thread
+	else
+		for (u32 code = 0; code < m_total_elements; code++)
+			if (m_dirty[code])
+				decode(code);
+}
+
+
+//-------------------------------------------------
+//  decode_work - work queue callback to decode
+//  a range of dirty codes
+//-------------------------------------------------
+
+void *gfx_element::decode_work(void *param, int threadid)
+{
+	decode_batch &batch = *reinterpret_cast<decode_batch *>(param);
+	for (u32 index = 0; index < batch.count; index++)
+	{
+		u32 code = batch.first + index;
+		if (batch.gfx->m_dirty[code])
+			batch.gfx->decode(code);
+	}
+	return nullptr;
+}
+
+
 
 /***************************************************************************
     DRAWGFX IMPLEMENTATIONS
@@ -1933,12 +1989,12 @@ void primask_draw_scanline32(bitmap_rgb32 &bitmap, s32 destx, s32 desty, s32 len
 
 void copybitmap(bitmap_ind16 &dest, const bitmap_ind16 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect)
 {
-	copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, [](u16 &destp, const u16 &srcp) { PIXEL_OP_COPY_OPAQUE(destp, srcp); });
+	copybitmap_opaque_core(dest, src, flipx, flipy, destx, desty, cliprect);
 }
 
 void copybitmap(bitmap_rgb32 &dest, const bitmap_rgb32 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect)
 {
-	copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, [](u32 &destp, const u32 &srcp) { PIXEL_OP_COPY_OPAQUE(destp, srcp); });
+	copybitmap_opaque_core(dest, src, flipx, flipy, destx, desty, cliprect);
 }
 
 void prio_copybitmap(bitmap_ind16 &dest, const bitmap_ind16 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect, bitmap_ind8 &priority, u32 pmask)
@@ -1985,7 +2041,7 @@ void copybitmap_trans(bitmap_ind16 &dest, const bitmap_ind16 &src, int flipx, in
 	if (trans_pen > 0xffff)
 		copybitmap(dest, src, flipx, flipy, destx, desty, cliprect);
 	else
-		copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, [trans_pen](u16 &destp, const u16 &srcp) { PIXEL_OP_COPY_TRANSPEN(destp, srcp); });
+		copybitmap_transpen_core(dest, src, flipx, flipy, destx, desty, cliprect, u16(trans_pen));
 }
 
 void copybitmap_trans(bitmap_rgb32 &dest, const bitmap_rgb32 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect, u32 trans_pen)
@@ -1993,7 +2049,7 @@ void copybitmap_trans(bitmap_rgb32 &dest, const bitmap_rgb32 &src, int flipx, in
 	if (trans_pen == 0xffffffff)
 		copybitmap(dest, src, flipx, flipy, destx, desty, cliprect);
 	else
-		copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, [trans_pen](u32 &destp, const u32 &srcp) { PIXEL_OP_COPY_TRANSPEN(destp, srcp); });
+		copybitmap_transpen_core(dest, src, flipx, flipy, destx, desty, cliprect, trans_pen);
 }
 
 void prio_copybitmap_trans(bitmap_ind16 &dest, const bitmap_ind16 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect, bitmap_ind8 &priority, u32 pmask, u32 trans_pen)
@@ -2047,7 +2103,7 @@ void primask_copybitmap_trans(bitmap_rgb32 &dest, const bitmap_rgb32 &src, int f
 
 void copybitmap_transalpha(bitmap_rgb32 &dest, const bitmap_rgb32 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect)
 {
-	copybitmap_core(dest, src, flipx, flipy, destx, desty, cliprect, [](u32 &destp, const u32 &srcp) { PIXEL_OP_COPY_TRANSALPHA(destp, srcp); });
+	copybitmap_transalpha_core(dest, src, flipx, flipy, destx, desty, cliprect);
 }
 
 void prio_copybitmap_transalpha(bitmap_rgb32 &dest, const bitmap_rgb32 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect, bitmap_ind8 &priority, u32 pmask)
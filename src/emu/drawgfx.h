@@ -186,6 +186,7 @@ public:
 	// operations
 	void mark_dirty(u32 code) { if (code < elements()) { m_dirty[code] = 1; m_dirtyseq++; } }
 	void mark_all_dirty() { memset(&m_dirty[0], 1, elements()); }
+	void decode_all(osd_work_queue *queue = nullptr);
 
 	const u8 *get_data(u32 code)
 	{
@@ -280,8 +281,17 @@ public:
 	void alphatable(bitmap_rgb32 &dest, const rectangle &cliprect, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, int fixedalpha, u8 *alphatable);
 
 private:
+	// a range of codes decoded by a single work item
+	struct decode_batch
+	{
+		gfx_element *   gfx;                // element being decoded
+		u32             first;              // first code in the range
+		u32             count;              // number of codes in the range
+	};
+
 	// internal helpers
 	void decode(u32 code);
+	static void *decode_work(void *param, int threadid);
 
 	// internal state
 	device_palette_interface *m_palette;    // palette used for drawing (optional when used as a pure decoder)
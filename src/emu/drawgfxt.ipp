@@ -1260,6 +1260,173 @@ inline void copybitmap_core(BitmapType &dest, const BitmapType &src, int flipx,
 
 
 
+/***************************************************************************
+    SPECIALIZED COPYBITMAP CORES
+***************************************************************************/
+
+/*
+    The generic copybitmap_core above applies an arbitrary pixel_op, which
+    keeps the compiler from turning the inner loops into straight memory
+    moves or vector selects. The cores below cover the dominant cases --
+    opaque copy, transpen copy, and transalpha copy without priority --
+    with branch-free inner loops that auto-vectorize on any target the
+    compiler supports; everything else falls back to the generic template.
+*/
+
+// shared clipping computation; returns false if the blit is fully clipped
+template <typename BitmapType>
+inline bool copybitmap_clip(const BitmapType &dest, const BitmapType &src, int flipx, int flipy, s32 &destx, s32 &desty, const rectangle &cliprect, s32 &destendx, s32 &destendy, s32 &srcx, s32 &srcy, s32 &dy)
+{
+	assert(dest.valid());
+	assert(src.valid());
+	assert(dest.cliprect().contains(cliprect));
+
+	// ignore empty/invalid cliprects
+	if (cliprect.empty())
+		return false;
+
+	// dy counts pixels in Y
+	dy = src.rowpixels();
+
+	// compute final pixel in X and exit if we are entirely clipped
+	destendx = destx + src.width() - 1;
+	if (destx > cliprect.right() || destendx < cliprect.left())
+		return false;
+
+	// apply left clip
+	srcx = 0;
+	if (destx < cliprect.left())
+	{
+		srcx = cliprect.left() - destx;
+		destx = cliprect.left();
+	}
+
+	// apply right clip
+	if (destendx > cliprect.right())
+		destendx = cliprect.right();
+
+	// compute final pixel in Y and exit if we are entirely clipped
+	destendy = desty + src.height() - 1;
+	if (desty > cliprect.bottom() || destendy < cliprect.top())
+		return false;
+
+	// apply top clip
+	srcy = 0;
+	if (desty < cliprect.top())
+	{
+		srcy = cliprect.top() - desty;
+		desty = cliprect.top();
+	}
+
+	// apply bottom clip
+	if (destendy > cliprect.bottom())
+		destendy = cliprect.bottom();
+
+	// apply X flipping
+	if (flipx)
+		srcx = src.width() - 1 - srcx;
+
+	// apply Y flipping
+	if (flipy)
+	{
+		srcy = src.height() - 1 - srcy;
+		dy = -dy;
+	}
+	return true;
+}
+
+// opaque copy; rows become straight memory moves
+template <typename BitmapType>
+inline void copybitmap_opaque_core(BitmapType &dest, const BitmapType &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect)
+{
+	g_profiler.start(PROFILER_COPYBITMAP);
+
+	s32 destendx, destendy, srcx, srcy, dy;
+	if (copybitmap_clip(dest, src, flipx, flipy, destx, desty, cliprect, destendx, destendy, srcx, srcy, dy))
+	{
+		s32 numpixels = destendx + 1 - destx;
+		const auto *srcdata = &src.pix(srcy, srcx);
+		for (s32 cury = desty; cury <= destendy; cury++)
+		{
+			auto *destptr = &dest.pix(cury, destx);
+			if (!flipx)
+				std::copy_n(srcdata, numpixels, destptr);
+			else
+				std::reverse_copy(srcdata - (numpixels - 1), srcdata + 1, destptr);
+			srcdata += dy;
+		}
+	}
+
+	g_profiler.stop();
+}
+
+// transpen copy; the inner loops are branch-free selects
+template <typename BitmapType>
+inline void copybitmap_transpen_core(BitmapType &dest, const BitmapType &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect, typename BitmapType::pixel_t trans_pen)
+{
+	g_profiler.start(PROFILER_COPYBITMAP);
+
+	s32 destendx, destendy, srcx, srcy, dy;
+	if (copybitmap_clip(dest, src, flipx, flipy, destx, desty, cliprect, destendx, destendy, srcx, srcy, dy))
+	{
+		s32 numpixels = destendx + 1 - destx;
+		const auto *srcdata = &src.pix(srcy, srcx);
+		for (s32 cury = desty; cury <= destendy; cury++)
+		{
+			auto *destptr = &dest.pix(cury, destx);
+			if (!flipx)
+				for (s32 curx = 0; curx < numpixels; curx++)
+				{
+					auto const srcval = srcdata[curx];
+					destptr[curx] = (srcval != trans_pen) ? srcval : destptr[curx];
+				}
+			else
+				for (s32 curx = 0; curx < numpixels; curx++)
+				{
+					auto const srcval = srcdata[-curx];
+					destptr[curx] = (srcval != trans_pen) ? srcval : destptr[curx];
+				}
+			srcdata += dy;
+		}
+	}
+
+	g_profiler.stop();
+}
+
+// transalpha copy; skips pixels with a zero alpha component
+inline void copybitmap_transalpha_core(bitmap_rgb32 &dest, const bitmap_rgb32 &src, int flipx, int flipy, s32 destx, s32 desty, const rectangle &cliprect)
+{
+	g_profiler.start(PROFILER_COPYBITMAP);
+
+	s32 destendx, destendy, srcx, srcy, dy;
+	if (copybitmap_clip(dest, src, flipx, flipy, destx, desty, cliprect, destendx, destendy, srcx, srcy, dy))
+	{
+		s32 numpixels = destendx + 1 - destx;
+		const u32 *srcdata = &src.pix(srcy, srcx);
+		for (s32 cury = desty; cury <= destendy; cury++)
+		{
+			u32 *destptr = &dest.pix(cury, destx);
+			if (!flipx)
+				for (s32 curx = 0; curx < numpixels; curx++)
+				{
+					u32 const srcval = srcdata[curx];
+					destptr[curx] = ((srcval & 0xff000000) != 0) ? srcval : destptr[curx];
+				}
+			else
+				for (s32 curx = 0; curx < numpixels; curx++)
+				{
+					u32 const srcval = srcdata[-curx];
+					destptr[curx] = ((srcval & 0xff000000) != 0) ? srcval : destptr[curx];
+				}
+			srcdata += dy;
+		}
+	}
+
+	g_profiler.stop();
+}
+
+
+
 /***************************************************************************
     BASIC COPYROZBITMAP CORE
 ***************************************************************************/
@@ -152,6 +152,9 @@ class memory_view;
 // declared in emuopts.h
 class emu_options;
 
+// declared in fileio.h
+class emu_file;
+
 // declared in gamedrv.h
 class game_driver;
 
@@ -186,6 +189,9 @@ class machine_config;
 // declared in natkeyboard.h
 class natural_keyboard;
 
+// declared in netplay.h
+class netplay_manager;
+
 // declared in network.h
 class network_manager;
 
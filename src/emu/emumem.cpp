@@ -272,6 +272,14 @@ memory_manager::memory_manager(running_machine &machine)
 
 memory_manager::~memory_manager()
 {
+	// release any shared region mappings; the publisher also removes the
+	// name so a stale object doesn't outlive the last instance using it
+	for (shared_region &shared : m_shared_regions)
+	{
+		osd_shared_mem_unmap(shared.base, shared.bytes);
+		if (shared.created)
+			osd_shared_mem_remove(shared.name.c_str());
+	}
 }
 
 //-------------------------------------------------
@@ -280,6 +288,9 @@ memory_manager::~memory_manager()
 
 void memory_manager::initialize()
 {
+	// attribute memory system allocations when tracking is enabled
+	MAME_ALLOC_SCOPE("memory init");
+
 	// loop over devices and spaces within each device
 	std::vector<device_memory_interface *> memories;
 	for (device_memory_interface &memory : memory_interface_enumerator(machine().root_device()))
@@ -353,6 +364,77 @@ void memory_manager::region_free(std::string name)
 }
 
 
+//-------------------------------------------------
+//  share_rom_regions - back large loaded regions
+//  with named copy-on-write shared mappings keyed
+//  by content hash, so concurrent instances of
+//  the same system share one physical copy
+//-------------------------------------------------
+
+void memory_manager::share_rom_regions()
+{
+	// sharing tiny regions just clutters the host's shared memory namespace
+	constexpr u32 SHARE_MIN_BYTES = 0x10000;
+
+	for (auto &entry : m_regionlist)
+	{
+		memory_region &region = *entry.second;
+		if (region.bytes() < SHARE_MIN_BYTES)
+			continue;
+
+		// key the mapping on the region contents; any difference (other
+		// versions, other sets) simply hashes to a different object
+		util::sha1_creator hasher;
+		hasher.append(region.base(), region.bytes());
+		const util::sha1_t digest = hasher.finish();
+
+		// some hosts limit shared object names to ~30 characters; the
+		// truncated hash is still verified against the full content below
+		std::string name("mame-");
+		name += digest.as_string().substr(0, 24);
+
+		bool created = false;
+		void *base = osd_shared_mem_map(name.c_str(), region.bytes(), created);
+		if (base == nullptr)
+			continue;
+
+		if (created)
+		{
+			// first instance: publish our copy, then remap copy-on-write
+			// so later in-place decryption or patching stays private; the
+			// second view must exist before the first is released or the
+			// object can vanish with its last reference
+			memcpy(base, region.base(), region.bytes());
+			bool dummy = false;
+			void *const cow = osd_shared_mem_map(name.c_str(), region.bytes(), dummy);
+			osd_shared_mem_unmap(base, region.bytes());
+			if (cow == nullptr)
+			{
+				osd_shared_mem_remove(name.c_str());
+				continue;
+			}
+			base = cow;
+		}
+		else
+		{
+			// make sure we didn't attach to a half-written object
+			util::sha1_creator checker;
+			checker.append(base, region.bytes());
+			if (checker.finish() != digest)
+			{
+				osd_shared_mem_unmap(base, region.bytes());
+				continue;
+			}
+		}
+
+		osd_printf_verbose("Backing region '%s' with %s shared mapping %s (%u bytes)\n",
+				region.name(), created ? "new" : "existing", name, region.bytes());
+		region.set_shared_base(reinterpret_cast<u8 *>(base));
+		m_shared_regions.emplace_back(shared_region{ std::move(name), base, region.bytes(), created });
+	}
+}
+
+
 //-------------------------------------------------
 //  anonymous_alloc - allocates a anonymous memory zone
 //-------------------------------------------------
@@ -926,6 +1008,72 @@ memory_passthrough_handler *address_space_installer::install_readwrite_tap(offs_
 }
 
 
+//**************************************************************************
+//  DIRTY PAGE TRACKING
+//**************************************************************************
+
+memory_dirty_tracker::memory_dirty_tracker(address_space &space, offs_t addrstart, offs_t addrend, int page_shift)
+	: m_space(space)
+	, m_addrstart(addrstart)
+	, m_addrend(addrend)
+	, m_page_shift(page_shift)
+	, m_pages(u32(((u64(addrend) - addrstart) >> page_shift) + 1))
+	, m_tap(nullptr)
+	, m_master((m_pages + 63) / 64, 0)
+	, m_master_any(false)
+{
+	// all widths share one marker; the tap sets a single bit in the master
+	// bitmap, so the per-write cost does not grow with subscribers
+	auto const mark = [this] (offs_t offset)
+	{
+		u32 const page = u32((offset - m_addrstart) >> m_page_shift);
+		m_master[page >> 6] |= u64(1) << (page & 63);
+		m_master_any = true;
+	};
+	switch (space.data_width())
+	{
+	case 8:  m_tap = space.install_write_tap(addrstart, addrend, "dirty_tracker", [mark] (offs_t offset, u8  &data, u8  mem_mask) { mark(offset); }); break;
+	case 16: m_tap = space.install_write_tap(addrstart, addrend, "dirty_tracker", [mark] (offs_t offset, u16 &data, u16 mem_mask) { mark(offset); }); break;
+	case 32: m_tap = space.install_write_tap(addrstart, addrend, "dirty_tracker", [mark] (offs_t offset, u32 &data, u32 mem_mask) { mark(offset); }); break;
+	case 64: m_tap = space.install_write_tap(addrstart, addrend, "dirty_tracker", [mark] (offs_t offset, u64 &data, u64 mem_mask) { mark(offset); }); break;
+	}
+}
+
+memory_dirty_tracker::~memory_dirty_tracker()
+{
+	if (m_tap != nullptr)
+		m_tap->remove();
+}
+
+int memory_dirty_tracker::subscribe()
+{
+	m_views.emplace_back((m_pages + 63) / 64, ~u64(0));
+	m_any.push_back(true);
+	return int(m_views.size() - 1);
+}
+
+bool memory_dirty_tracker::dirty(int subscriber)
+{
+	flush();
+	return m_any[subscriber];
+}
+
+void memory_dirty_tracker::flush()
+{
+	if (!m_master_any)
+		return;
+	for (size_t sub = 0; sub < m_views.size(); sub++)
+	{
+		std::vector<u64> &view = m_views[sub];
+		for (size_t word = 0; word < m_master.size(); word++)
+			view[word] |= m_master[word];
+		m_any[sub] = true;
+	}
+	std::fill(m_master.begin(), m_master.end(), 0);
+	m_master_any = false;
+}
+
+
 //**************************************************************************
 //  MEMORY BANK
 //**************************************************************************
@@ -936,11 +1084,13 @@ memory_passthrough_handler *address_space_installer::install_readwrite_tap(offs_
 
 memory_bank::memory_bank(device_t &device, std::string tag)
 	: m_machine(device.machine()),
-	  m_curentry(0)
+	  m_curentry(0),
+	  m_curbase(nullptr)
 {
 	m_tag = std::move(tag);
 	m_name = string_format("Bank '%s'", m_tag);
 	machine().save().save_item(&device, "memory", m_tag.c_str(), 0, NAME(m_curentry));
+	machine().save().register_postload(save_prepost_delegate(FUNC(memory_bank::postload), this));
 }
 
 
@@ -969,6 +1119,7 @@ void memory_bank::set_base(void *base)
 		m_curentry = 0;
 	}
 	m_entries[m_curentry] = reinterpret_cast<u8 *>(base);
+	m_curbase = m_entries[m_curentry];
 }
 
 
@@ -989,6 +1140,18 @@ void memory_bank::set_entry(int entrynum)
 		throw emu_fatalerror("memory_bank::set_entry called for bank '%s' with invalid bank entry %d", m_tag, entrynum);
 
 	m_curentry = entrynum;
+	m_curbase = m_entries[entrynum];
+}
+
+
+//-------------------------------------------------
+//  postload - refresh the cached base after the
+//  current entry has been restored
+//-------------------------------------------------
+
+void memory_bank::postload()
+{
+	m_curbase = (m_curentry < int(m_entries.size())) ? m_entries[m_curentry] : nullptr;
 }
 
 
@@ -1008,6 +1171,8 @@ void memory_bank::configure_entry(int entrynum, void *base)
 
 	// set the entry
 	m_entries[entrynum] = reinterpret_cast<u8 *>(base);
+	if (entrynum == m_curentry)
+		m_curbase = m_entries[entrynum];
 }
 
 
@@ -1023,6 +1188,8 @@ void memory_bank::configure_entries(int startentry, int numentries, void *base,
 	// fill in the requested bank entries
 	for (int entrynum = 0; entrynum < numentries; entrynum ++)
 		m_entries[entrynum + startentry] = reinterpret_cast<u8 *>(base) +  entrynum * stride;
+	if (m_curentry >= startentry && m_curentry < startentry + numentries)
+		m_curbase = m_entries[m_curentry];
 }
 
 
@@ -1038,6 +1205,8 @@ memory_region::memory_region(running_machine &machine, std::string name, u32 len
 	: m_machine(machine),
 		m_name(std::move(name)),
 		m_buffer(length),
+		m_shared_base(nullptr),
+		m_length(length),
 		m_endianness(endian),
 		m_bitwidth(width * 8),
 		m_bytewidth(width)
@@ -727,6 +727,75 @@ private:
 	void remove_handler(handler_entry *handler) { m_handlers.erase(m_handlers.find(handler)); }
 };
 
+// =====================-> Shared dirty-page tracking service
+
+// memory_dirty_tracker watches writes to a range of an address space through
+// a single passthrough tap and maintains a page-granular dirty bitmap that
+// any number of subscribers can consume independently; the per-write cost is
+// a single bit set regardless of the number of subscribers
+class memory_dirty_tracker
+{
+public:
+	// page_shift is in address units; the default gives 1K pages
+	memory_dirty_tracker(address_space &space, offs_t addrstart, offs_t addrend, int page_shift = 10);
+	~memory_dirty_tracker();
+
+	// getters
+	offs_t addrstart() const { return m_addrstart; }
+	offs_t addrend() const { return m_addrend; }
+	int page_shift() const { return m_page_shift; }
+
+	// register an independent consumer of the dirty state; all pages start
+	// out dirty so the subscriber's first pass is a full one
+	int subscribe();
+
+	// true if any page is dirty from this subscriber's point of view
+	bool dirty(int subscriber);
+
+	// hand each dirty address range to the callback and mark it clean
+	template <typename T> void consume(int subscriber, T &&callback)
+	{
+		flush();
+		if (!m_any[subscriber])
+			return;
+		m_any[subscriber] = false;
+
+		// walk the bitmap, coalescing runs of dirty pages into single ranges
+		std::vector<u64> &view = m_views[subscriber];
+		u32 page = 0;
+		while (page < m_pages)
+		{
+			if (!BIT(view[page >> 6], page & 63))
+			{
+				page++;
+				continue;
+			}
+			u32 const first = page;
+			while (page < m_pages && BIT(view[page >> 6], page & 63))
+			{
+				view[page >> 6] &= ~(u64(1) << (page & 63));
+				page++;
+			}
+			callback(m_addrstart + (offs_t(first) << m_page_shift), offs_t(std::min<u64>(m_addrend, u64(m_addrstart) + (u64(page) << m_page_shift) - 1)));
+		}
+	}
+
+private:
+	// fold freshly-written pages into every subscriber's view
+	void flush();
+
+	address_space &     m_space;                // address space being watched
+	offs_t              m_addrstart;            // start of the watched range
+	offs_t              m_addrend;              // end of the watched range
+	int                 m_page_shift;           // log2 of the page size in address units
+	u32                 m_pages;                // number of pages covered
+	memory_passthrough_handler *m_tap;          // the shared write tap
+	std::vector<u64>    m_master;               // pages written since the last flush
+	bool                m_master_any;           // true if the master bitmap has any bits set
+	std::vector<std::vector<u64>> m_views;      // per-subscriber dirty bitmaps
+	std::vector<bool>   m_any;                  // per-subscriber any-dirty flags
+};
+
 // =====================-> Forward declaration for address_space
 
 template<int Width, int AddrShift> class handler_entry_read_unmapped;
@@ -1446,12 +1515,37 @@ public:
 	void check_address_r(offs_t address) {
 		if(address >= m_addrstart_r && address <= m_addrend_r)
 			return;
+
+		// check the recently-hit ranges before walking the dispatch tree;
+		// accesses ping-ponging between a few ranges stay on this path
+		for(u32 i = 0; i != VICTIM_ENTRIES; i++)
+			if(address >= m_victim_r[i].start && address <= m_victim_r[i].end) {
+				std::swap(m_addrstart_r, m_victim_r[i].start);
+				std::swap(m_addrend_r, m_victim_r[i].end);
+				std::swap(m_cache_r, m_victim_r[i].handler);
+				return;
+			}
+
+		// demote the current range and walk the tree
+		m_victim_r[m_victim_next_r] = victim_entry<handler_entry_read<Width, AddrShift>>{ m_addrstart_r, m_addrend_r, m_cache_r };
+		m_victim_next_r = (m_victim_next_r + 1) % VICTIM_ENTRIES;
 		m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
 	}
 
 	void check_address_w(offs_t address) {
 		if(address >= m_addrstart_w && address <= m_addrend_w)
 			return;
+
+		for(u32 i = 0; i != VICTIM_ENTRIES; i++)
+			if(address >= m_victim_w[i].start && address <= m_victim_w[i].end) {
+				std::swap(m_addrstart_w, m_victim_w[i].start);
+				std::swap(m_addrend_w, m_victim_w[i].end);
+				std::swap(m_cache_w, m_victim_w[i].handler);
+				return;
+			}
+
+		m_victim_w[m_victim_next_w] = victim_entry<handler_entry_write<Width, AddrShift>>{ m_addrstart_w, m_addrend_w, m_cache_w };
+		m_victim_next_w = (m_victim_next_w + 1) % VICTIM_ENTRIES;
 		m_root_write->lookup(address, m_addrstart_w, m_addrend_w, m_cache_w);
 	}
 
@@ -1530,6 +1624,15 @@ public:
 	u16 write_qword_unaligned_flags(offs_t address, u64 data, u64 mask) { return memory_write_generic_flags<Width, AddrShift, Endian, 3, false>(wopf(), address, data, mask); }
 
 private:
+	// small fully-associative cache of recently-hit ranges, checked before
+	// re-walking the dispatch tree on a primary range miss
+	static constexpr u32 VICTIM_ENTRIES = 4;
+	template<typename Handler> struct victim_entry {
+		offs_t start = 1;
+		offs_t end = 0;
+		Handler *handler = nullptr;
+	};
+
 	address_space *             m_space;
 
 	offs_t                      m_addrmask;                // address mask
@@ -1540,6 +1643,11 @@ private:
 	handler_entry_read <Width, AddrShift> *m_cache_r;  // read cache
 	handler_entry_write<Width, AddrShift> *m_cache_w;  // write cache
 
+	victim_entry<handler_entry_read <Width, AddrShift>> m_victim_r[VICTIM_ENTRIES]; // recently-hit read ranges
+	victim_entry<handler_entry_write<Width, AddrShift>> m_victim_w[VICTIM_ENTRIES]; // recently-hit write ranges
+	u32                         m_victim_next_r = 0;       // next read victim slot to replace
+	u32                         m_victim_next_w = 0;       // next write victim slot to replace
+
 	handler_entry_read <Width, AddrShift> *m_root_read;  // decode tree roots
 	handler_entry_write<Width, AddrShift> *m_root_write;
 
@@ -2024,6 +2132,23 @@ public:
 	virtual void write_qword_unaligned(offs_t address, u64 data) = 0;
 	virtual void write_qword_unaligned(offs_t address, u64 data, u64 mask) = 0;
 
+	// block accessors for DMA-style transfers; the handler is resolved once
+	// per contiguous range and directly-mapped memory is copied wholesale,
+	// with a per-byte fallback across range boundaries and for I/O handlers;
+	// length is in bytes and must not wrap the end of the space
+	virtual void read_block(offs_t address, void *buffer, size_t length) = 0;
+	virtual void write_block(offs_t address, const void *buffer, size_t length) = 0;
+
+	// region-to-region copy for blitter-style DMA; copies rows of width
+	// bytes, advancing source and destination by their strides between rows
+	// (0 means densely packed), skipping source bytes equal to transpen when
+	// it is non-negative; directly-mapped memory is copied wholesale, while
+	// handler-backed ranges are dispatched at elemwidth (1, 2, 4 or 8
+	// bytes) so FIFOs and latched registers see the same accesses a manual
+	// loop of that width would issue; width must be a multiple of
+	// elemwidth, and transpen requires elemwidth 1
+	virtual void copy_block(offs_t dstaddr, offs_t srcaddr, size_t width, u32 rows = 1, s32 dststride = 0, s32 srcstride = 0, s32 transpen = -1, u8 elemwidth = 1) = 0;
+
 	// read accessors with flags
 	virtual std::pair<u8,  u16> read_byte_flags(offs_t address) = 0;
 	virtual std::pair<u16, u16> read_word_flags(offs_t address) = 0;
@@ -2109,7 +2234,7 @@ public:
 	// getters
 	running_machine &machine() const { return m_machine; }
 	int entry() const { return m_curentry; }
-	void *base() const { return m_entries.empty() ? nullptr : m_entries[m_curentry]; }
+	void *base() const { return m_curbase; }
 	const std::string &tag() const { return m_tag; }
 	const std::string &name() const { return m_name; }
 
@@ -2122,10 +2247,14 @@ public:
 	void set_entry(int entrynum);
 
 private:
+	// internal helpers
+	void postload();
+
 	// internal state
 	running_machine &       m_machine;              // need the machine to free our memory
 	std::vector<u8 *>       m_entries;              // the entries
 	int                     m_curentry;             // current entry
+	u8 *                    m_curbase;              // cached base of the current entry, so base() is a single load
 	std::string             m_name;                 // friendly name for this bank
 	std::string             m_tag;                  // tag for this bank
 };
@@ -2181,18 +2310,22 @@ public:
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	u8 *base() { return (m_buffer.size() > 0) ? &m_buffer[0] : nullptr; }
-	u8 *end() { return base() + m_buffer.size(); }
-	u32 bytes() const { return m_buffer.size(); }
+	u8 *base() { return (m_shared_base != nullptr) ? m_shared_base : ((m_buffer.size() > 0) ? &m_buffer[0] : nullptr); }
+	u8 *end() { return base() + bytes(); }
+	u32 bytes() const { return m_length; }
 	const std::string &name() const { return m_name; }
 
+	// back the region with an externally managed buffer and release the
+	// private copy; used for cross-instance ROM region sharing
+	void set_shared_base(u8 *base) { m_shared_base = base; m_buffer.clear(); m_buffer.shrink_to_fit(); }
+
 	// flag expansion
 	endianness_t endianness() const { return m_endianness; }
 	u8 bitwidth() const { return m_bitwidth; }
 	u8 bytewidth() const { return m_bytewidth; }
 
 	// data access
-	u8 &as_u8(offs_t offset = 0) { return m_buffer[offset]; }
+	u8 &as_u8(offs_t offset = 0) { return base()[offset]; }
 	u16 &as_u16(offs_t offset = 0) { return reinterpret_cast<u16 *>(base())[offset]; }
 	u32 &as_u32(offs_t offset = 0) { return reinterpret_cast<u32 *>(base())[offset]; }
 	u64 &as_u64(offs_t offset = 0) { return reinterpret_cast<u64 *>(base())[offset]; }
@@ -2202,6 +2335,8 @@ private:
 	running_machine &       m_machine;
 	std::string             m_name;
 	std::vector<u8>         m_buffer;
+	u8 *                    m_shared_base;
+	u32                     m_length;
 	endianness_t            m_endianness;
 	u8                      m_bitwidth;
 	u8                      m_bytewidth;
@@ -2326,9 +2461,23 @@ public:
 	memory_region *region_find(std::string name);
 	void region_free(std::string name);
 
+	// back large ROM regions with named copy-on-write shared mappings so
+	// concurrent instances of the same system share one physical copy;
+	// must run after ROM loading but before address maps capture pointers
+	void share_rom_regions();
+
 private:
 	struct stdlib_deleter { void operator()(void *p) const { free(p); } };
 
+	// a region backed by a named shared mapping
+	struct shared_region
+	{
+		std::string name;               // OSD shared memory object name
+		void *      base;               // mapped base pointer
+		size_t      bytes;              // mapped size
+		bool        created;            // true if this instance published the object
+	};
+
 	// internal state
 	running_machine &           m_machine;              // reference to the machine
 
@@ -2336,6 +2485,7 @@ private:
 	std::unordered_map<std::string, std::unique_ptr<memory_bank>>    m_banklist;             // map of banks
 	std::unordered_map<std::string, std::unique_ptr<memory_share>>   m_sharelist;            // map of shares
 	std::unordered_map<std::string, std::unique_ptr<memory_region>>  m_regionlist;           // map of memory regions
+	std::vector<shared_region>                                       m_shared_regions;       // regions backed by shared mappings
 
 	// Allocate the address spaces
 	void allocate(device_memory_interface &memory);
@@ -2426,11 +2576,15 @@ set(address_space *space, std::pair<void *, void *> rw)
 									   m_addrend_r = 0;
 									   m_addrstart_r = 1;
 									   m_cache_r = nullptr;
+									   for(auto &v : m_victim_r)
+										   v = victim_entry<handler_entry_read<Width, AddrShift>>();
 								   }
 								   if(u32(mode) & u32(read_or_write::WRITE)) {
 									   m_addrend_w = 0;
 									   m_addrstart_w = 1;
 									   m_cache_w = nullptr;
+									   for(auto &v : m_victim_w)
+										   v = victim_entry<handler_entry_write<Width, AddrShift>>();
 								   }
 							   });
 	m_root_read  = (handler_entry_read <Width, AddrShift> *)(rw.first);
@@ -2443,6 +2597,10 @@ set(address_space *space, std::pair<void *, void *> rw)
 	m_addrstart_w = 1;
 	m_addrend_w = 0;
 	m_cache_w = nullptr;
+	for(auto &v : m_victim_r)
+		v = victim_entry<handler_entry_read<Width, AddrShift>>();
+	for(auto &v : m_victim_w)
+		v = victim_entry<handler_entry_write<Width, AddrShift>>();
 }
 
 template<int Width, int AddrShift, endianness_t Endian>
@@ -348,6 +348,12 @@ public:
 	}
 
 	virtual ~address_space_specific() {
+		for(auto &entry : m_bank_install_cache) {
+			if(entry.second.first)
+				entry.second.first->unref();
+			if(entry.second.second)
+				entry.second.second->unref();
+		}
 		m_root_read ->unref();
 		m_root_write->unref();
 	}
@@ -386,6 +392,12 @@ public:
 		refs.add(m_nop_w);
 		for(handler_entry *e : m_delayed_unrefs)
 			refs.add(e);
+		for(auto const &entry : m_bank_install_cache) {
+			if(entry.second.first)
+				refs.add(entry.second.first);
+			if(entry.second.second)
+				refs.add(entry.second.second);
+		}
 		refs.propagate();
 		refs.check();
 	}
@@ -427,6 +439,151 @@ public:
 		return m_root_write->get_ptr(address);
 	}
 
+	// read a block, resolving the handler once per contiguous range
+	virtual void read_block(offs_t address, void *buffer, size_t length) override
+	{
+		if(AddrShift != 0)
+			fatalerror("%s: read_block is only supported on byte-addressable spaces\n", m_name);
+
+		u8 *dest = reinterpret_cast<u8 *>(buffer);
+		while(length != 0) {
+			offs_t const masked = address & m_addrmask;
+			offs_t start, end;
+			handler_entry_read<Width, AddrShift> *handler;
+			m_root_read->lookup(masked, start, end, handler);
+
+			// take as much as this range will give us
+			size_t const chunk = std::min<size_t>(length, size_t(end - masked) + 1);
+
+			// directly-mapped memory in host byte order is copied wholesale,
+			// everything else falls back to per-byte dispatch
+			void *const ptr = handler->get_ptr(masked);
+			if(ptr != nullptr && (Width == 0 || Endian == ENDIANNESS_NATIVE))
+				memcpy(dest, ptr, chunk);
+			else
+				for(size_t i = 0; i != chunk; i++)
+					dest[i] = read_byte(masked + i);
+
+			dest += chunk;
+			address += chunk;
+			length -= chunk;
+		}
+	}
+
+	// write a block, resolving the handler once per contiguous range
+	virtual void write_block(offs_t address, const void *buffer, size_t length) override
+	{
+		if(AddrShift != 0)
+			fatalerror("%s: write_block is only supported on byte-addressable spaces\n", m_name);
+
+		const u8 *src = reinterpret_cast<const u8 *>(buffer);
+		while(length != 0) {
+			offs_t const masked = address & m_addrmask;
+			offs_t start, end;
+			handler_entry_write<Width, AddrShift> *handler;
+			m_root_write->lookup(masked, start, end, handler);
+
+			size_t const chunk = std::min<size_t>(length, size_t(end - masked) + 1);
+
+			void *const ptr = handler->get_ptr(masked);
+			if(ptr != nullptr && (Width == 0 || Endian == ENDIANNESS_NATIVE))
+				memcpy(ptr, src, chunk);
+			else
+				for(size_t i = 0; i != chunk; i++)
+					write_byte(masked + i, src[i]);
+
+			src += chunk;
+			address += chunk;
+			length -= chunk;
+		}
+	}
+
+	// copy a block between two ranges of the space, resolving both
+	// handlers once per contiguous chunk
+	virtual void copy_block(offs_t dstaddr, offs_t srcaddr, size_t width, u32 rows, s32 dststride, s32 srcstride, s32 transpen, u8 elemwidth) override
+	{
+		if(AddrShift != 0)
+			fatalerror("%s: copy_block is only supported on byte-addressable spaces\n", m_name);
+		if(elemwidth != 1 && elemwidth != 2 && elemwidth != 4 && elemwidth != 8)
+			fatalerror("%s: copy_block called with invalid element width %d\n", m_name, elemwidth);
+		if(width % elemwidth)
+			fatalerror("%s: copy_block row width %d is not a multiple of element width %d\n", m_name, int(width), elemwidth);
+		if(transpen >= 0 && elemwidth != 1)
+			fatalerror("%s: copy_block transparency is only supported at element width 1\n", m_name);
+
+		for(u32 row = 0; row != rows; row++) {
+			offs_t src = srcaddr;
+			offs_t dst = dstaddr;
+			size_t remaining = width;
+			while(remaining != 0) {
+				offs_t const smasked = src & m_addrmask;
+				offs_t const dmasked = dst & m_addrmask;
+				offs_t sstart, send, dstart, dend;
+				handler_entry_read<Width, AddrShift> *shandler;
+				handler_entry_write<Width, AddrShift> *dhandler;
+				m_root_read->lookup(smasked, sstart, send, shandler);
+				m_root_write->lookup(dmasked, dstart, dend, dhandler);
+
+				// take as much as the smaller of the two ranges will give us
+				size_t chunk = std::min<size_t>(remaining, size_t(send - smasked) + 1);
+				chunk = std::min<size_t>(chunk, size_t(dend - dmasked) + 1);
+
+				void *const sptr = shandler->get_ptr(smasked);
+				void *const dptr = dhandler->get_ptr(dmasked);
+				if(sptr != nullptr && dptr != nullptr && (Width == 0 || Endian == ENDIANNESS_NATIVE)) {
+					if(transpen < 0)
+						memmove(dptr, sptr, chunk);
+					else {
+						// unconditional select so the compiler can vectorize;
+						// re-storing the old value is safe on plain memory
+						u8 const pen = u8(transpen);
+						u8 const *const s = reinterpret_cast<u8 const *>(sptr);
+						u8 *const d = reinterpret_cast<u8 *>(dptr);
+						for(size_t i = 0; i != chunk; i++)
+							d[i] = (s[i] == pen) ? d[i] : s[i];
+					}
+				} else {
+					// dispatch at the element width so handler-backed ends
+					// see the same accesses a manual DMA loop of that width
+					// would issue - a dword copy into a FIFO must pop one
+					// entry, not four masked sub-accesses; a chunk smaller
+					// than one element (a handler boundary splitting an
+					// element) becomes a single dispatched access, which
+					// masks and splits correctly on its own
+					chunk = std::min<size_t>(remaining, std::max<size_t>(elemwidth, chunk - (chunk % elemwidth)));
+					switch(elemwidth) {
+					case 2:
+						for(size_t i = 0; i != chunk; i += 2)
+							write_word(dmasked + i, read_word(smasked + i));
+						break;
+					case 4:
+						for(size_t i = 0; i != chunk; i += 4)
+							write_dword(dmasked + i, read_dword(smasked + i));
+						break;
+					case 8:
+						for(size_t i = 0; i != chunk; i += 8)
+							write_qword(dmasked + i, read_qword(smasked + i));
+						break;
+					default:
+						for(size_t i = 0; i != chunk; i++) {
+							u8 const data = read_byte(smasked + i);
+							if(transpen < 0 || data != u8(transpen))
+								write_byte(dmasked + i, data);
+						}
+						break;
+					}
+				}
+
+				src += chunk;
+				dst += chunk;
+				remaining -= chunk;
+			}
+
+			srcaddr += (srcstride != 0) ? srcstride : s32(width);
+			dstaddr += (dststride != 0) ? dststride : s32(width);
+		}
+	}
+
 	// native read
 	NativeType read_native(offs_t offset, NativeType mask)
 	{
@@ -555,6 +712,12 @@ public:
 
 	std::unordered_set<handler_entry *> m_delayed_unrefs;
 
+	// previously-built bank handlers, reused when the same configuration
+	// is reinstalled; bank-switching drivers thrash install_read_bank and
+	// rebuilding the handlers every switch is pure churn
+	static constexpr size_t BANK_INSTALL_CACHE_MAX = 64;
+	std::map<std::tuple<memory_bank *, memory_bank *, offs_t, offs_t, offs_t, u16>, std::pair<handler_entry_read<Width, AddrShift> *, handler_entry_write<Width, AddrShift> *>> m_bank_install_cache;
+
 private:
 	template<typename READ>
 	void install_read_handler_impl(offs_t addrstart, offs_t addrend, offs_t addrmask, offs_t addrmirror, offs_t addrselect, u64 unitmask, int cswidth, u16 flags, READ &handler_r)
@@ -1232,20 +1395,53 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 	offs_t nstart, nend, nmask, nmirror;
 	check_optimize_mirror("install_bank_generic", addrstart, addrend, addrmirror, nstart, nend, nmask, nmirror);
 
+	// look up or build the handlers for this configuration; on a repeat
+	// install the dispatch update just swaps the cached handlers back in
+	auto const key = std::make_tuple(rbank, wbank, nstart, nend, nmirror, flags);
+	auto cached = m_bank_install_cache.find(key);
+	if (cached == m_bank_install_cache.end())
+	{
+		// bound the cache; evicting only drops our extra reference, any
+		// handler still installed is kept alive by the dispatch table
+		if (m_bank_install_cache.size() >= BANK_INSTALL_CACHE_MAX)
+		{
+			for (auto &entry : m_bank_install_cache)
+			{
+				if (entry.second.first)
+					entry.second.first->unref();
+				if (entry.second.second)
+					entry.second.second->unref();
+			}
+			m_bank_install_cache.clear();
+		}
+
+		cached = m_bank_install_cache.emplace(key, std::make_pair(nullptr, nullptr)).first;
+		if (rbank != nullptr)
+		{
+			auto hand_r = new handler_entry_read_memory_bank<Width, AddrShift>(this, flags, *rbank);
+			hand_r->set_address_info(nstart, nmask);
+			cached->second.first = hand_r;
+		}
+		if (wbank != nullptr)
+		{
+			auto hand_w = new handler_entry_write_memory_bank<Width, AddrShift>(this, flags, *wbank);
+			hand_w->set_address_info(nstart, nmask);
+			cached->second.second = hand_w;
+		}
+	}
+
 	// map the read bank
 	if (rbank != nullptr)
 	{
-		auto hand_r = new handler_entry_read_memory_bank<Width, AddrShift>(this, flags, *rbank);
-		hand_r->set_address_info(nstart, nmask);
-		m_root_read->populate(nstart, nend, nmirror, hand_r);
+		cached->second.first->ref();
+		m_root_read->populate(nstart, nend, nmirror, cached->second.first);
 	}
 
 	// map the write bank
 	if (wbank != nullptr)
 	{
-		auto hand_w = new handler_entry_write_memory_bank<Width, AddrShift>(this, flags, *wbank);
-		hand_w->set_address_info(nstart, nmask);
-		m_root_write->populate(nstart, nend, nmirror, hand_w);
+		cached->second.second->ref();
+		m_root_write->populate(nstart, nend, nmirror, cached->second.second);
 	}
 
 	invalidate_caches(rbank ? wbank ? read_or_write::READWRITE : read_or_write::READ : read_or_write::WRITE);
@@ -60,11 +60,13 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DIFF_DIRECTORY,                             "diff",      OPTION_STRING,     "directory to save hard drive image difference files" },
 	{ OPTION_COMMENT_DIRECTORY,                          "comments",  OPTION_STRING,     "directory to save debugger comments" },
 	{ OPTION_SHARE_DIRECTORY,                            "share",     OPTION_STRING,     "directory to share with emulated machines" },
+	{ OPTION_CACHE_DIRECTORY,                            "cache",     OPTION_STRING,     "directory to save cached data (empty to disable caching)" },
 
 	// state/playback options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE STATE/PLAYBACK OPTIONS" },
 	{ OPTION_STATE,                                      nullptr,     OPTION_STRING,     "saved state to load" },
 	{ OPTION_AUTOSAVE,                                   "0",         OPTION_BOOLEAN,    "automatically restore state on start and save on exit for supported systems" },
+	{ OPTION_NVRAM_JOURNAL,                              "0",         OPTION_BOOLEAN,    "save NVRAM as a pristine base image plus a journal of dirty blocks to reduce write amplification" },
 	{ OPTION_REWIND,                                     "0",         OPTION_BOOLEAN,    "enable rewind savestates" },
 	{ OPTION_REWIND_CAPACITY "(1-2048)",                 "100",       OPTION_INTEGER,    "rewind buffer size in megabytes" },
 	{ OPTION_PLAYBACK ";pb",                             nullptr,     OPTION_STRING,     "playback an input file" },
@@ -91,6 +93,11 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       OPTION_FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         OPTION_BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         OPTION_BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_RUNAHEAD ";ra(0-5)",                        "0",         OPTION_INTEGER,    "run emulation this many frames ahead of the newest inputs and roll back via save states, hiding emulated input lag" },
+	{ OPTION_BENCHSTATS,                                 nullptr,     OPTION_STRING,     "file to write JSON benchmark statistics (speed percentiles and profiler totals) to on exit" },
+	{ OPTION_ADAPTIVE_QUANTUM ";aq",                     "0",         OPTION_BOOLEAN,    "relax the scheduling quantum while emulated devices are not synchronizing (may break tightly-coupled systems)" },
+	{ OPTION_SHARED_ROMS,                                "0",         OPTION_BOOLEAN,    "back large ROM regions with named shared memory so concurrent instances share one physical copy" },
+	{ OPTION_PREWARM,                                    nullptr,     OPTION_STRING,     "comma-separated list of systems whose ROM archives and CHD headers to pre-read into the OS file cache while this system runs" },
 
 	// render options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE RENDER OPTIONS" },
@@ -141,6 +148,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SAMPLES,                                    "1",         OPTION_BOOLEAN,    "enable the use of external samples if available" },
 	{ OPTION_VOLUME ";vol",                              "0",         OPTION_INTEGER,    "sound volume in decibels (-32 min, 0 max)" },
 	{ OPTION_COMPRESSOR,                                 "1",         OPTION_BOOLEAN,    "enable compressor for sound" },
+	{ OPTION_SOUND_UPDATES "(50-1000)",                  "50",        OPTION_INTEGER,    "sound updates mixed and sent to the OSD per second; higher rates allow lower audio latency" },
 	{ OPTION_SPEAKER_REPORT "(0-4)",                     "0",         OPTION_INTEGER,    "print report of speaker ouput maxima (0=none, or 1-4 for more detail)" },
 
 	// input options
@@ -182,6 +190,10 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UPDATEINPAUSE,                              "0",         OPTION_BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                nullptr,     OPTION_STRING,     "script for debugger" },
 	{ OPTION_DEBUGLOG,                                   "0",         OPTION_BOOLEAN,    "write debug console output to debug.log" },
+	{ OPTION_PROFILETRACE,                               nullptr,     OPTION_STRING,     "file to write a Chrome trace-event JSON timeline of profiler scopes to on exit" },
+	{ OPTION_SCHEDTRACE,                                 nullptr,     OPTION_STRING,     "file to record the device execution schedule to for benchmark comparison" },
+	{ OPTION_SCHEDTRACE_REF,                             nullptr,     OPTION_STRING,     "schedule trace to verify this run against, reporting any divergence on exit" },
+	{ OPTION_STARTUP_PROFILE,                            nullptr,     OPTION_STRING,     "file to write ranked JSON of per-phase and per-device machine startup times to" },
 
 	// comm options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE COMM OPTIONS" },
@@ -191,12 +203,19 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_COMM_REMOTE_PORT,                           "15112",     OPTION_STRING,     "remote port to connect to" },
 	{ OPTION_COMM_FRAME_SYNC,                            "0",         OPTION_BOOLEAN,    "sync frames" },
 
+	// netplay options
+	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE NETPLAY OPTIONS" },
+	{ OPTION_NETPLAY,                                    nullptr,     OPTION_STRING,     "lockstep netplay peer as host:port to connect to, or :port to listen on" },
+	{ OPTION_NETPLAY_DELAY "(1-10)",                     "3",         OPTION_INTEGER,    "frames of input delay used to hide network latency during netplay" },
+
 	// misc options
 	{ nullptr,                                           nullptr,     OPTION_HEADER,     "CORE MISC OPTIONS" },
 	{ OPTION_DRC,                                        "1",         OPTION_BOOLEAN,    "enable DRC CPU core if available" },
 	{ OPTION_DRC_USE_C,                                  "0",         OPTION_BOOLEAN,    "force DRC to use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         OPTION_BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         OPTION_BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_WARM_LIST,                              "0",         OPTION_BOOLEAN,    "persist list of translated PCs for DRC warm starts" },
+	{ OPTION_DRC_OPTIMIZE,                               "1",         OPTION_BOOLEAN,    "apply UML optimization passes before backend code generation" },
 	{ OPTION_BIOS,                                       nullptr,     OPTION_STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         OPTION_BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         OPTION_BOOLEAN,    "skip displaying the system information screen at startup" },
@@ -48,10 +48,12 @@
 #define OPTION_DIFF_DIRECTORY       "diff_directory"
 #define OPTION_COMMENT_DIRECTORY    "comment_directory"
 #define OPTION_SHARE_DIRECTORY      "share_directory"
+#define OPTION_CACHE_DIRECTORY      "cache_directory"
 
 // core state/playback options
 #define OPTION_STATE                "state"
 #define OPTION_AUTOSAVE             "autosave"
+#define OPTION_NVRAM_JOURNAL        "nvram_journal"
 #define OPTION_REWIND               "rewind"
 #define OPTION_REWIND_CAPACITY      "rewind_capacity"
 #define OPTION_PLAYBACK             "playback"
@@ -76,6 +78,11 @@
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_RUNAHEAD             "runahead"
+#define OPTION_BENCHSTATS           "benchstats"
+#define OPTION_ADAPTIVE_QUANTUM     "adaptive_quantum"
+#define OPTION_SHARED_ROMS          "shared_roms"
+#define OPTION_PREWARM              "prewarm"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -120,6 +127,7 @@
 #define OPTION_SAMPLES              "samples"
 #define OPTION_VOLUME               "volume"
 #define OPTION_COMPRESSOR           "compressor"
+#define OPTION_SOUND_UPDATES        "sound_updates"
 #define OPTION_SPEAKER_REPORT       "speaker_report"
 
 // core input options
@@ -158,12 +166,18 @@
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
 #define OPTION_DEBUGLOG             "debuglog"
+#define OPTION_PROFILETRACE         "profiletrace"
+#define OPTION_SCHEDTRACE           "schedtrace"
+#define OPTION_SCHEDTRACE_REF       "schedtrace_ref"
+#define OPTION_STARTUP_PROFILE      "startup_profile"
 
 // core misc options
 #define OPTION_DRC                  "drc"
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_WARM_LIST        "drc_warm_list"
+#define OPTION_DRC_OPTIMIZE         "drc_optimize"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
@@ -179,6 +193,10 @@
 #define OPTION_COMM_REMOTE_PORT     "comm_remoteport"
 #define OPTION_COMM_FRAME_SYNC      "comm_framesync"
 
+// core netplay options
+#define OPTION_NETPLAY              "netplay"
+#define OPTION_NETPLAY_DELAY        "netplay_delay"
+
 #define OPTION_CONFIRM_QUIT         "confirm_quit"
 #define OPTION_UI_MOUSE             "ui_mouse"
 
@@ -333,10 +351,12 @@ public:
 	const char *diff_directory() const { return value(OPTION_DIFF_DIRECTORY); }
 	const char *comment_directory() const { return value(OPTION_COMMENT_DIRECTORY); }
 	const char *share_directory() const { return value(OPTION_SHARE_DIRECTORY); }
+	const char *cache_directory() const { return value(OPTION_CACHE_DIRECTORY); }
 
 	// core state/playback options
 	const char *state() const { return value(OPTION_STATE); }
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
+	bool nvram_journal() const { return bool_value(OPTION_NVRAM_JOURNAL); }
 	int rewind() const { return bool_value(OPTION_REWIND); }
 	int rewind_capacity() const { return int_value(OPTION_REWIND_CAPACITY); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
@@ -361,6 +381,11 @@ public:
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	int runahead() const { return int_value(OPTION_RUNAHEAD); }
+	const char *bench_stats() const { return value(OPTION_BENCHSTATS); }
+	bool adaptive_quantum() const { return bool_value(OPTION_ADAPTIVE_QUANTUM); }
+	bool shared_roms() const { return bool_value(OPTION_SHARED_ROMS); }
+	const char *prewarm() const { return value(OPTION_PREWARM); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -405,6 +430,7 @@ public:
 	bool samples() const { return bool_value(OPTION_SAMPLES); }
 	int volume() const { return int_value(OPTION_VOLUME); }
 	bool compressor() const { return bool_value(OPTION_COMPRESSOR); }
+	int sound_updates() const { return int_value(OPTION_SOUND_UPDATES); }
 	int speaker_report() const { return int_value(OPTION_SPEAKER_REPORT); }
 
 	// core input options
@@ -441,12 +467,18 @@ public:
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
 	bool debuglog() const { return bool_value(OPTION_DEBUGLOG); }
+	const char *profile_trace() const { return value(OPTION_PROFILETRACE); }
+	const char *sched_trace() const { return value(OPTION_SCHEDTRACE); }
+	const char *sched_trace_ref() const { return value(OPTION_SCHEDTRACE_REF); }
+	const char *startup_profile() const { return value(OPTION_STARTUP_PROFILE); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_warm_list() const { return bool_value(OPTION_DRC_WARM_LIST); }
+	bool drc_optimize() const { return bool_value(OPTION_DRC_OPTIMIZE); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
@@ -462,6 +494,10 @@ public:
 	const char *comm_remoteport() const { return value(OPTION_COMM_REMOTE_PORT); }
 	bool comm_framesync() const { return bool_value(OPTION_COMM_FRAME_SYNC); }
 
+	// core netplay options
+	const char *netplay() const { return value(OPTION_NETPLAY); }
+	int netplay_delay() const { return int_value(OPTION_NETPLAY_DELAY); }
+
 
 	bool confirm_quit() const { return bool_value(OPTION_CONFIRM_QUIT); }
 	bool ui_mouse() const { return bool_value(OPTION_UI_MOUSE); }
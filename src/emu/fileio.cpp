@@ -279,15 +279,39 @@ util::hash_collection &emu_file::hashes(std::string_view types)
 		return m_hashes;
 	}
 
-	// read the data if we can
-	const u8 *filedata = (const u8 *)m_file->buffer();
-	if (filedata == nullptr)
+	// otherwise, stream the file through the hash engines in chunks;
+	// buffering the whole file would double the resident size of large
+	// ROMs just to hash them
+	std::uint64_t length;
+	if (m_file->length(length))
+		return m_hashes;
+	std::uint64_t const origin = tell();
+	if (m_file->seek(0, SEEK_SET))
 		return m_hashes;
+	constexpr std::uint64_t CHUNK_SIZE = 1 << 20;
+	std::vector<u8> chunk(std::size_t((std::min)(length, CHUNK_SIZE)));
+	m_hashes.begin(needed.c_str());
+	std::uint64_t remaining = length;
+	while (remaining != 0)
+	{
+		std::size_t const block = std::size_t((std::min)(remaining, std::uint64_t(chunk.size())));
+		std::size_t actual = 0;
+		if (m_file->read(&chunk[0], block, actual) || (actual != block))
+		{
+			// on a read error, drop everything rather than reporting
+			// hashes of partial data
+			m_hashes.end();
+			m_hashes.reset();
+			m_file->seek(origin, SEEK_SET);
+			return m_hashes;
+		}
+		m_hashes.buffer(&chunk[0], actual);
+		remaining -= actual;
+	}
+	m_hashes.end();
 
-	// compute the hash
-	std::uint64_t length;
-	if (!m_file->length(length))
-		m_hashes.compute(filedata, length, needed.c_str());
+	// put the file position back where we found it
+	m_file->seek(origin, SEEK_SET);
 	return m_hashes;
 }
 
@@ -409,6 +433,22 @@ std::error_condition emu_file::open_ram(const void *data, u32 length)
 }
 
 
+//-------------------------------------------------
+//  open_ram_write - open an empty "file" in RAM
+//  which grows as it is written
+//-------------------------------------------------
+
+std::error_condition emu_file::open_ram_write()
+{
+	// set a fake filename and CRC
+	m_filename = "RAM";
+	m_crc = 0;
+
+	// use the core_file's built-in RAM support
+	return util::core_file::open_ram_write(m_openflags, m_file);
+}
+
+
 //-------------------------------------------------
 //  close - close a file and free all data; also
 //  remove the file if requested
@@ -165,6 +165,7 @@ public:
 	std::error_condition open(const char *name, u32 crc) { return open(std::string(name), crc); }
 	std::error_condition open_next();
 	std::error_condition open_ram(const void *data, u32 length);
+	std::error_condition open_ram_write();
 	void close();
 
 	// position
@@ -15,8 +15,7 @@
 #include "emuopts.h"
 
 #include "hash.h"
-
-#include <pugixml.hpp>
+#include "xmlfile.h"
 
 
 /*-------------------------------------------------
@@ -30,33 +29,78 @@ static bool read_hash_config(const char *hash_path, const util::hash_collection
 	if (file.open(std::string(sysname) + ".hsi"))
 		return false;
 
-	pugi::xml_document doc;
-
-	pugi::xml_parse_result res = doc.load_file(file.fullpath());
-	if (res)
+	// scan for a <hash> element with matching checksums; a CRC32+SHA1 match
+	// wins outright, while a CRC32-only match is kept as a fallback
+	const std::string crc = hashes.internal_string().substr(1, 8);
+	const std::string sha1 = hashes.internal_string().substr(10, 40);
+
+	int depth = 0;
+	bool crc_matched = false, sha1_matched = false, in_extrainfo = false;
+	bool found_exact = false, found_partial = false;
+	std::string text, partial_result;
+
+	util::xml::parser scanner;
+	scanner.element_start =
+			[&] (std::string_view name, util::xml::parser::attribute_list const &attributes)
+			{
+				depth++;
+				if (depth == 2 && name == "hash")
+				{
+					std::string_view attr_crc, attr_sha1;
+					for (const auto &attr : attributes)
+					{
+						if (attr.first == "crc32")
+							attr_crc = attr.second;
+						else if (attr.first == "sha1")
+							attr_sha1 = attr.second;
+					}
+					crc_matched = (attr_crc == crc);
+					sha1_matched = (attr_sha1 == sha1);
+				}
+				else if (depth == 3 && crc_matched && name == "extrainfo")
+				{
+					in_extrainfo = true;
+					text.clear();
+				}
+				return true;
+			};
+	scanner.content =
+			[&] (std::string_view data)
+			{
+				if (in_extrainfo)
+					text.append(data);
+				return true;
+			};
+	scanner.element_end =
+			[&] (std::string_view name)
+			{
+				if (in_extrainfo && depth == 3)
+				{
+					in_extrainfo = false;
+					if (sha1_matched)
+					{
+						// a full match ends the scan early
+						result = text;
+						found_exact = true;
+						return false;
+					}
+					else if (!found_partial)
+					{
+						partial_result = text;
+						found_partial = true;
+					}
+				}
+				depth--;
+				return true;
+			};
+	scanner.parse(file);
+
+	if (found_exact)
+		return true;
+	if (found_partial)
 	{
-		// Do search by CRC32 and SHA1
-		std::string query = "/hashfile/hash[";
-		auto crc = hashes.internal_string().substr(1,8);
-		auto sha1 = hashes.internal_string().substr(10, 40);
-		query += "@crc32='" + crc + "' and @sha1='" + sha1 + "']/extrainfo";
-		pugi::xpath_node_set tools = doc.select_nodes(query.c_str());
-		for (pugi::xpath_node_set::const_iterator it = tools.begin(); it != tools.end(); ++it)
-		{
-			result = it->node().first_child().value();
-			return true;
-		}
-
-		// Try search by CRC32 only
-		query = "/hashfile/hash[";
-		query += "@crc32='" + crc + "']/extrainfo";
-		tools = doc.select_nodes(query.c_str());
-		for (pugi::xpath_node_set::const_iterator it = tools.begin(); it != tools.end(); ++it)
-		{
-			result = it->node().first_child().value();
-			return true;
-		}
-
+		result = partial_result;
+		return true;
 	}
 	return false;
 }
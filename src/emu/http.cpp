@@ -575,3 +575,17 @@ void http_manager::remove_endpoint(const std::string &path) {
 
 	m_endpoints.erase(path);
 }
+
+void http_manager::broadcast(const std::string &path, std::shared_ptr<const std::string> payload, int opcode) {
+	if (!m_active) return;
+
+	std::lock_guard<std::mutex> lock(m_endpoints_mutex);
+
+	auto i = m_endpoints.find(path);
+	if (i == m_endpoints.end()) return;
+
+	auto endpoint_impl = std::static_pointer_cast<websocket_endpoint_impl>((*i).second);
+	for (const auto &connection : endpoint_impl->m_endpoint->get_connections()) {
+		m_wsserver->send_shared(connection, payload, nullptr, opcode | 0x80);
+	}
+}
@@ -155,6 +155,11 @@ public:
 	/** Removes the websocket endpoint at the specified path. */
 	void remove_endpoint(const std::string &path);
 
+	/** Sends a message to every connection open on the websocket endpoint at the specified path.
+	 * The payload buffer is shared between the connections rather than copied per client, so
+	 * streaming the same data to many clients costs one buffer regardless of the client count. */
+	void broadcast(const std::string &path, std::shared_ptr<const std::string> payload, int opcode);
+
 	bool is_active() {
 		return m_active;
 	}
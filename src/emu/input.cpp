@@ -992,6 +992,12 @@ const char *input_manager::standard_token(input_item_id itemid) const
 
 bool input_manager::seq_pressed(const input_seq &seq)
 {
+	// fast path for the dominant case of a sequence holding a single code;
+	// this is called for every digital field every frame
+	input_code const code0 = seq[0];
+	if ((seq[1] == input_seq::end_code) && !code0.internal())
+		return code_pressed(code0);
+
 	// iterate over all of the codes
 	bool result = false;
 	bool invert = false;
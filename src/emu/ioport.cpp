@@ -98,6 +98,7 @@
 #include "ui/uimain.h"
 #include "inputdev.h"
 #include "natkeyboard.h"
+#include "netplay.h"
 
 #include "util/corestr.h"
 #include "util/ioprocsfilter.h"
@@ -124,6 +125,9 @@ namespace {
 
 const int SPACE_COUNT = 3;
 
+// frames between sync points in delta-framed INP recordings
+const u32 SYNC_POINT_FRAMES = 600;
+
 
 
 //**************************************************************************
@@ -1516,6 +1520,10 @@ ioport_value ioport_port::read()
 	if (!manager().safe_to_read())
 		throw emu_fatalerror("Input ports cannot be read at init time!");
 
+	// serve repeated polls within a frame from the cached value
+	if (m_live->cached_valid)
+		return m_live->cached;
+
 	// start with the digital state
 	ioport_value result = m_live->digital;
 
@@ -1530,6 +1538,14 @@ ioport_value ioport_port::read()
 	for (analog_field &analog : m_live->analoglist)
 		analog.read(result);
 
+	// ports with no dynamic read or analog fields cannot change until the
+	// next frame update, so the result can be cached
+	if (m_live->readlist.empty() && m_live->analoglist.empty())
+	{
+		m_live->cached = result;
+		m_live->cached_valid = true;
+	}
+
 	return result;
 }
 
@@ -1554,6 +1570,9 @@ void ioport_port::write(ioport_value data, ioport_value mem_mask)
 
 void ioport_port::frame_update()
 {
+	// the cached value is stale once new input state comes in
+	m_live->cached_valid = false;
+
 	// start with 0 values for the digital bits
 	m_live->digital = 0;
 
@@ -1655,6 +1674,9 @@ void ioport_port::init_live_state()
 
 void ioport_port::update_defvalue(bool flush_defaults)
 {
+	// the cached value folds in the default value, so it goes stale too
+	m_live->cached_valid = false;
+
 	// only clear on the first pass
 	if (flush_defaults)
 		m_live->defvalue = 0;
@@ -1678,7 +1700,9 @@ void ioport_port::update_defvalue(bool flush_defaults)
 ioport_port_live::ioport_port_live(ioport_port &port)
 	: defvalue(0),
 		digital(0),
-		outputvalue(0)
+		outputvalue(0),
+		cached(0),
+		cached_valid(false)
 {
 	// iterate over fields
 	for (ioport_field &field : port.fields())
@@ -1720,6 +1744,13 @@ ioport_manager::ioport_manager(running_machine &machine)
 	, m_playback_file(machine.options().input_directory(), OPEN_FLAG_READ)
 	, m_playback_accumulated_speed(0)
 	, m_playback_accumulated_frames(0)
+	, m_playback_delta(false)
+	, m_playback_port_index(0)
+	, m_playback_pending_index(0xffff)
+	, m_record_port_index(0)
+	, m_record_frame_count(0)
+	, m_macro_timer(nullptr)
+	, m_macro_index(0)
 	, m_deselected_card_config()
 {
 	for (auto &entries : m_type_to_entry)
@@ -2098,6 +2129,9 @@ void ioport_manager::frame_update()
 		playback_port(*port.second.get());
 		record_port(*port.second.get());
 
+		// exchange digital state with the netplay peer
+		netplay_port(*port.second.get());
+
 		// call device line write handlers
 		ioport_value newvalue = port.second->read();
 		for (dynamic_field &dynfield : port.second->live().writelist)
@@ -2105,6 +2139,10 @@ void ioport_manager::frame_update()
 				dynfield.write(newvalue);
 	}
 
+	// advance the netplay lockstep pipeline
+	if (machine().netplay() != nullptr)
+		machine().netplay()->frame_update();
+
 	g_profiler.stop();
 }
 
@@ -2811,6 +2849,10 @@ time_t ioport_manager::playback_init()
 		fatalerror("Input file invalid or in an older, unsupported format\n");
 	if (header.get_majversion() != inp_header::MAJVERSION)
 		fatalerror("Input file format version mismatch\n");
+	m_playback_delta = header.get_minversion() >= inp_header::MINVERSION_DELTA;
+
+	// reset the delta decoder
+	m_playback_snapshot.clear();
 
 	// output info to console
 	osd_printf_info("Input file: %s\n", filename);
@@ -2824,8 +2866,8 @@ time_t ioport_manager::playback_init()
 	if (sysname != machine().system().name)
 		osd_printf_info("Input file is for machine '%s', not for current machine '%s'\n", sysname, machine().system().name);
 
-	// enable compression
-	m_playback_stream = util::zlib_read(m_playback_file, 16386);
+	// enable compression, reading ahead of the decompressor on a worker thread
+	m_playback_stream = util::zlib_read(util::read_stream_read_ahead(m_playback_file, 65536), 16386);
 	return basetime;
 }
 
@@ -2886,6 +2928,26 @@ void ioport_manager::playback_frame(const attotime &curtime)
 		u32 curspeed;
 		m_playback_accumulated_speed += playback_read(curspeed);
 		m_playback_accumulated_frames++;
+
+		// delta-framed streams carry a flag byte and periodic sync points
+		if (m_playback_delta)
+		{
+			u8 flags;
+			playback_read(flags);
+			if (flags & 0x01)
+			{
+				u32 syncframe = 0;
+				u64 synchash = 0;
+				playback_read(syncframe);
+				playback_read(synchash);
+				if (m_playback_stream && synchash != input_state_hash())
+					playback_end(util::string_format("Sync point mismatch at frame %u", syncframe).c_str());
+			}
+
+			// fetch the first port carrying changes this frame
+			playback_read(m_playback_pending_index);
+			m_playback_port_index = 0;
+		}
 	}
 }
 
@@ -2899,6 +2961,30 @@ void ioport_manager::playback_port(ioport_port &port)
 	// if playing back, fetch information about this port
 	if (m_playback_stream)
 	{
+		// in delta-framed streams, ports that did not change carry no data;
+		// the local frame_update has already recomputed the port from host
+		// inputs, so re-apply the last recorded state or held inputs would
+		// release themselves one frame after they were recorded
+		u16 const index = m_playback_port_index++;
+		if (m_playback_delta && index != m_playback_pending_index)
+		{
+			if (index < m_playback_snapshot.size())
+			{
+				std::vector<s64> const &state = m_playback_snapshot[index];
+				size_t pos = 0;
+				port.live().defvalue = ioport_value(state[pos++]);
+				port.live().digital = ioport_value(state[pos++]);
+				for (analog_field &analog : port.live().analoglist)
+				{
+					analog.m_accum = s32(state[pos++]);
+					analog.m_previous = s32(state[pos++]);
+					analog.m_sensitivity = s32(state[pos++]);
+					analog.m_reverse = bool(state[pos++]);
+				}
+			}
+			return;
+		}
+
 		// read the default value and the digital state
 		playback_read(port.live().defvalue);
 		playback_read(port.live().digital);
@@ -2914,6 +3000,28 @@ void ioport_manager::playback_port(ioport_port &port)
 			playback_read(analog.m_sensitivity);
 			playback_read(analog.m_reverse);
 		}
+
+		if (m_playback_delta)
+		{
+			// snapshot what was applied so skipped frames can restore it
+			std::vector<s64> state;
+			state.reserve(2 + port.live().analoglist.size() * 4);
+			state.push_back(port.live().defvalue);
+			state.push_back(port.live().digital);
+			for (analog_field &analog : port.live().analoglist)
+			{
+				state.push_back(analog.m_accum);
+				state.push_back(analog.m_previous);
+				state.push_back(analog.m_sensitivity);
+				state.push_back(analog.m_reverse);
+			}
+			if (index >= m_playback_snapshot.size())
+				m_playback_snapshot.resize(index + 1);
+			m_playback_snapshot[index] = std::move(state);
+
+			// fetch the next port with changes (0xffff terminates the frame)
+			playback_read(m_playback_pending_index);
+		}
 	}
 }
 
@@ -2982,6 +3090,10 @@ void ioport_manager::record_init()
 	// write it
 	header.write(m_record_file);
 
+	// reset the delta encoder
+	m_record_snapshot.clear();
+	m_record_frame_count = 0;
+
 	// enable compression
 	m_record_stream = util::zlib_write(m_record_file, 6, 16384);
 }
@@ -3017,12 +3129,29 @@ void ioport_manager::record_frame(const attotime &curtime)
 	// if recording, record information about the current frame
 	if (m_record_stream)
 	{
+		// close out the previous frame's delta list
+		if (m_record_frame_count != 0)
+			record_write(u16(0xffff));
+
 		// first the absolute time
 		record_write(curtime.seconds());
 		record_write(curtime.attoseconds());
 
 		// then the current speed
 		record_write(u32(machine().video().speed_percent() * double(1 << 20)));
+
+		// flag byte, plus a periodic sync point carrying the frame number
+		// and a hash of the complete input state so playback can report
+		// divergence with frame accuracy instead of drifting silently
+		u8 const flags = (m_record_frame_count % SYNC_POINT_FRAMES == 0) ? 0x01 : 0x00;
+		record_write(flags);
+		if (flags & 0x01)
+		{
+			record_write(m_record_frame_count);
+			record_write(input_state_hash());
+		}
+		m_record_frame_count++;
+		m_record_port_index = 0;
 	}
 }
 
@@ -3036,7 +3165,28 @@ void ioport_manager::record_port(ioport_port &port)
 	// if recording, store information about this port
 	if (m_record_stream)
 	{
-		// store the default value and digital state
+		// flatten the current port state for comparison
+		std::vector<s64> state;
+		state.reserve(2 + port.live().analoglist.size() * 4);
+		state.push_back(port.live().defvalue);
+		state.push_back(port.live().digital);
+		for (analog_field &analog : port.live().analoglist)
+		{
+			state.push_back(analog.m_accum);
+			state.push_back(analog.m_previous);
+			state.push_back(analog.m_sensitivity);
+			state.push_back(analog.m_reverse);
+		}
+
+		// only ports that changed since last written carry data
+		u16 const index = m_record_port_index++;
+		if (index >= m_record_snapshot.size())
+			m_record_snapshot.resize(index + 1);
+		if (m_record_snapshot[index] == state)
+			return;
+
+		// store the port index, then the default value and digital state
+		record_write(index);
 		record_write(port.live().defvalue);
 		record_write(port.live().digital);
 
@@ -3051,7 +3201,122 @@ void ioport_manager::record_port(ioport_port &port)
 			record_write(analog.m_sensitivity);
 			record_write(analog.m_reverse);
 		}
+		m_record_snapshot[index] = std::move(state);
+	}
+}
+
+
+//-------------------------------------------------
+//  input_state_hash - compute an FNV-1a hash of
+//  the live state of every port, used to verify
+//  sync points during delta-framed playback
+//-------------------------------------------------
+
+u64 ioport_manager::input_state_hash()
+{
+	u64 hash = 0xcbf29ce484222325U;
+	auto const mix = [&hash] (u64 value)
+	{
+		for (unsigned byte = 0; byte < 8; byte++)
+			hash = (hash ^ ((value >> (8 * byte)) & 0xff)) * 0x00000100000001b3U;
+	};
+	for (auto &port : m_portlist)
+	{
+		mix(port.second->live().defvalue);
+		mix(port.second->live().digital);
+		for (analog_field &analog : port.second->live().analoglist)
+		{
+			mix(u32(analog.m_accum));
+			mix(u32(analog.m_previous));
+			mix(u32(analog.m_sensitivity));
+			mix(analog.m_reverse ? 1 : 0);
+		}
 	}
+	return hash;
+}
+
+
+//-------------------------------------------------
+//  netplay_port - substitute the digital state
+//  both netplay machines agreed to apply on this
+//  frame for a single port
+//-------------------------------------------------
+
+void ioport_manager::netplay_port(ioport_port &port)
+{
+	netplay_manager *const netplay = machine().netplay();
+	if (netplay != nullptr && netplay->active())
+		port.live().digital = netplay->exchange_digital(port.live().digital);
+}
+
+
+
+//**************************************************************************
+//  MACRO PLAYBACK
+//**************************************************************************
+
+//-------------------------------------------------
+//  play_macro - begin playing a compiled input
+//  macro; transitions are driven entirely by a
+//  scheduler timer, so playback has no per-frame
+//  cost regardless of the macro's length
+//-------------------------------------------------
+
+void ioport_manager::play_macro(std::vector<ioport_macro_step> &&steps)
+{
+	// cancel anything already playing
+	stop_macro();
+	if (steps.empty())
+		return;
+
+	// lazily allocate the timer on first use
+	if (m_macro_timer == nullptr)
+		m_macro_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(ioport_manager::macro_timer_expired), this));
+
+	// take ownership of the stream and schedule the first step
+	m_macro_steps = std::move(steps);
+	m_macro_index = 0;
+	m_macro_timer->adjust(m_macro_steps[0].delay);
+}
+
+
+//-------------------------------------------------
+//  stop_macro - cancel any macro in progress,
+//  leaving field values as last applied
+//-------------------------------------------------
+
+void ioport_manager::stop_macro()
+{
+	if (m_macro_timer != nullptr)
+		m_macro_timer->reset();
+	m_macro_steps.clear();
+	m_macro_index = 0;
+}
+
+
+//-------------------------------------------------
+//  macro_timer_expired - apply the next macro
+//  step(s) and reschedule for the following one
+//-------------------------------------------------
+
+void ioport_manager::macro_timer_expired(void *ptr, s32 param)
+{
+	// apply the due step plus any simultaneous (zero-delay) followers
+	do
+	{
+		ioport_macro_step &step = m_macro_steps[m_macro_index++];
+		step.field->set_value(step.value);
+
+		// refresh the port immediately so reads later in this frame see
+		// the new state rather than waiting for the next frame update
+		step.field->port().frame_update();
+	} while (m_macro_index < m_macro_steps.size() && m_macro_steps[m_macro_index].delay == attotime::zero);
+
+	// schedule the next transition, or finish
+	if (m_macro_index < m_macro_steps.size())
+		m_macro_timer->adjust(m_macro_steps[m_macro_index].delay);
+	else
+		stop_macro();
 }
 
 
@@ -670,7 +670,10 @@ class inp_header
 public:
 	// parameters
 	static constexpr unsigned MAJVERSION = 3;
-	static constexpr unsigned MINVERSION = 0;
+	static constexpr unsigned MINVERSION = 1;
+
+	// minor version that introduced delta-framed port data and sync points
+	static constexpr unsigned MINVERSION_DELTA = 1;
 
 	bool read(emu_file &f)
 	{
@@ -1356,6 +1359,20 @@ struct ioport_port_live
 	ioport_value            defvalue;           // combined default value across the port
 	ioport_value            digital;            // current value from all digital inputs
 	ioport_value            outputvalue;        // current value for outputs
+	ioport_value            cached;             // cached read value for ports with no dynamic/analog fields
+	bool                    cached_valid;       // true if the cached value is current for this frame
+};
+
+
+// ======================> ioport_macro_step
+
+// a single step in a compiled input macro: after the given delay from the
+// previous step, apply the value to the field
+struct ioport_macro_step
+{
+	ioport_field *          field;              // field to update
+	ioport_value            value;              // value to apply (0 releases a digital field)
+	attotime                delay;              // delay relative to the previous step
 };
 
 
@@ -1396,6 +1413,11 @@ public:
 	ioport_type token_to_input_type(const char *string, int &player) const;
 	std::string input_type_to_token(ioport_type type, int player);
 
+	// macro playback
+	void play_macro(std::vector<ioport_macro_step> &&steps);
+	void stop_macro();
+	bool macro_active() const noexcept { return m_macro_index < m_macro_steps.size(); }
+
 private:
 	// internal helpers
 	void init_port_types();
@@ -1432,6 +1454,12 @@ private:
 	void record_frame(const attotime &curtime);
 	void record_port(ioport_port &port);
 
+	u64 input_state_hash();
+
+	void netplay_port(ioport_port &port);
+
+	void macro_timer_expired(void *ptr, s32 param);
+
 	// internal state
 	running_machine &       m_machine;              // reference to owning machine
 	bool                    m_safe_to_read;         // clear at start; set after state is loaded
@@ -1456,6 +1484,20 @@ private:
 	u64                     m_playback_accumulated_speed; // accumulated speed during playback
 	u32                     m_playback_accumulated_frames; // accumulated frames during playback
 
+	// delta-framed INP state (format 3.1)
+	bool                    m_playback_delta;       // playback stream uses delta framing
+	u16                     m_playback_port_index;  // index of the port being updated this frame
+	u16                     m_playback_pending_index; // next port with recorded changes (0xffff = none)
+	std::vector<std::vector<s64>> m_playback_snapshot; // per-port values as last read, re-applied to skipped ports
+	u16                     m_record_port_index;    // index of the port being written this frame
+	u32                     m_record_frame_count;   // frames written so far
+	std::vector<std::vector<s64>> m_record_snapshot; // per-port values as last written
+
+	// macro playback
+	emu_timer *             m_macro_timer;          // timer driving macro transitions (nullptr until first use)
+	std::vector<ioport_macro_step> m_macro_steps;   // compiled macro currently playing
+	size_t                  m_macro_index;          // index of the next step to apply
+
 	// storage for inactive configuration
 	std::unique_ptr<util::xml::file> m_deselected_card_config;
 };
@@ -25,6 +25,7 @@
 #include "romload.h"
 #include "tilemap.h"
 #include "natkeyboard.h"
+#include "netplay.h"
 #include "ui/uimain.h"
 
 #include "corestr.h"
@@ -33,7 +34,9 @@
 #include <rapidjson/writer.h>
 #include <rapidjson/stringbuffer.h>
 
+#include <algorithm>
 #include <ctime>
+#include <fstream>
 
 #if defined(__EMSCRIPTEN__)
 #include <emscripten.h>
@@ -69,9 +72,12 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 		m_ui_active(_config.options().ui_active()),
 		m_basename(_config.gamedrv().name),
 		m_sample_rate(_config.options().sample_rate()),
+		m_logfile_flushed(0),
 		m_saveload_schedule(saveload_schedule::NONE),
 		m_saveload_schedule_time(attotime::zero),
 		m_saveload_searchpath(nullptr),
+		m_runahead(0),
+		m_runahead_speculative(false),
 
 		m_save(*this),
 		m_memory(*this),
@@ -130,6 +136,13 @@ std::string running_machine::describe_context() const
 
 void running_machine::start()
 {
+	// attribute startup allocations when allocation tracking is enabled
+	MAME_ALLOC_SCOPE("machine start");
+
+	// begin collecting startup timings if requested
+	m_startup_profile_enabled = (options().startup_profile()[0] != 0);
+	m_startup_profile_last = osd_ticks();
+
 	// initialize basic can't-fail systems here
 	m_configuration = std::make_unique<configuration_manager>(*this);
 	m_input = std::make_unique<input_manager>(*this);
@@ -142,13 +155,16 @@ void running_machine::start()
 
 	// initialize UI input
 	m_ui_input = std::make_unique<ui_input_manager>(*this);
+	startup_profile_mark("core managers");
 
 	// init the osd layer
 	m_manager.osd().init(*this);
+	startup_profile_mark("osd init");
 
 	// create the video manager
 	m_video = std::make_unique<video_manager>(*this);
 	m_ui = manager().create_ui(*this);
+	startup_profile_mark("video/ui managers");
 
 	// initialize the base time (needed for doing record/playback)
 	::time(&m_base_time);
@@ -162,9 +178,11 @@ void running_machine::start()
 
 	// initialize natural keyboard support after ports have been initialized
 	m_natkeyboard = std::make_unique<natural_keyboard>(*this);
+	startup_profile_mark("input ports");
 
 	// initialize the streams engine before the sound devices start
 	m_sound = std::make_unique<sound_manager>(*this);
+	startup_profile_mark("sound manager");
 
 	// resolve objects that can be used by memory maps
 	for (device_t &device : device_enumerator(root_device()))
@@ -176,7 +194,15 @@ void running_machine::start()
 	// complete address spaces).  These operations must proceed in this
 	// order
 	m_rom_load = std::make_unique<rom_load_manager>(*this);
+	startup_profile_mark("rom load");
+
+	// share loaded ROM regions between concurrent instances before any
+	// address map captures pointers into them
+	if (options().shared_roms())
+		m_memory.share_rom_regions();
+
 	m_memory.initialize();
+	startup_profile_mark("memory init");
 
 	// save the random seed or save states might be broken in drivers that use the rand() method
 	save().save_item(NAME(m_rand_seed));
@@ -186,6 +212,8 @@ void running_machine::start()
 	m_tilemap = std::make_unique<tilemap_manager>(*this);
 	m_crosshair = std::make_unique<crosshair_manager>(*this);
 	m_network = std::make_unique<network_manager>(*this);
+	if (options().netplay() != nullptr && options().netplay()[0] != 0)
+		m_netplay = std::make_unique<netplay_manager>(*this);
 
 	// initialize the debugger
 	if ((debug_flags & DEBUG_FLAG_ENABLED) != 0)
@@ -199,18 +227,21 @@ void running_machine::start()
 	// resolve objects that are created by memory maps
 	for (device_t &device : device_enumerator(root_device()))
 		device.resolve_post_map();
+	startup_profile_mark("object resolution");
 
 	// register callbacks for the devices, then start them
 	add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&running_machine::reset_all_devices, this));
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::stop_all_devices, this));
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
 	start_all_devices();
+	startup_profile_mark("device start");
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
 
 	// save outputs created before start time
 	output().register_save();
 
 	m_render->resolve_tags();
+	startup_profile_mark("render tag resolution");
 
 	// load cheat files
 	manager().load_cheatfiles(*this);
@@ -224,6 +255,21 @@ void running_machine::start()
 	if (filename[0] != 0 && !m_video->is_recording())
 		m_video->begin_recording(filename, movie_recording::format::AVI);
 
+	// start profile trace recording if specified
+	filename = options().profile_trace();
+	if (filename[0] != 0)
+	{
+		g_profiler.enable(true);
+		g_profiler.start_trace(filename);
+	}
+
+	// start schedule trace recording or verification if specified
+	filename = options().sched_trace();
+	if (filename[0] != 0)
+		m_scheduler.start_trace(filename, false);
+	else if ((filename = options().sched_trace_ref())[0] != 0)
+		m_scheduler.start_trace(filename, true);
+
 	// if we're coming in with a savegame request, process it now
 	const char *savegame = options().state();
 	if (savegame[0] != 0)
@@ -234,6 +280,10 @@ void running_machine::start()
 		schedule_load("auto");
 
 	manager().update_machine();
+
+	// dump the collected startup timings
+	startup_profile_mark("final startup");
+	startup_profile_dump();
 }
 
 
@@ -297,6 +347,18 @@ int running_machine::run(bool quiet)
 
 		m_hard_reset_pending = false;
 
+		// run-ahead relies on reliable in-memory save states; it can't be
+		// combined with lockstep netplay, which applies agreed inputs on
+		// exact frames that a speculative rollback would revisit
+		m_runahead = std::clamp(options().runahead(), 0, 5);
+		if (m_netplay != nullptr && m_netplay->active())
+			m_runahead = 0;
+		if (m_runahead != 0 && (m_system.flags & MACHINE_SUPPORTS_SAVE) == 0)
+		{
+			popmessage("Run-ahead disabled: %s does not support save states", m_system.type.fullname());
+			m_runahead = 0;
+		}
+
 		// initialize ui lists
 		// display the startup screens
 		manager().ui_initialize(*this);
@@ -322,7 +384,13 @@ int running_machine::run(bool quiet)
 
 			// execute CPUs if not paused
 			if (!m_paused)
-				m_scheduler.timeslice();
+			{
+				// with run-ahead active, emulate past the newest inputs and roll back
+				if (m_runahead != 0 && m_saveload_schedule == saveload_schedule::NONE)
+					runahead_frames();
+				else
+					m_scheduler.timeslice();
+			}
 			// otherwise, just pump video updates through
 			else
 				m_video->frame_update();
@@ -331,6 +399,11 @@ int running_machine::run(bool quiet)
 			if (m_saveload_schedule != saveload_schedule::NONE)
 				handle_saveload();
 
+			// report any asynchronous state save that has finished
+			save_error saverr;
+			if (m_save.async_save_finished(saverr))
+				report_saveload_result(saverr, false);
+
 			g_profiler.stop();
 		}
 		m_manager.http()->clear();
@@ -385,8 +458,18 @@ int running_machine::run(bool quiet)
 	call_notifiers(MACHINE_NOTIFY_EXIT);
 	util::archive_file::cache_clear();
 
+	// write out the profile trace while the device tree is still around
+	g_profiler.flush_trace(*this);
+
+	// finish any schedule trace and report the result
+	m_scheduler.flush_trace();
+
 	// close the logfile
 	m_logfile.reset();
+
+	// report per-scope allocation statistics when tracking is enabled
+	MAME_ALLOC_DUMP();
+
 	return error;
 }
 
@@ -640,6 +723,29 @@ void running_machine::immediate_load(const char *filename)
 }
 
 
+//-------------------------------------------------
+//  capture_state - snapshot the complete machine
+//  state into an in-memory buffer
+//-------------------------------------------------
+
+save_error running_machine::capture_state(std::vector<u8> &buffer)
+{
+	buffer.resize(ram_state::get_size(m_save));
+	return m_save.write_buffer(&buffer[0], buffer.size());
+}
+
+
+//-------------------------------------------------
+//  restore_state - return the machine to a state
+//  previously captured with capture_state
+//-------------------------------------------------
+
+save_error running_machine::restore_state(const std::vector<u8> &buffer)
+{
+	return m_save.read_buffer(&buffer[0], buffer.size());
+}
+
+
 //-------------------------------------------------
 //  rewind_capture - capture and append a new
 //  state to the rewind list
@@ -873,49 +979,23 @@ void running_machine::handle_saveload()
 			u32 const openflags = (m_saveload_schedule == saveload_schedule::LOAD) ? OPEN_FLAG_READ : (OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
 
 			// open the file
-			emu_file file(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
-			auto const filerr = file.open(m_saveload_pending_file);
+			auto file = std::make_unique<emu_file>(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
+			auto const filerr = file->open(m_saveload_pending_file);
 			if (!filerr)
 			{
-				const char *const opnamed = (m_saveload_schedule == saveload_schedule::LOAD) ? "loaded" : "saved";
-
-				// read/write the save state
-				save_error saverr = (m_saveload_schedule == saveload_schedule::LOAD) ? m_save.read_file(file) : m_save.write_file(file);
-
-				// handle the result
-				switch (saverr)
+				if (m_saveload_schedule == saveload_schedule::LOAD)
 				{
-				case STATERR_ILLEGAL_REGISTRATIONS:
-					popmessage("Error: Unable to %s state due to illegal registrations. See error.log for details.", opname);
-					break;
-
-				case STATERR_INVALID_HEADER:
-					popmessage("Error: Unable to %s state due to an invalid header. Make sure the save state is correct for this machine.", opname);
-					break;
-
-				case STATERR_READ_ERROR:
-					popmessage("Error: Unable to %s state due to a read error (file is likely corrupt).", opname);
-					break;
-
-				case STATERR_WRITE_ERROR:
-					popmessage("Error: Unable to %s state due to a write error. Verify there is enough disk space.", opname);
-					break;
-
-				case STATERR_NONE:
-					if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
-						popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
-					else
-						popmessage("State successfully %s.", opnamed);
-					break;
-
-				default:
-					popmessage("Error: Unknown error during state %s.", opnamed);
-					break;
+					// read the save state
+					report_saveload_result(m_save.read_file(*file), true);
+				}
+				else
+				{
+					// snapshot the state now; compression and writing continue
+					// on a worker, and completion is reported from the main loop
+					save_error saverr = m_save.write_file_async(std::move(file));
+					if (saverr != STATERR_NONE)
+						report_saveload_result(saverr, false);
 				}
-
-				// close and perhaps delete the file
-				if (saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE)
-					file.remove_on_close();
 			}
 			else if ((openflags == OPEN_FLAG_READ) && (std::errc::no_such_file_or_directory == filerr))
 			{
@@ -936,6 +1016,109 @@ void running_machine::handle_saveload()
 }
 
 
+//-------------------------------------------------
+//  report_saveload_result - report the outcome of
+//  a save or load to the user
+//-------------------------------------------------
+
+void running_machine::report_saveload_result(save_error saverr, bool is_load)
+{
+	const char *const opname = is_load ? "load" : "save";
+	const char *const opnamed = is_load ? "loaded" : "saved";
+
+	switch (saverr)
+	{
+	case STATERR_ILLEGAL_REGISTRATIONS:
+		popmessage("Error: Unable to %s state due to illegal registrations. See error.log for details.", opname);
+		break;
+
+	case STATERR_INVALID_HEADER:
+		popmessage("Error: Unable to %s state due to an invalid header. Make sure the save state is correct for this machine.", opname);
+		break;
+
+	case STATERR_READ_ERROR:
+		popmessage("Error: Unable to %s state due to a read error (file is likely corrupt).", opname);
+		break;
+
+	case STATERR_WRITE_ERROR:
+		popmessage("Error: Unable to %s state due to a write error. Verify there is enough disk space.", opname);
+		break;
+
+	case STATERR_NONE:
+		if (!(m_system.flags & MACHINE_SUPPORTS_SAVE))
+			popmessage("State successfully %s.\nWarning: Save states are not officially supported for this machine.", opnamed);
+		else
+			popmessage("State successfully %s.", opnamed);
+		break;
+
+	default:
+		popmessage("Error: Unknown error during state %s.", opnamed);
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  runahead_frames - advance the input-accurate
+//  state by one frame, then speculatively emulate
+//  the frames ahead of it, present the last one,
+//  and roll back; the player sees the machine's
+//  response to fresh inputs m_runahead frames
+//  earlier than it would otherwise appear
+//-------------------------------------------------
+
+void running_machine::runahead_frames()
+{
+	// advance the input-accurate state by one frame; this frame is never
+	// presented, the player sees its speculative successors instead
+	m_video->set_runahead_hidden(true);
+	u64 target = m_video->frame_update_count() + 1;
+	while (m_video->frame_update_count() < target && !scheduled_event_pending() && m_saveload_schedule == saveload_schedule::NONE)
+		m_scheduler.timeslice();
+
+	// if something interrupted the frame, skip the speculative burst entirely
+	if (scheduled_event_pending() || m_saveload_schedule != saveload_schedule::NONE)
+	{
+		m_video->set_runahead_hidden(false);
+		return;
+	}
+
+	// snapshot the state we must come back to
+	if (m_runahead_state == nullptr)
+		m_runahead_state = std::make_unique<ram_state>(m_save);
+	if (m_runahead_state->save() != STATERR_NONE)
+	{
+		m_video->set_runahead_hidden(false);
+		popmessage("Run-ahead disabled: state cannot be saved in memory");
+		m_runahead = 0;
+		return;
+	}
+
+	// speculatively emulate the run-ahead frames; only the last one is
+	// rendered and throttled, and none of their audio reaches the outputs
+	// since the rollback will re-emulate this stretch of time
+	m_runahead_speculative = true;
+	for (int frame = 0; frame < m_runahead && !scheduled_event_pending(); frame++)
+	{
+		m_video->set_runahead_hidden(frame != m_runahead - 1);
+		target = m_video->frame_update_count() + 1;
+		while (m_video->frame_update_count() < target && !scheduled_event_pending())
+			m_scheduler.timeslice();
+	}
+	m_video->set_runahead_hidden(false);
+
+	// roll back, so the next frame's inputs apply one frame behind what
+	// is already on screen
+	const save_error loaderr = m_runahead_state->load();
+	m_runahead_speculative = false;
+	if (loaderr != STATERR_NONE)
+	{
+		popmessage("Run-ahead disabled: state cannot be restored");
+		m_runahead = 0;
+	}
+}
+
+
 //-------------------------------------------------
 //  soft_reset - actually perform a soft-reset
 //  of the system
@@ -966,7 +1149,16 @@ void running_machine::logfile_callback(const char *buffer)
 	if (m_logfile != nullptr)
 	{
 		m_logfile->puts(buffer);
-		m_logfile->flush();
+
+		// flushing every line costs a system call per message, which
+		// dominates verbose logging runs; let the file go at most ~100ms
+		// stale instead so a crash still leaves a useful log behind
+		osd_ticks_t const now = osd_ticks();
+		if (now - m_logfile_flushed > osd_ticks_per_second() / 10)
+		{
+			m_logfile->flush();
+			m_logfile_flushed = now;
+		}
 	}
 }
 
@@ -977,40 +1169,120 @@ void running_machine::logfile_callback(const char *buffer)
 
 void running_machine::start_all_devices()
 {
-	// iterate through the devices
+	MAME_ALLOC_SCOPE("device start");
+
+	// gather the unstarted devices up front so the retry passes below only
+	// revisit devices that actually deferred, rather than re-walking the
+	// whole tree once per pass on large slot-heavy configurations
+	std::vector<device_t *> unstarted;
+	for (device_t &device : device_enumerator(root_device()))
+		if (!device.started())
+			unstarted.push_back(&device);
+
 	int last_failed_starts = -1;
-	do
+	while (!unstarted.empty())
 	{
-		// iterate over all devices
-		int failed_starts = 0;
-		for (device_t &device : device_enumerator(root_device()))
-			if (!device.started())
+		// iterate over the devices still awaiting a start
+		std::vector<device_t *> deferred;
+		for (device_t *device : unstarted)
+		{
+			// attempt to start the device, catching any expected exceptions
+			try
 			{
-				// attempt to start the device, catching any expected exceptions
-				try
-				{
-					// if the device doesn't have a machine yet, set it first
-					if (!device.m_machine)
-						device.set_machine(*this);
-
-					// now start the device
-					osd_printf_verbose("Starting %s '%s'\n", device.name(), device.tag());
-					device.start();
-				}
-				catch (device_missing_dependencies const &)
-				{
-					// handle missing dependencies by moving the device to the end
-					osd_printf_verbose("  (missing dependencies; rescheduling)\n");
-					failed_starts++;
-				}
+				// if the device doesn't have a machine yet, set it first
+				if (!device->m_machine)
+					device->set_machine(*this);
+
+				// now start the device, timing it if requested
+				osd_printf_verbose("Starting %s '%s'\n", device->name(), device->tag());
+				osd_ticks_t const start_ticks = m_startup_profile_enabled ? osd_ticks() : 0;
+				device->start();
+				if (m_startup_profile_enabled)
+					m_startup_profile.emplace_back(std::string("device:") + device->tag(), osd_ticks() - start_ticks);
+			}
+			catch (device_missing_dependencies const &)
+			{
+				// handle missing dependencies by moving the device to the end
+				osd_printf_verbose("  (missing dependencies; rescheduling)\n");
+				deferred.push_back(device);
 			}
+		}
 
 		// each iteration should reduce the number of failed starts; error if this doesn't happen
-		if (failed_starts == last_failed_starts)
+		if (int(deferred.size()) == last_failed_starts)
 			throw emu_fatalerror("Circular dependency in device startup!");
-		last_failed_starts = failed_starts;
+		last_failed_starts = int(deferred.size());
+		unstarted = std::move(deferred);
+	}
+}
+
+
+//-------------------------------------------------
+//  startup_profile_mark - record the time spent
+//  since the previous mark under the given name
+//-------------------------------------------------
+
+void running_machine::startup_profile_mark(const char *phase)
+{
+	if (!m_startup_profile_enabled)
+		return;
+
+	osd_ticks_t const now = osd_ticks();
+	m_startup_profile.emplace_back(phase, now - m_startup_profile_last);
+	m_startup_profile_last = now;
+}
+
+
+//-------------------------------------------------
+//  startup_profile_dump - write the collected
+//  startup timings as ranked JSON
+//-------------------------------------------------
+
+void running_machine::startup_profile_dump()
+{
+	if (!m_startup_profile_enabled)
+		return;
+
+	// rank entries by decreasing duration; phase entries sum to the total
+	// wall time while device:<tag> entries break down the device start phase
+	std::stable_sort(m_startup_profile.begin(), m_startup_profile.end(),
+			[] (auto const &a, auto const &b) { return a.second > b.second; });
+
+	double const to_ms = 1000.0 / double(osd_ticks_per_second());
+	osd_ticks_t total = 0;
+	for (auto const &entry : m_startup_profile)
+		if (entry.first.compare(0, 7, "device:") != 0)
+			total += entry.second;
+
+	rapidjson::StringBuffer buffer;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+	writer.StartObject();
+	writer.Key("system");
+	writer.String(m_system.name);
+	writer.Key("total_ms");
+	writer.Double(double(total) * to_ms);
+	writer.Key("entries");
+	writer.StartArray();
+	for (auto const &entry : m_startup_profile)
+	{
+		writer.StartObject();
+		writer.Key("name");
+		writer.String(entry.first.c_str());
+		writer.Key("ms");
+		writer.Double(double(entry.second) * to_ms);
+		writer.EndObject();
 	}
-	while (last_failed_starts);
+	writer.EndArray();
+	writer.EndObject();
+
+	std::ofstream file(options().startup_profile(), std::ios::out | std::ios::trunc);
+	if (file)
+		file << buffer.GetString() << '\n';
+	else
+		osd_printf_error("Unable to open startup profile file %s\n", options().startup_profile());
+
+	m_startup_profile.clear();
+	m_startup_profile_enabled = false;
 }
 
 
@@ -1117,6 +1389,10 @@ void running_machine::nvram_load()
 {
 	for (device_nvram_interface &nvram : nvram_interface_enumerator(root_device()))
 	{
+		// try the journaled path first; fall back to the plain image on failure
+		if (options().nvram_journal() && nvram_load_journaled(nvram))
+			continue;
+
 		emu_file file(options().nvram_directory(), OPEN_FLAG_READ);
 		if (!file.open(nvram_filename(nvram.device())))
 		{
@@ -1139,6 +1415,10 @@ void running_machine::nvram_save()
 	{
 		if (nvram.nvram_can_save())
 		{
+			// try the journaled path first; fall back to a full rewrite on failure
+			if (options().nvram_journal() && nvram_save_journaled(nvram))
+				continue;
+
 			emu_file file(options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
 			if (!file.open(nvram_filename(nvram.device())))
 			{
@@ -1150,6 +1430,164 @@ void running_machine::nvram_save()
 }
 
 
+// current version of the NVRAM journal file format
+static constexpr u32 NVRAM_JOURNAL_VERSION = 1;
+
+
+/*-------------------------------------------------
+    nvram_load_journaled - load a device's NVRAM
+    from its pristine base image plus the journal
+    of dirty blocks; returns false to fall back
+    to the plain image path
+-------------------------------------------------*/
+
+bool running_machine::nvram_load_journaled(device_nvram_interface &nvram)
+{
+	auto const get_u32le = [] (const u8 *src)
+	{
+		return u32(src[0]) | (u32(src[1]) << 8) | (u32(src[2]) << 16) | (u32(src[3]) << 24);
+	};
+	std::string const filename = nvram_filename(nvram.device());
+
+	// read the base image; with no base on disk fall back to defaults
+	std::vector<u8> image;
+	{
+		emu_file base(options().nvram_directory(), OPEN_FLAG_READ);
+		if (base.open(filename))
+		{
+			nvram.nvram_reset();
+			nvram.nvram_shadow().clear();
+			return true;
+		}
+		image.resize(base.size());
+		if (!image.empty() && base.read(&image[0], image.size()) != image.size())
+			return false;
+		base.close();
+	}
+
+	// the shadow tracks the pristine base image, not the patched result
+	nvram.nvram_shadow() = image;
+
+	// apply any journaled dirty blocks on top of the base
+	emu_file journal(options().nvram_directory(), OPEN_FLAG_READ);
+	if (!journal.open(filename + ".journal"))
+	{
+		u8 header[12];
+		if (journal.read(header, sizeof(header)) != sizeof(header))
+			return false;
+		if (header[0] != 'M' || header[1] != 'N' || header[2] != 'V' || header[3] != 'J')
+			return false;
+		if (get_u32le(&header[4]) != NVRAM_JOURNAL_VERSION || get_u32le(&header[8]) != image.size())
+			return false;
+		while (1)
+		{
+			u8 record[8];
+			u32 const bytes = journal.read(record, sizeof(record));
+			if (bytes == 0)
+				break;
+			if (bytes != sizeof(record))
+				return false;
+			u32 const offset = get_u32le(&record[0]);
+			u32 const length = get_u32le(&record[4]);
+			if (offset > image.size() || length > image.size() - offset)
+				return false;
+			if (journal.read(&image[offset], length) != length)
+				return false;
+		}
+		journal.close();
+	}
+
+	// hand the device a read-only RAM file over the patched image
+	emu_file file(OPEN_FLAG_READ);
+	if (file.open_ram(image.data(), image.size()))
+		return false;
+	nvram.nvram_load(file);
+	file.close();
+	return true;
+}
+
+
+/*-------------------------------------------------
+    nvram_save_journaled - save a device's NVRAM
+    as a journal of dirty blocks against the
+    pristine base image, compacting into a fresh
+    base once the journal grows too large;
+    returns false to fall back to a full rewrite
+-------------------------------------------------*/
+
+bool running_machine::nvram_save_journaled(device_nvram_interface &nvram)
+{
+	auto const put_u32le = [] (u8 *dest, u32 value)
+	{
+		dest[0] = value >> 0;
+		dest[1] = value >> 8;
+		dest[2] = value >> 16;
+		dest[3] = value >> 24;
+	};
+
+	// capture the contents the device would have written
+	std::vector<u8> image;
+	if (!nvram.nvram_image(image))
+		return false;
+	std::string const filename = nvram_filename(nvram.device());
+	std::vector<u8> &shadow = nvram.nvram_shadow();
+
+	// diff against the shadow in fixed-size blocks, coalescing adjacent
+	// dirty blocks into runs
+	constexpr u32 BLOCK_SIZE = 64;
+	std::vector<std::pair<u32, u32> > runs;
+	u64 dirtybytes = 0;
+	if (shadow.size() == image.size())
+		for (u32 offset = 0; offset < image.size(); offset += BLOCK_SIZE)
+		{
+			u32 const length = std::min<u32>(BLOCK_SIZE, image.size() - offset);
+			if (memcmp(&image[offset], &shadow[offset], length) != 0)
+			{
+				if (!runs.empty() && runs.back().first + runs.back().second == offset)
+					runs.back().second += length;
+				else
+					runs.emplace_back(offset, length);
+				dirtybytes += length;
+			}
+		}
+
+	// rewrite the base when there is no shadow to diff against, or when the
+	// journal would cover more than half the image anyway
+	if (shadow.size() != image.size() || dirtybytes * 2 > image.size())
+	{
+		emu_file base(options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (base.open(filename))
+			return false;
+		if (!image.empty() && base.write(&image[0], image.size()) != image.size())
+			return false;
+		base.close();
+
+		// the fresh base matches the current contents, so the journal is empty
+		shadow = image;
+		runs.clear();
+	}
+
+	// rewrite the journal wholesale; it is tiny relative to the base image
+	emu_file journal(options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (journal.open(filename + ".journal"))
+		return false;
+	u8 header[12] = { 'M', 'N', 'V', 'J' };
+	put_u32le(&header[4], NVRAM_JOURNAL_VERSION);
+	put_u32le(&header[8], u32(shadow.size()));
+	journal.write(header, sizeof(header));
+	for (auto const &run : runs)
+	{
+		u8 record[8];
+		put_u32le(&record[0], run.first);
+		put_u32le(&record[4], run.second);
+		journal.write(record, sizeof(record));
+		journal.write(&image[run.first], run.second);
+	}
+	journal.close();
+	return true;
+}
+
+
 //**************************************************************************
 //  OUTPUT
 //**************************************************************************
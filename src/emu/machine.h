@@ -17,7 +17,10 @@
 #ifndef MAME_EMU_MACHINE_H
 #define MAME_EMU_MACHINE_H
 
+#include "arena.h"
+
 #include <functional>
+#include <mutex>
 
 #include <ctime>
 
@@ -120,6 +123,7 @@ public:
 	machine_manager &manager() const { return m_manager; }
 	device_scheduler &scheduler() { return m_scheduler; }
 	save_manager &save() { return m_save; }
+	util::arena &arena() { return m_arena; }
 	memory_manager &memory() { return m_memory; }
 	ioport_manager &ioport() { return m_ioport; }
 	parameters_manager &parameters() { return m_parameters; }
@@ -140,6 +144,7 @@ public:
 	debug_view_manager &debug_view() const { assert(m_debug_view != nullptr); return *m_debug_view; }
 	debugger_manager &debugger() const { assert(m_debugger != nullptr); return *m_debugger; }
 	natural_keyboard &natkeyboard() noexcept { assert(m_natkeyboard != nullptr); return *m_natkeyboard; }
+	netplay_manager *netplay() const { return m_netplay.get(); }
 	template <class DriverClass> DriverClass *driver_data() const { return &downcast<DriverClass &>(root_device()); }
 	machine_phase phase() const { return m_current_phase; }
 	bool paused() const { return m_paused || (m_current_phase != machine_phase::RUNNING); }
@@ -149,6 +154,7 @@ public:
 	const std::string &basename() const { return m_basename; }
 	int sample_rate() const { return m_sample_rate; }
 	bool save_or_load_pending() const { return !m_saveload_pending_file.empty(); }
+	bool runahead_speculative() const { return m_runahead_speculative; }
 
 	// RAII-based side effect disable
 	// NOP-ed when passed false, to make it more easily conditional
@@ -180,6 +186,11 @@ public:
 	void immediate_save(const char *filename);
 	void immediate_load(const char *filename);
 
+	// in-memory state fork points, for harnesses that explore divergent
+	// input futures from one snapshot; call between timeslices
+	save_error capture_state(std::vector<u8> &buffer);
+	save_error restore_state(const std::vector<u8> &buffer);
+
 	// rewind operations
 	bool rewind_capture();
 	bool rewind_step();
@@ -248,16 +259,24 @@ private:
 	void start();
 	void set_saveload_filename(std::string &&filename);
 	void handle_saveload();
+	void report_saveload_result(save_error saverr, bool is_load);
+	void runahead_frames();
 	void soft_reset(void *ptr = nullptr, s32 param = 0);
 	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
 	void nvram_save();
+	bool nvram_load_journaled(device_nvram_interface &nvram);
+	bool nvram_save_journaled(device_nvram_interface &nvram);
 	void popup_clear() const;
 	void popup_message(util::format_argument_pack<std::ostream> const &args) const;
 
 	// internal callbacks
 	void logfile_callback(const char *buffer);
 
+	// startup profiling helpers
+	void startup_profile_mark(const char *phase);
+	void startup_profile_dump();
+
 	// internal device helpers
 	void start_all_devices();
 	void reset_all_devices();
@@ -279,6 +298,7 @@ private:
 	std::unique_ptr<tilemap_manager> m_tilemap;        // internal data from tilemap.cpp
 	std::unique_ptr<debug_view_manager> m_debug_view;  // internal data from debugvw.cpp
 	std::unique_ptr<network_manager> m_network;        // internal data from network.cpp
+	std::unique_ptr<netplay_manager> m_netplay;        // internal data from netplay.cpp
 	std::unique_ptr<bookkeeping_manager> m_bookkeeping;// internal data from bookkeeping.cpp
 	std::unique_ptr<configuration_manager> m_configuration; // internal data from config.cpp
 	std::unique_ptr<output_manager> m_output;          // internal data from output.cpp
@@ -303,6 +323,12 @@ private:
 	int                     m_sample_rate;          // the digital audio sample rate
 	std::unique_ptr<emu_file>  m_logfile;           // pointer to the active error.log file
 	std::unique_ptr<emu_file>  m_debuglogfile;      // pointer to the active debug.log file
+	osd_ticks_t             m_logfile_flushed;      // host time of the last error.log flush
+
+	// startup profiling (see -startup_profile)
+	bool                    m_startup_profile_enabled = false; // are we collecting startup timings?
+	osd_ticks_t             m_startup_profile_last = 0; // host time of the last phase mark
+	std::vector<std::pair<std::string, osd_ticks_t>> m_startup_profile; // recorded (name, duration) pairs
 
 	// load/save management
 	enum class saveload_schedule
@@ -316,6 +342,11 @@ private:
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
 
+	// run-ahead management
+	int                     m_runahead;             // number of frames to run ahead of the newest inputs
+	bool                    m_runahead_speculative; // true while emulating frames that will be rolled back
+	std::unique_ptr<ram_state> m_runahead_state;    // in-memory state for the run-ahead rollback
+
 	// notifier callbacks
 	struct notifier_callback_item
 	{
@@ -340,13 +371,17 @@ private:
 	std::list<std::unique_ptr<logerror_callback_item>> m_logerror_list;
 
 	// embedded managers and objects
+	util::arena             m_arena;                // arena for machine-lifetime bookkeeping; declared
+	                                                // before the managers so it is destroyed after them
 	save_manager            m_save;                 // save manager
 	memory_manager          m_memory;               // memory manager
 	ioport_manager          m_ioport;               // I/O port manager
 	parameters_manager      m_parameters;           // parameters manager
 	device_scheduler        m_scheduler;            // scheduler object
 
-	// string formatting buffer
+	// string formatting buffer, guarded so devices running on worker
+	// threads in parallel mode can log safely
+	mutable std::mutex m_logerror_mutex;
 	mutable util::ovectorstream m_string_buffer;
 
 #if defined(__EMSCRIPTEN__)
@@ -403,6 +438,7 @@ inline void running_machine::logerror(Format &&fmt, Params &&... args) const
 		g_profiler.start(PROFILER_LOGERROR);
 
 		// dump to the buffer
+		std::lock_guard<std::mutex> guard(m_logerror_mutex);
 		m_string_buffer.clear();
 		m_string_buffer.seekp(0);
 		util::stream_format(m_string_buffer, std::forward<Format>(fmt), std::forward<Params>(args)...);
@@ -58,6 +58,7 @@ public:
 	static void draw_user_interface(running_machine& machine);
 	static void periodic_check();
 	static bool frame_hook();
+	static bool idle_hook(uint64_t budget);
 	static void sound_hook();
 	static void layout_script_cb(layout_file &file, const char *script);
 	static bool standalone();
@@ -117,5 +117,162 @@ private:
 };
 
 
+// ======================> memory_array_view
+
+// compile-time specialized view onto a memory_array, in the spirit of the
+// Width/AddrShift parameters on memory_access_cache: when a driver knows the
+// array's layout statically (as paletteram and videoram helpers usually do),
+// instantiating a view replaces the indirect call through m_read_entry/
+// m_write_entry with fully inlined accesses, which matters inside tile-get
+// callbacks and other per-entry loops
+template <int BytesPerEntry, int MemBits, endianness_t Endian>
+class memory_array_view
+{
+	static_assert(BytesPerEntry == 1 || BytesPerEntry == 2 || BytesPerEntry == 4, "memory_array_view: illegal bytes-per-entry");
+	static_assert(MemBits == 8 || MemBits == 16 || MemBits == 32 || MemBits == 64, "memory_array_view: illegal memory width");
+
+public:
+	// construction; the array must match the compile-time parameters
+	memory_array_view(const memory_array &array)
+		: m_base(array.base())
+	{
+		assert(array.bytes_per_entry() == BytesPerEntry);
+		assert(array.membits() == MemBits);
+		assert(array.endianness() == Endian);
+	}
+
+	// entry-level readers and writers, mirroring memory_array::read/write
+	u32 read(int index) const
+	{
+		if constexpr (BytesPerEntry == 1)
+			return reinterpret_cast<u8 const *>(m_base)[swizzle8(index)];
+		else if constexpr (BytesPerEntry == 2 && MemBits == 8)
+		{
+			u8 const *const base = reinterpret_cast<u8 const *>(m_base);
+			if constexpr (Endian == ENDIANNESS_LITTLE)
+				return base[index*2] | (base[index*2+1] << 8);
+			else
+				return (base[index*2] << 8) | base[index*2+1];
+		}
+		else if constexpr (BytesPerEntry == 2)
+			return reinterpret_cast<u16 const *>(m_base)[swizzle16(index)];
+		else if constexpr (MemBits < 32)
+		{
+			if constexpr (Endian == ENDIANNESS_LITTLE)
+				return read_half(index*2) | (read_half(index*2+1) << 16);
+			else
+				return (read_half(index*2) << 16) | read_half(index*2+1);
+		}
+		else
+			return reinterpret_cast<u32 const *>(m_base)[swizzle32(index)];
+	}
+
+	void write(int index, u32 data)
+	{
+		if constexpr (BytesPerEntry == 1)
+			reinterpret_cast<u8 *>(m_base)[swizzle8(index)] = data;
+		else if constexpr (BytesPerEntry == 2 && MemBits == 8)
+		{
+			u8 *const base = reinterpret_cast<u8 *>(m_base);
+			if constexpr (Endian == ENDIANNESS_LITTLE)
+			{
+				base[index*2] = data;
+				base[index*2+1] = data >> 8;
+			}
+			else
+			{
+				base[index*2] = data >> 8;
+				base[index*2+1] = data;
+			}
+		}
+		else if constexpr (BytesPerEntry == 2)
+			reinterpret_cast<u16 *>(m_base)[swizzle16(index)] = data;
+		else if constexpr (MemBits < 32)
+		{
+			if constexpr (Endian == ENDIANNESS_LITTLE)
+			{
+				write_half(index*2, data);
+				write_half(index*2+1, data >> 16);
+			}
+			else
+			{
+				write_half(index*2, data >> 16);
+				write_half(index*2+1, data);
+			}
+		}
+		else
+			reinterpret_cast<u32 *>(m_base)[swizzle32(index)] = data;
+	}
+
+private:
+	// index swizzles matching the memory_array helpers for each entry width
+	static constexpr int swizzle8(int index)
+	{
+		if constexpr (MemBits == 8)
+			return index;
+		else if constexpr (MemBits == 16)
+			return (Endian == ENDIANNESS_LITTLE) ? BYTE_XOR_LE(index) : BYTE_XOR_BE(index);
+		else if constexpr (MemBits == 32)
+			return (Endian == ENDIANNESS_LITTLE) ? BYTE4_XOR_LE(index) : BYTE4_XOR_BE(index);
+		else
+			return BYTE8_XOR_BE(index);
+	}
+	static constexpr int swizzle16(int index)
+	{
+		if constexpr (MemBits == 16)
+			return index;
+		else if constexpr (MemBits == 32)
+			return (Endian == ENDIANNESS_LITTLE) ? BYTE_XOR_LE(index) : BYTE_XOR_BE(index);
+		else
+			return (Endian == ENDIANNESS_LITTLE) ? BYTE4_XOR_LE(index) : BYTE4_XOR_BE(index);
+	}
+	static constexpr int swizzle32(int index)
+	{
+		if constexpr (MemBits == 32)
+			return index;
+		else
+			return (Endian == ENDIANNESS_LITTLE) ? BYTE_XOR_LE(index) : BYTE_XOR_BE(index);
+	}
+
+	// 16-bit half readers/writers used to compose 4 byte entries on
+	// narrow buses
+	u32 read_half(int index) const
+	{
+		if constexpr (MemBits == 8)
+		{
+			u8 const *const base = reinterpret_cast<u8 const *>(m_base);
+			if constexpr (Endian == ENDIANNESS_LITTLE)
+				return base[index*2] | (base[index*2+1] << 8);
+			else
+				return (base[index*2] << 8) | base[index*2+1];
+		}
+		else
+			return reinterpret_cast<u16 const *>(m_base)[index];
+	}
+	void write_half(int index, u32 data)
+	{
+		if constexpr (MemBits == 8)
+		{
+			u8 *const base = reinterpret_cast<u8 *>(m_base);
+			if constexpr (Endian == ENDIANNESS_LITTLE)
+			{
+				base[index*2] = data;
+				base[index*2+1] = data >> 8;
+			}
+			else
+			{
+				base[index*2] = data >> 8;
+				base[index*2+1] = data;
+			}
+		}
+		else
+			reinterpret_cast<u16 *>(m_base)[index] = data;
+	}
+
+	// internal state
+	void *              m_base;
+};
+
+
 
 #endif  // MAME_EMU_MEMARRAY_H
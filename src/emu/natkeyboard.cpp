@@ -868,10 +868,16 @@ void natural_keyboard::timer(void *ptr, int param)
 {
 	if (!m_queue_chars.isnull())
 	{
-		// the driver has a queue_chars handler
-		while (!empty() && m_queue_chars(&m_buffer[m_bufbegin], 1))
+		// the driver has a queue_chars handler; hand it contiguous runs of
+		// buffered characters so a large paste drains in a few calls
+		// rather than one character per call
+		while (!empty())
 		{
-			m_bufbegin = (m_bufbegin + 1) % m_buffer.size();
+			size_t const run((m_bufbegin < m_bufend) ? (m_bufend - m_bufbegin) : (m_buffer.size() - m_bufbegin));
+			int const queued(m_queue_chars(&m_buffer[m_bufbegin], (m_current_rate != attotime::zero) ? 1 : run));
+			if (queued <= 0)
+				break;
+			m_bufbegin = (m_bufbegin + queued) % m_buffer.size();
 			if (m_current_rate != attotime::zero)
 				break;
 		}
@@ -0,0 +1,403 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    netplay.cpp
+
+    Deterministic lockstep netplay management.
+
+    Every frame, each machine captures its local digital port state in
+    deterministic port order and sends it to the peer tagged for a frame
+    input_delay frames in the future; the inputs actually applied on a
+    frame are the OR of what both players scheduled for it, so both
+    machines compute identical frames from identical data. Before the
+    pipeline is primed, nothing is pressed on either machine. Analog
+    inputs are not yet synchronized; systems relying on them will trip
+    the checksum-based desync detection.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "netplay.h"
+
+#include "emuopts.h"
+
+#include <cstring>
+
+
+//**************************************************************************
+//  NETPLAY MANAGER
+//**************************************************************************
+
+//-------------------------------------------------
+//  netplay_manager - constructor
+//-------------------------------------------------
+
+netplay_manager::netplay_manager(running_machine &machine)
+	: m_machine(machine)
+	, m_socket(OPEN_FLAG_READ | OPEN_FLAG_WRITE)
+	, m_active(false)
+	, m_input_delay(std::clamp(machine.options().netplay_delay(), 1, 10))
+	, m_frame(0)
+	, m_port_index(0)
+	, m_merged_valid(false)
+{
+	const char *const address = machine.options().netplay();
+	if (address != nullptr && address[0] != 0)
+		m_active = connect(address);
+}
+
+
+//-------------------------------------------------
+//  connect - establish the stream connection to
+//  the peer; an address without a host part means
+//  listen for an incoming connection instead
+//-------------------------------------------------
+
+bool netplay_manager::connect(const std::string &address)
+{
+	const bool listening = (address[0] == ':') || (address.find(':') == std::string::npos);
+
+	std::string path("socket.");
+	if (listening)
+	{
+		// a listening socket is requested via the create flag
+		m_socket.set_openflags(m_socket.openflags() | OPEN_FLAG_CREATE);
+		path += "0.0.0.0:";
+		path += (address[0] == ':') ? address.substr(1) : address;
+	}
+	else
+		path += address;
+
+	osd_printf_info(listening ? "Netplay: waiting for a peer on %s\n" : "Netplay: connecting to %s\n", path);
+	const std::error_condition err = m_socket.open(std::move(path));
+	if (err)
+	{
+		osd_printf_error("Netplay: unable to open %s (%s)\n", address, err.message());
+		return false;
+	}
+
+	return handshake(listening);
+}
+
+
+//-------------------------------------------------
+//  handshake - agree on protocol version, system
+//  and input delay; the connecting side talks
+//  first, and the listening side's first read
+//  also accepts the incoming connection
+//-------------------------------------------------
+
+bool netplay_manager::handshake(bool listening)
+{
+	// identify the system by name so mismatched setups fail up front
+	util::crc32_creator namecrc;
+	namecrc.append(machine().system().name, u32(std::strlen(machine().system().name)));
+	const u32 hello[3] = { PROTOCOL_VERSION, u32(namecrc.finish()), u32(m_input_delay) };
+
+	const osd_ticks_t deadline = osd_ticks() + osd_ticks_per_second() * CONNECT_TIMEOUT;
+	if (!listening && !send_message(MSG_HELLO, 0, hello, 3))
+		return false;
+
+	u8 type;
+	u32 frame;
+	if (!receive_message(type, frame, m_receive_values, deadline) || type != MSG_HELLO || m_receive_values.size() != 3)
+	{
+		osd_printf_error("Netplay: handshake with the peer failed\n");
+		return false;
+	}
+
+	if (listening && !send_message(MSG_HELLO, 0, hello, 3))
+		return false;
+
+	if (m_receive_values[0] != PROTOCOL_VERSION)
+	{
+		osd_printf_error("Netplay: peer uses protocol version %u, we use %u\n", m_receive_values[0], PROTOCOL_VERSION);
+		return false;
+	}
+	if (m_receive_values[1] != hello[1])
+	{
+		osd_printf_error("Netplay: peer is running a different system\n");
+		return false;
+	}
+
+	// both sides settle on the larger requested input delay
+	m_input_delay = std::max(m_input_delay, int(m_receive_values[2]));
+	osd_printf_info("Netplay: connected, input delay %d frame(s)\n", m_input_delay);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  disconnect - tear down the session, leaving
+//  the machine running standalone
+//-------------------------------------------------
+
+void netplay_manager::disconnect(const char *message)
+{
+	if (m_active)
+	{
+		m_active = false;
+		m_socket.close();
+		osd_printf_error("%s\n", message);
+		machine().popmessage("%s", message);
+	}
+}
+
+
+//-------------------------------------------------
+//  exchange_digital - record the local digital
+//  state of the next port and return the state
+//  both machines agreed to apply on this frame
+//-------------------------------------------------
+
+ioport_value netplay_manager::exchange_digital(ioport_value local)
+{
+	// remember what the local player is doing; it applies input_delay
+	// frames from now on both machines
+	m_local_inputs.push_back(local);
+
+	// until the pipeline is primed, neither player presses anything
+	ioport_value result = 0;
+	if (m_merged_valid && m_port_index < m_merged_inputs.size())
+		result = m_merged_inputs[m_port_index];
+	m_port_index++;
+	return result;
+}
+
+
+//-------------------------------------------------
+//  frame_update - ship this frame's local inputs,
+//  then block until the inputs for the next frame
+//  are agreed with the peer
+//-------------------------------------------------
+
+void netplay_manager::frame_update()
+{
+	m_port_index = 0;
+	if (!m_active)
+	{
+		m_local_inputs.clear();
+		return;
+	}
+
+	// ship this frame's local inputs, scheduled input_delay frames ahead
+	const u32 target = m_frame + u32(m_input_delay);
+	if (!send_message(MSG_INPUTS, target, m_local_inputs.empty() ? nullptr : &m_local_inputs[0], u16(m_local_inputs.size())))
+	{
+		disconnect("Netplay: connection to the peer was lost");
+		return;
+	}
+	m_local_future[target] = std::move(m_local_inputs);
+	m_local_inputs.clear();
+
+	// periodically checksum the full machine state for desync detection
+	if (m_frame % CRC_INTERVAL == 0)
+	{
+		const u32 crc = state_crc();
+		m_crc_history[m_frame] = crc;
+		while (m_crc_history.size() > 16)
+			m_crc_history.erase(m_crc_history.begin());
+		if (!send_message(MSG_CRC, m_frame, &crc, 1))
+		{
+			disconnect("Netplay: connection to the peer was lost");
+			return;
+		}
+	}
+
+	// move on to the next frame and wait for the inputs it needs
+	m_frame++;
+	if (m_frame < u32(m_input_delay))
+		return;
+	if (!pump_until_inputs(m_frame))
+	{
+		disconnect("Netplay: the peer stopped responding");
+		return;
+	}
+
+	// a digital field is active on a frame if either player activated it
+	const std::vector<u32> &local = m_local_future[m_frame];
+	const std::vector<u32> &remote = m_remote_inputs[m_frame];
+	m_merged_inputs.resize(std::min(local.size(), remote.size()));
+	for (size_t index = 0; index < m_merged_inputs.size(); index++)
+		m_merged_inputs[index] = local[index] | remote[index];
+	m_merged_valid = true;
+	m_local_future.erase(m_frame);
+	m_remote_inputs.erase(m_frame);
+}
+
+
+//-------------------------------------------------
+//  pump_until_inputs - process incoming messages
+//  until the remote inputs for the given frame
+//  have arrived
+//-------------------------------------------------
+
+bool netplay_manager::pump_until_inputs(u32 frame)
+{
+	const osd_ticks_t deadline = osd_ticks() + osd_ticks_per_second() * SYNC_TIMEOUT;
+	while (m_remote_inputs.find(frame) == m_remote_inputs.end())
+	{
+		u8 type;
+		u32 msgframe;
+		if (!receive_message(type, msgframe, m_receive_values, deadline))
+			return false;
+
+		switch (type)
+		{
+		case MSG_INPUTS:
+			m_remote_inputs[msgframe] = m_receive_values;
+			break;
+
+		case MSG_CRC:
+			if (m_receive_values.size() == 1)
+				check_crc(msgframe, m_receive_values[0]);
+			break;
+
+		default:
+			osd_printf_error("Netplay: unexpected message type %u from the peer\n", type);
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  check_crc - compare the peer's state checksum
+//  for a frame against our own
+//-------------------------------------------------
+
+void netplay_manager::check_crc(u32 frame, u32 crc)
+{
+	// the session keeps running so the players can see the report and
+	// decide to restart; once diverged there is nothing to recover
+	const auto ours = m_crc_history.find(frame);
+	if (ours != m_crc_history.end() && ours->second != crc)
+	{
+		osd_printf_error("Netplay: state checksum mismatch at frame %u (local %08X, remote %08X)\n", frame, ours->second, crc);
+		machine().popmessage("Netplay: desync detected at frame %u", frame);
+	}
+}
+
+
+//-------------------------------------------------
+//  state_crc - checksum the full machine state
+//  through the save-state system
+//-------------------------------------------------
+
+u32 netplay_manager::state_crc()
+{
+	save_manager &save = machine().save();
+	m_state_buffer.resize(save.total_data_size());
+	if (save.write_buffer(&m_state_buffer[0], m_state_buffer.size()) != STATERR_NONE)
+		return 0;
+
+	util::crc32_creator crc;
+	crc.append(&m_state_buffer[0], u32(m_state_buffer.size()));
+	return crc.finish();
+}
+
+
+//-------------------------------------------------
+//  write_exact - push a complete buffer into the
+//  socket, waiting out partial writes
+//-------------------------------------------------
+
+bool netplay_manager::write_exact(const u8 *data, u32 length)
+{
+	const osd_ticks_t deadline = osd_ticks() + osd_ticks_per_second() * SYNC_TIMEOUT;
+	while (length != 0)
+	{
+		const u32 written = m_socket.write(data, length);
+		data += written;
+		length -= written;
+		if (written == 0)
+		{
+			if (osd_ticks() > deadline)
+				return false;
+			osd_sleep(osd_ticks_per_second() / 1000);
+		}
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  read_exact - pull a complete buffer from the
+//  socket, waiting for data up to the deadline
+//-------------------------------------------------
+
+bool netplay_manager::read_exact(u8 *data, u32 length, osd_ticks_t deadline)
+{
+	while (length != 0)
+	{
+		const u32 received = m_socket.read(data, length);
+		data += received;
+		length -= received;
+		if (received == 0)
+		{
+			if (osd_ticks() > deadline)
+				return false;
+			osd_sleep(osd_ticks_per_second() / 1000);
+		}
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  send_message - serialize one message; all
+//  fields are little-endian on the wire
+//-------------------------------------------------
+
+bool netplay_manager::send_message(u8 type, u32 frame, const u32 *values, u16 count)
+{
+	std::vector<u8> buffer(7 + 4 * size_t(count));
+	buffer[0] = type;
+	buffer[1] = u8(frame >> 0);
+	buffer[2] = u8(frame >> 8);
+	buffer[3] = u8(frame >> 16);
+	buffer[4] = u8(frame >> 24);
+	buffer[5] = u8(count >> 0);
+	buffer[6] = u8(count >> 8);
+	for (u16 index = 0; index < count; index++)
+	{
+		buffer[7 + 4 * index + 0] = u8(values[index] >> 0);
+		buffer[7 + 4 * index + 1] = u8(values[index] >> 8);
+		buffer[7 + 4 * index + 2] = u8(values[index] >> 16);
+		buffer[7 + 4 * index + 3] = u8(values[index] >> 24);
+	}
+	return write_exact(&buffer[0], u32(buffer.size()));
+}
+
+
+//-------------------------------------------------
+//  receive_message - deserialize one message
+//-------------------------------------------------
+
+bool netplay_manager::receive_message(u8 &type, u32 &frame, std::vector<u32> &values, osd_ticks_t deadline)
+{
+	u8 header[7];
+	if (!read_exact(header, sizeof(header), deadline))
+		return false;
+
+	type = header[0];
+	frame = u32(header[1]) | (u32(header[2]) << 8) | (u32(header[3]) << 16) | (u32(header[4]) << 24);
+	const u16 count = u16(header[5] | (header[6] << 8));
+
+	values.resize(count);
+	if (count != 0)
+	{
+		std::vector<u8> payload(4 * size_t(count));
+		if (!read_exact(&payload[0], u32(payload.size()), deadline))
+			return false;
+		for (u16 index = 0; index < count; index++)
+			values[index] =
+					(u32(payload[4 * index + 0]) << 0) |
+					(u32(payload[4 * index + 1]) << 8) |
+					(u32(payload[4 * index + 2]) << 16) |
+					(u32(payload[4 * index + 3]) << 24);
+	}
+	return true;
+}
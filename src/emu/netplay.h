@@ -0,0 +1,97 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    netplay.h
+
+    Deterministic lockstep netplay management.
+
+    Two machines running the same driver exchange their digital input
+    state every frame over a TCP socket, scheduled a configurable number
+    of frames into the future so the link latency is hidden inside the
+    input delay rather than stalling emulation. Both machines apply the
+    identical merged inputs on the identical frame, so MAME's
+    determinism keeps them in sync; periodic save-state checksums catch
+    any divergence.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_NETPLAY_H
+#define MAME_EMU_NETPLAY_H
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+
+// ======================> netplay_manager
+
+class netplay_manager
+{
+public:
+	// construction/destruction
+	netplay_manager(running_machine &machine);
+
+	// getters
+	running_machine &machine() const { return m_machine; }
+	bool active() const { return m_active; }
+	int input_delay() const { return m_input_delay; }
+
+	// called by ioport_manager for each port, in deterministic port
+	// order; records the local digital state and returns the merged
+	// state both machines agreed to apply on this frame
+	ioport_value exchange_digital(ioport_value local);
+
+	// called by ioport_manager once all ports have been updated;
+	// ships the local inputs and blocks until the peer's inputs for
+	// the next frame have arrived
+	void frame_update();
+
+private:
+	// configuration
+	static constexpr u32 PROTOCOL_VERSION = 1;      // bumped when the wire format changes
+	static constexpr u32 CRC_INTERVAL = 60;         // frames between state checksums
+	static constexpr int CONNECT_TIMEOUT = 60;      // seconds to wait for a peer at startup
+	static constexpr int SYNC_TIMEOUT = 10;         // seconds to wait for remote inputs
+
+	// message types
+	enum : u8
+	{
+		MSG_HELLO = 0x01,                           // version/driver/delay handshake
+		MSG_INPUTS = 0x02,                          // digital port values for a future frame
+		MSG_CRC = 0x03                              // save-state checksum for a past frame
+	};
+
+	// internal helpers
+	bool connect(const std::string &address);
+	bool handshake(bool listening);
+	void disconnect(const char *message);
+	bool write_exact(const u8 *data, u32 length);
+	bool read_exact(u8 *data, u32 length, osd_ticks_t deadline);
+	bool send_message(u8 type, u32 frame, const u32 *values, u16 count);
+	bool receive_message(u8 &type, u32 &frame, std::vector<u32> &values, osd_ticks_t deadline);
+	bool pump_until_inputs(u32 frame);
+	void check_crc(u32 frame, u32 crc);
+	u32 state_crc();
+
+	// internal state
+	running_machine &   m_machine;                  // reference to our machine
+	emu_file            m_socket;                   // stream connection to the peer
+	bool                m_active;                   // flag: true while the lockstep session is running
+	int                 m_input_delay;              // frames between polling an input and applying it
+	u32                 m_frame;                    // current lockstep frame number
+	u32                 m_port_index;               // next port within the current frame
+
+	std::vector<u32>    m_local_inputs;             // digital inputs captured during this frame
+	std::map<u32, std::vector<u32>> m_local_future; // local inputs scheduled for future frames
+	std::map<u32, std::vector<u32>> m_remote_inputs; // remote inputs by the frame they apply to
+	std::vector<u32>    m_merged_inputs;            // agreed inputs to apply during the current frame
+	bool                m_merged_valid;             // flag: true once the pipeline is primed
+	std::vector<u32>    m_receive_values;           // scratch for incoming message payloads
+
+	std::map<u32, u32>  m_crc_history;              // our own state checksums by frame
+	std::vector<u8>     m_state_buffer;             // scratch buffer for checksumming
+};
+
+#endif // MAME_EMU_NETPLAY_H
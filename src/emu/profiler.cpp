@@ -24,6 +24,8 @@
 #include "emu.h"
 #include "profiler.h"
 
+#include <fstream>
+
 
 
 //**************************************************************************
@@ -38,6 +40,44 @@ struct profile_string
 
 
 
+//**************************************************************************
+//  LOCAL VARIABLES
+//**************************************************************************
+
+static const profile_string s_names[] =
+{
+	{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
+	{ PROFILER_MEM_REMAP,        "Memory Remapping" },
+	{ PROFILER_MEMREAD,          "Memory Read" },
+	{ PROFILER_MEMWRITE,         "Memory Write" },
+	{ PROFILER_VIDEO,            "Video Update" },
+	{ PROFILER_DRAWGFX,          "drawgfx" },
+	{ PROFILER_COPYBITMAP,       "copybitmap" },
+	{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
+	{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
+	{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
+	{ PROFILER_BLIT,             "OSD Blitting" },
+	{ PROFILER_SOUND,            "Sound Generation" },
+	{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
+	{ PROFILER_INPUT,            "Input Processing" },
+	{ PROFILER_MOVIE_REC,        "Movie Recording" },
+	{ PROFILER_LOGERROR,         "Error Logging" },
+	{ PROFILER_LUA,              "LUA" },
+	{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
+	{ PROFILER_USER1,            "User 1" },
+	{ PROFILER_USER2,            "User 2" },
+	{ PROFILER_USER3,            "User 3" },
+	{ PROFILER_USER4,            "User 4" },
+	{ PROFILER_USER5,            "User 5" },
+	{ PROFILER_USER6,            "User 6" },
+	{ PROFILER_USER7,            "User 7" },
+	{ PROFILER_USER8,            "User 8" },
+	{ PROFILER_PROFILER,         "Profiler" },
+	{ PROFILER_IDLE,             "Idle" }
+};
+
+
+
 //**************************************************************************
 //  GLOBAL VARIABLES
 //**************************************************************************
@@ -77,6 +117,9 @@ dummy_profiler_state::dummy_profiler_state()
 //-------------------------------------------------
 
 real_profiler_state::real_profiler_state()
+	: m_trace_index(0)
+	, m_trace_start_prof(0)
+	, m_trace_start_osd(0)
 {
 	memset(m_filo, 0, sizeof(m_filo));
 	memset(m_data, 0, sizeof(m_data));
@@ -141,38 +184,6 @@ const char *real_profiler_state::text(running_machine &machine)
 
 void real_profiler_state::update_text(running_machine &machine)
 {
-	static const profile_string names[] =
-	{
-		{ PROFILER_DRC_COMPILE,      "DRC Compilation" },
-		{ PROFILER_MEM_REMAP,        "Memory Remapping" },
-		{ PROFILER_MEMREAD,          "Memory Read" },
-		{ PROFILER_MEMWRITE,         "Memory Write" },
-		{ PROFILER_VIDEO,            "Video Update" },
-		{ PROFILER_DRAWGFX,          "drawgfx" },
-		{ PROFILER_COPYBITMAP,       "copybitmap" },
-		{ PROFILER_TILEMAP_DRAW,     "Tilemap Draw" },
-		{ PROFILER_TILEMAP_DRAW_ROZ, "Tilemap ROZ Draw" },
-		{ PROFILER_TILEMAP_UPDATE,   "Tilemap Update" },
-		{ PROFILER_BLIT,             "OSD Blitting" },
-		{ PROFILER_SOUND,            "Sound Generation" },
-		{ PROFILER_TIMER_CALLBACK,   "Timer Callbacks" },
-		{ PROFILER_INPUT,            "Input Processing" },
-		{ PROFILER_MOVIE_REC,        "Movie Recording" },
-		{ PROFILER_LOGERROR,         "Error Logging" },
-		{ PROFILER_LUA,              "LUA" },
-		{ PROFILER_EXTRA,            "Unaccounted/Overhead" },
-		{ PROFILER_USER1,            "User 1" },
-		{ PROFILER_USER2,            "User 2" },
-		{ PROFILER_USER3,            "User 3" },
-		{ PROFILER_USER4,            "User 4" },
-		{ PROFILER_USER5,            "User 5" },
-		{ PROFILER_USER6,            "User 6" },
-		{ PROFILER_USER7,            "User 7" },
-		{ PROFILER_USER8,            "User 8" },
-		{ PROFILER_PROFILER,         "Profiler" },
-		{ PROFILER_IDLE,             "Idle" }
-	};
-
 	// compute the total time for all bits, not including profiler or idle
 	u64 computed = 0;
 	profile_type curtype;
@@ -212,9 +223,17 @@ void real_profiler_state::update_text(running_machine &machine)
 
 			// and then the text
 			if (curtype >= PROFILER_DEVICE_FIRST && curtype <= PROFILER_DEVICE_MAX)
-				util::stream_format(stream, "'%s'", iter.byindex(curtype - PROFILER_DEVICE_FIRST)->tag());
+			{
+				device_t &dev = *iter.byindex(curtype - PROFILER_DEVICE_FIRST);
+				util::stream_format(stream, "'%s'", dev.tag());
+
+				// append the measured host cost per emulated second, if any
+				device_execute_interface *exec;
+				if (dev.interface(exec) && exec->run_cost_per_second() != 0)
+					util::stream_format(stream, "  %d ms/emu-sec", int(exec->run_cost_per_second() / 1000000));
+			}
 			else
-				for (auto & name : names)
+				for (auto & name : s_names)
 					if (name.type == curtype)
 					{
 						stream << name.string;
@@ -226,7 +245,105 @@ void real_profiler_state::update_text(running_machine &machine)
 		}
 	}
 
+	// append work queue activity so queue starvation shows up next to the timing data
+	osd_work_queue_stats stats;
+	for (int queuenum = 0; osd_work_queue_stats_get(queuenum, stats); queuenum++)
+		util::stream_format(stream, "Queue %d: %d/%d busy  depth %d (peak %d)  %d done of %d queued\n",
+				queuenum, stats.livethreads, stats.threads, stats.items, stats.peakitems,
+				stats.itemsdone, stats.itemsqueued);
+
 	// reset data set to 0
 	memset(m_data, 0, sizeof(m_data));
 	m_text = stream.str();
 }
+
+
+//-------------------------------------------------
+//  type_string - return the display name for a
+//  non-device profiler bucket
+//-------------------------------------------------
+
+const char *real_profiler_state::type_string(profile_type type)
+{
+	for (auto & entry : s_names)
+		if (entry.type == type)
+			return entry.string;
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  start_trace - begin recording scope
+//  transitions into the trace ring
+//-------------------------------------------------
+
+void real_profiler_state::start_trace(const char *filename)
+{
+	m_trace_file = filename;
+	m_trace_index = 0;
+	m_trace_start_prof = get_profile_ticks();
+	m_trace_start_osd = osd_ticks();
+	m_trace_events.resize(TRACE_RING_SIZE);
+}
+
+
+//-------------------------------------------------
+//  flush_trace - dump the recorded events as
+//  Chrome trace-event JSON and stop recording
+//-------------------------------------------------
+
+void real_profiler_state::flush_trace(running_machine &machine)
+{
+	if (m_trace_events.empty())
+		return;
+
+	// calibrate the profile tick rate against the OSD clock so timestamps come out in microseconds
+	osd_ticks_t profelapsed = get_profile_ticks() - m_trace_start_prof;
+	osd_ticks_t osdelapsed = osd_ticks() - m_trace_start_osd;
+	double uspertick = (profelapsed != 0) ? (1e6 * double(osdelapsed) / double(osd_ticks_per_second()) / double(profelapsed)) : 0.0;
+
+	std::ofstream file(m_trace_file);
+	if (file)
+	{
+		// snapshot the device tags up front; device buckets are indexed in enumeration order
+		std::vector<std::string> tags;
+		for (device_t &device : device_enumerator(machine.root_device()))
+			tags.push_back(device.tag());
+
+		file << "{\"traceEvents\":[\n";
+
+		// if the ring wrapped, the oldest surviving event is where the index points;
+		// a wrapped ring can start with unbalanced end events, which viewers tolerate
+		u64 first = (m_trace_index > TRACE_RING_SIZE) ? (m_trace_index - TRACE_RING_SIZE) : 0;
+		for (u64 eventnum = first; eventnum < m_trace_index; eventnum++)
+		{
+			const trace_event &event = m_trace_events[eventnum % TRACE_RING_SIZE];
+
+			// resolve the bucket name, using the device tag for device buckets
+			const char *name = "Unknown";
+			if (event.type >= PROFILER_DEVICE_FIRST && event.type <= PROFILER_DEVICE_MAX)
+			{
+				if (u32(event.type - PROFILER_DEVICE_FIRST) < tags.size())
+					name = tags[event.type - PROFILER_DEVICE_FIRST].c_str();
+			}
+			else
+				for (auto & entry : s_names)
+					if (entry.type == event.type)
+					{
+						name = entry.string;
+						break;
+					}
+
+			util::stream_format(file, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%f,\"pid\":1,\"tid\":1}",
+					(eventnum != first) ? ",\n" : "", name, event.begin ? 'B' : 'E',
+					double(event.tick - m_trace_start_prof) * uspertick);
+		}
+		file << "\n]}\n";
+	}
+	else
+		osd_printf_error("Unable to open profile trace file %s\n", m_trace_file);
+
+	// stop recording
+	m_trace_events.clear();
+	m_trace_file.clear();
+}
@@ -92,6 +92,8 @@ public:
 		return m_filoptr != nullptr;
 	}
 	const char *text(running_machine &machine);
+	osd_ticks_t data(profile_type type) const { return m_data[type]; }
+	static const char *type_string(profile_type type);
 
 	// enable/disable
 	void enable(bool state = true)
@@ -106,6 +108,10 @@ public:
 	void start(profile_type type) { if (enabled()) real_start(type); }
 	void stop() { if (enabled()) real_stop(); }
 
+	// trace recording
+	void start_trace(const char *filename);
+	void flush_trace(running_machine &machine);
+
 private:
 	void reset(bool enabled);
 	void update_text(running_machine &machine);
@@ -132,6 +138,10 @@ private:
 		// fill in this entry
 		m_filoptr->type = type;
 		m_filoptr->start = curticks;
+
+		// record the scope entry if tracing
+		if (!m_trace_events.empty())
+			record_trace(type, true, curticks);
 	}
 
 	//-------------------------------------------------
@@ -149,6 +159,10 @@ private:
 		// account for the time taken
 		m_data[m_filoptr->type] += curticks - m_filoptr->start;
 
+		// record the scope exit if tracing
+		if (!m_trace_events.empty())
+			record_trace(m_filoptr->type, false, curticks);
+
 		// move back an entry
 		m_filoptr--;
 
@@ -163,12 +177,40 @@ private:
 		osd_ticks_t     start;                      // start time
 	};
 
+	// a recorded scope transition in the trace ring
+	struct trace_event
+	{
+		osd_ticks_t     tick;                       // time of the transition
+		s32             type;                       // profile_type of the scope
+		bool            begin;                      // true on scope entry, false on exit
+	};
+
+	// number of events kept in the trace ring; older events are overwritten
+	static constexpr u64 TRACE_RING_SIZE = 0x100000;
+
+	//-------------------------------------------------
+	//  record_trace - append an event to the ring,
+	//  overwriting the oldest once it wraps
+	//-------------------------------------------------
+	ATTR_FORCE_INLINE void record_trace(int type, bool begin, osd_ticks_t tick)
+	{
+		trace_event &event = m_trace_events[m_trace_index++ % TRACE_RING_SIZE];
+		event.tick = tick;
+		event.type = type;
+		event.begin = begin;
+	}
+
 	// internal state
 	filo_entry *        m_filoptr;                  // current FILO index
 	std::string         m_text;                     // profiler text
 	attotime            m_text_time;                // profiler text last update
 	filo_entry          m_filo[32];                 // array of FILO entries
 	osd_ticks_t         m_data[PROFILER_TOTAL + 1]; // array of data
+	std::vector<trace_event> m_trace_events;        // trace ring; empty unless tracing
+	u64                 m_trace_index;              // total events recorded so far
+	std::string         m_trace_file;               // output filename for the trace dump
+	osd_ticks_t         m_trace_start_prof;         // profile tick count when tracing began
+	osd_ticks_t         m_trace_start_osd;          // OSD tick count when tracing began
 };
 
 
@@ -183,6 +225,8 @@ public:
 	// getters
 	bool enabled() const { return false; }
 	const char *text(running_machine &machine) { return ""; }
+	osd_ticks_t data(profile_type type) const { return 0; }
+	static const char *type_string(profile_type type) { return nullptr; }
 
 	// enable/disable
 	void enable(bool state = true) { }
@@ -190,6 +234,10 @@ public:
 	// start/stop
 	void start(profile_type type) { }
 	void stop() { }
+
+	// trace recording
+	void start_trace(const char *filename) { }
+	void flush_trace(running_machine &machine) { }
 };
 
 
@@ -24,11 +24,13 @@ namespace
 		{
 		}
 
+		~avi_movie_recording();
+
 		bool initialize(running_machine &machine, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool write_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	private:
 		avi_file::ptr m_avi_file; // handle to the open movie file
@@ -42,15 +44,34 @@ namespace
 		~mng_movie_recording();
 
 		bool initialize(std::unique_ptr<emu_file> &&file, bitmap_t &snap_bitmap);
-		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	protected:
 		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool write_sound_to_recording(const s16 *sound, int numsamples) override;
 
 	private:
 		std::unique_ptr<emu_file> m_mng_file; // handle to the open movie file
 		std::map<std::string, std::string> m_info_fields;
 	};
+
+
+	// writes unannotated BGRA32 frames for consumption by an external
+	// encoder (e.g. ffmpeg -f rawvideo -pix_fmt bgra)
+	class raw_movie_recording : public movie_recording
+	{
+	public:
+		raw_movie_recording(screen_device *screen);
+		~raw_movie_recording();
+
+		bool initialize(std::unique_ptr<emu_file> &&file);
+
+	protected:
+		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+		virtual bool write_sound_to_recording(const s16 *sound, int numsamples) override;
+
+	private:
+		std::unique_ptr<emu_file> m_raw_file; // handle to the open movie file
+	};
 };
 
 
@@ -67,6 +88,8 @@ movie_recording::movie_recording(screen_device *screen)
 	, m_frame_period(attotime::zero)
 	, m_next_frame_time(attotime::zero)
 	, m_frame(0)
+	, m_encode_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
+	, m_encode_error(false)
 {
 }
 
@@ -77,6 +100,68 @@ movie_recording::movie_recording(screen_device *screen)
 
 movie_recording::~movie_recording()
 {
+	flush_encoder();
+	osd_work_queue_free(m_encode_queue);
+	for (encode_request *request : m_request_pool)
+		delete request;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::flush_encoder
+//-------------------------------------------------
+
+void movie_recording::flush_encoder()
+{
+	osd_work_queue_wait(m_encode_queue, osd_ticks_per_second() * 10);
+}
+
+
+//-------------------------------------------------
+//  movie_recording::alloc_request
+//-------------------------------------------------
+
+movie_recording::encode_request *movie_recording::alloc_request()
+{
+	// grab a pooled request, or make a new one
+	{
+		std::lock_guard<std::mutex> lock(m_pool_lock);
+		if (!m_request_pool.empty())
+		{
+			encode_request *request = m_request_pool.back();
+			m_request_pool.pop_back();
+			return request;
+		}
+	}
+	encode_request *request = new encode_request;
+	request->recording = this;
+	return request;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::encode_callback - encode and
+//  write a queued request on the worker
+//-------------------------------------------------
+
+void *movie_recording::encode_callback(void *param, int threadid)
+{
+	auto *request = reinterpret_cast<encode_request *>(param);
+	movie_recording &recording = *request->recording;
+
+	// perform the format-specific encode and write
+	bool success;
+	if (request->is_sound)
+		success = recording.write_sound_to_recording(&request->samples[0], int(request->samples.size() / 2));
+	else
+		success = recording.append_single_video_frame(request->bitmap, request->palette.empty() ? nullptr : &request->palette[0], int(request->palette.size()));
+	if (!success)
+		recording.m_encode_error = true;
+
+	// recycle the request
+	std::lock_guard<std::mutex> lock(recording.m_pool_lock);
+	recording.m_request_pool.push_back(request);
+	return nullptr;
 }
 
 
@@ -94,15 +179,40 @@ bool movie_recording::append_video_frame(bitmap_rgb32 &bitmap, attotime curtime)
 	// keep appending frames until we're at curtime
 	while (next_frame_time() <= curtime)
 	{
-		// append this bitmap as a single frame
-		if (!append_single_video_frame(bitmap, palette, palette_entries))
-			return false;
+		// snapshot this bitmap and queue it for encoding; the copy is cheap
+		// compared to the compression it keeps off the emulation thread
+		encode_request *request = alloc_request();
+		request->is_sound = false;
+		request->bitmap.resize(bitmap.width(), bitmap.height());
+		copybitmap(request->bitmap, bitmap, 0, 0, 0, 0, request->bitmap.cliprect());
+		request->palette.clear();
+		if (palette_entries != 0)
+			request->palette.assign(palette, palette + palette_entries);
+		osd_work_item_queue(m_encode_queue, encode_callback, request, WORK_ITEM_FLAG_AUTO_RELEASE);
 		m_frame++;
 
 		// advance time
 		set_next_frame_time(next_frame_time() + frame_period());
 	}
-	return true;
+
+	// failures on the encoder surface on the following call
+	return !m_encode_error;
+}
+
+
+//-------------------------------------------------
+//  movie_recording::add_sound_to_recording
+//-------------------------------------------------
+
+bool movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+{
+	// copy the interleaved stereo samples and queue them behind any
+	// pending frames so the output stays in order
+	encode_request *request = alloc_request();
+	request->is_sound = true;
+	request->samples.assign(sound, sound + numsamples * 2);
+	osd_work_item_queue(m_encode_queue, encode_callback, request, WORK_ITEM_FLAG_AUTO_RELEASE);
+	return !m_encode_error;
 }
 
 
@@ -136,6 +246,14 @@ movie_recording::ptr movie_recording::create(running_machine &machine, screen_de
 		}
 		break;
 
+	case movie_recording::format::RAW:
+		{
+			auto raw_recording = std::make_unique<raw_movie_recording>(screen);
+			if (raw_recording->initialize(std::move(file)))
+				result = std::move(raw_recording);
+		}
+		break;
+
 	default:
 		throw false;
 	}
@@ -157,11 +275,23 @@ const char *movie_recording::format_file_extension(movie_recording::format fmt)
 	{
 		case format::AVI:   return "avi";
 		case format::MNG:   return "mng";
+		case format::RAW:   return "raw";
 		default:            throw false;
 	}
 }
 
 
+//-------------------------------------------------
+//  avi_movie_recording - destructor
+//-------------------------------------------------
+
+avi_movie_recording::~avi_movie_recording()
+{
+	// drain the encoder before the AVI file goes away
+	flush_encoder();
+}
+
+
 //-------------------------------------------------
 //  avi_movie_recording::initialize
 //-------------------------------------------------
@@ -213,19 +343,15 @@ bool avi_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 
 
 //-------------------------------------------------
-//  avi_movie_recording::append_video_frame
+//  avi_movie_recording::write_sound_to_recording
 //-------------------------------------------------
 
-bool avi_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool avi_movie_recording::write_sound_to_recording(const s16 *sound, int numsamples)
 {
-	g_profiler.start(PROFILER_MOVIE_REC);
-
-	// write the next frame
+	// write the next samples
 	avi_file::error avierr = m_avi_file->append_sound_samples(0, sound + 0, numsamples, 1);
 	if (avierr == avi_file::error::NONE)
 		avierr = m_avi_file->append_sound_samples(1, sound + 1, numsamples, 1);
-
-	g_profiler.stop();
 	return avierr == avi_file::error::NONE;
 }
 
@@ -247,6 +373,8 @@ mng_movie_recording::mng_movie_recording(screen_device *screen, std::map<std::st
 
 mng_movie_recording::~mng_movie_recording()
 {
+	// drain the encoder before closing out the capture
+	flush_encoder();
 	if (m_mng_file)
 		util::mng_capture_stop(*m_mng_file);
 }
@@ -291,10 +419,72 @@ bool mng_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 
 
 //-------------------------------------------------
-//  mng_movie_recording::add_sound_to_recording
+//  mng_movie_recording::write_sound_to_recording
+//-------------------------------------------------
+
+bool mng_movie_recording::write_sound_to_recording(const s16 *sound, int numsamples)
+{
+	// not supported; do nothing
+	return true;
+}
+
+
+//-------------------------------------------------
+//  raw_movie_recording - constructor
+//-------------------------------------------------
+
+raw_movie_recording::raw_movie_recording(screen_device *screen)
+	: movie_recording(screen)
+{
+}
+
+
+//-------------------------------------------------
+//  raw_movie_recording - destructor
+//-------------------------------------------------
+
+raw_movie_recording::~raw_movie_recording()
+{
+	// drain the encoder before the file goes away
+	flush_encoder();
+}
+
+
+//-------------------------------------------------
+//  raw_movie_recording::initialize
+//-------------------------------------------------
+
+bool raw_movie_recording::initialize(std::unique_ptr<emu_file> &&file)
+{
+	// compute the frame time
+	set_frame_period(screen() ? screen()->frame_period() : attotime::from_hz(screen_device::DEFAULT_FRAME_RATE));
+
+	m_raw_file = std::move(file);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  raw_movie_recording::append_single_video_frame
+//-------------------------------------------------
+
+bool raw_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries)
+{
+	// write the rows out back-to-back; the consumer is expected to know
+	// the frame size and rate
+	u32 const rowbytes = bitmap.width() * 4;
+	for (s32 y = 0; y < bitmap.height(); y++)
+		if (m_raw_file->write(&bitmap.pix(y), rowbytes) != rowbytes)
+			return false;
+	return true;
+}
+
+
+//-------------------------------------------------
+//  raw_movie_recording::write_sound_to_recording
 //-------------------------------------------------
 
-bool mng_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+bool raw_movie_recording::write_sound_to_recording(const s16 *sound, int numsamples)
 {
 	// not supported; do nothing
 	return true;
@@ -17,7 +17,10 @@
 #ifndef MAME_EMU_RECORDING_H
 #define MAME_EMU_RECORDING_H
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "attotime.h"
 #include "palette.h"
@@ -38,7 +41,8 @@ public:
 	enum class format
 	{
 		MNG,
-		AVI
+		AVI,
+		RAW
 	};
 
 	typedef std::unique_ptr<movie_recording> ptr;
@@ -52,11 +56,10 @@ public:
 	void set_next_frame_time(attotime time) { m_next_frame_time = time; }
 	attotime next_frame_time() const        { return m_next_frame_time; }
 
-	// methods
+	// methods; these copy the frame/samples and queue the encode and write
+	// to a per-recording worker, so the emulation thread never compresses
 	bool append_video_frame(bitmap_rgb32 &bitmap, attotime curtime);
-
-	// virtuals
-	virtual bool add_sound_to_recording(const s16 *sound, int numsamples) = 0;
+	bool add_sound_to_recording(const s16 *sound, int numsamples);
 
 	// statics
 	static movie_recording::ptr create(running_machine &machine, screen_device *screen, format fmt, std::unique_ptr<emu_file> &&file, bitmap_rgb32 &snap_bitmap);
@@ -68,18 +71,41 @@ protected:
 	movie_recording(const movie_recording &) = delete;
 	movie_recording(movie_recording &&) = delete;
 
-	// virtuals
+	// virtuals, called from the encoder queue only
 	virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) = 0;
+	virtual bool write_sound_to_recording(const s16 *sound, int numsamples) = 0;
 
 	// accessors
 	int current_frame() const { return m_frame; }
 	void set_frame_period(attotime time) { m_frame_period = time; }
 
+	// waits until all queued frames have been written; subclasses must call
+	// this from their destructors before tearing down their output files
+	void flush_encoder();
+
 private:
+	// a copied frame or sound chunk waiting to be encoded and written
+	struct encode_request
+	{
+		movie_recording *recording;         // owning recording
+		bool            is_sound;           // sound samples or video frame?
+		bitmap_rgb32    bitmap;             // copy of the frame to encode
+		std::vector<rgb_t> palette;         // copied palette entries
+		std::vector<s16> samples;           // copied interleaved sound samples
+	};
+
+	// internal helpers
+	encode_request *alloc_request();
+	static void *encode_callback(void *param, int threadid);
+
 	screen_device * m_screen;               // screen associated with this movie (can be nullptr)
 	attotime        m_frame_period;         // duration of movie frame
 	attotime        m_next_frame_time;      // time of next frame
 	int             m_frame;                // current movie frame number
+	osd_work_queue *m_encode_queue;         // queue performing encodes and writes
+	std::mutex      m_pool_lock;            // lock protecting the request pool
+	std::vector<encode_request *> m_request_pool; // recycled requests
+	std::atomic<bool> m_encode_error;       // set when a queued write fails
 };
 
 
@@ -295,6 +295,7 @@ render_texture::render_texture()
 		m_format(TEXFORMAT_ARGB32),
 		m_id(~0ULL),
 		m_old_id(~0ULL),
+		m_sequence(0),
 		m_scaler(nullptr),
 		m_param(nullptr),
 		m_curseq(0)
@@ -376,6 +377,7 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	m_bitmap = &bitmap;
 	m_sbounds = sbounds;
 	m_format = format;
+	m_sequence++;
 
 	// invalidate all scaled versions
 	for (auto & elem : m_scaled)
@@ -590,6 +592,7 @@ void render_container::set_overlay(bitmap_argb32 *bitmap)
 		m_overlaytexture = m_manager.texture_alloc(render_container::overlay_scale);
 		m_overlaytexture->set_bitmap(*bitmap, bitmap->cliprect(), TEXFORMAT_ARGB32);
 	}
+	m_version++;
 }
 
 
@@ -602,6 +605,7 @@ void render_container::set_user_settings(const user_settings &settings)
 {
 	m_user = settings;
 	recompute_lookups();
+	m_version++;
 }
 
 
@@ -614,6 +618,7 @@ void render_container::add_line(float x0, float y0, float x1, float y1, float wi
 	item &newitem = add_generic(CONTAINER_ITEM_LINE, x0, y0, x1, y1, argb);
 	newitem.m_width = width;
 	newitem.m_flags = flags;
+	mix_item(newitem);
 }
 
 
@@ -626,6 +631,7 @@ void render_container::add_quad(float x0, float y0, float x1, float y1, rgb_t ar
 	item &newitem = add_generic(CONTAINER_ITEM_QUAD, x0, y0, x1, y1, argb);
 	newitem.m_texture = texture;
 	newitem.m_flags = flags;
+	mix_item(newitem);
 }
 
 
@@ -646,6 +652,7 @@ void render_container::add_char(float x0, float y0, float height, float aspect,
 	newitem.m_texture = texture;
 	newitem.m_flags = PRIMFLAG_TEXORIENT(ROT0) | PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA) | PRIMFLAG_PACKABLE;
 	newitem.m_internal = INTERNAL_FLAG_CHAR;
+	mix_item(newitem);
 }
 
 
@@ -765,6 +772,27 @@ render_container::item &render_container::add_generic(u8 type, float x0, float y
 }
 
 
+//-------------------------------------------------
+//  mix_item - fold a completed item into the
+//  container's content hash
+//-------------------------------------------------
+
+void render_container::mix_item(const item &newitem)
+{
+	auto mix = [this] (u64 value) { m_content_hash = (m_content_hash * 0x100000001b3ULL) ^ value; };
+	mix((u64(newitem.m_type) << 56) | (u64(newitem.m_internal) << 32) | newitem.m_flags);
+	mix((u64(f2u(newitem.m_bounds.x0)) << 32) | f2u(newitem.m_bounds.y0));
+	mix((u64(f2u(newitem.m_bounds.x1)) << 32) | f2u(newitem.m_bounds.y1));
+	mix((u64(f2u(newitem.m_color.r)) << 32) | f2u(newitem.m_color.g));
+	mix((u64(f2u(newitem.m_color.b)) << 32) | f2u(newitem.m_color.a));
+	mix(u64(f2u(newitem.m_width)));
+
+	// a texture's sequence number changes when its bitmap is reset, so an
+	// in-place texture update never reads as clean
+	mix(u64(uintptr_t(newitem.m_texture)) ^ (newitem.m_texture != nullptr ? (u64(newitem.m_texture->sequence()) << 48) : 0));
+}
+
+
 //-------------------------------------------------
 //  recompute_lookups - recompute the lookup table
 //  for the render container
@@ -1029,6 +1057,7 @@ void render_target::set_view(unsigned viewindex)
 	{
 		m_curview = viewindex;
 		current_view().recompute(visibility_mask(), m_layerconfig.zoom_to_screen());
+		m_geometry_valid = false;
 		current_view().preload();
 	}
 }
@@ -1059,6 +1088,7 @@ void render_target::set_visibility_toggle(unsigned index, bool enable)
 	else
 		m_views[m_curview].second &= ~(u32(1) << index);
 	current_view().recompute(visibility_mask(), m_layerconfig.zoom_to_screen());
+	m_geometry_valid = false;
 	current_view().preload();
 }
 
@@ -1338,6 +1368,9 @@ void render_target::compute_minimum_size(s32 &minwidth, s32 &minheight)
 
 render_primitive_list &render_target::get_primitives()
 {
+	// attribute per-frame primitive allocations when tracking is enabled
+	MAME_ALLOC_SCOPE("render primitives");
+
 	// switch to the next primitive list
 	render_primitive_list &list = m_primlist[m_listindex];
 	m_listindex = (m_listindex + 1) % std::size(m_primlist);
@@ -1346,9 +1379,44 @@ render_primitive_list &render_target::get_primitives()
 	// free any previous primitives
 	list.release_all();
 
-	// compute the visible width/height
+	// accumulate a key for everything the view geometry depends on
+	u64 geokey = (u64(m_width) << 32) ^ u64(u32(m_height)) ^ (u64(m_orientation) << 24) ^ (u64(m_curview) << 16);
+	{
+		auto geomix = [&geokey] (u64 value) { geokey = (geokey * 0x100000001b3ULL) ^ value; };
+		u32 aspect_bits = 0;
+		std::memcpy(&aspect_bits, &m_pixel_aspect, sizeof(aspect_bits));
+		geomix(aspect_bits);
+		geomix(visibility_mask());
+		geomix((u64(u32(m_scale_mode)) << 32) | (u64(u16(m_int_scale_x)) << 16) | u64(u16(m_int_scale_y)));
+		geomix((m_keepaspect ? 1 : 0) | (m_int_overscan ? 2 : 0) | (m_layerconfig.zoom_to_screen() ? 4 : 0));
+		if (m_manager.machine().phase() >= machine_phase::RESET)
+			for (layout_view_item &curitem : current_view().items())
+				if (curitem.screen())
+				{
+					rectangle const visarea = curitem.screen()->visible_area();
+					geomix((u64(u32(visarea.left())) << 32) | u32(visarea.top()));
+					geomix((u64(u32(visarea.right())) << 32) | u32(visarea.bottom()));
+					geomix(curitem.screen()->container().orientation());
+				}
+	}
+
+	// compute the visible width/height, reusing the cached geometry when
+	// none of its inputs have changed since the last frame
 	s32 viswidth, visheight;
-	compute_visible_area(m_width, m_height, m_pixel_aspect, m_orientation, viswidth, visheight);
+	bool const geometry_rebuilt = !m_geometry_valid || (geokey != m_geometry_key);
+	if (geometry_rebuilt)
+	{
+		compute_visible_area(m_width, m_height, m_pixel_aspect, m_orientation, viswidth, visheight);
+		m_geometry_key = geokey;
+		m_geometry_valid = true;
+		m_geometry_viswidth = viswidth;
+		m_geometry_visheight = visheight;
+	}
+	else
+	{
+		viswidth = m_geometry_viswidth;
+		visheight = m_geometry_visheight;
+	}
 
 	// create a root transform for the target
 	object_transform root_xform;
@@ -1360,25 +1428,80 @@ render_primitive_list &render_target::get_primitives()
 	root_xform.orientation = m_orientation;
 	root_xform.no_center = false;
 
+	// accumulate a version for everything feeding this list so unchanged
+	// frames can be detected; live screens mix in their frame number, which
+	// makes the result conservative (never falsely clean) while running
+	u64 version = (u64(m_width) << 32) ^ u64(u32(m_height)) ^ (u64(m_orientation) << 24) ^ (u64(m_curview) << 16);
+	auto mix = [&version] (u64 value) { version = (version * 0x100000001b3ULL) ^ value; };
+
 	if (m_manager.machine().phase() >= machine_phase::RESET)
 	{
 		// we're running - iterate over items in the view
 		current_view().prepare_items();
-		for (layout_view_item &curitem : current_view().visible_items())
+		layout_view::item_ref_vector const &items = current_view().visible_items();
+
+		// refresh the flat per-item transform array when the geometry moved;
+		// items with animated or scripted bounds stay dynamic
+		if (geometry_rebuilt || m_item_transforms.size() != items.size())
 		{
-			// first apply orientation to the bounds
-			render_bounds bounds = curitem.bounds();
-			apply_orientation(bounds, root_xform.orientation);
-			normalize_bounds(bounds);
+			m_item_transforms.resize(items.size());
+			for (size_t itemnum = 0; items.size() != itemnum; itemnum++)
+			{
+				layout_view_item &curitem = items[itemnum].get();
+				cached_item_transform &cached = m_item_transforms[itemnum];
+				cached.dynamic = curitem.bounds_animated() || curitem.bounds_scripted();
+				if (!cached.dynamic)
+				{
+					// first apply orientation to the bounds
+					render_bounds bounds = curitem.bounds();
+					apply_orientation(bounds, root_xform.orientation);
+					normalize_bounds(bounds);
+
+					// then fold in the root transform
+					cached.xoffs = root_xform.xoffs + bounds.x0 * root_xform.xscale;
+					cached.yoffs = root_xform.yoffs + bounds.y0 * root_xform.yscale;
+					cached.xscale = (bounds.x1 - bounds.x0) * root_xform.xscale;
+					cached.yscale = (bounds.y1 - bounds.y0) * root_xform.yscale;
+					cached.orientation = orientation_add(curitem.orientation(), root_xform.orientation);
+				}
+			}
+		}
+
+		for (size_t itemnum = 0; items.size() != itemnum; itemnum++)
+		{
+			layout_view_item &curitem = items[itemnum].get();
+			cached_item_transform const &cached = m_item_transforms[itemnum];
+			if (curitem.screen())
+			{
+				mix(curitem.screen()->container().version());
+				mix(curitem.screen()->frame_number());
+			}
+			else
+				mix(u32(curitem.element_state()));
 
-			// apply the transform to the item
+			// apply the transform to the item; color is always live since
+			// it is cheap and can be animated independently
 			object_transform item_xform;
-			item_xform.xoffs = root_xform.xoffs + bounds.x0 * root_xform.xscale;
-			item_xform.yoffs = root_xform.yoffs + bounds.y0 * root_xform.yscale;
-			item_xform.xscale = (bounds.x1 - bounds.x0) * root_xform.xscale;
-			item_xform.yscale = (bounds.y1 - bounds.y0) * root_xform.yscale;
+			if (cached.dynamic)
+			{
+				render_bounds bounds = curitem.bounds();
+				apply_orientation(bounds, root_xform.orientation);
+				normalize_bounds(bounds);
+				item_xform.xoffs = root_xform.xoffs + bounds.x0 * root_xform.xscale;
+				item_xform.yoffs = root_xform.yoffs + bounds.y0 * root_xform.yscale;
+				item_xform.xscale = (bounds.x1 - bounds.x0) * root_xform.xscale;
+				item_xform.yscale = (bounds.y1 - bounds.y0) * root_xform.yscale;
+				item_xform.orientation = orientation_add(curitem.orientation(), root_xform.orientation);
+			}
+			else
+			{
+				item_xform.xoffs = cached.xoffs;
+				item_xform.yoffs = cached.yoffs;
+				item_xform.xscale = cached.xscale;
+				item_xform.yscale = cached.yscale;
+				item_xform.orientation = cached.orientation;
+			}
 			item_xform.color = curitem.color() * root_xform.color;
-			item_xform.orientation = orientation_add(curitem.orientation(), root_xform.orientation);
 			item_xform.no_center = false;
 
 			// if there is no associated element, it must be a screen element
@@ -1426,8 +1549,13 @@ render_primitive_list &render_target::get_primitives()
 
 		// add UI elements
 		add_container_primitives(list, root_xform, ui_xform, m_manager.ui_container(), BLENDMODE_ALPHA);
+		mix(m_manager.ui_container().version());
 	}
 
+	// update the dirty state now that all inputs have been mixed in
+	m_primitives_changed = (version != m_primitives_version);
+	m_primitives_version = version;
+
 	// optimize the list before handing it off
 	add_clear_and_optimize_primitive_list(list);
 	list.release_lock();
@@ -1590,6 +1718,7 @@ void render_target::resolve_tags()
 		file.resolve_tags();
 
 	current_view().recompute(visibility_mask(), m_layerconfig.zoom_to_screen());
+	m_geometry_valid = false;
 	current_view().preload();
 }
 
@@ -1602,6 +1731,7 @@ void render_target::resolve_tags()
 void render_target::update_layer_config()
 {
 	current_view().recompute(visibility_mask(), m_layerconfig.zoom_to_screen());
+	m_geometry_valid = false;
 }
 
 
@@ -2560,9 +2690,44 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 
 std::pair<float, float> render_target::map_point_internal(s32 target_x, s32 target_y)
 {
-	// compute the visible width/height
+	// accumulate a key for everything the view geometry depends on
+	u64 geokey = (u64(m_width) << 32) ^ u64(u32(m_height)) ^ (u64(m_orientation) << 24) ^ (u64(m_curview) << 16);
+	{
+		auto geomix = [&geokey] (u64 value) { geokey = (geokey * 0x100000001b3ULL) ^ value; };
+		u32 aspect_bits = 0;
+		std::memcpy(&aspect_bits, &m_pixel_aspect, sizeof(aspect_bits));
+		geomix(aspect_bits);
+		geomix(visibility_mask());
+		geomix((u64(u32(m_scale_mode)) << 32) | (u64(u16(m_int_scale_x)) << 16) | u64(u16(m_int_scale_y)));
+		geomix((m_keepaspect ? 1 : 0) | (m_int_overscan ? 2 : 0) | (m_layerconfig.zoom_to_screen() ? 4 : 0));
+		if (m_manager.machine().phase() >= machine_phase::RESET)
+			for (layout_view_item &curitem : current_view().items())
+				if (curitem.screen())
+				{
+					rectangle const visarea = curitem.screen()->visible_area();
+					geomix((u64(u32(visarea.left())) << 32) | u32(visarea.top()));
+					geomix((u64(u32(visarea.right())) << 32) | u32(visarea.bottom()));
+					geomix(curitem.screen()->container().orientation());
+				}
+	}
+
+	// compute the visible width/height, reusing the cached geometry when
+	// none of its inputs have changed since the last frame
 	s32 viswidth, visheight;
-	compute_visible_area(m_width, m_height, m_pixel_aspect, m_orientation, viswidth, visheight);
+	bool const geometry_rebuilt = !m_geometry_valid || (geokey != m_geometry_key);
+	if (geometry_rebuilt)
+	{
+		compute_visible_area(m_width, m_height, m_pixel_aspect, m_orientation, viswidth, visheight);
+		m_geometry_key = geokey;
+		m_geometry_valid = true;
+		m_geometry_viswidth = viswidth;
+		m_geometry_visheight = visheight;
+	}
+	else
+	{
+		viswidth = m_geometry_viswidth;
+		visheight = m_geometry_visheight;
+	}
 
 	// create a root transform for the target
 	object_transform root_xform;
@@ -2698,6 +2863,7 @@ void render_target::config_load(util::xml::data_node const *targetnode)
 		if (&current_view() == &view->first)
 		{
 			current_view().recompute(visibility_mask(), m_layerconfig.zoom_to_screen());
+			m_geometry_valid = false;
 			current_view().preload();
 		}
 	}
@@ -293,8 +293,8 @@ private:
 	simple_list<render_primitive> m_primlist;               // list of primitives
 	simple_list<reference> m_reflist;                       // list of references
 
-	fixed_allocator<render_primitive> m_primitive_allocator;// allocator for primitives
-	fixed_allocator<reference> m_reference_allocator;       // allocator for references
+	chunked_allocator<render_primitive> m_primitive_allocator; // allocator for primitives
+	chunked_allocator<reference> m_reference_allocator;     // allocator for references
 
 	std::recursive_mutex     m_lock;                             // lock to protect list accesses
 };
@@ -328,6 +328,9 @@ public:
 	// configure the texture bitmap
 	void set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, texture_format format);
 
+	// content sequence number, bumped on every set_bitmap
+	u32 sequence() const { return m_sequence; }
+
 	// set a unique identifier
 	void set_id(u64 id) { m_old_id = m_id; m_id = id; }
 
@@ -356,6 +359,7 @@ private:
 	texture_format      m_format;                   // format of the texture data
 	u64                 m_id;                       // unique id to pass to osd
 	u64                 m_old_id;                   // previous id, if applicable
+	u32                 m_sequence;                 // bumped whenever the bitmap is (re)set
 
 	// scaling state (ARGB32 only)
 	texture_scaler_func m_scaler;                   // scaling callback
@@ -407,12 +411,16 @@ public:
 	bool is_empty() const { return m_itemlist.empty(); }
 	const user_settings &get_user_settings() const { return m_user; }
 
+	// content-derived version; redrawing identical items leaves it
+	// unchanged so downstream primitive lists can be detected as clean
+	u64 version() const { return (u64(m_version) << 32) ^ m_content_hash; }
+
 	// setters
 	void set_overlay(bitmap_argb32 *bitmap);
 	void set_user_settings(const user_settings &settings);
 
 	// empty the item list
-	void empty() { m_item_allocator.reclaim_all(m_itemlist); }
+	void empty() { m_item_allocator.reclaim_all(m_itemlist); m_content_hash = CONTENT_HASH_BASIS; }
 
 	// add items to the list
 	void add_line(float x0, float y0, float x1, float y1, float width, rgb_t argb, u32 flags);
@@ -465,9 +473,13 @@ private:
 	// internal helpers
 	const simple_list<item> &items() const { return m_itemlist; }
 	item &add_generic(u8 type, float x0, float y0, float x1, float y1, rgb_t argb);
+	void mix_item(const item &newitem);
 	void recompute_lookups();
 	void update_palette();
 
+	// FNV-1 offset basis, the content hash of an empty container
+	static constexpr u64 CONTENT_HASH_BASIS = 0xcbf29ce484222325ULL;
+
 	// internal state
 	render_manager &        m_manager;              // reference back to the owning manager
 	simple_list<item>       m_itemlist;             // head of the item list
@@ -479,6 +491,8 @@ private:
 	std::unique_ptr<palette_client> m_palclient;    // client to the screen palette
 	std::vector<rgb_t>      m_bcglookup;            // copy of screen palette with bcg adjustment
 	rgb_t                   m_bcglookup256[0x400];  // lookup table for brightness/contrast/gamma
+	u32                     m_version = 0;          // bumped on settings/overlay changes
+	u64                     m_content_hash = CONTENT_HASH_BASIS; // running hash of the current items
 };
 
 
@@ -531,6 +545,7 @@ public:
 
 	// layer config setters
 	void set_visibility_toggle(unsigned index, bool enable);
+	void invalidate_view_geometry() { m_geometry_valid = false; }
 	void set_screen_overlay_enabled(bool enable) { m_layerconfig.set_screen_overlay_enabled(enable); update_layer_config(); }
 	void set_zoom_to_screen(bool zoom) { m_layerconfig.set_zoom_to_screen(zoom); update_layer_config(); }
 
@@ -547,6 +562,11 @@ public:
 	// get a primitive list
 	render_primitive_list &get_primitives();
 
+	// dirty tracking; true if the last get_primitives() produced a list
+	// whose inputs differ from the previous one, so an OSD may skip
+	// recompositing when this is false; conservative for live screens
+	bool primitives_changed() const { return m_primitives_changed; }
+
 	// hit testing
 	bool map_point_container(s32 target_x, s32 target_y, render_container &container, float &container_x, float &container_y);
 	bool map_point_input(s32 target_x, s32 target_y, ioport_port *&input_port, ioport_value &input_mask, float &input_x, float &input_y);
@@ -564,6 +584,16 @@ private:
 	// private classes declared in render.cpp
 	struct object_transform;
 
+	// precomputed per-item placement, so unchanged frames skip the
+	// orientation/normalization math in get_primitives
+	struct cached_item_transform
+	{
+		float               xoffs, yoffs;       // precomputed offsets
+		float               xscale, yscale;     // precomputed scales
+		int                 orientation;        // combined orientation
+		bool                dynamic;            // bounds can change from frame to frame
+	};
+
 	// internal helpers
 	enum constructor_impl_t { CONSTRUCTOR_IMPL };
 	template <typename T> render_target(render_manager &manager, T&& layout, u32 flags, constructor_impl_t);
@@ -605,6 +635,13 @@ private:
 	u32                     m_flags;                    // creation flags
 	render_primitive_list   m_primlist[NUM_PRIMLISTS];  // list of primitives
 	int                     m_listindex;                // index of next primlist to use
+	u64                     m_primitives_version = 0;   // combined version of the last list's inputs
+	bool                    m_primitives_changed = true; // did the last list differ from its predecessor?
+	u64                     m_geometry_key = 0;         // inputs the cached view geometry was computed for
+	bool                    m_geometry_valid = false;   // true if the cached view geometry can be reused
+	s32                     m_geometry_viswidth = 0;    // cached visible width
+	s32                     m_geometry_visheight = 0;   // cached visible height
+	std::vector<cached_item_transform> m_item_transforms; // flat per-visible-item transforms
 	s32                     m_width;                    // width in pixels
 	s32                     m_height;                   // height in pixels
 	render_bounds           m_bounds;                   // bounds of the target
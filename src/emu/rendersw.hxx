@@ -13,6 +13,7 @@
 #include "eminline.h"
 #include "video/rgbutil.h"
 #include "render.h"
+#include "rendutil.h"
 
 
 template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB, bool NoDestRead = false, bool BilinearFilter = false>
@@ -1026,6 +1027,64 @@ private:
 		// fast case: no coloring, no alpha
 		if (prim.color.r >= 1.0f && prim.color.g >= 1.0f && prim.color.b >= 1.0f && is_opaque(prim.color.a))
 		{
+			// fastest case: unity-scale axis-aligned quads with an identity
+			// pixel format can be copied a row at a time, which the compiler
+			// turns into wide vector moves
+			if (!BilinearFilter && !palbase &&
+				sizeof(PixelType) == sizeof(u32) &&
+				SrcShiftR == 0 && SrcShiftG == 0 && SrcShiftB == 0 &&
+				DstShiftR == 16 && DstShiftG == 8 && DstShiftB == 0 &&
+				setup.dudx == 0x10000 && setup.dvdx == 0 && setup.dudy == 0 && setup.dvdy == 0x10000 &&
+				(setup.startu & 0xffff) == 0 && (setup.startv & 0xffff) == 0)
+			{
+				s32 const width = setup.endx - setup.startx;
+				s32 const height = setup.endy - setup.starty;
+				s32 const u0 = setup.startu >> 16;
+				s32 const v0 = setup.startv >> 16;
+				if (width > 0 && u0 >= 0 && v0 >= 0 && (u0 + width) <= s32(prim.texture.width) && (v0 + height) <= s32(prim.texture.height))
+				{
+					u32 const *src = reinterpret_cast<u32 const *>(prim.texture.base) + v0 * prim.texture.rowpixels + u0;
+					PixelType *dest = dstdata + setup.starty * pitch + setup.startx;
+					for (s32 y = 0; y < height; y++)
+					{
+						std::memcpy(dest, src, size_t(width) * sizeof(u32));
+						src += prim.texture.rowpixels;
+						dest += pitch;
+					}
+					return;
+				}
+			}
+
+			// rotated-screen case: unity-scale quads with swapped axes
+			// become a cache-blocked transpose instead of a walk down a
+			// texture column for every destination row
+			if (!BilinearFilter && !palbase &&
+				sizeof(PixelType) == sizeof(u32) &&
+				SrcShiftR == 0 && SrcShiftG == 0 && SrcShiftB == 0 &&
+				DstShiftR == 16 && DstShiftG == 8 && DstShiftB == 0 &&
+				setup.dudx == 0 && (setup.dvdx == 0x10000 || setup.dvdx == -0x10000) &&
+				(setup.dudy == 0x10000 || setup.dudy == -0x10000) && setup.dvdy == 0 &&
+				(setup.startu & 0xffff) == 0 && (setup.startv & 0xffff) == 0)
+			{
+				s32 const width = setup.endx - setup.startx;
+				s32 const height = setup.endy - setup.starty;
+				s32 const u0 = setup.startu >> 16;
+				s32 const v0 = setup.startv >> 16;
+				s32 const du = setup.dudy >> 16;
+				s32 const dv = setup.dvdx >> 16;
+				s32 const u1 = u0 + du * (height - 1);
+				s32 const v1 = v0 + dv * (width - 1);
+				if (width > 0 && height > 0 &&
+					u0 >= 0 && u1 >= 0 && u0 < s32(prim.texture.width) && u1 < s32(prim.texture.width) &&
+					v0 >= 0 && v1 >= 0 && v0 < s32(prim.texture.height) && v1 < s32(prim.texture.height))
+				{
+					u32 const *const src = reinterpret_cast<u32 const *>(prim.texture.base) + v0 * prim.texture.rowpixels + u0;
+					u32 *const dest = reinterpret_cast<u32 *>(dstdata + setup.starty * pitch + setup.startx);
+					render_transposed_copy(dest, pitch, src, dv * s32(prim.texture.rowpixels), du, width, height);
+					return;
+				}
+			}
+
 			// loop over rows
 			for (s32 y = setup.starty; y < setup.endy; y++)
 			{
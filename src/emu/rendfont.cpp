@@ -855,19 +855,35 @@ float render_font::char_width(float height, float aspect, char32_t ch)
 
 float render_font::string_width(float height, float aspect, std::string_view string)
 {
+	// the accumulated width in font units is independent of the requested
+	// size, so memoize it; menus and OSD overlays measure the same strings
+	// every frame
+	u64 hash = 0xcbf29ce484222325U;
+	for (char const c : string)
+		hash = (hash ^ u8(c)) * 0x00000100000001b3U;
+
+	auto const found = m_width_cache.find(hash);
+	if (found != m_width_cache.end() && found->second.first == string)
+		return float(found->second.second) * m_scale * height * aspect;
+
 	// loop over the string and accumulate widths
 	int totwidth = 0;
 
 	char32_t schar;
 
 	// loop over characters
-	while (!string.empty())
+	std::string_view remaining = string;
+	while (!remaining.empty())
 	{
-		int scharcount = uchar_from_utf8(&schar, string);
+		int scharcount = uchar_from_utf8(&schar, remaining);
 		totwidth += get_char(schar).width;
-		string.remove_prefix(scharcount);
+		remaining.remove_prefix(scharcount);
 	}
 
+	// remember the result, keeping the cache bounded
+	if (m_width_cache.size() >= WIDTH_CACHE_MAX)
+		m_width_cache.clear();
+	m_width_cache[hash] = std::make_pair(std::string(string), totwidth);
 
 	// scale the final result based on height
 	return float(totwidth) * m_scale * height * aspect;
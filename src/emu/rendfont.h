@@ -106,8 +106,14 @@ private:
 	EQUIVALENT_ARRAY(m_glyphs, glyph *) m_glyphs_cmd; // array of glyph subtables
 	std::vector<char>   m_rawdata_cmd;      // pointer to the raw data for the font
 
+	// measured string widths in font units, keyed by a hash of the string;
+	// glyph advances are fixed for the lifetime of the font, so entries
+	// never go stale
+	std::unordered_map<u64, std::pair<std::string, s32>> m_width_cache;
+
 	// constants
 	static const u64 CACHED_BDF_HASH_SIZE   = 1024;
+	static const size_t WIDTH_CACHE_MAX     = 4096;
 };
 
 std::string convert_command_glyph(std::string_view str);
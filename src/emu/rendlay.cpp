@@ -1267,6 +1267,7 @@ layout_element::layout_element(environment &env, util::xml::data_node const &ele
 	, m_defstate(env.get_attribute_int(elemnode, "defstate", -1))
 	, m_statemask(0)
 	, m_foldhigh(false)
+	, m_cache_state(0)
 {
 	// parse components in order
 	bool first = true;
@@ -1657,13 +1658,140 @@ void layout_element::preload()
 void layout_element::element_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param)
 {
 	texture const &elemtex(*reinterpret_cast<texture const *>(param));
+	layout_element &element(*elemtex.m_element);
+
+	// reuse a previous rasterization if one is cached on disk
+	if (element.cache_load(dest, elemtex.m_state))
+		return;
 
 	// draw components that are visible in the current state
-	for (auto const &curcomp : elemtex.m_element->m_complist)
+	for (auto const &curcomp : element.m_complist)
 	{
 		if ((elemtex.m_state & curcomp->statemask()) == curcomp->stateval())
-			curcomp->draw(elemtex.m_element->machine(), dest, elemtex.m_state);
+			curcomp->draw(element.machine(), dest, elemtex.m_state);
+	}
+
+	// save the result for future runs
+	element.cache_save(dest, elemtex.m_state);
+}
+
+
+//-------------------------------------------------
+//  cache_digest - compute the content digest
+//  keying the rasterization cache, returning
+//  false if this element cannot be cached
+//-------------------------------------------------
+
+bool layout_element::cache_digest()
+{
+	// caching can be disabled outright
+	if (!*machine().options().cache_directory())
+		return false;
+
+	// every component must be able to describe its output for the cache
+	// key to be sound
+	if (m_cache_state == 0)
+	{
+		util::sha1_creator hasher;
+		hasher.append(&m_statemask, sizeof(m_statemask));
+		hasher.append(&m_foldhigh, sizeof(m_foldhigh));
+		m_cache_state = 1;
+		for (component::ptr const &curcomp : m_complist)
+			if (!curcomp->fold_digest(machine(), hasher))
+			{
+				m_cache_state = -1;
+				break;
+			}
+		if (m_cache_state == 1)
+			m_cache_digest = hasher.finish();
+	}
+	return m_cache_state > 0;
+}
+
+
+//-------------------------------------------------
+//  cache_filename - compute the cache file name
+//  for the given state at the given size
+//-------------------------------------------------
+
+std::string layout_element::cache_filename(int state, s32 width, s32 height) const
+{
+	util::sha1_creator hasher;
+	hasher.append(&m_cache_digest, sizeof(m_cache_digest));
+	hasher.append(&state, sizeof(state));
+	hasher.append(&width, sizeof(width));
+	hasher.append(&height, sizeof(height));
+	return std::string("artwork") + PATH_SEPARATOR + hasher.finish().as_string() + ".arb";
+}
+
+
+//-------------------------------------------------
+//  cache_load - fill the destination bitmap from
+//  a cached rasterization, if one exists
+//-------------------------------------------------
+
+bool layout_element::cache_load(bitmap_argb32 &dest, int state)
+{
+	if (!cache_digest())
+		return false;
+
+	emu_file file(machine().options().cache_directory(), OPEN_FLAG_READ);
+	if (file.open(cache_filename(state, dest.width(), dest.height())))
+		return false;
+
+	// read and validate the header
+	u8 header[16];
+	if (file.read(header, sizeof(header)) != sizeof(header))
+		return false;
+	if (header[0] != 'M' || header[1] != 'A' || header[2] != 'R' || header[3] != 'C')
+		return false;
+	u32 const version = header[4] | (u32(header[5]) << 8) | (u32(header[6]) << 16) | (u32(header[7]) << 24);
+	s32 const width = header[8] | (u32(header[9]) << 8) | (u32(header[10]) << 16) | (u32(header[11]) << 24);
+	s32 const height = header[12] | (u32(header[13]) << 8) | (u32(header[14]) << 16) | (u32(header[15]) << 24);
+	if (version != 1 || width != dest.width() || height != dest.height())
+		return false;
+
+	// read the pixel data a row at a time
+	u32 const rowbytes = width * sizeof(u32);
+	for (s32 y = 0; y < height; y++)
+		if (file.read(&dest.pix(y), rowbytes) != rowbytes)
+		{
+			// leave no partial garbage for the components to blend over
+			dest.fill(0);
+			return false;
+		}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  cache_save - save a rasterization to the disk
+//  cache; failure (e.g. a read-only cache
+//  directory) is harmless
+//-------------------------------------------------
+
+void layout_element::cache_save(bitmap_argb32 &dest, int state)
+{
+	if (!cache_digest())
+		return;
+
+	emu_file file(machine().options().cache_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(cache_filename(state, dest.width(), dest.height())))
+		return;
+
+	u8 header[16] = { 'M', 'A', 'R', 'C' };
+	u32 const values[3] = { 1, u32(dest.width()), u32(dest.height()) };
+	for (int i = 0; i < 3; i++)
+	{
+		header[4 + (i * 4) + 0] = values[i] >> 0;
+		header[4 + (i * 4) + 1] = values[i] >> 8;
+		header[4 + (i * 4) + 2] = values[i] >> 16;
+		header[4 + (i * 4) + 3] = values[i] >> 24;
 	}
+	file.write(header, sizeof(header));
+	for (s32 y = 0; y < dest.height(); y++)
+		file.write(&dest.pix(y), dest.width() * sizeof(u32));
+	file.close();
 }
 
 
@@ -1702,6 +1830,18 @@ protected:
 			draw_svg(dest, bounds, state);
 	}
 
+	virtual bool fold_digest_extra(running_machine &machine, util::sha1_creator &hasher) override
+	{
+		if (!m_bitmap.valid() && !m_svg)
+			load_image(machine);
+
+		// the source data digest is only valid if everything loaded cleanly
+		if (!m_srchash_valid)
+			return false;
+		hasher.append(&m_srchash, sizeof(m_srchash));
+		return true;
+	}
+
 private:
 	// internal helpers
 	void draw_bitmap(bitmap_argb32 &dest, rectangle const &bounds, int state)
@@ -1819,6 +1959,11 @@ private:
 
 	void load_image(running_machine &machine)
 	{
+		// digest the source data as it is loaded so the rasterization
+		// cache notices changed artwork files
+		util::sha1_creator srchash;
+		bool hashvalid = true;
+
 		// if we have a filename, go with that
 		emu_file file(m_searchpath.empty() ? m_dirname : m_searchpath, OPEN_FLAG_READ);
 		if (!m_imagefile.empty())
@@ -1831,6 +1976,11 @@ private:
 			std::error_condition const imgerr = file.open(filename);
 			if (!imgerr)
 			{
+				std::string const filehash = file.hashes("s").internal_string();
+				if (!filehash.empty())
+					srchash.append(filehash.c_str(), filehash.length());
+				else
+					hashvalid = false;
 				if (!load_bitmap(file))
 				{
 					LOGMASKED(LOG_IMAGE_LOAD, "Image component will attempt to parse file as SVG\n");
@@ -1840,12 +1990,14 @@ private:
 			}
 			else
 			{
+				hashvalid = false;
 				LOGMASKED(LOG_IMAGE_LOAD, "Image component unable to open image file '%s' (%s:%d %s)\n",
 						filename, imgerr.category().name(), imgerr.value(), imgerr.message());
 			}
 		}
 		else if (!m_data.empty())
 		{
+			srchash.append(m_data.c_str(), m_data.length());
 			load_image_data();
 		}
 
@@ -1862,6 +2014,11 @@ private:
 				std::error_condition const alferr = file.open(filename);
 				if (!alferr)
 				{
+					std::string const alfahash = file.hashes("s").internal_string();
+					if (!alfahash.empty())
+						srchash.append(alfahash.c_str(), alfahash.length());
+					else
+						hashvalid = false;
 					// TODO: no way to detect corner case where we had alpha from the image but the alpha PNG makes it entirely opaque
 					if (render_load_png(m_bitmap, file, true))
 						m_hasalpha = true;
@@ -1869,6 +2026,7 @@ private:
 				}
 				else
 				{
+					hashvalid = false;
 					LOGMASKED(LOG_IMAGE_LOAD, "Image component unable to open alpha channel file '%s' (%s:%d %s)\n",
 							filename, alferr.category().name(), alferr.value(), alferr.message());
 				}
@@ -1882,6 +2040,9 @@ private:
 		// if we can't load an image, allocate a dummy one and report an error
 		if (!m_bitmap.valid() && !m_svg)
 		{
+			// never cache the dummy image
+			hashvalid = false;
+
 			// draw some stripes in the bitmap
 			m_bitmap.allocate(100, 100);
 			m_bitmap.fill(0);
@@ -1896,6 +2057,13 @@ private:
 				osd_printf_warning("Unable to load component image '%s'/'%s'\n", m_imagefile, m_alphafile);
 		}
 
+		// finalize the source digest
+		if (hashvalid)
+		{
+			m_srchash = srchash.finish();
+			m_srchash_valid = true;
+		}
+
 		// clear out this stuff in case it's large
 		if (!m_svg)
 			m_rasterizer.reset();
@@ -2074,6 +2242,8 @@ private:
 	std::shared_ptr<NSVGrasterizer> m_rasterizer;       // SVG rasteriser
 	bitmap_argb32                   m_bitmap;           // source bitmap for images
 	bool                            m_hasalpha = false; // is there any alpha component present?
+	util::sha1_t                    m_srchash;          // digest of the source data
+	bool                            m_srchash_valid = false; // whether all source data was digested
 
 	// cold state
 	std::string                     m_searchpath;       // asset search path (for lazy loading)
@@ -3735,6 +3905,34 @@ int layout_element::component::maxstate() const
 }
 
 
+//-------------------------------------------------
+//  fold_digest - fold everything determining this
+//  component's output into a digest for the
+//  rasterization cache; returns false if the
+//  output cannot be cached
+//-------------------------------------------------
+
+bool layout_element::component::fold_digest(running_machine &machine, util::sha1_creator &hasher)
+{
+	// fold the resolved state so identical XML instantiated with
+	// different layout parameters doesn't collide
+	hasher.append(&m_statemask, sizeof(m_statemask));
+	hasher.append(&m_stateval, sizeof(m_stateval));
+	for (auto const &step : m_bounds)
+		hasher.append(&step, sizeof(step));
+	for (auto const &step : m_color)
+		hasher.append(&step, sizeof(step));
+	return fold_digest_extra(machine, hasher);
+}
+
+
+bool layout_element::component::fold_digest_extra(running_machine &machine, util::sha1_creator &hasher)
+{
+	// conservative default - only components that opt in are cached
+	return false;
+}
+
+
 //-------------------------------------------------
 //  draw_text - draw text in the specified color
 //-------------------------------------------------
@@ -4704,6 +4902,7 @@ void layout_view_item::set_animation_state_callback(state_delegate &&handler)
 
 void layout_view_item::set_bounds_callback(bounds_delegate &&handler)
 {
+	m_bounds_scripted = !handler.isnull();
 	if (!handler.isnull())
 		m_get_bounds = std::move(handler);
 	else
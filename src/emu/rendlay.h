@@ -16,6 +16,8 @@
 #include "rendertypes.h"
 #include "screen.h"
 
+#include "hashing.h"
+
 #include <array>
 #include <functional>
 #include <map>
@@ -116,10 +118,12 @@ private:
 		// operations
 		virtual void preload(running_machine &machine);
 		virtual void draw(running_machine &machine, bitmap_argb32 &dest, int state);
+		bool fold_digest(running_machine &machine, util::sha1_creator &hasher);
 
 	protected:
 		// helpers
 		virtual int maxstate() const;
+		virtual bool fold_digest_extra(running_machine &machine, util::sha1_creator &hasher);
 		virtual void draw_aligned(running_machine &machine, bitmap_argb32 &dest, const rectangle &bounds, int state);
 
 		// drawing helpers
@@ -182,6 +186,10 @@ private:
 
 	// internal helpers
 	static void element_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
+	bool cache_digest();
+	std::string cache_filename(int state, s32 width, s32 height) const;
+	bool cache_load(bitmap_argb32 &dest, int state);
+	void cache_save(bitmap_argb32 &dest, int state);
 	template <typename T> static component::ptr make_component(environment &env, util::xml::data_node const &compnode);
 	template <int D> static component::ptr make_dotmatrix_component(environment &env, util::xml::data_node const &compnode);
 
@@ -194,6 +202,8 @@ private:
 	int                         m_statemask;    // mask to apply to state values
 	bool                        m_foldhigh;     // whether we need to fold state values above the mask range
 	std::vector<texture>        m_elemtex;      // array of element textures used for managing the scaled bitmaps
+	util::sha1_t                m_cache_digest; // content digest for the rasterization cache
+	int                         m_cache_state;  // 0 = not determined, 1 = cacheable, -1 = not cacheable
 };
 
 
@@ -276,6 +286,7 @@ public:
 	screen_device *screen() const { return m_screen; }
 	bool bounds_animated() const { return m_bounds.size() > 1U; }
 	bool color_animated() const { return m_color.size() > 1U; }
+	bool bounds_scripted() const { return m_bounds_scripted; }
 	render_bounds bounds() const { return m_get_bounds(); }
 	render_color color() const { return m_get_color(); }
 	bool scroll_wrap_x() const { return m_scrollwrapx; }
@@ -357,6 +368,7 @@ private:
 	state_delegate          m_get_elem_state;       // resolved element state function
 	state_delegate          m_get_anim_state;       // resolved animation state function
 	bounds_delegate         m_get_bounds;           // resolved bounds function
+	bool                    m_bounds_scripted = false; // a custom bounds callback is installed
 	color_delegate          m_get_color;            // resolved color function
 	scroll_size_delegate    m_get_scroll_size_x;    // resolved horizontal scroll window size function
 	scroll_size_delegate    m_get_scroll_size_y;    // resolved vertical scroll window size function
@@ -147,6 +147,40 @@ static bool copy_png_alpha_to_bitmap(bitmap_argb32 &bitmap, const util::png_info
     RENDER UTILITIES
 ***************************************************************************/
 
+/*-------------------------------------------------
+    render_transposed_copy - copy a rectangle of
+    32-bit pixels whose source walks column-wise
+    (a rotated screen); working in 8x8 blocks
+    keeps both source and destination accesses
+    within a handful of cache lines instead of
+    striding through the whole texture for every
+    destination row
+-------------------------------------------------*/
+
+void render_transposed_copy(u32 *dst, s32 dstpitch, const u32 *src, s32 srcxstep, s32 srcystep, s32 width, s32 height)
+{
+	constexpr s32 BLOCK = 8;
+	for (s32 y0 = 0; y0 < height; y0 += BLOCK)
+	{
+		s32 const ylim = std::min(y0 + BLOCK, height);
+		for (s32 x0 = 0; x0 < width; x0 += BLOCK)
+		{
+			s32 const xlim = std::min(x0 + BLOCK, width);
+			for (s32 y = y0; y < ylim; y++)
+			{
+				u32 *d = dst + y * dstpitch + x0;
+				const u32 *s = src + y * srcystep + x0 * srcxstep;
+				for (s32 x = x0; x < xlim; x++)
+				{
+					*d++ = *s;
+					s += srcxstep;
+				}
+			}
+		}
+	}
+}
+
+
 /*-------------------------------------------------
     render_resample_argb_bitmap_hq - perform a high
     quality resampling of a texture
@@ -40,6 +40,7 @@ enum ru_imgformat
 /* ----- render utilities ----- */
 
 void render_resample_argb_bitmap_hq(bitmap_argb32 &dest, bitmap_argb32 &source, const render_color &color, bool force = false);
+void render_transposed_copy(u32 *dst, s32 dstpitch, const u32 *src, s32 srcxstep, s32 srcystep, s32 width, s32 height);
 bool render_clip_line(render_bounds *bounds, const render_bounds *clip);
 bool render_clip_quad(render_bounds *bounds, const render_bounds *clip, render_quad_texuv *texcoords);
 void render_line_to_quad(const render_bounds *bounds, float width, float length_extension, render_bounds *bounds0, render_bounds *bounds1);
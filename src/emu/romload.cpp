@@ -178,6 +178,16 @@ std::error_condition do_open_disk(const emu_options &options, std::initializer_l
 	return result;
 }
 
+// a deferred length/hash verification of one loaded file
+struct verify_job
+{
+	rom_load_manager *          loader;     // owning load manager
+	std::unique_ptr<emu_file>   file;       // file to verify, owned by the job
+	std::string                 name;       // ROM name for messages
+	u32                         explength;  // expected length
+	util::hash_collection       hashes;     // expected hashes
+};
+
 } // anonymous namespace
 
 
@@ -546,6 +556,61 @@ void rom_load_manager::verify_length_and_hash(emu_file *file, std::string_view n
 }
 
 
+/*-------------------------------------------------
+    queue_verify - hand a loaded file off to the
+    verification queue, taking ownership of it
+-------------------------------------------------*/
+
+void rom_load_manager::queue_verify(std::unique_ptr<emu_file> file, std::string name, u32 explength, util::hash_collection hashes)
+{
+	if (!file)
+		return;
+
+	// lazily allocate the queue
+	if (m_verify_queue == nullptr)
+		m_verify_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
+	// queue the job; the worker owns it from here
+	auto *job = new verify_job{ this, std::move(file), std::move(name), explength, std::move(hashes) };
+	osd_work_item_queue(m_verify_queue, verify_rom_static, job, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+/*-------------------------------------------------
+    verify_rom_static - verification worker
+    callback
+-------------------------------------------------*/
+
+void *rom_load_manager::verify_rom_static(void *param, int threadid)
+{
+	std::unique_ptr<verify_job> job(reinterpret_cast<verify_job *>(param));
+
+	// hash outside the lock; emu_file caches the result so the
+	// re-computation inside verify_length_and_hash is free
+	if (!job->hashes.flag(util::hash_collection::FLAG_NO_DUMP))
+		job->file->hashes(job->hashes.hash_types());
+
+	// fold the results into the shared accumulators
+	{
+		std::lock_guard<std::mutex> lock(job->loader->m_verify_lock);
+		job->loader->verify_length_and_hash(job->file.get(), job->name, job->explength, job->hashes);
+	}
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    flush_verify_queue - wait for all outstanding
+    verifications to complete
+-------------------------------------------------*/
+
+void rom_load_manager::flush_verify_queue()
+{
+	if (m_verify_queue != nullptr)
+		osd_work_queue_wait(m_verify_queue, osd_ticks_per_second() * 60);
+}
+
+
 /*-------------------------------------------------
     display_loading_rom_message - display
     messages about ROM loading to the user
@@ -571,6 +636,9 @@ void rom_load_manager::display_loading_rom_message(const char *name, bool from_l
 
 void rom_load_manager::display_rom_load_results(bool from_list)
 {
+	/* make sure all background verifications have reported in */
+	flush_verify_queue();
+
 	/* final status display */
 	display_loading_rom_message(nullptr, from_list);
 
@@ -943,6 +1011,9 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 			}
 
 			// loop until we run out of reloads
+			std::string verify_name;
+			u32 verify_length = 0;
+			util::hash_collection verify_hashes;
 			do
 			{
 				// loop until we run out of continues/ignores
@@ -965,12 +1036,12 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 				}
 				while (ROMENTRY_ISCONTINUE(romp) || ROMENTRY_ISIGNORE(romp));
 
-				// if this was the first use of this file, verify the length and CRC
+				// if this was the first use of this file, remember what to verify
 				if (baserom)
 				{
-					LOG("Verifying length (%X) and checksums\n", explength);
-					verify_length_and_hash(file.get(), baserom->name(), explength, util::hash_collection(baserom->hashdata()));
-					LOG("Verify finished\n");
+					verify_name = baserom->name();
+					verify_length = explength;
+					verify_hashes = util::hash_collection(baserom->hashdata());
 				}
 
 				// re-seek to the start and clear the baserom so we don't reverify
@@ -981,11 +1052,12 @@ void rom_load_manager::process_rom_entries(std::initializer_list<std::reference_
 			}
 			while (ROMENTRY_ISRELOAD(romp));
 
-			// close the file
+			// hand the file off for background verification; the worker
+			// closes it once the hashes have been checked
 			if (file)
 			{
-				LOG("Closing ROM file\n");
-				file.reset();
+				LOG("Queuing verification of length (%X) and checksums\n", verify_length);
+				queue_verify(std::move(file), std::move(verify_name), verify_length, std::move(verify_hashes));
 			}
 		}
 		else
@@ -1429,6 +1501,7 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 	, m_region(nullptr)
 	, m_errorstring()
 	, m_softwarningstring()
+	, m_verify_queue(nullptr)
 {
 	// figure out which BIOS we are using
 	std::map<std::string_view, std::string> card_bios;
@@ -1477,6 +1550,22 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 }
 
 
+/*-------------------------------------------------
+    ~rom_load_manager - tear down the verification
+    queue
+-------------------------------------------------*/
+
+rom_load_manager::~rom_load_manager()
+{
+	if (m_verify_queue != nullptr)
+	{
+		flush_verify_queue();
+		osd_work_queue_free(m_verify_queue);
+		m_verify_queue = nullptr;
+	}
+}
+
+
 // -------------------------------------------------
 // rom_build_entries - builds a rom_entry vector
 // from a tiny_rom_entry array
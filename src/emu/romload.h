@@ -17,6 +17,7 @@
 
 #include <functional>
 #include <initializer_list>
+#include <mutex>
 #include <string>
 #include <system_error>
 #include <type_traits>
@@ -402,6 +403,7 @@ class rom_load_manager
 public:
 	// construction/destruction
 	rom_load_manager(running_machine &machine);
+	~rom_load_manager();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
@@ -438,6 +440,9 @@ private:
 	void handle_missing_file(const rom_entry *romp, const std::vector<std::string> &tried_file_names, std::error_condition chderr);
 	void dump_wrong_and_correct_checksums(const util::hash_collection &hashes, const util::hash_collection &acthashes);
 	void verify_length_and_hash(emu_file *file, std::string_view name, u32 explength, const util::hash_collection &hashes);
+	void queue_verify(std::unique_ptr<emu_file> file, std::string name, u32 explength, util::hash_collection hashes);
+	void flush_verify_queue();
+	static void *verify_rom_static(void *param, int threadid);
 	void display_loading_rom_message(const char *name, bool from_list);
 	void display_rom_load_results(bool from_list);
 	void region_post_process(memory_region *region, bool invert);
@@ -471,6 +476,9 @@ private:
 
 	std::string         m_errorstring;        // error string
 	std::string         m_softwarningstring;  // software warning string
+
+	osd_work_queue *    m_verify_queue;       // work queue for background hash verification
+	std::mutex          m_verify_lock;        // protects the warning/error accumulators
 };
 
 
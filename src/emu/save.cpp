@@ -26,9 +26,13 @@
 #include "emuopts.h"
 
 #include "util/coreutil.h"
+#include "util/huffman.h"
 #include "util/ioprocs.h"
 #include "util/ioprocsfilter.h"
 
+#include <atomic>
+#include <cstring>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -67,11 +71,28 @@ save_manager::save_manager(running_machine &machine)
 	: m_machine(machine)
 	, m_reg_allowed(true)
 	, m_illegal_regs(0)
+	, m_layout_valid(false)
+	, m_total_size(0)
+	, m_signature(0)
+	, m_async_queue(nullptr)
 {
 	m_rewind = std::make_unique<rewinder>(*this);
 }
 
 
+//-------------------------------------------------
+//  ~save_manager - destructor
+//-------------------------------------------------
+
+save_manager::~save_manager()
+{
+	// let any background write finish, then take down the queue
+	flush_async_save();
+	if (m_async_queue)
+		osd_work_queue_free(m_async_queue);
+}
+
+
 //-------------------------------------------------
 //  allow_registration - allow/disallow
 //  registrations to happen
@@ -81,16 +102,21 @@ void save_manager::allow_registration(bool allowed)
 {
 	// allow/deny registration
 	m_reg_allowed = allowed;
-	if (!allowed)
+	if (allowed)
+	{
+		// the cached layout no longer matches what may be registered
+		m_layout_valid = false;
+	}
+	else
 	{
 		// look for duplicates
 		std::sort(m_entry_list.begin(), m_entry_list.end(),
-				[] (std::unique_ptr<state_entry> const& a, std::unique_ptr<state_entry> const& b) { return a->m_name < b->m_name; });
+				[] (state_entry const *a, state_entry const *b) { return std::strcmp(a->m_name, b->m_name) < 0; });
 
 		int dupes_found = 0;
 		for (int i = 1; i < m_entry_list.size(); i++)
 		{
-			if (m_entry_list[i - 1]->m_name == m_entry_list[i]->m_name)
+			if (!std::strcmp(m_entry_list[i - 1]->m_name, m_entry_list[i]->m_name))
 			{
 				osd_printf_error("Duplicate save state registration entry (%s)\n", m_entry_list[i]->m_name);
 				dupes_found++;
@@ -102,6 +128,17 @@ void save_manager::allow_registration(bool allowed)
 
 		dump_registry();
 
+		// the layout is now fixed; cache the total size, signature and
+		// header so per-frame snapshots don't walk the entry list to
+		// recompute them
+		m_total_size = HEADER_SIZE;
+		for (const auto &entry : m_entry_list)
+			m_total_size += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+		m_signature = signature();
+		m_cached_header.resize(HEADER_SIZE);
+		build_header(&m_cached_header[0], m_signature);
+		m_layout_valid = true;
+
 		// everything is registered by now, evaluate the savestate size
 		m_rewind->clamp_capacity();
 	}
@@ -118,14 +155,14 @@ const char *save_manager::indexed_item(int index, void *&base, u32 &valsize, u32
 	if (index >= m_entry_list.size() || index < 0)
 		return nullptr;
 
-	state_entry *entry = m_entry_list.at(index).get();
+	state_entry *entry = m_entry_list.at(index);
 	base = entry->m_data;
 	valsize = entry->m_typesize;
 	valcount = entry->m_typecount;
 	blockcount = entry->m_blockcount;
 	stride = entry->m_stride;
 
-	return entry->m_name.c_str();
+	return entry->m_name;
 }
 
 
@@ -198,8 +235,11 @@ void save_manager::save_memory(device_t *device, const char *module, const char
 	else
 		totalname = string_format("%s/%X/%s", module, index, name);
 
-	// insert us into the list
-	m_entry_list.emplace_back(std::make_unique<state_entry>(val, std::move(totalname), device, module, tag ? tag : "", index, valsize, valcount, blockcount, stride));
+	// insert us into the list; entries and their names live in the machine
+	// arena and are released wholesale when the machine is destroyed, so
+	// tens of thousands of registrations cost no individual allocations
+	util::arena &arena = machine().arena();
+	m_entry_list.emplace_back(arena.make<state_entry>(val, arena.intern(totalname), device, arena.intern(module), arena.intern(tag ? tag : ""), index, valsize, valcount, blockcount, stride));
 }
 
 
@@ -259,6 +299,9 @@ void save_manager::dispatch_presave()
 
 save_error save_manager::write_file(emu_file &file)
 {
+	// don't fight a background write over the file
+	flush_async_save();
+
 	util::write_stream::ptr writer;
 	save_error err = do_write(
 			[] (size_t total_size) { return true; },
@@ -292,6 +335,9 @@ save_error save_manager::write_file(emu_file &file)
 
 save_error save_manager::read_file(emu_file &file)
 {
+	// don't fight a background write over the file
+	flush_async_save();
+
 	util::read_stream::ptr reader;
 	return do_read(
 			[] (size_t total_size) { return true; },
@@ -318,6 +364,132 @@ save_error save_manager::read_file(emu_file &file)
 }
 
 
+//-------------------------------------------------
+//  async_save_request - state snapshot handed to
+//  the background writer
+//-------------------------------------------------
+
+struct save_manager::async_save_request
+{
+	std::unique_ptr<emu_file> m_file;                 // destination file
+	std::vector<u8>           m_buffer;               // uncompressed snapshot, header included
+	std::atomic<bool>         m_done{ false };        // has the worker finished?
+	save_error                m_result = STATERR_WRITE_ERROR; // outcome of the write
+
+	static void *write(void *param, int threadid);
+};
+
+
+//-------------------------------------------------
+//  async_save_request::write - worker callback;
+//  compresses and writes the snapshot, producing
+//  the same layout as write_file
+//-------------------------------------------------
+
+void *save_manager::async_save_request::write(void *param, int threadid)
+{
+	auto &request = *reinterpret_cast<async_save_request *>(param);
+
+	// write the header uncompressed, then the data through zlib
+	save_error result = STATERR_WRITE_ERROR;
+	util::core_file::ptr proxy;
+	size_t written;
+	if (!request.m_file->seek(0, SEEK_SET)
+			&& !util::core_file::open_proxy(*request.m_file, proxy) && proxy
+			&& !proxy->write(&request.m_buffer[0], HEADER_SIZE, written) && (HEADER_SIZE == written))
+	{
+		util::write_stream::ptr writer = util::zlib_write(*request.m_file, 6, 16384);
+		const size_t datasize = request.m_buffer.size() - HEADER_SIZE;
+		if (writer
+				&& !writer->write(&request.m_buffer[HEADER_SIZE], datasize, written) && (datasize == written)
+				&& !writer->finalize())
+			result = STATERR_NONE;
+	}
+
+	// delete the file on failure, then release it
+	if (result != STATERR_NONE)
+		request.m_file->remove_on_close();
+	request.m_file.reset();
+
+	// publish the result
+	request.m_result = result;
+	request.m_done.store(true, std::memory_order_release);
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  write_file_async - take a state snapshot on
+//  the calling thread and hand it to a background
+//  worker for compression and writing
+//-------------------------------------------------
+
+save_error save_manager::write_file_async(std::unique_ptr<emu_file> &&file)
+{
+	// only one write can be in flight; an unreported result from a
+	// previous write can only be dropped here, so log it
+	const save_error pending = flush_async_save();
+	if (pending != STATERR_NONE)
+		machine().logerror("Error: previous asynchronous state save failed.\n");
+
+	// snapshot the machine state; this is just memcpys plus presave calls
+	auto request = std::make_unique<async_save_request>();
+	request->m_buffer.resize(total_data_size());
+	const save_error err = write_buffer(&request->m_buffer[0], request->m_buffer.size());
+	if (err != STATERR_NONE)
+	{
+		file->remove_on_close();
+		return err;
+	}
+
+	// hand the file and snapshot to the worker
+	request->m_file = std::move(file);
+	if (!m_async_queue)
+		m_async_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	m_async_save = std::move(request);
+	osd_work_item_queue(m_async_queue, &async_save_request::write, m_async_save.get(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	return STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  async_save_finished - poll a pending
+//  background write, returning true exactly once
+//  when it has completed
+//-------------------------------------------------
+
+bool save_manager::async_save_finished(save_error &result)
+{
+	if (!m_async_save || !m_async_save->m_done.load(std::memory_order_acquire))
+		return false;
+
+	result = m_async_save->m_result;
+	m_async_save.reset();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  flush_async_save - wait for any pending
+//  background write and return its result
+//-------------------------------------------------
+
+save_error save_manager::flush_async_save()
+{
+	if (!m_async_save)
+		return STATERR_NONE;
+
+	// wait for the worker to drain
+	while (!osd_work_queue_wait(m_async_queue, osd_ticks_per_second()))
+	{
+	}
+
+	const save_error result = m_async_save->m_result;
+	m_async_save.reset();
+	return result;
+}
+
+
 //-------------------------------------------------
 //  write_stream - write the current machine state
 //  to an output stream
@@ -410,23 +582,19 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 		return STATERR_ILLEGAL_REGISTRATIONS;
 
 	// check for sufficient space
-	size_t total_size = HEADER_SIZE;
-	for (const auto &entry : m_entry_list)
-		total_size += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
-	if (!check_space(total_size))
+	if (!check_space(total_data_size()))
 		return STATERR_WRITE_ERROR;
 
-	// generate the header
+	// generate the header unless the cached copy is current
 	u8 header[HEADER_SIZE];
-	memcpy(&header[0], STATE_MAGIC_NUM, 8);
-	header[8] = SAVE_VERSION;
-	header[9] = NATIVE_ENDIAN_VALUE_LE_BE(0, SS_MSB_FIRST);
-	strncpy((char *)&header[0x0a], machine().system().name, 0x1c - 0x0a);
-	u32 sig = signature();
-	*(u32 *)&header[0x1c] = little_endianize_int32(sig);
+	const u8 *headerptr = header;
+	if (m_layout_valid)
+		headerptr = &m_cached_header[0];
+	else
+		build_header(header, signature());
 
 	// write the header and turn on compression for the rest of the file
-	if (!start_header() || !write_block(header, sizeof(header)) || !start_data())
+	if (!start_header() || !write_block(headerptr, HEADER_SIZE) || !start_data())
 		return STATERR_WRITE_ERROR;
 
 	// call the pre-save functions
@@ -457,10 +625,7 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 		return STATERR_ILLEGAL_REGISTRATIONS;
 
 	// check for sufficient space
-	size_t total_size = HEADER_SIZE;
-	for (const auto &entry : m_entry_list)
-		total_size += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
-	if (!check_length(total_size))
+	if (!check_length(total_data_size()))
 		return STATERR_READ_ERROR;
 
 	// read the header and turn on compression for the rest of the file
@@ -469,7 +634,7 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 		return STATERR_READ_ERROR;
 
 	// verify the header and report an error if it doesn't match
-	u32 sig = signature();
+	u32 sig = m_layout_valid ? m_signature : signature();
 	if (validate_header(header, machine().system().name, sig, nullptr, "Error: ")  != STATERR_NONE)
 		return STATERR_INVALID_HEADER;
 
@@ -509,7 +674,7 @@ u32 save_manager::signature() const
 	for (auto &entry : m_entry_list)
 	{
 		// add the entry name to the CRC
-		crc = core_crc32(crc, (u8 *)entry->m_name.c_str(), entry->m_name.length());
+		crc = core_crc32(crc, (u8 *)entry->m_name, std::strlen(entry->m_name));
 
 		// add the type and size to the CRC
 		u32 temp[4];
@@ -523,6 +688,39 @@ u32 save_manager::signature() const
 }
 
 
+//-------------------------------------------------
+//  total_data_size - return the size of the
+//  header plus all registered data, using the
+//  cached value when the layout is fixed
+//-------------------------------------------------
+
+size_t save_manager::total_data_size() const
+{
+	if (m_layout_valid)
+		return m_total_size;
+
+	size_t total_size = HEADER_SIZE;
+	for (const auto &entry : m_entry_list)
+		total_size += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+	return total_size;
+}
+
+
+//-------------------------------------------------
+//  build_header - generate the state header for
+//  the given signature
+//-------------------------------------------------
+
+void save_manager::build_header(u8 *header, u32 sig) const
+{
+	memcpy(&header[0], STATE_MAGIC_NUM, 8);
+	header[8] = SAVE_VERSION;
+	header[9] = NATIVE_ENDIAN_VALUE_LE_BE(0, SS_MSB_FIRST);
+	strncpy((char *)&header[0x0a], machine().system().name, 0x1c - 0x0a);
+	*(u32 *)&header[0x1c] = little_endianize_int32(sig);
+}
+
+
 //-------------------------------------------------
 //  dump_registry - dump the registry to the
 //  logfile
@@ -531,7 +729,7 @@ u32 save_manager::signature() const
 void save_manager::dump_registry() const
 {
 	for (auto &entry : m_entry_list)
-		LOG(("%s: %u x %u x %u (%u)\n", entry->m_name.c_str(), entry->m_typesize, entry->m_typecount, entry->m_blockcount, entry->m_stride));
+		LOG(("%s: %u x %u x %u (%u)\n", entry->m_name, entry->m_typesize, entry->m_typecount, entry->m_blockcount, entry->m_stride));
 }
 
 
@@ -599,14 +797,12 @@ save_manager::state_callback::state_callback(save_prepost_delegate callback)
 ram_state::ram_state(save_manager &save)
 	: m_save(save)
 	, m_data()
+	, m_keyframe()
+	, m_compressed(false)
 	, m_valid(false)
 	, m_time(m_save.machine().time())
 {
 	m_data.reserve(get_size(save));
-	m_data.clear();
-	m_data.rdbuf()->clear();
-	m_data.seekp(0);
-	m_data.seekg(0);
 }
 
 
@@ -617,28 +813,37 @@ ram_state::ram_state(save_manager &save)
 
 size_t ram_state::get_size(save_manager &save)
 {
-	size_t totalsize = 0;
+	return save.total_data_size();
+}
+
 
-	for (auto &entry : save.m_entry_list)
-		totalsize += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+//-------------------------------------------------
+//  stored_size - bytes this state actually holds;
+//  a keyframe owner accounts for the shared
+//  buffer, deltas only for their packed size
+//-------------------------------------------------
 
-	return totalsize + HEADER_SIZE;
+size_t ram_state::stored_size() const
+{
+	return m_data.size() + ((m_keyframe && m_data.empty()) ? m_keyframe->size() : 0);
 }
 
 
 //-------------------------------------------------
 //  save - write the current machine state to the
-//  allocated stream
+//  allocated buffer
 //-------------------------------------------------
 
 save_error ram_state::save()
 {
 	// initialize
 	m_valid = false;
-	m_data.seekp(0);
+	m_keyframe.reset();
+	m_compressed = false;
+	m_data.resize(get_size(m_save));
 
 	// get the save manager to write state
-	const save_error err = m_save.write_stream(m_data);
+	const save_error err = m_save.write_buffer(&m_data[0], m_data.size());
 	if (err != STATERR_NONE)
 		return err;
 
@@ -652,20 +857,89 @@ save_error ram_state::save()
 
 //-------------------------------------------------
 //  load - restore the machine state from the
-//  stream
+//  buffer
 //-------------------------------------------------
 
 save_error ram_state::load()
 {
-	// initialize
-	m_data.seekg(0);
-
 	// if we have illegal registrations, return an error
 	if (m_save.m_illegal_regs > 0)
 		return STATERR_ILLEGAL_REGISTRATIONS;
 
-	// get the save manager to load state
-	return m_save.read_stream(m_data);
+	// complete states load directly
+	if (!m_keyframe)
+		return m_save.read_buffer(&m_data[0], m_data.size());
+
+	// the keyframe owner loads from the shared buffer
+	if (m_data.empty())
+		return m_save.read_buffer(&(*m_keyframe)[0], m_keyframe->size());
+
+	// otherwise, reconstruct the complete state from the delta
+	std::vector<u8> scratch;
+	if (m_compressed)
+	{
+		scratch.resize(m_keyframe->size());
+		huffman_8bit_decoder decoder;
+		if (decoder.decode(&m_data[0], m_data.size(), &scratch[0], scratch.size()) != HUFFERR_NONE)
+			return STATERR_READ_ERROR;
+	}
+	else
+		scratch = m_data;
+
+	const std::vector<u8> &key = *m_keyframe;
+	for (size_t i = 0; i < scratch.size(); i++)
+		scratch[i] ^= key[i];
+
+	return m_save.read_buffer(&scratch[0], scratch.size());
+}
+
+
+//-------------------------------------------------
+//  make_keyframe - donate the complete buffer as
+//  a shared keyframe for later deltas to pack
+//  against
+//-------------------------------------------------
+
+std::shared_ptr<const std::vector<u8>> ram_state::make_keyframe()
+{
+	assert(!m_keyframe);
+
+	m_keyframe = std::make_shared<const std::vector<u8>>(std::move(m_data));
+	m_data.clear();
+	m_compressed = false;
+
+	return m_keyframe;
+}
+
+
+//-------------------------------------------------
+//  pack - convert the complete buffer to an XOR
+//  delta against a keyframe, compressed with the
+//  huffman coder when that is a win
+//-------------------------------------------------
+
+void ram_state::pack(const std::shared_ptr<const std::vector<u8>> &keyframe)
+{
+	assert(!m_keyframe);
+	assert(keyframe->size() == m_data.size());
+
+	// XOR against the keyframe, so unchanged bytes collapse to zero
+	const std::vector<u8> &key = *keyframe;
+	for (size_t i = 0; i < m_data.size(); i++)
+		m_data[i] ^= key[i];
+
+	// try to compress the delta, keeping it raw if that fails to help
+	std::vector<u8> compressed(m_data.size());
+	huffman_8bit_encoder encoder;
+	u32 complength = 0;
+	if (encoder.encode(&m_data[0], m_data.size(), &compressed[0], compressed.size(), complength) == HUFFERR_NONE)
+	{
+		compressed.resize(complength);
+		compressed.shrink_to_fit();
+		m_data = std::move(compressed);
+		m_compressed = true;
+	}
+	m_keyframe = keyframe;
 }
 
 
@@ -681,6 +955,7 @@ rewinder::rewinder(save_manager &save)
 	, m_first_invalid_index(REWIND_INDEX_NONE)
 	, m_first_time_warning(true)
 	, m_first_time_note(true)
+	, m_since_keyframe(0)
 {
 }
 
@@ -750,16 +1025,20 @@ bool rewinder::capture()
 		return false;
 	}
 
+	ram_state *state = nullptr;
 	if (current_index_is_last())
 	{
 		// we need to create a new state
-		std::unique_ptr<ram_state> state = std::make_unique<ram_state>(m_save);
-		const save_error error = state->save();
+		std::unique_ptr<ram_state> newstate = std::make_unique<ram_state>(m_save);
+		const save_error error = newstate->save();
 
 		// validate the state
 		if (error == STATERR_NONE)
+		{
 			// it's safe to append
-			m_state_list.push_back(std::move(state));
+			state = newstate.get();
+			m_state_list.push_back(std::move(newstate));
+		}
 		else
 		{
 			// internal error, complain and evacuate
@@ -773,7 +1052,7 @@ bool rewinder::capture()
 		invalidate();
 
 		// update the existing state
-		ram_state *state = m_state_list.at(m_current_index).get();
+		state = m_state_list.at(m_current_index).get();
 		const save_error error = state->save();
 
 		// validate the state
@@ -785,6 +1064,15 @@ bool rewinder::capture()
 		}
 	}
 
+	// pack the new state as a delta, starting a fresh keyframe periodically
+	if (!m_keyframe || m_keyframe->size() != ram_state::get_size(m_save) || ++m_since_keyframe >= KEYFRAME_INTERVAL)
+	{
+		m_keyframe = state->make_keyframe();
+		m_since_keyframe = 0;
+	}
+	else
+		state->pack(m_keyframe);
+
 	// make sure we will fit in
 	if (!check_size())
 		// the list keeps growing
@@ -852,26 +1140,25 @@ bool rewinder::check_size()
 	if (!m_enabled)
 		return false;
 
-	// state sizes in bytes
+	// state sizes in bytes; deltas make individual states cheap, but the
+	// next capture can be a complete keyframe, so reserve room for one
 	const size_t singlesize = ram_state::get_size(m_save);
-	size_t totalsize = m_state_list.size() * singlesize;
+	size_t totalsize = 0;
+	for (auto &state : m_state_list)
+		totalsize += state->stored_size();
 
 	// convert our limit from megabytes
 	const size_t capsize = m_capacity * 1024 * 1024;
 
-	// safety check that shouldn't be allowed to trigger
-	if (totalsize > capsize)
+	// safety check that shouldn't be allowed to trigger; shared keyframes
+	// stay alive as long as deltas still reference them
+	while (totalsize > capsize && m_state_list.size() > 1)
 	{
-		// states to remove
-		const u32 count = (totalsize - capsize) / singlesize;
-
-		// drop everything that's beyond capacity
-		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
+		// drop the oldest state
+		totalsize -= m_state_list.front()->stored_size();
+		m_state_list.erase(m_state_list.begin());
 	}
 
-	// update before new check
-	totalsize = m_state_list.size() * singlesize;
-
 	// check if capacity will be hit by the newly captured state
 	if (totalsize + singlesize >= capsize)
 	{
@@ -984,13 +1271,13 @@ void rewinder::report_error(save_error error, rewind_operation operation)
 
 save_manager::state_entry::state_entry(
 		void *data,
-		std::string &&name, device_t *device, std::string &&module, std::string &&tag, int index,
+		const char *name, device_t *device, const char *module, const char *tag, int index,
 		u8 size, u32 valcount, u32 blockcount, u32 stride)
 	: m_data(data)
-	, m_name(std::move(name))
+	, m_name(name)
 	, m_device(device)
-	, m_module(std::move(module))
-	, m_tag(std::move(tag))
+	, m_module(module)
+	, m_tag(tag)
 	, m_index(index)
 	, m_typesize(size)
 	, m_typecount(valcount)
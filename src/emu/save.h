@@ -124,17 +124,17 @@ class save_manager
 	{
 	public:
 		// construction/destruction
-		state_entry(void *data, std::string &&name, device_t *device, std::string &&module, std::string &&tag, int index, u8 size, u32 valcount, u32 blockcount, u32 stride);
+		state_entry(void *data, const char *name, device_t *device, const char *module, const char *tag, int index, u8 size, u32 valcount, u32 blockcount, u32 stride);
 
 		// helpers
 		void flip_data();
 
 		// state
 		void *          m_data;                 // pointer to the memory to save/restore
-		std::string     m_name;                 // full name
+		const char *    m_name;                 // full name, interned in the machine arena
 		device_t *      m_device;               // associated device, nullptr if none
-		std::string     m_module;               // module name
-		std::string     m_tag;                  // tag name
+		const char *    m_module;               // module name, interned in the machine arena
+		const char *    m_tag;                  // tag name, interned in the machine arena
 		int             m_index;                // index
 		u8              m_typesize;             // size of the raw data type
 		u32             m_typecount;            // number of items in each block
@@ -144,6 +144,7 @@ class save_manager
 
 	friend class ram_state;
 	friend class rewinder;
+	friend class netplay_manager;
 
 public:
 	// stuff to allow STRUCT_MEMBER to work with pointers
@@ -154,6 +155,7 @@ public:
 
 	// construction/destruction
 	save_manager(running_machine &machine);
+	~save_manager();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
@@ -304,6 +306,12 @@ public:
 	save_error write_file(emu_file &file);
 	save_error read_file(emu_file &file);
 
+	// asynchronous variant of write_file: the state snapshot is taken
+	// immediately, while compression and file output happen on a worker
+	save_error write_file_async(std::unique_ptr<emu_file> &&file);
+	bool async_save_finished(save_error &result);
+	save_error flush_async_save();
+
 	save_error write_stream(std::ostream &str);
 	save_error read_stream(std::istream &str);
 
@@ -327,16 +335,31 @@ private:
 	template <typename T, typename U, typename V, typename W>
 	save_error do_read(T check_length, U read_block, V start_header, W start_data);
 	u32 signature() const;
+	size_t total_data_size() const;
+	void build_header(u8 *header, u32 sig) const;
 	void dump_registry() const;
 	static save_error validate_header(const u8 *header, const char *gamename, u32 signature, void (CLIB_DECL *errormsg)(const char *fmt, ...), const char *error_prefix);
 
+	// asynchronous savestate write in flight, if any
+	struct async_save_request;
+
 	// internal state
 	running_machine &         m_machine;              // reference to our machine
 	std::unique_ptr<rewinder> m_rewind;               // rewinder
 	bool                      m_reg_allowed;          // are registrations allowed?
 	s32                       m_illegal_regs;         // number of illegal registrations
 
-	std::vector<std::unique_ptr<state_entry>>    m_entry_list;       // list of registered entries
+	std::unique_ptr<async_save_request> m_async_save; // pending background write
+	osd_work_queue *          m_async_queue;          // queue the background write runs on
+
+	// values cached when registration closes, so per-frame snapshots
+	// don't recompute them from the full entry list
+	bool                      m_layout_valid;         // are the cached values current?
+	size_t                    m_total_size;           // size of the header plus all entry data
+	u32                       m_signature;            // signature CRC over the registered structure
+	std::vector<u8>           m_cached_header;        // pre-generated state header
+
+	std::vector<state_entry *>                   m_entry_list;       // list of registered entries, allocated from the machine arena
 	std::vector<std::unique_ptr<ram_state>>      m_ramstate_list;    // list of ram states
 	std::vector<std::unique_ptr<state_callback>> m_presave_list;     // list of pre-save functions
 	std::vector<std::unique_ptr<state_callback>> m_postload_list;    // list of post-load functions
@@ -345,7 +368,9 @@ private:
 class ram_state
 {
 	save_manager &     m_save;                        // reference to save_manager
-	util::vectorstream m_data;                        // save data buffer
+	std::vector<u8>    m_data;                        // complete save data, or a delta when a keyframe is attached
+	std::shared_ptr<const std::vector<u8>> m_keyframe; // keyframe the delta applies to (rewinder use only)
+	bool               m_compressed;                  // is the delta huffman-compressed?
 
 public:
 	bool               m_valid;                       // can we load this state?
@@ -353,8 +378,13 @@ public:
 
 	ram_state(save_manager &save);
 	static size_t get_size(save_manager &save);
+	size_t stored_size() const;
 	save_error save();
 	save_error load();
+
+	// rewinder delta support
+	std::shared_ptr<const std::vector<u8>> make_keyframe();
+	void pack(const std::shared_ptr<const std::vector<u8>> &keyframe);
 };
 
 class rewinder
@@ -366,8 +396,14 @@ class rewinder
 	s32            m_first_invalid_index;             // all states before this one are guarateed to be valid
 	bool           m_first_time_warning;              // keep track of warnings we report
 	bool           m_first_time_note;                 // keep track of notes
+	u32            m_since_keyframe;                  // deltas packed since the last keyframe
+	std::shared_ptr<const std::vector<u8>> m_keyframe; // keyframe recent captures are packed against
 	std::vector<std::unique_ptr<ram_state>> m_state_list; // rewinder's own ram states
 
+	// complete states between keyframes; everything in between is stored
+	// as a compressed XOR delta against the preceding keyframe
+	static constexpr u32 KEYFRAME_INTERVAL = 60;
+
 	// load/save management
 	enum class rewind_operation
 	{
@@ -10,6 +10,12 @@
 
 #include "emu.h"
 #include "debugger.h"
+#include "emuopts.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
 
 //**************************************************************************
 //  DEBUGGING
@@ -34,6 +40,11 @@ enum
 	TRIGGER_SUSPENDTIME = -4000
 };
 
+// adaptive quantum tuning; each quiet window doubles the effective
+// quantum, up to 1 << ADAPTIVE_MAX_SHIFT times the configured value
+static constexpr attoseconds_t ADAPTIVE_QUIET_WINDOW = ATTOSECONDS_PER_MILLISECOND;
+static constexpr int ADAPTIVE_MAX_SHIFT = 3;
+
 
 
 //**************************************************************************
@@ -141,8 +152,10 @@ inline emu_timer &emu_timer::init(device_t &device, device_timer_id id, void *pt
 
 inline emu_timer &emu_timer::release()
 {
-	// unhook us from the global list
-	machine().scheduler().timer_list_remove(*this);
+	// unhook us from the global list on the way back to the pool
+	device_scheduler &scheduler = machine().scheduler();
+	scheduler.m_timers_live--;
+	scheduler.timer_list_remove(*this);
 	return *this;
 }
 
@@ -323,6 +336,136 @@ void emu_timer::device_timer_expired(emu_timer &timer, void *ptr, s32 param)
 //  DEVICE SCHEDULER
 //**************************************************************************
 
+//-------------------------------------------------
+//  sched_trace - record/verify state behind
+//  -schedtrace and -schedtrace_ref; the trace is a
+//  stream of compact records covering every
+//  executed segment and timer callback, which is
+//  enough to prove that two builds ran the same
+//  schedule (byte order is host-native, so traces
+//  only compare on the same host)
+//-------------------------------------------------
+
+class device_scheduler::sched_trace
+{
+public:
+	sched_trace(const char *filename, bool verify)
+		: m_verify(verify)
+	{
+		if (verify)
+		{
+			// load the whole reference trace up front
+			std::ifstream file(filename, std::ios::binary);
+			m_ok = file.good();
+			if (m_ok)
+			{
+				m_ref.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+				m_ok = m_ref.size() >= sizeof(MAGIC) && !std::memcmp(&m_ref[0], MAGIC, sizeof(MAGIC));
+				m_offset = sizeof(MAGIC);
+			}
+		}
+		else
+		{
+			m_file.open(filename, std::ios::binary | std::ios::trunc);
+			m_ok = m_file.good();
+			if (m_ok)
+				m_file.write(MAGIC, sizeof(MAGIC));
+		}
+	}
+
+	bool ok() const { return m_ok; }
+
+	// record one executed segment for a device
+	void record_run(device_execute_interface &exec, int ran)
+	{
+		auto ins = m_indexes.emplace(&exec, u8(m_indexes.size()));
+		if (ins.second)
+		{
+			// first appearance; emit the index-to-tag binding
+			char const *const tag = exec.device().tag();
+			u16 const length = u16(std::strlen(tag));
+			u8 define[4] = { OP_DEFINE, ins.first->second, u8(length & 0xff), u8(length >> 8) };
+			emit(define, sizeof(define));
+			emit(tag, length);
+		}
+
+		u32 const cycles = u32(ran);
+		u8 run[6] = { OP_RUN, ins.first->second, u8(cycles), u8(cycles >> 8), u8(cycles >> 16), u8(cycles >> 24) };
+		emit(run, sizeof(run));
+		m_records++;
+	}
+
+	// record one timer callback about to fire
+	void record_timer(const emu_timer &timer)
+	{
+		u32 const expire = u32(timer.expire().attoseconds() / ATTOSECONDS_PER_NANOSECOND);
+		u8 rec[5] = { OP_TIMER, u8(expire), u8(expire >> 8), u8(expire >> 16), u8(expire >> 24) };
+		emit(rec, sizeof(rec));
+		m_records++;
+	}
+
+	// report (verify mode) or finish the file (record mode)
+	void flush()
+	{
+		if (m_verify)
+		{
+			if (m_diverged)
+				osd_printf_warning("Schedule trace DIVERGED from reference after %llu records (byte offset %u)\n", (unsigned long long)m_diverge_record, u32(m_offset));
+			else if (m_offset < m_ref.size())
+				osd_printf_info("Schedule trace matched the reference for all %llu records (reference continues past this run)\n", (unsigned long long)m_records);
+			else
+				osd_printf_info("Schedule trace matched the reference exactly (%llu records)\n", (unsigned long long)m_records);
+		}
+		else
+		{
+			m_file.close();
+			osd_printf_info("Wrote schedule trace (%llu records)\n", (unsigned long long)m_records);
+		}
+	}
+
+private:
+	// record opcodes
+	static constexpr u8 OP_DEFINE = 0x00;   // u8 index, u16 tag length, tag bytes
+	static constexpr u8 OP_RUN = 0x01;      // u8 index, u32 cycles executed
+	static constexpr u8 OP_TIMER = 0x02;    // u32 expiry time in nanoseconds (low 32 bits)
+
+	static constexpr char MAGIC[8] = { 'M', 'A', 'M', 'E', 'S', 'C', 'H', '1' };
+
+	// write bytes to the file, or compare them against the reference
+	void emit(const void *data, size_t length)
+	{
+		if (length == 0)
+			return;
+		if (m_verify)
+		{
+			if (m_diverged)
+				return;
+			if ((m_offset + length) > m_ref.size() || std::memcmp(&m_ref[m_offset], data, length))
+			{
+				m_diverged = true;
+				m_diverge_record = m_records;
+				return;
+			}
+			m_offset += length;
+		}
+		else
+			m_file.write(reinterpret_cast<const char *>(data), length);
+	}
+
+	bool                m_verify;           // true to verify against a reference, false to record
+	bool                m_ok = false;       // did the file open/parse?
+	std::ofstream       m_file;             // output file (record mode)
+	std::vector<char>   m_ref;              // reference trace contents (verify mode)
+	size_t              m_offset = 0;       // current compare offset into the reference
+	bool                m_diverged = false; // has the schedule diverged from the reference?
+	u64                 m_records = 0;      // records emitted or matched so far
+	u64                 m_diverge_record = 0; // record count at the point of divergence
+	std::unordered_map<device_execute_interface *, u8> m_indexes; // device-to-index bindings
+};
+
+constexpr char device_scheduler::sched_trace::MAGIC[8];
+
+
 //-------------------------------------------------
 //  device_scheduler - constructor
 //-------------------------------------------------
@@ -332,7 +475,19 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_executing_device(nullptr),
 	m_execute_list(nullptr),
 	m_basetime(attotime::zero),
+	m_work_queue(nullptr),
+	m_parallel_mode(false),
+	m_adaptive_quantum(machine.options().adaptive_quantum()),
+	m_sync_events(0),
+	m_adaptive_shift(0),
+	m_adaptive_expire(attotime::zero),
 	m_timer_list(nullptr),
+	m_timer_tail(nullptr),
+	m_timers_allocated(0),
+	m_timers_recycled(0),
+	m_timers_temporary(0),
+	m_timers_live(0),
+	m_timers_live_peak(0),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
@@ -340,7 +495,7 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
 {
 	// append a single never-expiring timer so there is always one in the list
-	m_timer_list = &m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), nullptr, true);
+	m_timer_list = &timer_new(true).init(machine, timer_expired_delegate(), nullptr, true);
 	m_timer_list->adjust(attotime::never);
 
 	// register global states
@@ -356,12 +511,75 @@ device_scheduler::device_scheduler(running_machine &machine) :
 
 device_scheduler::~device_scheduler()
 {
+	// tear down the parallel work queue if one was created
+	if (m_work_queue != nullptr)
+		osd_work_queue_free(m_work_queue);
+
+	// report pool usage, flagging one-shot timers that can never fire;
+	// the never-expiring sentinel created by the constructor is expected
+	u32 stuck = 0;
+	for (emu_timer *timer = m_timer_list; timer != nullptr; timer = timer->next())
+		if (timer->m_temporary && timer->m_expire.is_never())
+			stuck++;
+	if (stuck > 1)
+		osd_printf_verbose("Scheduler: %u one-shot timer(s) pending with no expiry (leaked?)\n", stuck - 1);
+	osd_printf_verbose("Scheduler: %u timer allocations (%u one-shot, %u recycled), peak %u live\n",
+			m_timers_allocated, m_timers_temporary, m_timers_recycled, m_timers_live_peak);
+
 	// remove all timers
 	while (m_timer_list != nullptr)
 		m_timer_allocator.reclaim(m_timer_list->release());
 }
 
 
+//-------------------------------------------------
+//  start_trace - begin recording the schedule to
+//  a file, or verifying it against a previously
+//  recorded reference
+//-------------------------------------------------
+
+void device_scheduler::start_trace(const char *filename, bool verify)
+{
+	auto trace = std::make_unique<sched_trace>(filename, verify);
+	if (!trace->ok())
+	{
+		osd_printf_error("Failed to open schedule trace file %s\n", filename);
+		return;
+	}
+	m_trace = std::move(trace);
+}
+
+
+//-------------------------------------------------
+//  flush_trace - finish any active schedule trace
+//  and report the result
+//-------------------------------------------------
+
+void device_scheduler::flush_trace()
+{
+	if (m_trace != nullptr)
+	{
+		m_trace->flush();
+		m_trace.reset();
+	}
+}
+
+
+//-------------------------------------------------
+//  set_parallel_mode - enable or disable parallel
+//  execution of devices flagged as parallel-safe;
+//  devices without the flag continue to run
+//  serially on the scheduler's thread
+//-------------------------------------------------
+
+void device_scheduler::set_parallel_mode(bool enable)
+{
+	if (enable && m_work_queue == nullptr)
+		m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	m_parallel_mode = enable && (m_work_queue != nullptr);
+}
+
+
 //-------------------------------------------------
 //  time - return the current time
 //-------------------------------------------------
@@ -406,17 +624,20 @@ bool device_scheduler::can_save() const
 
 inline void device_scheduler::apply_suspend_changes()
 {
-	u32 suspendchanged = 0;
+	bool repartition = false;
 	for (device_execute_interface *exec = m_execute_list; exec != nullptr; exec = exec->m_nextexec)
 	{
-		suspendchanged |= exec->m_suspend ^ exec->m_nextsuspend;
+		// only a transition between running and suspended affects the list
+		// ordering; a change of suspend reason alone can be applied in place
+		if ((exec->m_suspend == 0) != (exec->m_nextsuspend == 0))
+			repartition = true;
 		exec->m_suspend = exec->m_nextsuspend;
 		exec->m_nextsuspend &= ~SUSPEND_REASON_TIMESLICE;
 		exec->m_eatcycles = exec->m_nexteatcycles;
 	}
 
-	// recompute the execute list if any CPUs changed their suspension state
-	if (suspendchanged != 0)
+	// recompute the execute list if any CPUs crossed the suspend boundary
+	if (repartition)
 		rebuild_execute_list();
 	else
 		m_suspend_changes_pending = false;
@@ -431,6 +652,7 @@ inline void device_scheduler::apply_suspend_changes()
 void device_scheduler::timeslice()
 {
 	bool call_debugger = ((machine().debug_flags & DEBUG_FLAG_ENABLED) != 0);
+	bool account_cost = g_profiler.enabled();
 
 	// build the execution list if we don't have one yet
 	if (UNEXPECTED(m_execute_list == nullptr))
@@ -440,11 +662,35 @@ void device_scheduler::timeslice()
 	while (m_basetime >= m_quantum_list.first()->m_expire)
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
+	// list of devices queued to the work queue this slice
+	std::vector<device_execute_interface *> parallel_run;
+
+	// adaptive quantum: any sync activity snaps the quantum back to the
+	// configured value; each quiet window relaxes it by another doubling
+	if (UNEXPECTED(m_adaptive_quantum))
+	{
+		if (m_sync_events != 0)
+		{
+			m_sync_events = 0;
+			m_adaptive_shift = 0;
+			m_adaptive_expire = m_basetime + attotime(0, ADAPTIVE_QUIET_WINDOW);
+		}
+		else if (m_basetime >= m_adaptive_expire)
+		{
+			if (m_adaptive_shift < ADAPTIVE_MAX_SHIFT)
+				m_adaptive_shift++;
+			m_adaptive_expire = m_basetime + attotime(0, ADAPTIVE_QUIET_WINDOW);
+		}
+	}
+
 	// loop until we hit the next timer
 	while (m_basetime < m_timer_list->m_expire)
 	{
 		// by default, assume our target is the end of the next quantum
-		attotime target(m_basetime + attotime(0, m_quantum_list.first()->m_actual));
+		attoseconds_t quantum = m_quantum_list.first()->m_actual;
+		if (UNEXPECTED(m_adaptive_shift != 0))
+			quantum = std::max(quantum, std::min(quantum << m_adaptive_shift, ATTOSECONDS_PER_SECOND / 60));
+		attotime target(m_basetime + attotime(0, quantum));
 
 		// however, if the next timer is going to fire before then, override
 		if (m_timer_list->m_expire < target)
@@ -484,6 +730,17 @@ void device_scheduler::timeslice()
 					// if we're not suspended, actually execute
 					if (exec->m_suspend == 0)
 					{
+						// parallel-safe devices are queued to the work queue and
+						// accounted for after the end-of-slice barrier
+						if (UNEXPECTED(m_parallel_mode) && exec->m_parallel_safe && !call_debugger)
+						{
+							exec->m_cycles_stolen = 0;
+							*exec->m_icountptr = exec->m_cycles_running;
+							osd_work_item_queue(m_work_queue, execute_parallel_callback, exec, WORK_ITEM_FLAG_AUTO_RELEASE);
+							parallel_run.push_back(exec);
+							continue;
+						}
+
 						g_profiler.start(exec->m_profiler);
 
 						// note that this global variable cycles_stolen can be modified
@@ -491,6 +748,7 @@ void device_scheduler::timeslice()
 						exec->m_cycles_stolen = 0;
 						m_executing_device = exec;
 						*exec->m_icountptr = exec->m_cycles_running;
+						osd_ticks_t runstart = UNEXPECTED(account_cost || exec->m_account_cost) ? osd_ticks() : 0;
 						if (!call_debugger)
 							exec->run();
 						else
@@ -506,36 +764,36 @@ void device_scheduler::timeslice()
 						assert(ran >= exec->m_cycles_stolen);
 						ran -= exec->m_cycles_stolen;
 						g_profiler.stop();
+						if (UNEXPECTED(runstart != 0))
+							exec->account_run_cost(osd_ticks() - runstart, ran);
 					}
 
-					// account for these cycles
-					exec->m_totalcycles += ran;
-
-					// update the local time for this CPU
-					attotime deltatime;
-					if (ran < exec->m_cycles_per_second)
-						deltatime = attotime(0, exec->m_attoseconds_per_cycle * ran);
-					else
-					{
-						u32 remainder;
-						s32 secs = divu_64x32_rem(ran, exec->m_cycles_per_second, remainder);
-						deltatime = attotime(secs, u64(remainder) * exec->m_attoseconds_per_cycle);
-					}
-					assert(deltatime >= attotime::zero);
-					exec->m_localtime += deltatime;
-					LOG("         %d ran, %d total, time = %s\n", ran, s32(exec->m_totalcycles), exec->m_localtime.as_string(PRECISION));
-
-					// if the new local CPU time is less than our target, move the target up, but not before the base
-					if (exec->m_localtime < target)
-					{
-						target = std::max(exec->m_localtime, m_basetime);
-						LOG("         (new target)\n");
-					}
+					// account for these cycles and update the local time
+					update_local_time(*exec, ran, target);
 				}
 			}
 		}
 		m_executing_device = nullptr;
 
+		// barrier: wait for queued parallel-safe devices, then account their cycles
+		if (UNEXPECTED(!parallel_run.empty()))
+		{
+			osd_work_queue_wait(m_work_queue, osd_ticks_per_second());
+			for (device_execute_interface *exec : parallel_run)
+			{
+				int ran = exec->m_cycles_running;
+				assert(ran >= *exec->m_icountptr);
+				ran -= *exec->m_icountptr;
+				assert(ran >= exec->m_cycles_stolen);
+				ran -= exec->m_cycles_stolen;
+				// the worker accumulated the host ticks; fold in the cycles here
+				if (UNEXPECTED(account_cost || exec->m_account_cost))
+					exec->account_run_cost(0, ran);
+				update_local_time(*exec, ran, target);
+			}
+			parallel_run.clear();
+		}
+
 		// update the base time
 		m_basetime = target;
 	}
@@ -545,6 +803,66 @@ void device_scheduler::timeslice()
 }
 
 
+//-------------------------------------------------
+//  update_local_time - account executed cycles
+//  against a device's local time, dragging the
+//  timeslice target back if the device fell short
+//-------------------------------------------------
+
+inline void device_scheduler::update_local_time(device_execute_interface &exec, int ran, attotime &target)
+{
+	// record or verify the executed segment if a trace is active
+	if (UNEXPECTED(m_trace != nullptr))
+		m_trace->record_run(exec, ran);
+
+	// account for these cycles
+	exec.m_totalcycles += ran;
+
+	// update the local time for this CPU
+	attotime deltatime;
+	if (ran < exec.m_cycles_per_second)
+		deltatime = attotime(0, exec.m_attoseconds_per_cycle * ran);
+	else
+	{
+		u32 remainder;
+		s32 secs = divu_64x32_rem(ran, exec.m_cycles_per_second, remainder);
+		deltatime = attotime(secs, u64(remainder) * exec.m_attoseconds_per_cycle);
+	}
+	assert(deltatime >= attotime::zero);
+	exec.m_localtime += deltatime;
+	LOG("         %d ran, %d total, time = %s\n", ran, s32(exec.m_totalcycles), exec.m_localtime.as_string(PRECISION));
+
+	// if the new local CPU time is less than our target, move the target up, but not before the base
+	if (exec.m_localtime < target)
+	{
+		target = std::max(exec.m_localtime, m_basetime);
+		LOG("         (new target)\n");
+	}
+}
+
+
+//-------------------------------------------------
+//  execute_parallel_callback - work item callback
+//  running a single parallel-safe device on a
+//  worker thread; no profiling or debugger hooks
+//-------------------------------------------------
+
+void *device_scheduler::execute_parallel_callback(void *param, int threadid)
+{
+	device_execute_interface &exec = *reinterpret_cast<device_execute_interface *>(param);
+	if (UNEXPECTED(exec.m_account_cost || g_profiler.enabled()))
+	{
+		// accumulate host ticks only; the barrier accounts the cycles
+		osd_ticks_t runstart = osd_ticks();
+		exec.run();
+		exec.m_cost_ticks += osd_ticks() - runstart;
+	}
+	else
+		exec.run();
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  abort_timeslice - abort execution for the
 //  current timeslice
@@ -552,6 +870,7 @@ void device_scheduler::timeslice()
 
 void device_scheduler::abort_timeslice()
 {
+	m_sync_events++;
 	if (m_executing_device != nullptr)
 		m_executing_device->abort_timeslice();
 }
@@ -563,6 +882,9 @@ void device_scheduler::abort_timeslice()
 
 void device_scheduler::trigger(int trigid, const attotime &after)
 {
+	// triggers are a cross-device synchronization mechanism
+	m_sync_events++;
+
 	// ensure we have a list of executing devices
 	if (m_execute_list == nullptr)
 		rebuild_execute_list();
@@ -585,6 +907,9 @@ void device_scheduler::trigger(int trigid, const attotime &after)
 
 void device_scheduler::boost_interleave(const attotime &timeslice_time, const attotime &boost_duration)
 {
+	// an explicit boost demands tight interleave right now
+	m_sync_events++;
+
 	// ignore timeslices > 1 second
 	if (timeslice_time.seconds() > 0)
 		return;
@@ -592,6 +917,24 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 }
 
 
+//-------------------------------------------------
+//  timer_new - grab a timer from the pool,
+//  keeping the accounting straight
+//-------------------------------------------------
+
+inline emu_timer &device_scheduler::timer_new(bool temporary)
+{
+	m_timers_allocated++;
+	if (temporary)
+		m_timers_temporary++;
+	if (!m_timer_allocator.empty())
+		m_timers_recycled++;
+	if (++m_timers_live > m_timers_live_peak)
+		m_timers_live_peak = m_timers_live;
+	return *m_timer_allocator.alloc();
+}
+
+
 //-------------------------------------------------
 //  timer_alloc - allocate a global non-device
 //  timer and return a pointer
@@ -599,7 +942,7 @@ void device_scheduler::boost_interleave(const attotime &timeslice_time, const at
 
 emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *ptr)
 {
-	return &m_timer_allocator.alloc()->init(machine(), callback, ptr, false);
+	return &timer_new(false).init(machine(), callback, ptr, false);
 }
 
 
@@ -611,7 +954,10 @@ emu_timer *device_scheduler::timer_alloc(timer_expired_delegate callback, void *
 
 void device_scheduler::timer_set(const attotime &duration, timer_expired_delegate callback, int param, void *ptr)
 {
-	m_timer_allocator.alloc()->init(machine(), callback, ptr, true).adjust(duration, param);
+	// zero-latency timers are the usual cross-device synchronization idiom
+	if (duration == attotime::zero)
+		m_sync_events++;
+	timer_new(true).init(machine(), callback, ptr, true).adjust(duration, param);
 }
 
 
@@ -622,7 +968,7 @@ void device_scheduler::timer_set(const attotime &duration, timer_expired_delegat
 
 emu_timer *device_scheduler::timer_alloc(device_t &device, device_timer_id id, void *ptr)
 {
-	return &m_timer_allocator.alloc()->init(device, id, ptr, false);
+	return &timer_new(false).init(device, id, ptr, false);
 }
 
 
@@ -634,7 +980,10 @@ emu_timer *device_scheduler::timer_alloc(device_t &device, device_timer_id id, v
 
 void device_scheduler::timer_set(const attotime &duration, device_t &device, device_timer_id id, int param, void *ptr)
 {
-	m_timer_allocator.alloc()->init(device, id, ptr, true).adjust(duration, param);
+	// zero-latency timers are the usual cross-device synchronization idiom
+	if (duration == attotime::zero)
+		m_sync_events++;
+	timer_new(true).init(device, id, ptr, true).adjust(duration, param);
 }
 
 
@@ -778,6 +1127,13 @@ void device_scheduler::rebuild_execute_list()
 		add_scheduling_quantum(min_quantum, attotime::never);
 	}
 
+	// enumerating the device tree involves an interface lookup per device,
+	// which is far too expensive to repeat every time a spinning CPU toggles
+	// its suspend state, so cache the enumeration the first time through
+	if (m_execute_cache.empty())
+		for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+			m_execute_cache.push_back(&exec);
+
 	// start with an empty list
 	device_execute_interface **active_tailptr = &m_execute_list;
 	*active_tailptr = nullptr;
@@ -787,19 +1143,19 @@ void device_scheduler::rebuild_execute_list()
 	device_execute_interface **suspend_tailptr = &suspend_list;
 
 	// iterate over all devices
-	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+	for (device_execute_interface *exec : m_execute_cache)
 	{
 		// append to the appropriate list
-		exec.m_nextexec = nullptr;
-		if (exec.m_suspend == 0)
+		exec->m_nextexec = nullptr;
+		if (exec->m_suspend == 0)
 		{
-			*active_tailptr = &exec;
-			active_tailptr = &exec.m_nextexec;
+			*active_tailptr = exec;
+			active_tailptr = &exec->m_nextexec;
 		}
 		else
 		{
-			*suspend_tailptr = &exec;
-			suspend_tailptr = &exec.m_nextexec;
+			*suspend_tailptr = exec;
+			suspend_tailptr = &exec->m_nextexec;
 		}
 	}
 
@@ -818,12 +1174,25 @@ inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 	// disabled timers sort to the end
 	const attotime expire = timer.m_enabled ? timer.m_expire : attotime::never;
 
+	// fast path: if we expire at or after the tail, append at the end; this
+	// covers the common cases of never-expiring and disabled timers without
+	// walking the whole list; compare against the tail's effective key, as
+	// a disabled tail sorts as never regardless of its stale expire time
+	if (m_timer_tail != nullptr && (m_timer_tail->m_enabled ? m_timer_tail->m_expire : attotime::never) <= expire)
+	{
+		timer.m_prev = m_timer_tail;
+		timer.m_next = nullptr;
+		m_timer_tail->m_next = &timer;
+		m_timer_tail = &timer;
+		return timer;
+	}
+
 	// loop over the timer list
 	emu_timer *prevtimer = nullptr;
 	for (emu_timer *curtimer = m_timer_list; curtimer != nullptr; prevtimer = curtimer, curtimer = curtimer->next())
 	{
 		// if the current list entry expires after us, we should be inserted before it
-		if (curtimer->m_expire > expire)
+		if ((curtimer->m_enabled ? curtimer->m_expire : attotime::never) > expire)
 		{
 			// link the new guy in before the current list entry
 			timer.m_prev = prevtimer;
@@ -847,6 +1216,7 @@ inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 
 	timer.m_prev = prevtimer;
 	timer.m_next = nullptr;
+	m_timer_tail = &timer;
 	return timer;
 }
 
@@ -866,6 +1236,8 @@ inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 
 	if (timer.m_next != nullptr)
 		timer.m_next->m_prev = timer.m_prev;
+	else
+		m_timer_tail = timer.m_prev;
 
 	return timer;
 }
@@ -885,6 +1257,10 @@ inline void device_scheduler::execute_timers()
 		// if this is a one-shot timer, disable it now
 		emu_timer &timer = *m_timer_list;
 		bool was_enabled = timer.m_enabled;
+
+		// record or verify the expiration if a trace is active
+		if (UNEXPECTED(m_trace != nullptr))
+			m_trace->record_timer(timer);
 		if (timer.m_period.is_zero() || timer.m_period.is_never())
 			timer.m_enabled = false;
 
@@ -981,6 +1357,8 @@ void device_scheduler::dump_timers() const
 {
 	machine().logerror("=============================================\n");
 	machine().logerror("Timer Dump: Time = %15s\n", time().as_string(PRECISION));
+	machine().logerror("Pool: %u allocations (%u one-shot, %u recycled), %u live (peak %u)\n",
+			m_timers_allocated, m_timers_temporary, m_timers_recycled, m_timers_live, m_timers_live_peak);
 	for (emu_timer *timer = first_timer(); timer != nullptr; timer = timer->next())
 		timer->dump();
 	machine().logerror("=============================================\n");
@@ -119,9 +119,12 @@ public:
 	// execution
 	void timeslice();
 	void abort_timeslice();
+	void set_parallel_mode(bool enable);
+	bool parallel_mode() const { return m_parallel_mode; }
+	bool adaptive_quantum() const { return m_adaptive_quantum; }
 	void trigger(int trigid, const attotime &after = attotime::zero);
 	void boost_interleave(const attotime &timeslice_time, const attotime &boost_duration);
-	void suspend_resume_changed() { m_suspend_changes_pending = true; }
+	void suspend_resume_changed() { m_suspend_changes_pending = true; m_sync_events++; }
 
 	// timers, specified by callback/name
 	emu_timer *timer_alloc(timer_expired_delegate callback, void *ptr = nullptr);
@@ -135,10 +138,23 @@ public:
 	// debugging
 	void dump_timers() const;
 
+	// timer pool accounting
+	u32 timers_allocated() const noexcept { return m_timers_allocated; }
+	u32 timers_recycled() const noexcept { return m_timers_recycled; }
+	u32 timers_live() const noexcept { return m_timers_live; }
+	u32 timers_live_peak() const noexcept { return m_timers_live_peak; }
+
+	// schedule trace recording/verification (-schedtrace/-schedtrace_ref)
+	void start_trace(const char *filename, bool verify);
+	void flush_trace();
+
 	// for emergencies only!
 	void eat_all_cycles();
 
 private:
+	// schedule trace record/verify state
+	class sched_trace;
+
 	// callbacks
 	void timed_trigger(void *ptr, s32 param);
 	void presave();
@@ -151,25 +167,52 @@ private:
 	void add_scheduling_quantum(const attotime &quantum, const attotime &duration);
 
 	// timer helpers
+	emu_timer &timer_new(bool temporary);
 	emu_timer &timer_list_insert(emu_timer &timer);
 	emu_timer &timer_list_remove(emu_timer &timer);
 	void execute_timers();
 
+	// parallel execution helpers
+	void update_local_time(device_execute_interface &exec, int ran, attotime &target);
+	static void *execute_parallel_callback(void *param, int threadid);
+
 	// internal state
 	running_machine &           m_machine;                  // reference to our machine
 	device_execute_interface *  m_executing_device;         // pointer to currently executing device
 	device_execute_interface *  m_execute_list;             // list of devices to be executed
+	std::vector<device_execute_interface *> m_execute_cache; // cached enumeration of all execute interfaces
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
 
+	// parallel execution state
+	osd_work_queue *            m_work_queue;               // work queue for parallel-safe devices
+	bool                        m_parallel_mode;            // true if parallel execution is enabled
+
+	// adaptive quantum state; while the devices are not synchronizing via
+	// triggers, suspends or zero-latency timers, the effective quantum is
+	// progressively doubled; any sync event snaps it back to the configured value
+	bool                        m_adaptive_quantum;         // true if adaptive quantum relaxation is enabled
+	u32                         m_sync_events;              // sync events seen since the last check
+	int                         m_adaptive_shift;           // current left shift applied to the quantum
+	attotime                    m_adaptive_expire;          // end of the current quiet observation window
+
 	// list of active timers
 	emu_timer *                 m_timer_list;               // head of the active list
+	emu_timer *                 m_timer_tail;               // tail of the active list, for O(1) appends
 	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
 
+	// timer pool accounting
+	u32                         m_timers_allocated;         // total timer initializations
+	u32                         m_timers_recycled;          // initializations served from the free list
+	u32                         m_timers_temporary;         // one-shot (timer_set-style) initializations
+	u32                         m_timers_live;              // timers currently allocated from the pool
+	u32                         m_timers_live_peak;         // high-water mark of live timers
+
 	// other internal states
 	emu_timer *                 m_callback_timer;           // pointer to the current callback timer
 	bool                        m_callback_timer_modified;  // true if the current callback timer was modified
 	attotime                    m_callback_timer_expire_time; // the original expiration time
 	bool                        m_suspend_changes_pending;  // suspend/resume changes are pending
+	std::unique_ptr<sched_trace> m_trace;                   // active schedule trace, or null
 
 	// scheduling quanta
 	class quantum_slot
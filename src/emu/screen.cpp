@@ -553,6 +553,7 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_curbitmap(0)
 	, m_curtexture(0)
 	, m_changed(true)
+	, m_frame_latched(false)
 	, m_last_partial_scan(0)
 	, m_partial_scan_hpos(-1)
 	, m_color(rgb_t(0xff, 0xff, 0xff, 0xff))
@@ -569,6 +570,7 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_scanline_timer(nullptr)
 	, m_frame_number(0)
 	, m_partial_updates_this_frame(0)
+	, m_update_queue(nullptr)
 {
 	m_unique_id = m_id_counter;
 	m_id_counter++;
@@ -583,6 +585,8 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 screen_device::~screen_device()
 {
 	destroy_scan_bitmaps();
+	if (m_update_queue != nullptr)
+		osd_work_queue_free(m_update_queue);
 }
 
 
@@ -844,6 +848,10 @@ void screen_device::device_start()
 	if ((m_video_attributes & VIDEO_UPDATE_SCANLINE) != 0 || m_scanline_cb)
 		m_scanline_timer = timer_alloc(TID_SCANLINE);
 
+	// allocate a work queue if the driver promises a slice-parallel update callback
+	if ((m_video_attributes & VIDEO_UPDATE_PARALLEL) != 0 && m_type != SCREEN_TYPE_SVG && !(m_video_attributes & VIDEO_VARIABLE_WIDTH))
+		m_update_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
 	// configure the screen with the default parameters
 	configure(m_width, m_height, m_visarea, m_refresh);
 
@@ -1222,12 +1230,17 @@ bool screen_device::update_partial(int scanline)
 	{
 		if (m_type != SCREEN_TYPE_SVG)
 		{
-			screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
-			switch (curbitmap.format())
+			if (m_update_queue != nullptr)
+				flags = update_bands(clip);
+			else
 			{
-				default:
-				case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-				case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
+				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
+				switch (curbitmap.format())
+				{
+					default:
+					case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
+					case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
+				}
 			}
 		}
 		else
@@ -1249,6 +1262,77 @@ bool screen_device::update_partial(int scanline)
 }
 
 
+//-------------------------------------------------
+//  update_bands - split a partial update into
+//  horizontal bands and run the update callback
+//  on the work queue; only used when the driver
+//  has opted in via VIDEO_UPDATE_PARALLEL
+//-------------------------------------------------
+
+u32 screen_device::update_bands(const rectangle &clip)
+{
+	// bands shorter than this aren't worth the dispatch overhead
+	constexpr int MIN_BAND_HEIGHT = 16;
+	constexpr int MAX_BANDS = 8;
+
+	// for small updates just run the callback directly on this thread
+	int numbands = std::min(MAX_BANDS, clip.height() / MIN_BAND_HEIGHT);
+	if (numbands < 2)
+	{
+		update_band band{ this, clip, 0 };
+		update_band_work(&band, -1);
+		return band.flags;
+	}
+
+	// carve the cliprect into equal horizontal bands
+	m_update_bands.clear();
+	int top = clip.top();
+	for (int bandnum = 0; bandnum < numbands; bandnum++)
+	{
+		int bottom = clip.top() + (clip.height() * (bandnum + 1)) / numbands - 1;
+		update_band &band = m_update_bands.emplace_back();
+		band.screen = this;
+		band.clip = clip;
+		band.clip.sety(top, bottom);
+		band.flags = 0;
+		top = bottom + 1;
+	}
+
+	// queue one item per band and wait for completion
+	for (update_band &band : m_update_bands)
+		osd_work_item_queue(m_update_queue, update_band_work, &band, WORK_ITEM_FLAG_AUTO_RELEASE);
+	while (!osd_work_queue_wait(m_update_queue, osd_ticks_per_second()))
+		;
+
+	// the not-changed flag only survives if every band reported it
+	u32 flags = UPDATE_HAS_NOT_CHANGED;
+	for (const update_band &band : m_update_bands)
+		flags &= band.flags;
+	return flags;
+}
+
+
+//-------------------------------------------------
+//  update_band_work - work queue callback to
+//  update one horizontal band of the screen
+//-------------------------------------------------
+
+void *screen_device::update_band_work(void *param, int threadid)
+{
+	update_band &band = *reinterpret_cast<update_band *>(param);
+	screen_device &screen = *band.screen;
+
+	screen_bitmap &curbitmap = screen.m_bitmap[screen.m_curbitmap];
+	switch (curbitmap.format())
+	{
+		default:
+		case BITMAP_FORMAT_IND16:   band.flags = screen.m_screen_update_ind16(screen, curbitmap.as_ind16(), band.clip);   break;
+		case BITMAP_FORMAT_RGB32:   band.flags = screen.m_screen_update_rgb32(screen, curbitmap.as_rgb32(), band.clip);   break;
+	}
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  update_now - perform an update from the last
 //  beam position up to the current beam position
@@ -1656,6 +1740,16 @@ void screen_device::vblank_begin()
 	if (m_is_primary_screen && !(m_video_attributes & VIDEO_UPDATE_AFTER_VBLANK))
 		machine().video().frame_update();
 
+	// other screens complete and latch their frame on their own cadence;
+	// this is where a screen with a refresh rate different from the
+	// primary's gets its frame finished at the right time instead of
+	// being forced to the primary's vblank
+	if (frame_latching() && machine().phase() == machine_phase::RUNNING)
+	{
+		update_partial(m_visarea.max_y);
+		latch_complete_frame();
+	}
+
 	// call the screen specific callbacks
 	for (auto &item : m_callback_list)
 		item->m_callback(*this, true);
@@ -1750,16 +1844,39 @@ void screen_device::create_composited_bitmap()
 //  screen
 //-------------------------------------------------
 
+void screen_device::latch_complete_frame()
+{
+	// nothing to do if the frame didn't change or isn't going anywhere
+	if (!m_changed || machine().video().skip_this_frame() || !machine().render().is_live(*this))
+		return;
+
+	// move the completed frame into the presentation texture; rows of
+	// the next frame rendered before the primary screen presents will
+	// go into the other bitmap
+	if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
+		create_composited_bitmap();
+	m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
+	m_curtexture = m_curbitmap;
+	m_curbitmap = 1 - m_curbitmap;
+	m_changed = false;
+	m_frame_latched = true;
+}
+
+
 bool screen_device::update_quads()
 {
+	bool const latched = m_frame_latched;
+	m_frame_latched = false;
+
 	// only update if live
 	if (machine().render().is_live(*this))
 	{
 		// only update if empty and not a vector game; otherwise assume the driver did it directly
 		if (m_type != SCREEN_TYPE_VECTOR && (m_video_attributes & VIDEO_SELF_RENDER) == 0)
 		{
-			// if we're not skipping the frame and if the screen actually changed, then update the texture
-			if (!machine().video().skip_this_frame() && m_changed)
+			// if we're not skipping the frame and if the screen actually changed, then update the texture;
+			// frame-latching screens have already done this at their own vblank
+			if (!frame_latching() && !machine().video().skip_this_frame() && m_changed)
 			{
 				if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 				{
@@ -1779,9 +1896,18 @@ bool screen_device::update_quads()
 		}
 	}
 
-	// reset the screen changed flags
-	bool result = m_changed;
-	m_changed = false;
+	// reset the screen changed flags; for frame-latching screens the
+	// change state is consumed when the frame is latched instead
+	bool result;
+	if (frame_latching())
+	{
+		result = latched;
+	}
+	else
+	{
+		result = m_changed;
+		m_changed = false;
+	}
 	return result;
 }
 
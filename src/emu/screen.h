@@ -60,6 +60,11 @@ constexpr u32 UPDATE_HAS_NOT_CHANGED = 0x0001;   // the video has not changed
  @def VIDEO_VARIABLE_WIDTH
  causes the screen to construct its final bitmap from a composite upscale of individual scanline bitmaps
 
+ @def VIDEO_UPDATE_PARALLEL
+ promises that the screen update callback is a pure function of the emulated
+ state for any sub-rectangle, so partial updates may be split into horizontal
+ bands and run concurrently on worker threads
+
  @}
  */
 
@@ -70,6 +75,7 @@ constexpr u32 VIDEO_SELF_RENDER             = 0x0008;
 constexpr u32 VIDEO_ALWAYS_UPDATE           = 0x0080;
 constexpr u32 VIDEO_UPDATE_SCANLINE         = 0x0100;
 constexpr u32 VIDEO_VARIABLE_WIDTH          = 0x0200;
+constexpr u32 VIDEO_UPDATE_PARALLEL         = 0x0400;
 
 
 //**************************************************************************
@@ -403,6 +409,10 @@ public:
 	int partial_scan_hpos() const { return m_partial_scan_hpos; }
 	bool update_partial(int scanline);
 	void update_now();
+
+	// true for screens that complete and latch their frames at their own
+	// vblank instead of being driven at the primary screen's refresh
+	bool frame_latching() const { return !m_is_primary_screen && (m_type != SCREEN_TYPE_VECTOR) && !(m_video_attributes & VIDEO_SELF_RENDER); }
 	void reset_partial_updates();
 
 	// additional helpers
@@ -420,6 +430,14 @@ public:
 private:
 	class svg_renderer;
 
+	// a horizontal band of a parallel screen update
+	struct update_band
+	{
+		screen_device * screen;             // screen being updated
+		rectangle       clip;               // band to pass to the update callback
+		u32             flags;              // result flags from the callback
+	};
+
 	// timer IDs
 	enum
 	{
@@ -444,6 +462,7 @@ private:
 	void realloc_screen_bitmaps();
 	void vblank_begin();
 	void vblank_end();
+	void latch_complete_frame();
 	void finalize_burnin();
 	void load_effect_overlay(const char *filename);
 	void update_scan_bitmap_size(int y);
@@ -451,6 +470,8 @@ private:
 	void create_composited_bitmap();
 	void destroy_scan_bitmaps();
 	void allocate_scan_bitmaps();
+	u32 update_bands(const rectangle &clip);
+	static void *update_band_work(void *param, int threadid);
 
 	// inline configuration data
 	screen_type_enum    m_type;                     // type of screen
@@ -489,6 +510,7 @@ private:
 	u8                  m_curbitmap;                // current bitmap index
 	u8                  m_curtexture;               // current texture index
 	bool                m_changed;                  // has this bitmap changed?
+	bool                m_frame_latched;            // texture latched with a completed frame at our own vblank
 	s32                 m_last_partial_scan;        // scanline of last partial update
 	s32                 m_partial_scan_hpos;        // horizontal pixel last rendered on this partial scanline
 	bitmap_argb32       m_screen_overlay_bitmap;    // screen overlay bitmap
@@ -510,6 +532,10 @@ private:
 	u64                 m_frame_number;             // the current frame number
 	u32                 m_partial_updates_this_frame;// partial update counter this frame
 
+	// parallel updates
+	osd_work_queue *    m_update_queue;             // work queue for parallel updates, or nullptr
+	std::vector<update_band> m_update_bands;        // band parameters for the current update
+
 	bool                m_is_primary_screen;
 
 	// VBLANK callbacks
@@ -192,7 +192,8 @@ public:
 			std::string &listname,
 			std::string &description,
 			std::list<software_info> &infolist,
-			std::ostream &errors);
+			std::ostream &errors,
+			std::vector<software_item_location> *locations);
 
 private:
 	enum parse_position
@@ -238,6 +239,7 @@ private:
 	const std::string_view      m_filename;
 	std::list<software_info> &  m_infolist;
 	std::ostream &              m_errors;
+	std::vector<software_item_location> *m_locations;
 	struct XML_ParserStruct *   m_parser;
 	std::string &               m_listname;
 	std::string &               m_description;
@@ -260,10 +262,12 @@ softlist_parser::softlist_parser(
 		std::string &listname,
 		std::string &description,
 		std::list<software_info> &infolist,
-		std::ostream &errors) :
+		std::ostream &errors,
+		std::vector<software_item_location> *locations) :
 	m_filename(filename),
 	m_infolist(infolist),
 	m_errors(errors),
+	m_locations(locations),
 	m_listname(listname),
 	m_description(description),
 	m_data_accum_expected(false),
@@ -562,6 +566,10 @@ void softlist_parser::parse_main_start(const char *tagname, const char **attribu
 		{
 			m_infolist.emplace_back(std::string(attrvalues[0]), std::string(attrvalues[1]), attrvalues[2]);
 			m_current_info = &m_infolist.back();
+
+			// record where this item starts in the source file
+			if (m_locations != nullptr)
+				m_locations->emplace_back(software_item_location{ m_current_info->shortname(), u64(XML_GetCurrentByteIndex(m_parser)), 0 });
 		}
 		else
 			parse_error("No name defined for item");
@@ -578,6 +586,9 @@ void softlist_parser::parse_main_start(const char *tagname, const char **attribu
 
 void softlist_parser::parse_main_end(const char *tagname)
 {
+	// record where this item ends in the source file
+	if (m_locations != nullptr && m_current_info != nullptr && strcmp(tagname, "software") == 0 && !m_locations->empty())
+		m_locations->back().end = u64(XML_GetCurrentByteIndex(m_parser)) + XML_GetCurrentByteCount(m_parser);
 }
 
 
@@ -914,9 +925,10 @@ void parse_software_list(
 		std::string &listname,
 		std::string &description,
 		std::list<software_info> &infolist,
-		std::ostream &errors)
+		std::ostream &errors,
+		std::vector<software_item_location> *locations)
 {
-	detail::softlist_parser(file, filename, listname, description, infolist, errors);
+	detail::softlist_parser(file, filename, listname, description, infolist, errors, locations);
 }
 
 
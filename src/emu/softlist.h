@@ -22,6 +22,7 @@
 #include <set>
 #include <string>
 #include <string_view>
+#include <vector>
 
 
 //**************************************************************************
@@ -157,16 +158,27 @@ private:
 };
 
 
+// describes where one software item lives in the source XML
+struct software_item_location
+{
+	std::string     name;               // short name of the item
+	u64             begin;              // offset of the opening <software> tag
+	u64             end;                // offset just past the closing </software> tag
+};
+
+
 // ----- Helpers -----
 
-// parses a software list
+// parses a software list; if locations is non-null, it is filled with the
+// byte range each software item occupies in the source file
 void parse_software_list(
 		util::read_stream &file,
 		std::string_view filename,
 		std::string &listname,
 		std::string &description,
 		std::list<software_info> &infolist,
-		std::ostream &errors);
+		std::ostream &errors,
+		std::vector<software_item_location> *locations = nullptr);
 
 // parses a software identifier (e.g. - 'apple2e:agentusa:flop1') into its constituent parts (returns false if cannot parse)
 bool software_name_parse(std::string_view identifier, std::string *list_name = nullptr, std::string *software_name = nullptr, std::string *part_name = nullptr);
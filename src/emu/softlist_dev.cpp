@@ -17,11 +17,24 @@
 #include "validity.h"
 
 #include "corestr.h"
+#include "hashing.h"
 #include "unicode.h"
 
+#include <algorithm>
 #include <cctype>
 
 
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// binary index sidecar format
+static constexpr u8 INDEX_MAGIC[4] = { 'S', 'L', 'I', 'X' };
+static constexpr u32 INDEX_VERSION = 1;
+static constexpr u32 INDEX_HEADER_SIZE = 32;
+static constexpr u32 INDEX_RECORD_SIZE = 20;
+
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
@@ -29,6 +42,35 @@
 typedef std::unordered_map<std::string, const software_info *> softlist_map;
 
 
+//**************************************************************************
+//  INLINE HELPERS
+//**************************************************************************
+
+static inline void put_u32le(u8 *dest, u32 value)
+{
+	dest[0] = value >> 0;
+	dest[1] = value >> 8;
+	dest[2] = value >> 16;
+	dest[3] = value >> 24;
+}
+
+static inline void put_u64le(u8 *dest, u64 value)
+{
+	put_u32le(&dest[0], u32(value));
+	put_u32le(&dest[4], u32(value >> 32));
+}
+
+static inline u32 get_u32le(const u8 *src)
+{
+	return u32(src[0]) | (u32(src[1]) << 8) | (u32(src[2]) << 16) | (u32(src[3]) << 24);
+}
+
+static inline u64 get_u64le(const u8 *src)
+{
+	return u64(get_u32le(&src[0])) | (u64(get_u32le(&src[4])) << 32);
+}
+
+
 //**************************************************************************
 //  GLOBAL VARIABLES
 //**************************************************************************
@@ -182,6 +224,7 @@ void software_list_device::release()
 	m_description.clear();
 	m_errors.clear();
 	m_infolist.clear();
+	m_indexed_info.clear();
 }
 
 
@@ -257,6 +300,20 @@ const software_info *software_list_device::find(const std::string &look_for)
 
 	const bool iswild = look_for.find_first_of("*?") != std::string::npos;
 
+	// before paying for a full parse, an exact lookup can try the binary
+	// index sidecar and materialize just the one item from the XML
+	if (!m_parsed && !iswild)
+	{
+		// check items materialized by previous lookups first
+		for (const software_info &info : m_indexed_info)
+			if (core_stricmp(look_for.c_str(), info.shortname().c_str()) == 0)
+				return &info;
+
+		const software_info *const indexed = find_indexed(look_for);
+		if (indexed != nullptr)
+			return indexed;
+	}
+
 	// find a match (will cause a parse if needed when calling get_info)
 	const auto &info_list = get_info();
 	auto iter = std::find_if(
@@ -294,9 +351,15 @@ void software_list_device::parse()
 	{
 		// parse if no error
 		std::ostringstream errs;
-		parse_software_list(file, m_filename, m_shortname, m_description, m_infolist, errs);
-		file.close();
+		std::vector<software_item_location> locations;
+		parse_software_list(file, m_filename, m_shortname, m_description, m_infolist, errs, &locations);
 		m_errors = errs.str();
+
+		// a clean parse refreshes the binary index sidecar used to look up
+		// single items without parsing the whole file
+		if (m_errors.empty() && !locations.empty())
+			write_index(file, locations);
+		file.close();
 	}
 	else if (std::errc::no_such_file_or_directory == filerr)
 	{
@@ -312,6 +375,201 @@ void software_list_device::parse()
 }
 
 
+//-------------------------------------------------
+//  write_index - write the binary index sidecar
+//  recording where each software item lives in
+//  the source file
+//-------------------------------------------------
+
+void software_list_device::write_index(emu_file &file, const std::vector<software_item_location> &locations)
+{
+	// the prologue is everything up to the first software item; a fragment
+	// of the file only parses as a document with the prologue intact
+	u64 const filesize = file.size();
+	u64 const prologue_length = locations.front().begin;
+	if (prologue_length == 0 || prologue_length > filesize)
+		return;
+
+	// read the whole file back so the ranges can be checksummed
+	std::vector<u8> contents(filesize);
+	file.seek(0, SEEK_SET);
+	if (file.read(&contents[0], filesize) != filesize)
+		return;
+	u32 const prologue_crc = util::crc32_creator::simple(&contents[0], prologue_length);
+
+	// validate the recorded ranges before trusting them
+	for (const software_item_location &location : locations)
+		if (location.begin < prologue_length || location.end <= location.begin || location.end > filesize)
+			return;
+
+	// skip the rewrite if an up-to-date index is already present
+	{
+		emu_file existing(mconfig().options().hash_path(), OPEN_FLAG_READ);
+		if (!existing.open(m_list_name + ".idx"))
+		{
+			u8 header[INDEX_HEADER_SIZE];
+			if (existing.read(header, sizeof(header)) == sizeof(header)
+					&& memcmp(&header[0], INDEX_MAGIC, sizeof(INDEX_MAGIC)) == 0
+					&& get_u32le(&header[4]) == INDEX_VERSION
+					&& get_u64le(&header[8]) == filesize
+					&& get_u32le(&header[16]) == prologue_length
+					&& get_u32le(&header[20]) == prologue_crc
+					&& get_u32le(&header[24]) == locations.size())
+				return;
+		}
+	}
+
+	// sort the records by name so that lookups can binary search
+	std::vector<const software_item_location *> sorted;
+	sorted.reserve(locations.size());
+	for (const software_item_location &location : locations)
+		sorted.push_back(&location);
+	std::sort(sorted.begin(), sorted.end(), [] (const software_item_location *a, const software_item_location *b) { return a->name < b->name; });
+
+	// build the records and the interned name table
+	std::vector<u8> records(sorted.size() * INDEX_RECORD_SIZE);
+	std::vector<char> table;
+	u8 *record = &records[0];
+	for (const software_item_location *location : sorted)
+	{
+		u32 const length = u32(location->end - location->begin);
+		put_u32le(&record[0], u32(table.size()));
+		put_u64le(&record[4], location->begin);
+		put_u32le(&record[12], length);
+		put_u32le(&record[16], util::crc32_creator::simple(&contents[location->begin], length));
+		record += INDEX_RECORD_SIZE;
+		table.insert(table.end(), location->name.c_str(), location->name.c_str() + location->name.length() + 1);
+	}
+
+	// write the sidecar; failure (e.g. a read-only hash path) is harmless
+	emu_file index(mconfig().options().hash_path(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (index.open(m_list_name + ".idx"))
+		return;
+	u8 header[INDEX_HEADER_SIZE] = { INDEX_MAGIC[0], INDEX_MAGIC[1], INDEX_MAGIC[2], INDEX_MAGIC[3] };
+	put_u32le(&header[4], INDEX_VERSION);
+	put_u64le(&header[8], filesize);
+	put_u32le(&header[16], u32(prologue_length));
+	put_u32le(&header[20], prologue_crc);
+	put_u32le(&header[24], u32(sorted.size()));
+	put_u32le(&header[28], u32(table.size()));
+	index.write(header, sizeof(header));
+	index.write(&records[0], records.size());
+	index.write(&table[0], table.size());
+	index.close();
+	osd_printf_verbose("%s: Wrote binary index for %s (%d items)\n", tag(), m_list_name, int(sorted.size()));
+}
+
+
+//-------------------------------------------------
+//  find_indexed - look up a single item through
+//  the binary index sidecar and materialize it
+//  without parsing the whole source file
+//-------------------------------------------------
+
+const software_info *software_list_device::find_indexed(const std::string &look_for)
+{
+	// open the source XML and its index sidecar
+	emu_file file(mconfig().options().hash_path(), OPEN_FLAG_READ);
+	if (file.open(m_list_name + ".xml"))
+		return nullptr;
+	m_filename = file.filename();
+	emu_file index(mconfig().options().hash_path(), OPEN_FLAG_READ);
+	if (index.open(m_list_name + ".idx"))
+		return nullptr;
+
+	// read the header and validate it against the current source file
+	u8 header[INDEX_HEADER_SIZE];
+	if (index.read(header, sizeof(header)) != sizeof(header))
+		return nullptr;
+	if (memcmp(&header[0], INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 || get_u32le(&header[4]) != INDEX_VERSION)
+		return nullptr;
+	if (get_u64le(&header[8]) != file.size())
+		return nullptr;
+	u32 const prologue_length = get_u32le(&header[16]);
+	u32 const count = get_u32le(&header[24]);
+	u32 const table_size = get_u32le(&header[28]);
+	if (prologue_length == 0 || prologue_length > file.size() || count == 0 || table_size == 0)
+		return nullptr;
+	if (u64(count) * INDEX_RECORD_SIZE + table_size + INDEX_HEADER_SIZE > index.size())
+		return nullptr;
+
+	// the prologue checksum catches edits to the source file
+	std::vector<u8> prologue(prologue_length);
+	if (file.read(&prologue[0], prologue_length) != prologue_length)
+		return nullptr;
+	if (u32(util::crc32_creator::simple(&prologue[0], prologue_length)) != get_u32le(&header[20]))
+		return nullptr;
+
+	// read the records and the interned name table
+	std::vector<u8> records(count * INDEX_RECORD_SIZE);
+	if (index.read(&records[0], records.size()) != records.size())
+		return nullptr;
+	std::vector<char> table(table_size);
+	if (index.read(&table[0], table_size) != table_size || table.back() != '\0')
+		return nullptr;
+	index.close();
+
+	// binary search the records for the name
+	std::string const name = strmakelower(look_for);
+	const u8 *found = nullptr;
+	u32 lo = 0, hi = count;
+	while (lo < hi)
+	{
+		u32 const mid = (lo + hi) / 2;
+		const u8 *const record = &records[mid * INDEX_RECORD_SIZE];
+		u32 const nameoffs = get_u32le(&record[0]);
+		if (nameoffs >= table_size)
+			return nullptr;
+		int const cmp = strcmp(&table[nameoffs], name.c_str());
+		if (cmp == 0)
+		{
+			found = record;
+			break;
+		}
+		else if (cmp < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (found == nullptr)
+		return nullptr;
+
+	// fetch the item's bytes and verify them
+	u64 const begin = get_u64le(&found[4]);
+	u32 const length = get_u32le(&found[12]);
+	if (begin < prologue_length || begin + length > file.size())
+		return nullptr;
+	std::vector<u8> item(length);
+	file.seek(begin, SEEK_SET);
+	if (file.read(&item[0], length) != length)
+		return nullptr;
+	if (u32(util::crc32_creator::simple(&item[0], length)) != get_u32le(&found[16]))
+		return nullptr;
+	file.close();
+
+	// synthesize a document containing just this item and parse it
+	std::string document;
+	document.reserve(prologue_length + length + 16);
+	document.append(reinterpret_cast<const char *>(&prologue[0]), prologue_length);
+	document.append(reinterpret_cast<const char *>(&item[0]), length);
+	document.append("</softwarelist>");
+	util::random_read::ptr stream = util::ram_read(document.data(), document.size());
+	if (!stream)
+		return nullptr;
+
+	std::ostringstream errs;
+	std::list<software_info> infolist;
+	parse_software_list(*stream, m_filename, m_shortname, m_description, infolist, errs);
+	if (!errs.str().empty() || infolist.size() != 1 || core_stricmp(infolist.front().shortname().c_str(), look_for.c_str()) != 0)
+		return nullptr;
+
+	// keep the materialized item alive for the life of the device
+	m_indexed_info.splice(m_indexed_info.end(), infolist);
+	osd_printf_verbose("%s: Found %s via binary index\n", tag(), look_for);
+	return &m_indexed_info.back();
+}
+
+
 //-------------------------------------------------
 //  is_compatible - determine if we are compatible
 //  with the given software_list_device
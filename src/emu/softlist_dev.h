@@ -140,6 +140,8 @@ protected:
 private:
 	// internal helpers
 	void parse();
+	void write_index(emu_file &file, const std::vector<software_item_location> &locations);
+	const software_info *find_indexed(const std::string &look_for);
 	void internal_validity_check(validity_checker &valid) ATTR_COLD;
 
 	// configuration state
@@ -154,6 +156,7 @@ private:
 	std::string                 m_description;
 	std::string                 m_errors;
 	std::list<software_info>    m_infolist;
+	std::list<software_info>    m_indexed_info;     // items materialized individually via the index
 };
 
 
@@ -559,6 +559,7 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 	m_output_adaptive(sample_rate == SAMPLE_RATE_OUTPUT_ADAPTIVE),
 	m_synchronous((flags & STREAM_SYNCHRONOUS) != 0),
 	m_resampling_disabled((flags & STREAM_DISABLE_INPUT_RESAMPLING) != 0),
+	m_silent_updates(0),
 	m_sync_timer(nullptr),
 	m_input(inputs),
 	m_input_view(inputs),
@@ -741,6 +742,34 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 			// if we have an extended callback, that's all we need
 			m_callback_ex(*this, m_input_view, m_output_view);
 
+			// track whether this update produced anything but silence; the
+			// scan exits at the first live sample, so it is cheap for
+			// active streams, and silent streams save mixing work downstream
+			bool silent = true;
+			for (unsigned int outindex = 0; silent && outindex < m_output.size(); outindex++)
+			{
+				auto &view = m_output_view[outindex];
+				s32 sampbase = 0;
+				s32 remaining = view.samples();
+				while (silent && remaining > 0)
+				{
+					s32 chunk = remaining;
+					stream_buffer::sample_t const *const samps = view.raw_span(sampbase, chunk);
+					for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+						if (samps[sampindex] != 0)
+						{
+							silent = false;
+							break;
+						}
+					sampbase += chunk;
+					remaining -= chunk;
+				}
+			}
+			if (!silent)
+				m_silent_updates = 0;
+			else if (m_silent_updates < SILENT_UPDATES_BEFORE_SKIP)
+				m_silent_updates++;
+
 #if (SOUND_DEBUG)
 			// make sure everything was overwritten
 			for (unsigned int outindex = 0; outindex < m_output.size(); outindex++)
@@ -952,6 +981,14 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 		return;
 	}
 
+	// if the source has produced nothing but silence for a while, skip
+	// the resampling math and just emit more silence
+	if (stream.input(0).valid() && stream.input(0).source().stream().output_silent())
+	{
+		output.fill(0);
+		return;
+	}
+
 	// optimize_resampler ensures we should not have equal sample rates
 	sound_assert(input.sample_rate() != output.sample_rate());
 
@@ -991,27 +1028,38 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 	stream_buffer::sample_t srcpos = stream_buffer::sample_t(double(delta.attoseconds()) / double(rebased.sample_period_attoseconds()));
 	sound_assert(srcpos <= 1.0f);
 
+	// fold the input gain into the samples as we fetch them raw
+	stream_buffer::sample_t const gain = rebased.gain();
+
 	// input is undersampled: point sample except where our sample period covers a boundary
 	s32 srcindex = 0;
 	if (step < 1.0)
 	{
-		stream_buffer::sample_t cursample = rebased.get(srcindex++);
-		for ( ; dstindex < numsamples; dstindex++)
+		stream_buffer::sample_t cursample = rebased.getraw(srcindex++) * gain;
+		while (dstindex < numsamples)
 		{
-			// if still within the current sample, just replicate
-			srcpos += step;
-			if (srcpos <= 1.0)
-				output.put(dstindex, cursample);
-
-			// if crossing a sample boundary, blend with the neighbor
-			else
+			// work on the longest contiguous run of output samples, writing
+			// through a raw pointer rather than per-sample bounds checks
+			s32 chunk = numsamples - dstindex;
+			stream_buffer::sample_t *const dst = output.raw_span(dstindex, chunk);
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
 			{
-				srcpos -= 1.0;
-				sound_assert(srcpos <= step + 1e-5);
-				stream_buffer::sample_t prevsample = cursample;
-				cursample = rebased.get(srcindex++);
-				output.put(dstindex, stepinv * (prevsample * (step - srcpos) + srcpos * cursample));
+				// if still within the current sample, just replicate
+				srcpos += step;
+				if (srcpos <= 1.0)
+					dst[sampindex] = cursample;
+
+				// if crossing a sample boundary, blend with the neighbor
+				else
+				{
+					srcpos -= 1.0;
+					sound_assert(srcpos <= step + 1e-5);
+					stream_buffer::sample_t prevsample = cursample;
+					cursample = rebased.getraw(srcindex++) * gain;
+					dst[sampindex] = stepinv * (prevsample * (step - srcpos) + srcpos * cursample);
+				}
 			}
+			dstindex += chunk;
 		}
 		sound_assert(srcindex <= rebased.samples());
 	}
@@ -1019,29 +1067,36 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 	// input is oversampled: sum the energy
 	else
 	{
-		float cursample = rebased.get(srcindex++);
-		for ( ; dstindex < numsamples; dstindex++)
+		stream_buffer::sample_t cursample = rebased.getraw(srcindex++) * gain;
+		while (dstindex < numsamples)
 		{
-			// compute the partial first sample and advance
-			stream_buffer::sample_t scale = 1.0 - srcpos;
-			stream_buffer::sample_t sample = cursample * scale;
-
-			// add in complete samples until we only have a fraction left
-			stream_buffer::sample_t remaining = step - scale;
-			while (remaining >= 1.0)
+			// as above, work on contiguous runs of output samples
+			s32 chunk = numsamples - dstindex;
+			stream_buffer::sample_t *const dst = output.raw_span(dstindex, chunk);
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
 			{
-				sample += rebased.get(srcindex++);
-				remaining -= 1.0;
+				// compute the partial first sample and advance
+				stream_buffer::sample_t scale = 1.0 - srcpos;
+				stream_buffer::sample_t sample = cursample * scale;
+
+				// add in complete samples until we only have a fraction left
+				stream_buffer::sample_t remaining = step - scale;
+				while (remaining >= 1.0)
+				{
+					sample += rebased.getraw(srcindex++) * gain;
+					remaining -= 1.0;
+				}
+
+				// add in the final partial sample
+				cursample = rebased.getraw(srcindex++) * gain;
+				sample += cursample * remaining;
+				dst[sampindex] = sample * stepinv;
+
+				// our position is now the remainder
+				srcpos = remaining;
+				sound_assert(srcindex <= rebased.samples());
 			}
-
-			// add in the final partial sample
-			cursample = rebased.get(srcindex++);
-			sample += cursample * remaining;
-			output.put(dstindex, sample * stepinv);
-
-			// our position is now the remainder
-			srcpos = remaining;
-			sound_assert(srcindex <= rebased.samples());
+			dstindex += chunk;
 		}
 	}
 }
@@ -1059,6 +1114,7 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 sound_manager::sound_manager(running_machine &machine) :
 	m_machine(machine),
 	m_update_timer(nullptr),
+	m_update_frequency(std::clamp(machine.options().sound_updates(), STREAMS_UPDATE_FREQUENCY, 1000)),
 	m_update_number(0),
 	m_last_update(attotime::zero),
 	m_finalmix_leftover(0),
@@ -1106,9 +1162,11 @@ sound_manager::sound_manager(running_machine &machine) :
 	// set the starting attenuation
 	set_attenuation(machine.options().volume());
 
-	// start the periodic update flushing timer
+	// start the periodic update flushing timer; smaller update quanta
+	// allow the OSD to run with less buffered audio
+	const attotime update_attotime = attotime::from_hz(m_update_frequency);
 	m_update_timer = machine.scheduler().timer_alloc(timer_expired_delegate(FUNC(sound_manager::update), this));
-	m_update_timer->adjust(STREAMS_UPDATE_ATTOTIME, 0, STREAMS_UPDATE_ATTOTIME);
+	m_update_timer->adjust(update_attotime, 0, update_attotime);
 }
 
 
@@ -1507,7 +1565,7 @@ void sound_manager::update(void *ptr, int param)
 	if (curmax * m_compressor_scale > 1.0)
 	{
 		m_compressor_scale = 1.0 / curmax;
-		m_compressor_counter = STREAMS_UPDATE_FREQUENCY / 5;
+		m_compressor_counter = m_update_frequency / 5;
 	}
 
 	// if we're currently scaled, wait a bit to see if we can trend back toward 1.0
@@ -1535,6 +1593,23 @@ void sound_manager::update(void *ptr, int param)
 	u32 finalmix_offset = 0;
 	s16 *finalmix = &m_finalmix[0];
 	int sample;
+
+	// common case: running at full speed with a stable compressor scale;
+	// this branch-free version of the loop below vectorizes into saturating
+	// SIMD conversion where the generic one cannot
+	if (finalmix_step == 1000 && m_finalmix_leftover == 0 && lscale == m_compressor_scale && rscale == m_compressor_scale)
+	{
+		stream_buffer::sample_t const scale = m_compressor_enabled ? m_compressor_scale : 1.0f;
+		for (int sampindex = 0; sampindex < m_samples_this_update; sampindex++)
+		{
+			stream_buffer::sample_t const lsamp = std::clamp(m_leftmix[sampindex] * scale, stream_buffer::sample_t(-1.0), stream_buffer::sample_t(1.0));
+			stream_buffer::sample_t const rsamp = std::clamp(m_rightmix[sampindex] * scale, stream_buffer::sample_t(-1.0), stream_buffer::sample_t(1.0));
+			finalmix[finalmix_offset++] = s16(lsamp * 32767.0);
+			finalmix[finalmix_offset++] = s16(rsamp * 32767.0);
+		}
+		sample = m_samples_this_update * 1000;
+	}
+	else
 	for (sample = m_finalmix_leftover; sample < m_samples_this_update * 1000; sample += finalmix_step)
 	{
 		int sampindex = sample / 1000;
@@ -1573,8 +1648,10 @@ void sound_manager::update(void *ptr, int param)
 	}
 	m_finalmix_leftover = sample - m_samples_this_update * 1000;
 
-	// play the result
-	if (finalmix_offset > 0)
+	// play the result; speculative run-ahead frames get rolled back and
+	// this stretch of time re-emulated, so their samples must not reach
+	// the outputs twice
+	if (finalmix_offset > 0 && !machine().runahead_speculative())
 	{
 		if (!m_nosound_mode)
 			machine().osd().update_audio_stream(finalmix, finalmix_offset / 2);
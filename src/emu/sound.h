@@ -328,6 +328,21 @@ public:
 		return m_buffer->get(index);
 	}
 
+	// return a pointer to a run of raw samples starting at the given index;
+	// the count is clamped to the contiguous run before the circular buffer
+	// wraps. as with getraw(), the gain is not applied
+	sample_t const *raw_span(s32 index, s32 &count) const
+	{
+		sound_assert(u32(index) < samples());
+		sound_assert(count > 0 && u32(index) + u32(count) <= samples());
+		index += m_start;
+		if (index >= m_buffer->size())
+			index -= m_buffer->size();
+		if (count > s32(m_buffer->size()) - index)
+			count = s32(m_buffer->size()) - index;
+		return &m_buffer->m_buffer[index];
+	}
+
 protected:
 	// normalize start/end
 	void normalize_start_end()
@@ -405,52 +420,83 @@ public:
 		m_buffer->put(index, m_buffer->get(index) + sample);
 	}
 
+	// return a writable pointer to a run of raw samples starting at the
+	// given index; the count is clamped to the contiguous run before the
+	// circular buffer wraps
+	using read_stream_view::raw_span;
+	sample_t *raw_span(s32 index, s32 &count)
+	{
+		sound_assert(u32(index) < samples());
+		sound_assert(count > 0 && u32(index) + u32(count) <= samples());
+		s32 const bufindex = index_to_buffer_index(index);
+		if (count > s32(m_buffer->size()) - bufindex)
+			count = s32(m_buffer->size()) - bufindex;
+		return &m_buffer->m_buffer[bufindex];
+	}
+
 	// add a sample to the buffer, converting from an integer with the given maximum
 	void add_int(s32 index, s32 sample, s32 max)
 	{
 		add(index, sample_t(sample) * (1.0f / sample_t(max)));
 	}
 
-	// fill part of the view with the given value
+	// fill part of the view with the given value, one contiguous run at a time
 	void fill(sample_t value, s32 start, s32 count)
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = index_to_buffer_index(start);
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		while (count > 0)
 		{
-			m_buffer->put(index, value);
-			index = m_buffer->next_index(index);
+			s32 chunk = count;
+			sample_t *const dst = raw_span(start, chunk);
+			std::fill_n(dst, chunk, value);
+			start += chunk;
+			count -= chunk;
 		}
 	}
 	void fill(sample_t value, s32 start) { fill(value, start, samples() - start); }
 	void fill(sample_t value) { fill(value, 0, samples()); }
 
-	// copy data from another view
+	// copy data from another view; runs between wrap points are copied as
+	// flat blocks, degenerating to a memcpy when the source gain is unity
 	void copy(read_stream_view const &src, s32 start, s32 count)
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = index_to_buffer_index(start);
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		sample_t const srcgain = src.gain();
+		while (count > 0)
 		{
-			m_buffer->put(index, src.get(start + sampindex));
-			index = m_buffer->next_index(index);
+			s32 chunk = count;
+			sample_t *const dst = raw_span(start, chunk);
+			sample_t const *const srcptr = src.raw_span(start, chunk);
+			if (srcgain == 1.0f)
+				std::copy_n(srcptr, chunk, dst);
+			else
+				for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+					dst[sampindex] = srcptr[sampindex] * srcgain;
+			start += chunk;
+			count -= chunk;
 		}
 	}
 	void copy(read_stream_view const &src, s32 start) { copy(src, start, samples() - start); }
 	void copy(read_stream_view const &src) { copy(src, 0, samples()); }
 
-	// add data from another view to our current values
+	// add data from another view to our current values, in flat blocks the
+	// compiler can vectorize
 	void add(read_stream_view const &src, s32 start, s32 count)
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = index_to_buffer_index(start);
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		sample_t const srcgain = src.gain();
+		while (count > 0)
 		{
-			m_buffer->put(index, m_buffer->get(index) + src.get(start + sampindex));
-			index = m_buffer->next_index(index);
+			s32 chunk = count;
+			sample_t *const dst = raw_span(start, chunk);
+			sample_t const *const srcptr = src.raw_span(start, chunk);
+			for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+				dst[sampindex] += srcptr[sampindex] * srcgain;
+			start += chunk;
+			count -= chunk;
 		}
 	}
 	void add(read_stream_view const &src, s32 start) { add(src, start, samples() - start); }
@@ -606,6 +652,10 @@ class sound_stream
 {
 	friend class sound_manager;
 
+	// consecutive fully-silent updates before consumers may skip this
+	// stream's output; acts as hysteresis around brief gaps in the audio
+	static constexpr u32 SILENT_UPDATES_BEFORE_SKIP = 4;
+
 	// private common constructopr
 	sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output_base, u32 sample_rate, sound_stream_flags flags);
 
@@ -623,6 +673,10 @@ public:
 	bool synchronous() const { return m_synchronous; }
 	bool resampling_disabled() const { return m_resampling_disabled; }
 
+	// true if the stream has generated nothing but silence for a while;
+	// mixers and resamplers use this to skip work on long-idle streams
+	bool output_silent() const { return m_silent_updates >= SILENT_UPDATES_BEFORE_SKIP; }
+
 	// input and output getters
 	u32 input_count() const { return m_input.size(); }
 	u32 output_count() const { return m_output.size(); }
@@ -691,6 +745,7 @@ private:
 	bool m_output_adaptive;                        // adaptive stream that runs at the sample rate of its output
 	bool m_synchronous;                            // synchronous stream that runs at the rate of its input
 	bool m_resampling_disabled;                    // is resampling of input streams disabled?
+	u32 m_silent_updates;                          // number of consecutive fully-silent updates
 	emu_timer *m_sync_timer;                       // update timer for synchronous streams
 
 	// input information
@@ -816,12 +871,13 @@ private:
 	// helper to adjust scale factor toward a goal
 	stream_buffer::sample_t adjust_toward_compressor_scale(stream_buffer::sample_t curscale, stream_buffer::sample_t prevsample, stream_buffer::sample_t rawsample);
 
-	// periodic sound update, called STREAMS_UPDATE_FREQUENCY per second
+	// periodic sound update, called m_update_frequency times per second
 	void update(void *ptr = nullptr, s32 param = 0);
 
 	// internal state
 	running_machine &m_machine;           // reference to the running machine
 	emu_timer *m_update_timer;            // timer that runs the update function
+	int m_update_frequency;               // updates per second; STREAMS_UPDATE_FREQUENCY unless overridden
 	std::vector<std::reference_wrapper<speaker_device> > m_speakers;
 
 	u32 m_update_number;                  // current update index; used for sample rate updates
@@ -86,27 +86,38 @@ void speaker_device::mix(stream_buffer::sample_t *leftmix, stream_buffer::sample
 		}
 	}
 
-	// mix if sound is enabled
-	if (!suppress)
+	// mix if sound is enabled, working on contiguous runs of raw samples
+	// so the compiler can vectorize the accumulation; a mixer stream that
+	// has settled into silence contributes nothing, so skip it entirely
+	if (!suppress && !m_mixer_stream->output_silent())
 	{
-		// if the speaker is centered, send to both left and right
-		if (m_x == 0)
-			for (int sample = 0; sample < expected_samples; sample++)
-			{
-				stream_buffer::sample_t cursample = view.get(sample);
-				leftmix[sample] += cursample;
-				rightmix[sample] += cursample;
-			}
+		stream_buffer::sample_t const gain = view.gain();
+		for (int sample = 0; sample < expected_samples; )
+		{
+			s32 chunk = expected_samples - sample;
+			stream_buffer::sample_t const *const src = view.raw_span(sample, chunk);
+
+			// if the speaker is centered, send to both left and right
+			if (m_x == 0)
+				for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+				{
+					stream_buffer::sample_t cursample = src[sampindex] * gain;
+					leftmix[sample + sampindex] += cursample;
+					rightmix[sample + sampindex] += cursample;
+				}
 
-		// if the speaker is to the left, send only to the left
-		else if (m_x < 0)
-			for (int sample = 0; sample < expected_samples; sample++)
-				leftmix[sample] += view.get(sample);
+			// if the speaker is to the left, send only to the left
+			else if (m_x < 0)
+				for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+					leftmix[sample + sampindex] += src[sampindex] * gain;
 
-		// if the speaker is to the right, send only to the right
-		else
-			for (int sample = 0; sample < expected_samples; sample++)
-				rightmix[sample] += view.get(sample);
+			// if the speaker is to the right, send only to the right
+			else
+				for (s32 sampindex = 0; sampindex < chunk; sampindex++)
+					rightmix[sample + sampindex] += src[sampindex] * gain;
+
+			sample += chunk;
+		}
 	}
 }
 
@@ -383,6 +383,7 @@ void tilemap_t::init_common(
 	m_palette_offset = 0;
 	m_gfx_used = 0;
 	memset(m_gfx_dirtyseq, 0, sizeof(m_gfx_dirtyseq));
+	m_generation = 0;
 
 	// reset scroll information
 	m_scrollrows = 1;
@@ -512,6 +513,31 @@ void tilemap_t::mark_tile_dirty(tilemap_memory_index memindex)
 }
 
 
+//-------------------------------------------------
+//  mark_region_dirty - mark a contiguous range
+//  of memory indexes dirty in a single pass
+//-------------------------------------------------
+
+void tilemap_t::mark_region_dirty(tilemap_memory_index start, tilemap_memory_index end)
+{
+	// clamp the range to the valid memory indexes
+	if (start >= m_memory_to_logical.size())
+		return;
+	end = std::min(end, tilemap_memory_index(m_memory_to_logical.size() - 1));
+
+	// mark each mapped tile individually rather than falling back to the
+	// all-dirty path, so a bulk VRAM change doesn't force untouched tiles
+	// to be redrawn
+	for (tilemap_memory_index memindex = start; memindex <= end; memindex++)
+	{
+		logical_index logindex = m_memory_to_logical[memindex];
+		if (logindex != INVALID_LOGICAL_INDEX)
+			m_tileflags[logindex] = TILE_FLAG_DIRTY;
+	}
+	m_all_tiles_clean = false;
+}
+
+
 //-------------------------------------------------
 //  map_pens_to_layer - specify the mapping of one
 //  or more pens (where (<pen> & mask) == pen) to
@@ -701,6 +727,7 @@ void tilemap_t::mappings_create()
 	m_memory_to_logical.resize(max_memory_index);
 	m_logical_to_memory.resize(max_logical_index);
 	m_tileflags.resize(max_logical_index);
+	m_tile_generation.resize(max_logical_index);
 
 	// update the mappings
 	mappings_update();
@@ -749,10 +776,11 @@ void tilemap_t::mappings_update()
 inline void tilemap_t::realize_all_dirty_tiles()
 {
 	// if all the tiles are marked dirty, or something in the gfx has changed,
-	// flush the dirty status to all tiles
+	// advance the generation; any tile whose stamp no longer matches will be
+	// redrawn, without having to rewrite the flags for every tile here
 	if (m_all_tiles_dirty || gfx_elements_changed())
 	{
-		memset(&m_tileflags[0], TILE_FLAG_DIRTY, m_tileflags.size());
+		m_generation++;
 		m_all_tiles_dirty = false;
 		m_gfx_used = 0;
 	}
@@ -777,12 +805,39 @@ g_profiler.start(PROFILER_TILEMAP_DRAW);
 	// flush the dirty state to all tiles as appropriate
 	realize_all_dirty_tiles();
 
-	// iterate over rows and columns
+	// gather the parameters for each dirty tile; the get info callbacks can
+	// reach into live driver state, so they always run on this thread
+	m_pending_tiles.clear();
 	logical_index logindex = 0;
 	for (u32 row = 0; row < m_rows; row++)
 		for (u32 col = 0; col < m_cols; col++, logindex++)
-			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
-				tile_update(logindex, col, row);
+			if (m_tileflags[logindex] == TILE_FLAG_DIRTY || m_tile_generation[logindex] != m_generation)
+				tile_collect(m_pending_tiles.emplace_back(), logindex, col, row);
+
+	// rasterize the gathered tiles; each tile owns a disjoint rectangle of
+	// the pixmap, so large batches can be spread across the work queue
+	osd_work_queue *queue = m_manager->work_queue();
+	if (queue != nullptr && m_pending_tiles.size() >= MIN_PARALLEL_TILES)
+	{
+		// carve the list into contiguous batches and queue one item per batch
+		u32 batchsize = std::max<u32>(m_cols, MIN_PARALLEL_TILES / 4);
+		m_render_batches.clear();
+		for (u32 first = 0; first < m_pending_tiles.size(); first += batchsize)
+		{
+			tile_render_batch &batch = m_render_batches.emplace_back();
+			batch.tilemap = this;
+			batch.first = first;
+			batch.count = std::min<u32>(batchsize, m_pending_tiles.size() - first);
+		}
+		for (tile_render_batch &batch : m_render_batches)
+			osd_work_item_queue(queue, tile_render_work, &batch, WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+			;
+	}
+	else
+		for (const pending_tile &tile : m_pending_tiles)
+			tile_render(tile);
+	m_pending_tiles.clear();
 
 	// mark it all clean
 	m_all_tiles_clean = true;
@@ -796,6 +851,19 @@ g_profiler.stop();
 //-------------------------------------------------
 
 void tilemap_t::tile_update(logical_index logindex, u32 col, u32 row)
+{
+	pending_tile tile;
+	tile_collect(tile, logindex, col, row);
+	tile_render(tile);
+}
+
+
+//-------------------------------------------------
+//  tile_collect - gather the parameters for a
+//  single dirty tile from the get info callback
+//-------------------------------------------------
+
+void tilemap_t::tile_collect(pending_tile &tile, logical_index logindex, u32 col, u32 row)
 {
 g_profiler.start(PROFILER_TILEMAP_UPDATE);
 
@@ -803,18 +871,18 @@ g_profiler.start(PROFILER_TILEMAP_UPDATE);
 	tilemap_memory_index memindex = m_logical_to_memory[logindex];
 	m_tile_get_info(*this, m_tileinfo, memindex);
 
-	// apply the global tilemap flip to the returned flip flags
-	u32 flags = m_tileinfo.flags ^ (m_attributes & 0x03);
-
-	// draw the tile, using either direct or transparent
-	u32 x0 = m_tilewidth * col;
-	u32 y0 = m_tileheight * row;
-	m_tileflags[logindex] = tile_draw(m_tileinfo.pen_data, x0, y0,
-		m_tileinfo.palette_base, m_tileinfo.category, m_tileinfo.group, flags, m_tileinfo.pen_mask);
-
-	// if mask data is specified, apply it
-	if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != nullptr)
-		m_tileflags[logindex] = tile_apply_bitmask(m_tileinfo.mask_data, x0, y0, m_tileinfo.category, flags);
+	// record everything needed to draw the tile later, applying the global
+	// tilemap flip to the returned flip flags
+	tile.pen_data = m_tileinfo.pen_data;
+	tile.mask_data = m_tileinfo.mask_data;
+	tile.logindex = logindex;
+	tile.x0 = m_tilewidth * col;
+	tile.y0 = m_tileheight * row;
+	tile.palette_base = m_tileinfo.palette_base;
+	tile.category = m_tileinfo.category;
+	tile.group = m_tileinfo.group;
+	tile.flags = m_tileinfo.flags ^ (m_attributes & 0x03);
+	tile.pen_mask = m_tileinfo.pen_mask;
 
 	// track which gfx have been used for this tilemap
 	if (m_tileinfo.gfxnum != 0xff && (m_gfx_used & (1 << m_tileinfo.gfxnum)) == 0)
@@ -827,6 +895,40 @@ g_profiler.stop();
 }
 
 
+//-------------------------------------------------
+//  tile_render - rasterize a gathered tile into
+//  the pixmap; safe to call from a worker thread
+//-------------------------------------------------
+
+void tilemap_t::tile_render(const pending_tile &tile)
+{
+	// draw the tile, using either direct or transparent
+	m_tileflags[tile.logindex] = tile_draw(tile.pen_data, tile.x0, tile.y0,
+		tile.palette_base, tile.category, tile.group, tile.flags, tile.pen_mask);
+
+	// if mask data is specified, apply it
+	if ((tile.flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && tile.mask_data != nullptr)
+		m_tileflags[tile.logindex] = tile_apply_bitmask(tile.mask_data, tile.x0, tile.y0, tile.category, tile.flags);
+
+	// stamp the tile with the current generation
+	m_tile_generation[tile.logindex] = m_generation;
+}
+
+
+//-------------------------------------------------
+//  tile_render_work - work queue callback to
+//  rasterize a batch of gathered tiles
+//-------------------------------------------------
+
+void *tilemap_t::tile_render_work(void *param, int threadid)
+{
+	tile_render_batch &batch = *reinterpret_cast<tile_render_batch *>(param);
+	for (u32 index = 0; index < batch.count; index++)
+		batch.tilemap->tile_render(batch.tilemap->m_pending_tiles[batch.first + index]);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  tile_draw - draw a single tile to the
 //  tilemap's internal pixmap, using the pen as
@@ -1233,7 +1335,7 @@ void tilemap_t::draw_instance(screen_device &screen, _BitmapClass &dest, const b
 				logical_index logindex = row * m_cols + column;
 
 				// if the current tile is dirty, fix it
-				if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
+				if (m_tileflags[logindex] == TILE_FLAG_DIRTY || m_tile_generation[logindex] != m_generation)
 					tile_update(logindex, column, row);
 
 				// if the current summary data is non-zero, we must draw masked
@@ -1427,88 +1529,80 @@ void tilemap_t::draw_roz_core(screen_device &screen, _BitmapClass &destbitmap, c
 		}
 	}
 
-	// wraparound case
-	else if (wraparound)
+	// wraparound and non-wraparound cases; when the transform includes a
+	// rotation component the source is read along a rotated line, so a
+	// plain row-major walk of the destination thrashes the cache - process
+	// the destination in square blocks instead to bound the working set;
+	// each pixel depends only on its own coordinates, so the result is
+	// identical in any order
+	else
 	{
-		// loop over rows
-		while (sy <= ey)
-		{
-			// initialize X counters
-			int x = sx;
-			u32 cx = startx;
-			u32 cy = starty;
+		constexpr int ROZ_BLOCK = 32;
+		const int blockw = (incxy == 0 && incyx == 0) ? (ex - sx + 1) : ROZ_BLOCK;
 
-			// get dest and priority pointers
-			typename _BitmapClass::pixel_t *dest = &destbitmap.pix(sy, sx);
-			u8 *pri = (priority != 0xff00) ? &priority_bitmap.pix(sy, sx) : nullptr;
+		// loop over blocks of rows
+		for (int by = sy; by <= ey; by += ROZ_BLOCK)
+		{
+			const int bey = std::min(by + ROZ_BLOCK - 1, ey);
 
-			// loop over columns
-			while (x <= ex)
+			// loop over blocks of columns
+			for (int bx = sx; bx <= ex; bx += blockw)
 			{
-				// plot if we match the mask
-				if ((m_flagsmap.pix((cy >> 16) & ymask, (cx >> 16) & xmask) & mask) == value)
-				{
-					ROZ_PLOT_PIXEL(m_pixmap.pix((cy >> 16) & ymask, (cx >> 16) & xmask));
-					if (priority != 0xff00)
-						*pri = (*pri & (priority >> 8)) | priority;
-				}
+				const int bex = std::min(bx + blockw - 1, ex);
 
-				// advance in X
-				cx += incxx;
-				cy += incxy;
-				x++;
-				++dest;
-				if (priority != 0xff00)
-					pri++;
-			}
+				// compute the source position of the block origin
+				u32 rowstartx = startx + u32(bx - sx) * incxx + u32(by - sy) * incyx;
+				u32 rowstarty = starty + u32(bx - sx) * incxy + u32(by - sy) * incyy;
 
-			// advance in Y
-			startx += incyx;
-			starty += incyy;
-			sy++;
-		}
-	}
-
-	// non-wraparound case
-	else
-	{
-		// loop over rows
-		while (sy <= ey)
-		{
-			// initialize X counters
-			int x = sx;
-			u32 cx = startx;
-			u32 cy = starty;
+				// loop over rows within the block
+				for (int y = by; y <= bey; y++)
+				{
+					// initialize X counters
+					int x = bx;
+					u32 cx = rowstartx;
+					u32 cy = rowstarty;
 
-			// get dest and priority pointers
-			typename _BitmapClass::pixel_t *dest = &destbitmap.pix(sy, sx);
-			u8 *pri = (priority != 0xff00) ? &priority_bitmap.pix(sy, sx) : nullptr;
+					// get dest and priority pointers
+					typename _BitmapClass::pixel_t *dest = &destbitmap.pix(y, bx);
+					u8 *pri = (priority != 0xff00) ? &priority_bitmap.pix(y, bx) : nullptr;
 
-			// loop over columns
-			while (x <= ex)
-			{
-				// plot if we're within the bitmap and we match the mask
-				if (cx < widthshifted && cy < heightshifted)
-					if ((m_flagsmap.pix(cy >> 16, cx >> 16) & mask) == value)
+					// loop over columns
+					while (x <= bex)
 					{
-						ROZ_PLOT_PIXEL(m_pixmap.pix(cy >> 16, cx >> 16));
+						// plot if we match the mask, wrapping or clipping as appropriate
+						if (wraparound)
+						{
+							if ((m_flagsmap.pix((cy >> 16) & ymask, (cx >> 16) & xmask) & mask) == value)
+							{
+								ROZ_PLOT_PIXEL(m_pixmap.pix((cy >> 16) & ymask, (cx >> 16) & xmask));
+								if (priority != 0xff00)
+									*pri = (*pri & (priority >> 8)) | priority;
+							}
+						}
+						else if (cx < widthshifted && cy < heightshifted)
+						{
+							if ((m_flagsmap.pix(cy >> 16, cx >> 16) & mask) == value)
+							{
+								ROZ_PLOT_PIXEL(m_pixmap.pix(cy >> 16, cx >> 16));
+								if (priority != 0xff00)
+									*pri = (*pri & (priority >> 8)) | priority;
+							}
+						}
+
+						// advance in X
+						cx += incxx;
+						cy += incxy;
+						x++;
+						++dest;
 						if (priority != 0xff00)
-							*pri = (*pri & (priority >> 8)) | priority;
+							pri++;
 					}
 
-				// advance in X
-				cx += incxx;
-				cy += incxy;
-				x++;
-				++dest;
-				if (priority != 0xff00)
-					pri++;
+					// advance in Y
+					rowstartx += incyx;
+					rowstarty += incyy;
+				}
 			}
-
-			// advance in Y
-			startx += incyx;
-			starty += incyy;
-			sy++;
 		}
 	}
 }
@@ -1576,7 +1670,8 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ))
 {
 }
 
@@ -1600,6 +1695,10 @@ tilemap_manager::~tilemap_manager()
 				break;
 			}
 	}
+
+	// free the shared render queue
+	if (m_queue != nullptr)
+		osd_work_queue_free(m_queue);
 }
 
 
@@ -417,6 +417,9 @@ class tilemap_t
 	// internal usage to mark tiles dirty
 	static const u8 TILE_FLAG_DIRTY = 0xff;
 
+	// minimum number of dirty tiles before rendering is spread across the work queue
+	static const u32 MIN_PARALLEL_TILES = 256;
+
 	// invalid logical index
 	static const logical_index INVALID_LOGICAL_INDEX = (logical_index)~0;
 
@@ -477,6 +480,7 @@ public:
 	// dirtying
 	void mark_mapping_dirty() { mappings_update(); }
 	void mark_tile_dirty(tilemap_memory_index memindex);
+	void mark_region_dirty(tilemap_memory_index start, tilemap_memory_index end);
 	void mark_all_dirty() { m_all_tiles_dirty = true; m_all_tiles_clean = false; }
 
 	// pen mapping
@@ -526,6 +530,30 @@ private:
 		u8                  alpha;
 	};
 
+	// parameters for one dirty tile, gathered from the get info callback so
+	// that rasterization can be deferred and spread across worker threads
+	struct pending_tile
+	{
+		const u8 *      pen_data;           // decoded pen data for the tile
+		const u8 *      mask_data;          // mask data to apply, or nullptr
+		logical_index   logindex;           // logical index of the tile
+		u32             x0;                 // leftmost pixel in the pixmap
+		u32             y0;                 // topmost pixel in the pixmap
+		u32             palette_base;       // base palette entry
+		u8              category;           // category of the tile
+		u8              group;              // group for pen-to-layer mapping
+		u8              flags;              // flags, with the global flip applied
+		u8              pen_mask;           // mask to apply to the pen data
+	};
+
+	// a contiguous run of pending tiles rendered by a single work item
+	struct tile_render_batch
+	{
+		tilemap_t *     tilemap;            // tilemap being updated
+		u32             first;              // index of the first pending tile
+		u32             count;              // number of pending tiles in the run
+	};
+
 	// inline helpers
 	s32 effective_rowscroll(int index, u32 screen_width);
 	s32 effective_colscroll(int index, u32 screen_height);
@@ -550,6 +578,9 @@ private:
 	// internal drawing
 	void pixmap_update();
 	void tile_update(logical_index logindex, u32 col, u32 row);
+	void tile_collect(pending_tile &tile, logical_index logindex, u32 col, u32 row);
+	void tile_render(const pending_tile &tile);
+	static void *tile_render_work(void *param, int threadid);
 	u8 tile_draw(const u8 *pendata, u32 x0, u32 y0, u32 palette_base, u8 category, u8 group, u8 flags, u8 pen_mask);
 	u8 tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
@@ -604,6 +635,12 @@ private:
 	// pixel data
 	bitmap_ind16                m_pixmap;               // cached pixel data
 
+	// incremental update state
+	u32                         m_generation;           // current update generation
+	std::vector<u32>            m_tile_generation;      // generation stamp for each tile
+	std::vector<pending_tile>   m_pending_tiles;        // tiles gathered for the current update
+	std::vector<tile_render_batch> m_render_batches;    // work item parameters for the current update
+
 	// transparency mapping
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<u8>             m_tileflags;            // per-tile flags
@@ -625,6 +662,7 @@ public:
 
 	// getters
 	running_machine &machine() const { return m_machine; }
+	osd_work_queue *work_queue() const { return m_queue; }
 
 	// tilemap creation
 	template <typename T, typename U>
@@ -654,6 +692,7 @@ private:
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	osd_work_queue *        m_queue;
 };
 
 
@@ -17,7 +17,10 @@
 #include "video/rgbutil.h"
 #include "unicode.h"
 
+#include <atomic>
 #include <cctype>
+#include <memory>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
 
@@ -1732,7 +1735,8 @@ void validity_checker::validate_tag(const char *tag)
 //-------------------------------------------------
 
 validity_checker::validity_checker(emu_options &options, bool quick)
-	: m_drivlist(options)
+	: m_options(options)
+	, m_drivlist(options)
 	, m_errors(0)
 	, m_warnings(0)
 	, m_print_verbose(options.verbose())
@@ -1741,6 +1745,8 @@ validity_checker::validity_checker(emu_options &options, bool quick)
 	, m_current_ioport(nullptr)
 	, m_checking_card(false)
 	, m_quick(quick)
+	, m_parallel_worker(false)
+	, m_report(nullptr)
 {
 	// pre-populate the defstr map with all the default strings
 	for (int strnum = 1; strnum < INPUT_STRING_COUNT; strnum++)
@@ -1823,16 +1829,24 @@ bool validity_checker::check_all_matching(const char *string)
 		output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "\n");
 	}
 
-	// then iterate over all drivers and check them
+	// then gather all drivers matching the name
 	m_drivlist.reset();
-	bool validated_any = false;
+	std::vector<game_driver const *> matching;
 	while (m_drivlist.next())
-	{
 		if (driver_list::matches(string, m_drivlist.driver().name))
-		{
-			validate_one(m_drivlist.driver());
-			validated_any = true;
-		}
+			matching.push_back(&m_drivlist.driver());
+	bool const validated_any = !matching.empty();
+
+	// shard large runs across worker threads; small runs and verbose runs
+	// (where the output is used to localise crashes) stay serial
+	if (matching.size() > 32 && !m_print_verbose && std::thread::hardware_concurrency() > 1)
+	{
+		check_parallel(matching);
+	}
+	else
+	{
+		for (game_driver const *driver : matching)
+			validate_one(*driver);
 	}
 
 	// validate devices
@@ -1850,6 +1864,88 @@ bool validity_checker::check_all_matching(const char *string)
 }
 
 
+//-------------------------------------------------
+//  check_parallel - validate a list of drivers
+//  across worker threads, printing the per-driver
+//  reports in driver order once all are done
+//-------------------------------------------------
+
+thread_local validity_checker *validity_checker::s_worker = nullptr;
+
+bool validity_checker::check_parallel(std::vector<game_driver const *> const &drivers)
+{
+	// duplicate name/description detection spans the whole list and needs
+	// no machine_config, so do it up front here; workers skip those checks
+	// because each of them only sees its own share of the drivers
+	for (game_driver const *driver : drivers)
+	{
+		m_current_driver = driver;
+		if (!m_names_map.insert(std::make_pair(driver->name, driver)).second)
+		{
+			game_driver const *const match = m_names_map.find(driver->name)->second;
+			osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
+		}
+		if (!m_descriptions_map.insert(std::make_pair(driver->type.fullname(), driver)).second)
+		{
+			game_driver const *const match = m_descriptions_map.find(driver->type.fullname())->second;
+			osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
+		}
+	}
+	m_current_driver = nullptr;
+	if (m_errors > 0)
+		output_indented_errors(m_error_text, "Errors");
+	m_error_text.clear();
+
+	// one worker checker per thread; each keeps its own maps and buffers
+	unsigned const threadcount = std::min<size_t>(std::thread::hardware_concurrency(), drivers.size());
+	std::vector<std::unique_ptr<validity_checker>> workers;
+	workers.reserve(threadcount);
+	for (unsigned threadnum = 0; threadnum < threadcount; threadnum++)
+	{
+		workers.emplace_back(std::make_unique<validity_checker>(m_options, m_quick));
+		workers.back()->m_parallel_worker = true;
+	}
+
+	// per-driver report slots; each is written by exactly one worker
+	std::vector<std::string> reports(drivers.size());
+	std::atomic<size_t> nextindex(0);
+
+	// run the workers over the list until it is exhausted
+	std::vector<std::thread> threads;
+	threads.reserve(threadcount);
+	for (unsigned threadnum = 0; threadnum < threadcount; threadnum++)
+	{
+		validity_checker &worker = *workers[threadnum];
+		threads.emplace_back([&worker, &drivers, &reports, &nextindex] ()
+				{
+					s_worker = &worker;
+					size_t index;
+					while ((index = nextindex.fetch_add(1)) < drivers.size())
+					{
+						worker.m_report = &reports[index];
+						worker.validate_one(*drivers[index]);
+						worker.m_report = nullptr;
+					}
+					s_worker = nullptr;
+				});
+	}
+	for (std::thread &thread : threads)
+		thread.join();
+
+	// fold the counts back in and print the reports in driver order
+	for (auto const &worker : workers)
+	{
+		m_errors += worker->m_errors;
+		m_warnings += worker->m_warnings;
+	}
+	for (std::string const &report : reports)
+		if (!report.empty())
+			output_via_delegate(OSD_OUTPUT_CHANNEL_ERROR, "%s", report);
+
+	return !(m_errors > 0 || m_warnings > 0);
+}
+
+
 //-------------------------------------------------
 //  validate_begin - prepare for validation by
 //  taking over the output callbacks and resetting
@@ -1959,18 +2055,21 @@ void validity_checker::validate_one(const game_driver &driver)
 
 void validity_checker::validate_driver(device_t &root)
 {
-	// check for duplicate names
-	if (!m_names_map.insert(std::make_pair(m_current_driver->name, m_current_driver)).second)
+	// check for duplicate names and descriptions; workers only see their
+	// share of the list, so check_parallel does this for the whole list first
+	if (!m_parallel_worker)
 	{
-		const game_driver *match = m_names_map.find(m_current_driver->name)->second;
-		osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
-	}
+		if (!m_names_map.insert(std::make_pair(m_current_driver->name, m_current_driver)).second)
+		{
+			const game_driver *match = m_names_map.find(m_current_driver->name)->second;
+			osd_printf_error("Driver name is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
+		}
 
-	// check for duplicate descriptions
-	if (!m_descriptions_map.insert(std::make_pair(m_current_driver->type.fullname(), m_current_driver)).second)
-	{
-		const game_driver *match = m_descriptions_map.find(m_current_driver->type.fullname())->second;
-		osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
+		if (!m_descriptions_map.insert(std::make_pair(m_current_driver->type.fullname(), m_current_driver)).second)
+		{
+			const game_driver *match = m_descriptions_map.find(m_current_driver->type.fullname())->second;
+			osd_printf_error("Driver description is a duplicate of %s(%s)\n", core_filename_extract_base(match->type.source()), match->name);
+		}
 	}
 
 	// determine if we are a clone
@@ -2774,6 +2873,14 @@ void validity_checker::build_output_prefix(std::ostream &str) const
 
 void validity_checker::output_callback(osd_output_channel channel, const util::format_argument_pack<std::ostream> &args)
 {
+	// only the main checker sits on the global output stack; messages raised
+	// on a worker thread belong to that thread's checker, so reroute them
+	if (s_worker != nullptr && s_worker != this)
+	{
+		s_worker->output_callback(channel, args);
+		return;
+	}
+
 	std::ostringstream output;
 	switch (channel)
 	{
@@ -2828,8 +2935,13 @@ void validity_checker::output_callback(osd_output_channel channel, const util::f
 template <typename Format, typename... Params>
 void validity_checker::output_via_delegate(osd_output_channel channel, Format &&fmt, Params &&...args)
 {
-	// call through to the delegate with the proper parameters
-	chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	// workers capture their report output for ordered printing by the
+	// main checker once all drivers are done
+	if (m_report != nullptr)
+		m_report->append(util::string_format(std::forward<Format>(fmt), std::forward<Params>(args)...));
+	else
+		// call through to the delegate with the proper parameters
+		chain_output(channel, util::make_format_argument_pack(std::forward<Format>(fmt), std::forward<Params>(args)...));
 }
 
 //-------------------------------------------------
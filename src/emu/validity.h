@@ -66,6 +66,7 @@ private:
 	void validate_begin();
 	void validate_end();
 	void validate_one(const game_driver &driver);
+	bool check_parallel(std::vector<game_driver const *> const &drivers);
 
 	// internal sub-checks
 	void validate_driver(device_t &root);
@@ -82,6 +83,9 @@ private:
 	template <typename Format, typename... Params> void output_via_delegate(osd_output_channel channel, Format &&fmt, Params &&...args);
 	void output_indented_errors(std::string &text, const char *header);
 
+	// options used to construct us, for spawning parallel workers
+	emu_options &           m_options;
+
 	// internal driver list
 	driver_enumerator       m_drivlist;
 
@@ -111,6 +115,15 @@ private:
 	string_set              m_already_checked;
 	bool                    m_checking_card;
 	bool const              m_quick;
+
+	// parallel validation state; workers skip list-wide duplicate checks
+	// and capture their console output for ordered merging
+	bool                    m_parallel_worker;
+	std::string *           m_report;
+
+	// identifies the worker owning the current thread so output lands in
+	// its buffers rather than the checker on the global output stack
+	static thread_local validity_checker *s_worker;
 };
 
 #endif // MAME_EMU_VALIDITY_H
@@ -23,6 +23,9 @@
 
 #include "osdepend.h"
 
+#include <algorithm>
+#include <fstream>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -82,6 +85,7 @@ video_manager::video_manager(running_machine &machine)
 	, m_speed_last_realtime(0)
 	, m_speed_last_emutime(attotime::zero)
 	, m_speed_percent(1.0)
+	, m_speed_ewma(1.0)
 	, m_overall_real_seconds(0)
 	, m_overall_real_ticks(0)
 	, m_overall_emutime(attotime::zero)
@@ -100,15 +104,22 @@ video_manager::video_manager(running_machine &machine)
 	, m_frameskip_adjust(0)
 	, m_skipping_this_frame(false)
 	, m_average_oversleep(0)
+	, m_frame_update_count(0)
+	, m_runahead_hidden(false)
 	, m_snap_target(nullptr)
 	, m_snap_native(true)
 	, m_snap_width(0)
 	, m_snap_height(0)
+	, m_snap_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
 {
 	// request a callback upon exiting
 	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&video_manager::exit, this));
 	machine.save().register_postload(save_prepost_delegate(FUNC(video_manager::postload), this));
 
+	// if benchmark statistics were requested, enable the profiler so subsystem totals accumulate
+	if (machine.options().bench_stats()[0] != 0)
+		g_profiler.enable(true);
+
 	// extract initial execution state from global configuration settings
 	update_refresh_speed();
 
@@ -209,6 +220,11 @@ void video_manager::frame_update(bool from_debugger)
 	// only render sound and video if we're in the running phase
 	machine_phase const phase = machine().phase();
 	bool skipped_it = m_skipping_this_frame;
+
+	// run-ahead frames that will never be presented are treated like
+	// skipped frames: no rendering and no throttling
+	if (m_runahead_hidden)
+		skipped_it = true;
 	bool const update_screens = (phase == machine_phase::RUNNING) && (!machine().paused() || machine().options().update_in_pause());
 	bool anything_changed = update_screens && finish_screen_updates();
 
@@ -247,11 +263,17 @@ void video_manager::frame_update(bool from_debugger)
 
 	if (!from_debugger)
 	{
-		// perform tasks for this frame
+		// count the frame so run-ahead can tell when one has passed
+		m_frame_update_count++;
+
+		// perform tasks for this frame; this must happen for hidden
+		// run-ahead frames too, since ioport polls fresh inputs from a
+		// frame notification and the hidden frame is exactly the one
+		// that has to see them
 		machine().call_notifiers(MACHINE_NOTIFY_FRAME);
 
-		// update frameskipping
-		if (phase > machine_phase::INIT)
+		// update frameskipping; hidden frames would skew the pattern
+		if (phase > machine_phase::INIT && !m_runahead_hidden)
 			update_frameskip();
 
 		// update speed computations
@@ -313,6 +335,22 @@ std::string video_manager::speed_text()
 }
 
 
+//**************************************************************************
+//  SNAPSHOT REQUEST
+//**************************************************************************
+
+// a pending snapshot: the bitmap is copied on the emulation thread, the
+// PNG encode and file write happen on the work queue
+struct video_manager::snap_request
+{
+	video_manager *     video;          // owning manager
+	std::unique_ptr<emu_file> file;     // destination file
+	bitmap_rgb32        bitmap;         // copy of the rendered snapshot
+	util::png_info      pnginfo;        // text entries to embed
+	std::vector<rgb_t>  palette;        // copied palette entries
+};
+
+
 //-------------------------------------------------
 //  save_snapshot - save a snapshot to the given
 //  file handle
@@ -342,6 +380,77 @@ void video_manager::save_snapshot(screen_device *screen, emu_file &file)
 }
 
 
+//-------------------------------------------------
+//  save_snapshot_async - render a snapshot on the
+//  emulation thread and hand the PNG encode and
+//  write to the work queue
+//-------------------------------------------------
+
+void video_manager::save_snapshot_async(screen_device *screen, std::unique_ptr<emu_file> &&file)
+{
+	// validate
+	assert(!m_snap_native || screen != nullptr);
+
+	// create the bitmap to pass in
+	create_snapshot_bitmap(screen);
+
+	// grab a pooled request, or make a new one
+	snap_request *request = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(m_snap_pool_lock);
+		if (!m_snap_pool.empty())
+		{
+			request = m_snap_pool.back();
+			m_snap_pool.pop_back();
+		}
+	}
+	if (request == nullptr)
+		request = new snap_request;
+
+	// copy everything the writer needs; the bitmap copy is cheap compared
+	// to the PNG compression this takes off the emulation thread
+	request->video = this;
+	request->file = std::move(file);
+	request->bitmap.resize(m_snap_bitmap.width(), m_snap_bitmap.height());
+	copybitmap(request->bitmap, m_snap_bitmap, 0, 0, 0, 0, request->bitmap.cliprect());
+	request->pnginfo.reset();
+	request->pnginfo.add_text("Software", std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version()));
+	request->pnginfo.add_text("System", std::string(machine().system().manufacturer).append(" ").append(machine().system().type.fullname()));
+	request->palette.clear();
+	if (screen != nullptr && screen->has_palette())
+	{
+		const rgb_t *entries = screen->palette().palette()->entry_list_adjusted();
+		request->palette.assign(entries, entries + screen->palette().entries());
+	}
+
+	// queue the write; the queue is serial, so files complete in order
+	osd_work_item_queue(m_snap_queue, snapshot_write_callback, request, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+
+//-------------------------------------------------
+//  snapshot_write_callback - encode and write a
+//  queued snapshot on the work queue
+//-------------------------------------------------
+
+void *video_manager::snapshot_write_callback(void *param, int threadid)
+{
+	auto *request = reinterpret_cast<snap_request *>(param);
+
+	// compress and write off the emulation thread
+	std::error_condition const error = util::png_write_bitmap(*request->file, &request->pnginfo, request->bitmap, int(request->palette.size()), request->palette.empty() ? nullptr : &request->palette[0]);
+	if (error)
+		osd_printf_error("Error generating PNG for snapshot (%s:%d %s)\n", error.category().name(), error.value(), error.message());
+	request->file.reset();
+
+	// recycle the request
+	video_manager &video = *request->video;
+	std::lock_guard<std::mutex> lock(video.m_snap_pool_lock);
+	video.m_snap_pool.push_back(request);
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  save_active_screen_snapshots - save a
 //  snapshot of all active screens
@@ -355,19 +464,19 @@ void video_manager::save_active_screen_snapshots()
 		for (screen_device &screen : screen_device_enumerator(machine().root_device()))
 			if (machine().render().is_live(screen))
 			{
-				emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-				std::error_condition const filerr = open_next(file, "png");
+				auto file = std::make_unique<emu_file>(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+				std::error_condition const filerr = open_next(*file, "png");
 				if (!filerr)
-					save_snapshot(&screen, file);
+					save_snapshot_async(&screen, std::move(file));
 			}
 	}
 	else
 	{
 		// otherwise, just write a single snapshot
-		emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-		std::error_condition const filerr = open_next(file, "png");
+		auto file = std::make_unique<emu_file>(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		std::error_condition const filerr = open_next(*file, "png");
 		if (!filerr)
-			save_snapshot(nullptr, file);
+			save_snapshot_async(nullptr, std::move(file));
 	}
 }
 
@@ -470,6 +579,17 @@ void video_manager::add_sound_to_recording(const s16 *sound, int numsamples)
 
 void video_manager::exit()
 {
+	// finish any snapshot writes still in flight
+	if (m_snap_queue != nullptr)
+	{
+		osd_work_queue_wait(m_snap_queue, osd_ticks_per_second() * 10);
+		osd_work_queue_free(m_snap_queue);
+		m_snap_queue = nullptr;
+	}
+	for (snap_request *request : m_snap_pool)
+		delete request;
+	m_snap_pool.clear();
+
 	// stop recording any movie
 	m_movie_recordings.clear();
 
@@ -485,6 +605,84 @@ void video_manager::exit()
 		double final_emu_time = m_overall_emutime.as_double();
 		osd_printf_info("Average speed: %.2f%% (%d seconds)\n", 100 * final_emu_time / final_real_time, (m_overall_emutime + attotime(0, ATTOSECONDS_PER_SECOND / 2)).seconds());
 	}
+
+	// write machine-readable benchmark statistics if requested
+	const char *statsfile = machine().options().bench_stats();
+	if (statsfile[0] != 0)
+		write_bench_stats(statsfile);
+}
+
+
+//-------------------------------------------------
+//  write_bench_stats - dump machine-readable
+//  benchmark statistics as JSON for -benchstats
+//-------------------------------------------------
+
+void video_manager::write_bench_stats(const char *filename)
+{
+	std::ofstream file(filename);
+	if (!file)
+	{
+		osd_printf_error("Unable to open benchmark stats file %s\n", filename);
+		return;
+	}
+
+	// sort the recorded samples so percentiles are a simple lookup
+	std::vector<double> sorted = m_speed_samples;
+	std::sort(sorted.begin(), sorted.end());
+	auto percentile = [&sorted] (double frac) -> double
+	{
+		if (sorted.empty())
+			return 0.0;
+		return sorted[size_t(frac * double(sorted.size() - 1) + 0.5)];
+	};
+
+	osd_ticks_t tps = osd_ticks_per_second();
+	double real_time = double(m_overall_real_seconds) + double(m_overall_real_ticks) / double(tps);
+	double emu_time = m_overall_emutime.as_double();
+
+	// overall throughput; speeds are ratios where 1.0 is full speed
+	file << "{\n";
+	util::stream_format(file, "  \"driver\": \"%s\",\n", machine().system().name);
+	util::stream_format(file, "  \"emulated_seconds\": %f,\n", emu_time);
+	util::stream_format(file, "  \"wall_seconds\": %f,\n", real_time);
+	util::stream_format(file, "  \"average_speed\": %f,\n", (real_time != 0.0) ? emu_time / real_time : 0.0);
+	util::stream_format(file, "  \"speed_samples\": %d,\n", sorted.size());
+	file << "  \"speed_percentiles\": {\n";
+	util::stream_format(file, "    \"min\": %f,\n", percentile(0.0));
+	util::stream_format(file, "    \"p10\": %f,\n", percentile(0.1));
+	util::stream_format(file, "    \"p50\": %f,\n", percentile(0.5));
+	util::stream_format(file, "    \"p90\": %f,\n", percentile(0.9));
+	util::stream_format(file, "    \"max\": %f\n", percentile(1.0));
+	file << "  },\n";
+
+	// per-subsystem profiler totals; empty unless this is a MAME_PROFILER build
+	file << "  \"profiler_ticks\": {";
+	device_enumerator iter(machine().root_device());
+	bool first = true;
+	for (profile_type curtype = PROFILER_DEVICE_FIRST; curtype < PROFILER_TOTAL; ++curtype)
+	{
+		osd_ticks_t ticks = g_profiler.data(curtype);
+		if (ticks == 0)
+			continue;
+
+		// device buckets are named by tag, the rest by their overlay names
+		const char *name = nullptr;
+		if (curtype <= PROFILER_DEVICE_MAX)
+		{
+			device_t *device = iter.byindex(curtype - PROFILER_DEVICE_FIRST);
+			if (device != nullptr)
+				name = device->tag();
+		}
+		else
+			name = profiler_state::type_string(curtype);
+		if (name == nullptr)
+			continue;
+
+		util::stream_format(file, "%s\n    \"%s\": %d", first ? "" : ",", name, ticks);
+		first = false;
+	}
+	file << (first ? "}\n" : "\n  }\n") << "}\n";
 }
 
 
@@ -593,7 +791,12 @@ bool video_manager::finish_screen_updates()
 	{
 		if (screen.partial_scan_hpos() >= 0) // previous update ended mid-scanline
 			screen.update_now();
-		screen.update_partial(screen.visible_area().max_y);
+
+		// frame-latching screens complete their frames in their own
+		// vblank_begin; forcing them to the primary screen's refresh here
+		// would render the remainder of an in-progress frame early
+		if (!screen.frame_latching())
+			screen.update_partial(screen.visible_area().max_y);
 
 		if (machine().render().is_live(screen))
 			has_live_screen = true;
@@ -607,6 +810,13 @@ bool video_manager::finish_screen_updates()
 		if (screen.update_quads())
 			anything_changed = true;
 
+	// hand finished screen bitmaps to any registered frame consumers; this
+	// happens every frame regardless of frameskip or rendering state
+	if (!m_frame_consumers.empty())
+		for (screen_device &screen : iter)
+			for (auto const &consumer : m_frame_consumers)
+				consumer(screen, screen.curbitmap());
+
 	// update our movie recording and burn-in state
 	if (!machine().paused())
 	{
@@ -788,6 +998,14 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 		else
 			delta = 0;
 
+		// offer the wait to queued Lua idle work before sleeping; if some
+		// ran and more is pending, recompute how much wait is left
+		if (delta != 0 && emulator_info::idle_hook(delta))
+		{
+			current_ticks = osd_ticks();
+			continue;
+		}
+
 		// see if we can sleep
 		bool const slept = allowed_to_sleep && delta;
 		if (slept)
@@ -829,8 +1047,10 @@ void video_manager::update_frameskip()
 	// if we're throttling and autoframeskip is on, adjust
 	if (effective_throttle() && effective_autoframeskip() && m_frameskip_counter == 0)
 	{
-		// calibrate the "adjusted speed" based on the target
-		double adjusted_speed_percent = m_speed_percent / double(m_throttle_rate);
+		// calibrate the "adjusted speed" based on the target, using the
+		// smoothed speed so momentary spikes don't cause the level to
+		// oscillate between adjacent settings
+		double adjusted_speed_percent = m_speed_ewma / double(m_throttle_rate);
 
 		double speed = m_speed * 0.001;
 		if (adjusted_speed_percent >= 0.995 * speed)
@@ -848,7 +1068,7 @@ void video_manager::update_frameskip()
 		{
 			// if we're too slow, attempt to increase the frameskip
 			if (adjusted_speed_percent < 0.80 *  speed) // if below 80% speed, be more aggressive
-				m_frameskip_adjust -= (0.90 * speed - m_speed_percent) / 0.05;
+				m_frameskip_adjust -= (0.90 * speed - m_speed_ewma) / 0.05;
 			else if (m_frameskip_level < 8) // if we're close, only force it up to frameskip 8
 				m_frameskip_adjust--;
 
@@ -934,6 +1154,10 @@ void video_manager::recompute_speed(const attotime &emutime)
 		osd_ticks_t tps = osd_ticks_per_second();
 		m_speed_percent = delta_emutime.as_double() * (double)tps / (double)delta_realtime;
 
+		// fold into the smoothed estimate used by autoframeskip; a single
+		// cheap or expensive interval shouldn't move the skip level
+		m_speed_ewma = (m_speed_ewma * 2.0 + m_speed_percent) / 3.0;
+
 		// remember the last times
 		m_speed_last_realtime = realtime;
 		m_speed_last_emutime = emutime;
@@ -947,6 +1171,10 @@ void video_manager::recompute_speed(const attotime &emutime)
 		// if we've had at least 4 consecutive valid periods, accumulate stats
 		if (m_overall_valid_counter >= 4)
 		{
+			// keep a sample for percentile reporting if requested
+			if (machine().options().bench_stats()[0] != 0)
+				m_speed_samples.push_back(m_speed_percent);
+
 			m_overall_real_ticks += delta_realtime;
 			while (m_overall_real_ticks >= tps)
 			{
@@ -961,10 +1189,10 @@ void video_manager::recompute_speed(const attotime &emutime)
 	if (m_seconds_to_run != 0 && emutime.seconds() >= m_seconds_to_run)
 	{
 		// create a final screenshot
-		emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-		std::error_condition const filerr = open_next(file, "png");
+		auto file = std::make_unique<emu_file>(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		std::error_condition const filerr = open_next(*file, "png");
 		if (!filerr)
-			save_snapshot(nullptr, file);
+			save_snapshot_async(nullptr, std::move(file));
 
 		//printf("Scheduled exit at %f\n", emutime.as_double());
 		// schedule our demise
@@ -1045,6 +1273,45 @@ void video_manager::pixels(u32 *buffer)
 }
 
 
+//-------------------------------------------------
+//  hash_bitmap - compute an FNV-1a hash over the
+//  visible pixels of a screen bitmap; the result
+//  depends only on pixel values, never on the
+//  row stride, so it is stable across hosts
+//-------------------------------------------------
+
+u64 video_manager::hash_bitmap(screen_bitmap &bitmap)
+{
+	u64 hash = 0xcbf29ce484222325U;
+	auto const hash_rows = [&hash] (auto &src)
+	{
+		const rectangle &visarea = src.cliprect();
+		for (int y = visarea.top(); y <= visarea.bottom(); y++)
+			for (int x = visarea.left(); x <= visarea.right(); x++)
+			{
+				auto pix = src.pix(y, x);
+				for (unsigned byte = 0; byte < sizeof(pix); byte++)
+					hash = (hash ^ ((pix >> (8 * byte)) & 0xff)) * 0x00000100000001b3U;
+			}
+	};
+
+	switch (bitmap.format())
+	{
+	case BITMAP_FORMAT_IND16:
+		hash_rows(bitmap.as_ind16());
+		break;
+
+	case BITMAP_FORMAT_RGB32:
+		hash_rows(bitmap.as_rgb32());
+		break;
+
+	default:
+		break;
+	}
+	return hash;
+}
+
+
 //-------------------------------------------------
 //  open_next - open the next non-existing file of
 //  type filetype according to our numbering
@@ -1215,7 +1482,7 @@ void video_manager::toggle_record_movie(movie_recording::format format)
 	if (!is_recording())
 	{
 		begin_recording(nullptr, format);
-		machine().popmessage("REC START (%s)", format == movie_recording::format::MNG ? "MNG" : "AVI");
+		machine().popmessage("REC START (%s)", format == movie_recording::format::MNG ? "MNG" : format == movie_recording::format::AVI ? "AVI" : "RAW");
 	}
 	else
 	{
@@ -19,7 +19,11 @@
 
 #include "recording.h"
 
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <system_error>
+#include <vector>
 
 
 //**************************************************************************
@@ -35,6 +39,9 @@ constexpr int MAX_FRAMESKIP = FRAMESKIP_LEVELS - 2;
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+class screen_bitmap;
+
+
 // ======================> video_manager
 
 class video_manager
@@ -53,12 +60,15 @@ public:
 	bool throttled() const { return m_throttled; }
 	float throttle_rate() const { return m_throttle_rate; }
 	bool fastforward() const { return m_fastforward; }
+	u64 frame_update_count() const { return m_frame_update_count; }
+	bool runahead_hidden() const { return m_runahead_hidden; }
 
 	// setters
 	void set_frameskip(int frameskip);
 	void set_throttled(bool throttled) { m_throttled = throttled; }
 	void set_throttle_rate(float throttle_rate) { m_throttle_rate = throttle_rate; }
 	void set_fastforward(bool ffwd) { m_fastforward = ffwd; }
+	void set_runahead_hidden(bool hidden) { m_runahead_hidden = hidden; }
 	void set_output_changed() { m_output_changed = true; }
 
 	// misc
@@ -70,6 +80,14 @@ public:
 	// render a frame
 	void frame_update(bool from_debugger = false);
 
+	// frame consumers: callbacks handed each screen's finished bitmap once
+	// per frame, independent of rendering and frameskip; this is the raw
+	// emulated output, before any render_target work, intended for headless
+	// frame hashing and similar automation
+	using frame_consumer_func = std::function<void (screen_device &screen, screen_bitmap &bitmap)>;
+	void add_frame_consumer(frame_consumer_func &&callback) { m_frame_consumers.emplace_back(std::move(callback)); }
+	static u64 hash_bitmap(screen_bitmap &bitmap);
+
 	// current speed helpers
 	std::string speed_text();
 	double speed_percent() const { return m_speed_percent; }
@@ -105,9 +123,12 @@ private:
 	void update_frameskip();
 	void update_refresh_speed();
 	void recompute_speed(const attotime &emutime);
+	void write_bench_stats(const char *filename);
 
 	// snapshot/movie helpers
 	void create_snapshot_bitmap(screen_device *screen);
+	void save_snapshot_async(screen_device *screen, std::unique_ptr<emu_file> &&file);
+	static void *snapshot_write_callback(void *param, int threadid);
 	void record_frame();
 
 	// movies
@@ -130,12 +151,14 @@ private:
 	osd_ticks_t         m_speed_last_realtime;      // real time at the last speed calculation
 	attotime            m_speed_last_emutime;       // emulated time at the last speed calculation
 	double              m_speed_percent;            // most recent speed percentage
+	double              m_speed_ewma;               // smoothed speed percentage for frameskip decisions
 
 	// overall speed computation
 	u32                 m_overall_real_seconds;     // accumulated real seconds at normal speed
 	osd_ticks_t         m_overall_real_ticks;       // accumulated real ticks at normal speed
 	attotime            m_overall_emutime;          // accumulated emulated time at normal speed
 	u32                 m_overall_valid_counter;    // number of consecutive valid time periods
+	std::vector<double> m_speed_samples;            // per-interval speed samples for -benchstats
 
 	// configuration
 	bool                m_throttled;                // flag: true if we're currently throttled
@@ -155,6 +178,10 @@ private:
 	bool                m_skipping_this_frame;      // flag: true if we are skipping the current frame
 	osd_ticks_t         m_average_oversleep;        // average number of ticks the OSD oversleeps
 
+	// run-ahead
+	u64                 m_frame_update_count;       // total number of frame updates since startup
+	bool                m_runahead_hidden;          // flag: true while emulating frames that are never presented
+
 	// snapshot stuff
 	render_target *     m_snap_target;              // screen shapshot target
 	bitmap_rgb32        m_snap_bitmap;              // screen snapshot bitmap
@@ -162,9 +189,18 @@ private:
 	s32                 m_snap_width;               // width of snapshots (0 == auto)
 	s32                 m_snap_height;              // height of snapshots (0 == auto)
 
+	// asynchronous snapshot writing
+	struct snap_request;                            // pending snapshot write (defined in video.cpp)
+	osd_work_queue *    m_snap_queue;               // queue performing background PNG encodes/writes
+	std::mutex          m_snap_pool_lock;           // lock protecting the request pool
+	std::vector<snap_request *> m_snap_pool;        // recycled snapshot requests
+
 	// movie recordings
 	std::vector<movie_recording::ptr> m_movie_recordings;
 
+	// frame consumers
+	std::vector<frame_consumer_func> m_frame_consumers;
+
 	static const bool   s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS];
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
@@ -0,0 +1,41 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb, Ryan Holtz
+/***************************************************************************
+
+    rgbneon.cpp
+
+    ARM NEON optimized RGB utilities.
+
+    WARNING: This code assumes NEON availability (ARMv7 VFPv3-D32 with
+    Advanced SIMD, or any AArch64 implementation).
+
+***************************************************************************/
+
+#include "emu.h"
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+
+#include "rgbneon.h"
+
+
+/***************************************************************************
+    HIGHER LEVEL OPERATIONS
+***************************************************************************/
+
+void rgbaint_t::blend(const rgbaint_t& other, u8 factor)
+{
+	const int32x4_t scale1 = vdupq_n_s32(factor);
+	const int32x4_t scale2 = vsubq_s32(vdupq_n_s32(0x100), scale1);
+
+	m_value = vaddq_s32(vmulq_s32(m_value, scale1), vmulq_s32(other.m_value, scale2));
+	m_value = vshrq_n_s32(m_value, 8);
+}
+
+void rgbaint_t::scale_and_clamp(const rgbaint_t& scale)
+{
+	mul(scale);
+	sra_imm(8);
+	clamp_to_uint8();
+}
+
+#endif // (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
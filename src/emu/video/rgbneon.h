@@ -0,0 +1,358 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb, Ryan Holtz
+/***************************************************************************
+
+    rgbneon.h
+
+    ARM NEON optimized RGB utilities.
+
+    WARNING: This code assumes NEON availability (ARMv7 VFPv3-D32 with
+    Advanced SIMD, or any AArch64 implementation).
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_RGBNEON_H
+#define MAME_EMU_VIDEO_RGBNEON_H
+
+#pragma once
+
+#include <arm_neon.h>
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+class rgbaint_t
+{
+public:
+	rgbaint_t() { }
+	explicit rgbaint_t(u32 rgba) { set(rgba); }
+	rgbaint_t(s32 a, s32 r, s32 g, s32 b) { set(a, r, g, b); }
+	explicit rgbaint_t(const rgb_t& rgb) { set(rgb); }
+	explicit rgbaint_t(int32x4_t rgba) { m_value = rgba; }
+
+	rgbaint_t(const rgbaint_t& other) = default;
+	rgbaint_t &operator=(const rgbaint_t& other) = default;
+
+	void set(const rgbaint_t& other) { m_value = other.m_value; }
+	void set(const u32& rgba)
+	{
+		const uint8x8_t packed = vreinterpret_u8_u32(vdup_n_u32(rgba));
+		m_value = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(vmovl_u8(packed))));
+	}
+	void set(s32 a, s32 r, s32 g, s32 b)
+	{
+		const s32 temp[4] = { b, g, r, a };
+		m_value = vld1q_s32(temp);
+	}
+	void set(const rgb_t& rgb) { set((const u32&) rgb); }
+	// This function sets all elements to the same val
+	void set_all(const s32& val) { m_value = vdupq_n_s32(val); }
+	// This function zeros all elements
+	void zero() { m_value = veorq_s32(m_value, m_value); }
+	// This function zeros only the alpha element
+	void zero_alpha() { m_value = vsetq_lane_s32(0, m_value, 3); }
+
+	inline rgb_t to_rgba() const
+	{
+		const uint8x8_t packed = vqmovun_s16(vcombine_s16(vqmovn_s32(m_value), vdup_n_s16(0)));
+		return vget_lane_u32(vreinterpret_u32_u8(packed), 0);
+	}
+
+	inline rgb_t to_rgba_clamp() const
+	{
+		return to_rgba();
+	}
+
+	void set_a16(const s32 value) { m_value = vreinterpretq_s32_s16(vsetq_lane_s16(s16(value), vreinterpretq_s16_s32(m_value), 6)); }
+	void set_a(const s32 value) { m_value = vsetq_lane_s32(value, m_value, 3); }
+	void set_r(const s32 value) { m_value = vsetq_lane_s32(value, m_value, 2); }
+	void set_g(const s32 value) { m_value = vsetq_lane_s32(value, m_value, 1); }
+	void set_b(const s32 value) { m_value = vsetq_lane_s32(value, m_value, 0); }
+
+	u8 get_a() const { return u8(u32(vgetq_lane_s32(m_value, 3))); }
+	u8 get_r() const { return u8(u32(vgetq_lane_s32(m_value, 2))); }
+	u8 get_g() const { return u8(u32(vgetq_lane_s32(m_value, 1))); }
+	u8 get_b() const { return u8(u32(vgetq_lane_s32(m_value, 0))); }
+
+	s32 get_a32() const { return vgetq_lane_s32(m_value, 3); }
+	s32 get_r32() const { return vgetq_lane_s32(m_value, 2); }
+	s32 get_g32() const { return vgetq_lane_s32(m_value, 1); }
+	s32 get_b32() const { return vgetq_lane_s32(m_value, 0); }
+
+	// These selects return an rgbaint_t with all fields set to the element choosen (a, r, g, or b)
+	rgbaint_t select_alpha32() const { return rgbaint_t(vdupq_n_s32(get_a32())); }
+	rgbaint_t select_red32() const { return rgbaint_t(vdupq_n_s32(get_r32())); }
+	rgbaint_t select_green32() const { return rgbaint_t(vdupq_n_s32(get_g32())); }
+	rgbaint_t select_blue32() const { return rgbaint_t(vdupq_n_s32(get_b32())); }
+
+	inline void add(const rgbaint_t& color2)
+	{
+		m_value = vaddq_s32(m_value, color2.m_value);
+	}
+
+	inline void add_imm(const s32 imm)
+	{
+		m_value = vaddq_s32(m_value, vdupq_n_s32(imm));
+	}
+
+	inline void add_imm_rgba(const s32 a, const s32 r, const s32 g, const s32 b)
+	{
+		add(rgbaint_t(a, r, g, b));
+	}
+
+	inline void sub(const rgbaint_t& color2)
+	{
+		m_value = vsubq_s32(m_value, color2.m_value);
+	}
+
+	inline void sub_imm(const s32 imm)
+	{
+		m_value = vsubq_s32(m_value, vdupq_n_s32(imm));
+	}
+
+	inline void sub_imm_rgba(const s32 a, const s32 r, const s32 g, const s32 b)
+	{
+		sub(rgbaint_t(a, r, g, b));
+	}
+
+	inline void subr(const rgbaint_t& color2)
+	{
+		m_value = vsubq_s32(color2.m_value, m_value);
+	}
+
+	inline void subr_imm(const s32 imm)
+	{
+		m_value = vsubq_s32(vdupq_n_s32(imm), m_value);
+	}
+
+	inline void subr_imm_rgba(const s32 a, const s32 r, const s32 g, const s32 b)
+	{
+		subr(rgbaint_t(a, r, g, b));
+	}
+
+	inline void mul(const rgbaint_t& color)
+	{
+		m_value = vmulq_s32(m_value, color.m_value);
+	}
+
+	inline void mul_imm(const s32 imm)
+	{
+		m_value = vmulq_s32(m_value, vdupq_n_s32(imm));
+	}
+
+	inline void mul_imm_rgba(const s32 a, const s32 r, const s32 g, const s32 b)
+	{
+		mul(rgbaint_t(a, r, g, b));
+	}
+
+	inline void shl(const rgbaint_t& shift)
+	{
+		// out-of-range shift counts yield zero, matching the SSE behaviour
+		const uint32x4_t invalid = vcgeq_u32(vreinterpretq_u32_s32(shift.m_value), vdupq_n_u32(32));
+		m_value = vbicq_s32(vshlq_s32(m_value, shift.m_value), vreinterpretq_s32_u32(invalid));
+	}
+
+	inline void shl_imm(const u8 shift)
+	{
+		if (shift > 31)
+			zero();
+		else
+			m_value = vshlq_s32(m_value, vdupq_n_s32(shift));
+	}
+
+	inline void shr(const rgbaint_t& shift)
+	{
+		const uint32x4_t invalid = vcgeq_u32(vreinterpretq_u32_s32(shift.m_value), vdupq_n_u32(32));
+		const uint32x4_t shifted = vshlq_u32(vreinterpretq_u32_s32(m_value), vnegq_s32(shift.m_value));
+		m_value = vbicq_s32(vreinterpretq_s32_u32(shifted), vreinterpretq_s32_u32(invalid));
+	}
+
+	inline void shr_imm(const u8 shift)
+	{
+		if (shift > 31)
+			zero();
+		else
+			m_value = vreinterpretq_s32_u32(vshlq_u32(vreinterpretq_u32_s32(m_value), vdupq_n_s32(-s32(shift))));
+	}
+
+	inline void sra(const rgbaint_t& shift)
+	{
+		// arithmetic shifts clamp the count at 31, matching the SSE behaviour
+		const int32x4_t count = vminq_s32(shift.m_value, vdupq_n_s32(31));
+		m_value = vshlq_s32(m_value, vnegq_s32(count));
+	}
+
+	inline void sra_imm(const u8 shift)
+	{
+		const s32 count = (shift > 31) ? 31 : shift;
+		m_value = vshlq_s32(m_value, vdupq_n_s32(-count));
+	}
+
+	void or_reg(const rgbaint_t& color2) { m_value = vorrq_s32(m_value, color2.m_value); }
+	void and_reg(const rgbaint_t& color2) { m_value = vandq_s32(m_value, color2.m_value); }
+	void xor_reg(const rgbaint_t& color2) { m_value = veorq_s32(m_value, color2.m_value); }
+
+	void andnot_reg(const rgbaint_t& color2) { m_value = vbicq_s32(m_value, color2.m_value); }
+
+	void or_imm(s32 value) { m_value = vorrq_s32(m_value, vdupq_n_s32(value)); }
+	void and_imm(s32 value) { m_value = vandq_s32(m_value, vdupq_n_s32(value)); }
+	void xor_imm(s32 value) { m_value = veorq_s32(m_value, vdupq_n_s32(value)); }
+
+	void or_imm_rgba(s32 a, s32 r, s32 g, s32 b) { or_reg(rgbaint_t(a, r, g, b)); }
+	void and_imm_rgba(s32 a, s32 r, s32 g, s32 b) { and_reg(rgbaint_t(a, r, g, b)); }
+	void xor_imm_rgba(s32 a, s32 r, s32 g, s32 b) { xor_reg(rgbaint_t(a, r, g, b)); }
+
+	inline void clamp_and_clear(const u32 sign)
+	{
+		int32x4_t vsign = vdupq_n_s32(sign);
+		m_value = vandq_s32(m_value, vreinterpretq_s32_u32(vceqq_s32(vandq_s32(m_value, vsign), vdupq_n_s32(0))));
+		vsign = vmvnq_s32(vshrq_n_s32(vsign, 1));
+		const uint32x4_t mask = vcgtq_s32(m_value, vsign);
+		m_value = vbslq_s32(mask, vsign, m_value);
+	}
+
+	inline void clamp_to_uint8()
+	{
+		const uint8x8_t packed = vqmovun_s16(vcombine_s16(vqmovn_s32(m_value), vdup_n_s16(0)));
+		m_value = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(vmovl_u8(packed))));
+	}
+
+	inline void sign_extend(const u32 compare, const u32 sign)
+	{
+		const int32x4_t compare_vec = vdupq_n_s32(compare);
+		const uint32x4_t compare_mask = vceqq_s32(vandq_s32(m_value, compare_vec), compare_vec);
+		m_value = vorrq_s32(m_value, vandq_s32(vdupq_n_s32(sign), vreinterpretq_s32_u32(compare_mask)));
+	}
+
+	inline void min(const s32 value)
+	{
+		m_value = vminq_s32(m_value, vdupq_n_s32(value));
+	}
+
+	inline void max(const s32 value)
+	{
+		m_value = vmaxq_s32(m_value, vdupq_n_s32(value));
+	}
+
+	void blend(const rgbaint_t& other, u8 factor);
+
+	void scale_and_clamp(const rgbaint_t& scale);
+
+	// This version needs absolute value of value and scale to be 11 bits or less
+	inline void scale_imm_and_clamp(const s16 scale)
+	{
+		mul_imm(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	// This function needs absolute value of color and scale to be 15 bits or less
+	inline void scale_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other)
+	{
+		mul(scale);
+		sra_imm(8);
+		add(other);
+		clamp_to_uint8();
+	}
+
+	// This function needs absolute value of color and scale to be 15 bits or less
+	inline void scale2_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other, const rgbaint_t& scale2)
+	{
+		const int32x4_t temp = vaddq_s32(vmulq_s32(m_value, scale.m_value), vmulq_s32(other.m_value, scale2.m_value));
+		m_value = vshrq_n_s32(temp, 8);
+		clamp_to_uint8();
+	}
+
+	void cmpeq(const rgbaint_t& value) { m_value = vreinterpretq_s32_u32(vceqq_s32(m_value, value.m_value)); }
+	void cmpgt(const rgbaint_t& value) { m_value = vreinterpretq_s32_u32(vcgtq_s32(m_value, value.m_value)); }
+	void cmplt(const rgbaint_t& value) { m_value = vreinterpretq_s32_u32(vcltq_s32(m_value, value.m_value)); }
+
+	void cmpeq_imm(s32 value) { m_value = vreinterpretq_s32_u32(vceqq_s32(m_value, vdupq_n_s32(value))); }
+	void cmpgt_imm(s32 value) { m_value = vreinterpretq_s32_u32(vcgtq_s32(m_value, vdupq_n_s32(value))); }
+	void cmplt_imm(s32 value) { m_value = vreinterpretq_s32_u32(vcltq_s32(m_value, vdupq_n_s32(value))); }
+
+	void cmpeq_imm_rgba(s32 a, s32 r, s32 g, s32 b) { cmpeq(rgbaint_t(a, r, g, b)); }
+	void cmpgt_imm_rgba(s32 a, s32 r, s32 g, s32 b) { cmpgt(rgbaint_t(a, r, g, b)); }
+	void cmplt_imm_rgba(s32 a, s32 r, s32 g, s32 b) { cmplt(rgbaint_t(a, r, g, b)); }
+
+	inline rgbaint_t& operator+=(const rgbaint_t& other)
+	{
+		m_value = vaddq_s32(m_value, other.m_value);
+		return *this;
+	}
+
+	inline rgbaint_t& operator+=(const s32 other)
+	{
+		m_value = vaddq_s32(m_value, vdupq_n_s32(other));
+		return *this;
+	}
+
+	inline rgbaint_t& operator-=(const rgbaint_t& other)
+	{
+		m_value = vsubq_s32(m_value, other.m_value);
+		return *this;
+	}
+
+	inline rgbaint_t& operator*=(const rgbaint_t& other)
+	{
+		m_value = vmulq_s32(m_value, other.m_value);
+		return *this;
+	}
+
+	inline rgbaint_t& operator*=(const s32 other)
+	{
+		m_value = vmulq_s32(m_value, vdupq_n_s32(other));
+		return *this;
+	}
+
+	inline rgbaint_t& operator>>=(const s32 shift)
+	{
+		sra_imm(u8(shift));
+		return *this;
+	}
+
+	inline void merge_alpha16(const rgbaint_t& alpha)
+	{
+		m_value = vreinterpretq_s32_s16(vsetq_lane_s16(vgetq_lane_s16(vreinterpretq_s16_s32(alpha.m_value), 6), vreinterpretq_s16_s32(m_value), 6));
+	}
+
+	inline void merge_alpha(const rgbaint_t& alpha)
+	{
+		m_value = vsetq_lane_s32(vgetq_lane_s32(alpha.m_value, 3), m_value, 3);
+	}
+
+	static u32 bilinear_filter(u32 rgb00, u32 rgb01, u32 rgb10, u32 rgb11, u8 u, u8 v)
+	{
+		const uint32x4_t fin = bilinear_core(rgb00, rgb01, rgb10, rgb11, u, v);
+		const uint8x8_t packed = vqmovn_u16(vcombine_u16(vqmovn_u32(fin), vdup_n_u16(0)));
+		return vget_lane_u32(vreinterpret_u32_u8(packed), 0);
+	}
+
+	void bilinear_filter_rgbaint(u32 rgb00, u32 rgb01, u32 rgb10, u32 rgb11, u8 u, u8 v)
+	{
+		m_value = vreinterpretq_s32_u32(bilinear_core(rgb00, rgb01, rgb10, rgb11, u, v));
+	}
+
+protected:
+	static uint32x4_t bilinear_core(u32 rgb00, u32 rgb01, u32 rgb10, u32 rgb11, u8 u, u8 v)
+	{
+		const uint16x4_t w00 = vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(rgb00))));
+		const uint16x4_t w01 = vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(rgb01))));
+		const uint16x4_t w10 = vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(rgb10))));
+		const uint16x4_t w11 = vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(rgb11))));
+
+		// horizontal blend of each row, 8.8 fixed point
+		const uint32x4_t row0 = vmlal_n_u16(vmull_n_u16(w00, 256 - u), w01, u);
+		const uint32x4_t row1 = vmlal_n_u16(vmull_n_u16(w10, 256 - u), w11, u);
+
+		// vertical blend and shift back down to 8 bits
+		const uint32x4_t fin = vaddq_u32(vmulq_n_u32(row0, 256 - v), vmulq_n_u32(row1, v));
+		return vshrq_n_u32(fin, 16);
+	}
+
+	int32x4_t m_value;
+};
+
+#endif // MAME_EMU_VIDEO_RGBNEON_H
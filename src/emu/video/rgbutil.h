@@ -18,6 +18,11 @@
 #define MAME_RGB_HIGH_PRECISION
 #include "rgbsse.h"
 
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+
+#define MAME_RGB_HIGH_PRECISION
+#include "rgbneon.h"
+
 #elif defined(__ALTIVEC__)
 
 #define MAME_RGB_HIGH_PRECISION
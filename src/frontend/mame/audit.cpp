@@ -19,8 +19,11 @@
 #include "softlist_dev.h"
 
 #include "chd.h"
+#include "corestr.h"
 
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 //#define VERBOSE 1
 #define LOG_OUTPUT_FUNC osd_printf_verbose
@@ -29,6 +32,70 @@
 
 namespace {
 
+// shared cache of actual file hashes - a clone's search path pulls in its
+// parents' archives, so bulk verification would otherwise read and hash
+// each parent ROM once per clone; keyed strings include the resolved path,
+// length and requested hash types so a replaced file cannot match stale
+// data, and each entry remembers the modification time and size of its
+// containing file so results can be persisted between runs and invalidated
+// when an archive changes
+struct audit_hash_entry
+{
+	int64_t         mtime;      // modification time of the containing file
+	uint64_t        size;       // size of the containing file
+	std::string     hashes;     // hashes in internal string format
+};
+
+// name of the persistent cache file within the configuration directory
+constexpr char const AUDIT_CACHE_NAME[] = "audit.cache";
+constexpr char const AUDIT_CACHE_HEADER[] = "MAME audit cache 1";
+
+std::mutex f_hash_cache_lock;
+std::unordered_map<std::string, audit_hash_entry> f_hash_cache;
+std::unordered_map<std::string, std::pair<int64_t, uint64_t> > f_stat_cache;
+bool f_hash_cache_enabled = false;
+bool f_hash_cache_dirty = false;
+
+
+//-------------------------------------------------
+//  container_stat - return the modification time
+//  and size of the file containing the given path,
+//  walking up from an archive member to the
+//  archive itself; results are cached for the run
+//-------------------------------------------------
+
+std::pair<int64_t, uint64_t> container_stat(std::string path)
+{
+	{
+		std::lock_guard<std::mutex> guard(f_hash_cache_lock);
+		auto const it = f_stat_cache.find(path);
+		if (it != f_stat_cache.end())
+			return it->second;
+	}
+
+	std::pair<int64_t, uint64_t> result(0, 0);
+	std::string trimmed(path);
+	while (!trimmed.empty())
+	{
+		auto const entry = osd_stat(trimmed);
+		if (entry && (entry->type == osd::directory::entry::entry_type::FILE))
+		{
+			result.first = std::chrono::duration_cast<std::chrono::seconds>(entry->last_modified.time_since_epoch()).count();
+			result.second = entry->size;
+			break;
+		}
+		auto const sep = trimmed.find_last_of("/\\");
+		if (std::string::npos == sep)
+			break;
+		trimmed.resize(sep);
+	}
+
+	std::lock_guard<std::mutex> guard(f_hash_cache_lock);
+	f_stat_cache.emplace(std::move(path), result);
+	return result;
+}
+
+
 struct parent_rom
 {
 	parent_rom(device_type t, rom_entry const *r) : type(t), name(r->name()), hashes(r->hashdata()), length(rom_file_size(r)) { }
@@ -597,7 +664,7 @@ media_auditor::audit_record &media_auditor::audit_one_rom(const std::vector<std:
 
 	// if it worked, get the actual length and hashes, then stop
 	if (!filerr)
-		record.set_actual(file.hashes(m_validation), file.size());
+		record.set_actual(file_hashes(file), file.size());
 
 	// compute the final status
 	compute_status(record, rom, record.actual_length() != 0);
@@ -605,6 +672,121 @@ media_auditor::audit_record &media_auditor::audit_one_rom(const std::vector<std:
 }
 
 
+//-------------------------------------------------
+//  file_hashes - hash an opened file, consulting
+//  the shared cache when enabled
+//-------------------------------------------------
+
+util::hash_collection media_auditor::file_hashes(emu_file &file) const
+{
+	if (!f_hash_cache_enabled)
+		return file.hashes(m_validation);
+
+	// look for a previous result for the same file and hash types, and
+	// only accept it if the containing file is unchanged
+	std::string key = util::string_format("%s|%X|%s", file.fullpath(), file.size(), m_validation);
+	std::pair<int64_t, uint64_t> const stat = container_stat(file.fullpath());
+	{
+		std::lock_guard<std::mutex> guard(f_hash_cache_lock);
+		auto const it = f_hash_cache.find(key);
+		if ((it != f_hash_cache.end()) && (it->second.mtime == stat.first) && (it->second.size == stat.second))
+		{
+			util::hash_collection result;
+			result.from_internal_string(it->second.hashes);
+			return result;
+		}
+	}
+
+	// not found or stale - hash the file and publish the result
+	util::hash_collection result = file.hashes(m_validation);
+	std::lock_guard<std::mutex> guard(f_hash_cache_lock);
+	f_hash_cache[std::move(key)] = audit_hash_entry{ stat.first, stat.second, result.internal_string() };
+	f_hash_cache_dirty = true;
+	return result;
+}
+
+
+//-------------------------------------------------
+//  enable_hash_cache - enable or disable the
+//  shared hash cache, dropping any cached results
+//  when disabling
+//-------------------------------------------------
+
+void media_auditor::enable_hash_cache(bool enable)
+{
+	std::lock_guard<std::mutex> guard(f_hash_cache_lock);
+	f_hash_cache_enabled = enable;
+	if (!enable)
+	{
+		f_hash_cache.clear();
+		f_stat_cache.clear();
+		f_hash_cache_dirty = false;
+	}
+}
+
+
+//-------------------------------------------------
+//  load_hash_cache - enable the shared hash cache
+//  and seed it from the persistent cache file, so
+//  hashes of unchanged archives carry over from
+//  previous runs
+//-------------------------------------------------
+
+void media_auditor::load_hash_cache(emu_options &options)
+{
+	enable_hash_cache(true);
+
+	emu_file file(options.cfg_directory(), OPEN_FLAG_READ);
+	if (file.open(AUDIT_CACHE_NAME))
+		return;
+
+	// validate the header before trusting any of it
+	char buffer[1024];
+	if (!file.gets(buffer, std::size(buffer)) || (strtrimspace(buffer) != AUDIT_CACHE_HEADER))
+		return;
+
+	// each line is "<mtime> <size> <hashes> <key>"; the key may contain
+	// spaces, so it runs to the end of the line
+	std::lock_guard<std::mutex> guard(f_hash_cache_lock);
+	while (file.gets(buffer, std::size(buffer)))
+	{
+		long long mtime;
+		unsigned long long size;
+		char hashes[128];
+		int keypos;
+		if ((sscanf(buffer, "%lld %llu %127s %n", &mtime, &size, hashes, &keypos) == 3) && buffer[keypos])
+		{
+			std::string key(strtrimspace(std::string_view(&buffer[keypos])));
+			if (!key.empty())
+				f_hash_cache.emplace(std::move(key), audit_hash_entry{ mtime, size, hashes });
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  save_hash_cache - write the shared hash cache
+//  back to the persistent cache file if anything
+//  changed
+//-------------------------------------------------
+
+void media_auditor::save_hash_cache(emu_options &options)
+{
+	std::lock_guard<std::mutex> guard(f_hash_cache_lock);
+	if (!f_hash_cache_dirty)
+		return;
+
+	emu_file file(options.cfg_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(AUDIT_CACHE_NAME))
+		return;
+
+	file.printf("%s\n", AUDIT_CACHE_HEADER);
+	for (auto const &entry : f_hash_cache)
+		file.printf("%d %d %s %s\n", entry.second.mtime, entry.second.size, entry.second.hashes, entry.first);
+	f_hash_cache_dirty = false;
+}
+
+
 //-------------------------------------------------
 //  audit_one_disk - validate a single disk entry
 //-------------------------------------------------
@@ -35,6 +35,8 @@
 
 // forward declarations
 class driver_enumerator;
+class emu_file;
+class emu_options;
 class software_list_device;
 
 
@@ -160,10 +162,20 @@ public:
 	summary audit_samples();
 	summary summarize(const char *name, std::ostream *output = nullptr) const;
 
+	// shared hash cache control - while enabled, file hashes are cached
+	// globally so identical parent ROM entries are only hashed once when
+	// bulk-verifying many sets (possibly from multiple threads); the cache
+	// can additionally be persisted so unchanged archives are not re-read
+	// on subsequent runs
+	static void enable_hash_cache(bool enable);
+	static void load_hash_cache(emu_options &options);
+	static void save_hash_cache(emu_options &options);
+
 private:
 	// internal helpers
 	template <typename T> void audit_regions(T do_audit, const rom_entry *region, std::size_t &found, std::size_t &required);
 	audit_record &audit_one_rom(const std::vector<std::string> &searchpath, const rom_entry *rom);
+	util::hash_collection file_hashes(emu_file &file) const;
 	template <typename... T> audit_record &audit_one_disk(const rom_entry *rom, T &&... args);
 	void compute_status(audit_record &record, const rom_entry *rom, bool found);
 
@@ -1004,6 +1004,7 @@ bool cheat_entry::set_state(script_state newstate)
 
 	// change to the state and run the appropriate script
 	m_state = newstate;
+	m_manager.m_running_dirty = true;
 	if (newstate == SCRIPT_STATE_OFF)
 		execute_off_script();
 	else if ((newstate == SCRIPT_STATE_ON) || (newstate == SCRIPT_STATE_RUN))
@@ -1060,6 +1061,7 @@ constexpr int cheat_manager::CHEAT_VERSION;
 
 cheat_manager::cheat_manager(running_machine &machine)
 	: m_machine(machine)
+	, m_running_dirty(true)
 	, m_framecount(0)
 	, m_numlines(0)
 	, m_lastline(0)
@@ -1145,6 +1147,8 @@ void cheat_manager::reload()
 
 	// free everything
 	m_cheatlist.clear();
+	m_runninglist.clear();
+	m_running_dirty = true;
 
 	// reset state
 	m_framecount = 0;
@@ -1375,8 +1379,20 @@ void cheat_manager::frame_update()
 	for (auto & elem : m_output)
 		elem.clear();
 
+	// rebuild the cached list of running cheats if any state has changed;
+	// large collections are mostly switched off, and walking every entry
+	// each frame costs more than the cheats that actually run
+	if (m_running_dirty)
+	{
+		m_runninglist.clear();
+		for (auto &cheat : m_cheatlist)
+			if (cheat->state() == SCRIPT_STATE_RUN)
+				m_runninglist.push_back(cheat.get());
+		m_running_dirty = false;
+	}
+
 	// iterate over running cheats and execute them
-	for (auto &cheat : m_cheatlist)
+	for (cheat_entry *cheat : m_runninglist)
 		cheat->frame_update();
 
 	// increment the frame counter
@@ -330,6 +330,9 @@ public:
 	static uint64_t execute_tobcd(int params, uint64_t const *param);
 
 private:
+	// allow entries to invalidate the running cheat list on state changes
+	friend class cheat_entry;
+
 	// internal helpers
 	void frame_update();
 	void load_cheats(std::string const &filename);
@@ -337,6 +340,8 @@ private:
 	// internal state
 	running_machine &                           m_machine;      // reference to our machine
 	std::vector<std::unique_ptr<cheat_entry>>   m_cheatlist;    // cheat list
+	std::vector<cheat_entry *>                  m_runninglist;  // cached list of running cheats
+	bool                                        m_running_dirty;// true if the running cheat list must be rebuilt
 	uint64_t                                    m_framecount;   // frame count
 	std::vector<std::string>                    m_output;       // array of output strings
 	std::vector<ui::text_layout::text_justify>  m_justify;      // justification for each string
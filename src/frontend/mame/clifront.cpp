@@ -14,6 +14,7 @@
 #include "ui/moptions.h"
 
 #include "audit.h"
+#include "infojson.h"
 #include "infoxml.h"
 #include "language.h"
 #include "luaengine.h"
@@ -38,6 +39,7 @@
 #include <algorithm>
 #include <new>
 #include <set>
+#include <sstream>
 #include <tuple>
 #include <cctype>
 
@@ -57,6 +59,7 @@
 
 // frontend commands
 #define CLICOMMAND_LISTXML              "listxml"
+#define CLICOMMAND_LISTJSON             "listjson"
 #define CLICOMMAND_LISTFULL             "listfull"
 #define CLICOMMAND_LISTSOURCE           "listsource"
 #define CLICOMMAND_LISTCLONES           "listclones"
@@ -78,6 +81,7 @@
 
 // command options
 #define CLIOPTION_DTD                   "dtd"
+#define CLIOPTION_JSONFIELDS            "jsonfields"
 
 
 namespace {
@@ -102,6 +106,7 @@ const options_entry cli_option_entries[] =
 	/* frontend commands */
 	{ nullptr,                              nullptr,   OPTION_HEADER,     "FRONTEND COMMANDS" },
 	{ CLICOMMAND_LISTXML        ";lx",      "0",       OPTION_COMMAND,    "all available info on driver in XML format" },
+	{ CLICOMMAND_LISTJSON       ";lj",      "0",       OPTION_COMMAND,    "selected info on driver as newline-delimited JSON" },
 	{ CLICOMMAND_LISTFULL       ";ll",      "0",       OPTION_COMMAND,    "short name, full name" },
 	{ CLICOMMAND_LISTSOURCE     ";ls",      "0",       OPTION_COMMAND,    "driver sourcefile" },
 	{ CLICOMMAND_LISTCLONES     ";lc",      "0",       OPTION_COMMAND,    "show clones" },
@@ -123,15 +128,15 @@ const options_entry cli_option_entries[] =
 
 	{ nullptr,                              nullptr,   OPTION_HEADER,     "FRONTEND COMMAND OPTIONS" },
 	{ CLIOPTION_DTD,                        "1",       OPTION_BOOLEAN,    "include DTD in XML output" },
+	{ CLIOPTION_JSONFIELDS,                 "",        OPTION_STRING,     "comma-separated fields to include in JSON output (\"all\" for everything)" },
 	{ nullptr }
 };
 
 
 void print_summary(
-		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		media_auditor::summary summary, const char *summary_text, bool record_none_needed,
 		const char *type, const char *name, const char *parent,
-		unsigned &correct, unsigned &incorrect, unsigned &notfound,
-		util::ovectorstream &buffer)
+		unsigned &correct, unsigned &incorrect, unsigned &notfound)
 {
 	if (summary == media_auditor::NOTFOUND)
 	{
@@ -141,11 +146,7 @@ void print_summary(
 	else if (record_none_needed || (summary != media_auditor::NONE_NEEDED))
 	{
 		// output the summary of the audit
-		buffer.clear();
-		buffer.seekp(0);
-		auditor.summarize(name, &buffer);
-		buffer.put('\0');
-		osd_printf_info("%s", &buffer.vec()[0]);
+		osd_printf_info("%s", summary_text);
 
 		// output the name of the driver and its parent
 		osd_printf_info("%sset %s ", type, name);
@@ -180,6 +181,21 @@ void print_summary(
 	}
 }
 
+
+void print_summary(
+		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		const char *type, const char *name, const char *parent,
+		unsigned &correct, unsigned &incorrect, unsigned &notfound,
+		util::ovectorstream &buffer)
+{
+	// generate the summary text, then print it
+	buffer.clear();
+	buffer.seekp(0);
+	auditor.summarize(name, &buffer);
+	buffer.put('\0');
+	print_summary(summary, &buffer.vec()[0], record_none_needed, type, name, parent, correct, incorrect, notfound);
+}
+
 } // anonymous namespace
 
 
@@ -365,6 +381,20 @@ void cli_frontend::listxml(const std::vector<std::string> &args)
 }
 
 
+//-------------------------------------------------
+//  listjson - output one JSON record per line
+//  for one or more games, with the field set
+//  selected by -jsonfields
+//-------------------------------------------------
+
+void cli_frontend::listjson(const std::vector<std::string> &args)
+{
+	// create the JSON and print it to stdout
+	info_json_creator creator(m_options, m_options.value(CLIOPTION_JSONFIELDS));
+	creator.output(std::cout, args);
+}
+
+
 //-------------------------------------------------
 //  listfull - output the name and description of
 //  one or more games
@@ -914,23 +944,42 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 	unsigned incorrect = 0;
 	unsigned notfound = 0;
 
-	// iterate over drivers
+	// holds the results of auditing one driver's ROMs on a worker thread
+	struct audit_task
+	{
+		emu_options &               options;        // options to construct the enumerator from
+		game_driver const &         driver;         // driver to audit
+		const char *                parent;         // name of the clone's parent, if any
+		media_auditor::summary      summary;        // result of the audit
+		std::string                 summary_text;   // buffered detail output
+
+		static void *audit(void *param, int threadid)
+		{
+			audit_task &task = *reinterpret_cast<audit_task *>(param);
+			driver_enumerator enumerator(task.options, task.driver);
+			enumerator.next();
+			media_auditor auditor(enumerator);
+			task.summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
+			std::ostringstream stream;
+			auditor.summarize(task.driver.name, &stream);
+			task.summary_text = stream.str();
+			return nullptr;
+		}
+	};
+
+	// collect matching drivers up front
 	driver_enumerator drivlist(m_options);
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	std::vector<std::unique_ptr<audit_task> > tasks;
 	while (drivlist.next())
 	{
 		if (included(drivlist.driver().name))
 		{
-			// audit the ROMs in this set
-			media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
-
 			auto const clone_of = drivlist.clone();
-			print_summary(
-					auditor, summary, true,
-					"rom", drivlist.driver().name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
-					correct, incorrect, notfound,
-					summary_string);
+			tasks.emplace_back(new audit_task{
+					m_options,
+					drivlist.driver(),
+					(clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
+					media_auditor::NOTFOUND });
 
 			// if it wasn't a wildcard, there can only be one
 			if (!iswild)
@@ -938,8 +987,32 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 		}
 	}
 
+	// audit the sets concurrently - each work item uses its own enumerator
+	// and buffers its results, and identical parent ROMs shared between
+	// clones are only hashed once; hashes of archives unchanged since the
+	// previous run are taken from the persistent cache
+	media_auditor::load_hash_cache(m_options);
+	osd_work_queue *const queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	for (auto const &task : tasks)
+		osd_work_item_queue(queue, &audit_task::audit, task.get(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+	{
+	}
+	osd_work_queue_free(queue);
+	media_auditor::save_hash_cache(m_options);
+	media_auditor::enable_hash_cache(false);
+
+	// print the results in driver order
+	for (auto const &task : tasks)
+		print_summary(
+				task->summary, task->summary_text.c_str(), true,
+				"rom", task->driver.name, task->parent,
+				correct, incorrect, notfound);
+
 	if (iswild || !matchcount)
 	{
+		media_auditor auditor(drivlist);
+		util::ovectorstream summary_string;
 		machine_config config(GAME_NAME(___empty), m_options);
 		machine_config::token const tok(config.begin_configuration(config.root_device()));
 		for (device_type type : registered_device_types)
@@ -1609,6 +1682,7 @@ const cli_frontend::info_command_struct *cli_frontend::find_command(const std::s
 	static const info_command_struct s_info_commands[] =
 	{
 		{ CLICOMMAND_LISTXML,           0, -1, &cli_frontend::listxml,          "[pattern] ..." },
+		{ CLICOMMAND_LISTJSON,          0, -1, &cli_frontend::listjson,         "[pattern] ..." },
 		{ CLICOMMAND_LISTFULL,          0, -1, &cli_frontend::listfull,         "[pattern] ..." },
 		{ CLICOMMAND_LISTSOURCE,        0, -1, &cli_frontend::listsource,       "[system name]" },
 		{ CLICOMMAND_LISTCLONES,        0,  1, &cli_frontend::listclones,       "[system name]" },
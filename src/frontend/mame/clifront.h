@@ -48,6 +48,7 @@ private:
 
 	// commands
 	void listxml(const std::vector<std::string> &args);
+	void listjson(const std::vector<std::string> &args);
 	void listfull(const std::vector<std::string> &args);
 	void listsource(const std::vector<std::string> &args);
 	void listclones(const std::vector<std::string> &args);
@@ -0,0 +1,403 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    infojson.cpp
+
+    Dumps a selectable subset of the MAME internal data as
+    newline-delimited JSON.
+
+    Unlike -listxml, which always pays for full machine_config
+    construction and emits the whole schema, each machine here is a
+    single self-contained JSON object on its own line, and only the
+    requested fields are populated.  Fields that come straight from the
+    driver list are emitted without constructing a machine config at
+    all, so single-field queries over the whole driver list are cheap;
+    fields that need a config reuse the packetized worker task scheme
+    from -listxml so construction runs in parallel while output stays
+    deterministic and streamed.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "infojson.h"
+
+#include "drivenum.h"
+#include "romload.h"
+
+#include "corestr.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <future>
+#include <locale>
+#include <queue>
+#include <set>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+
+namespace {
+
+//**************************************************************************
+//  ANONYMOUS NAMESPACE PROTOTYPES
+//**************************************************************************
+
+std::string json_escape(const char *string);
+
+void output_one(std::ostream &out, const game_driver &driver, uint32_t fields, machine_config *config);
+
+
+//**************************************************************************
+//  GLOBAL VARIABLES
+//**************************************************************************
+
+// field selection bits; FIELDS_CONFIG marks the fields that require a
+// machine_config to be constructed for each machine
+constexpr uint32_t FIELD_DESCRIPTION    = 1 << 0;
+constexpr uint32_t FIELD_YEAR           = 1 << 1;
+constexpr uint32_t FIELD_MANUFACTURER   = 1 << 2;
+constexpr uint32_t FIELD_SOURCEFILE     = 1 << 3;
+constexpr uint32_t FIELD_CLONEOF        = 1 << 4;
+constexpr uint32_t FIELD_ROMOF          = 1 << 5;
+constexpr uint32_t FIELD_FLAGS          = 1 << 6;
+constexpr uint32_t FIELD_STATUS         = 1 << 7;
+constexpr uint32_t FIELD_ROMS           = 1 << 8;
+constexpr uint32_t FIELD_DEVICES        = 1 << 9;
+
+constexpr uint32_t FIELDS_CONFIG        = FIELD_STATUS | FIELD_ROMS | FIELD_DEVICES;
+constexpr uint32_t FIELDS_DEFAULT       = FIELD_DESCRIPTION | FIELD_YEAR | FIELD_MANUFACTURER | FIELD_SOURCEFILE | FIELD_CLONEOF | FIELD_ROMOF | FIELD_FLAGS;
+constexpr uint32_t FIELDS_ALL           = FIELDS_DEFAULT | FIELDS_CONFIG;
+
+// JSON field names
+constexpr std::pair<char const *, uint32_t> f_field_names[] = {
+		{ "description",    FIELD_DESCRIPTION   },
+		{ "year",           FIELD_YEAR          },
+		{ "manufacturer",   FIELD_MANUFACTURER  },
+		{ "sourcefile",     FIELD_SOURCEFILE    },
+		{ "cloneof",        FIELD_CLONEOF       },
+		{ "romof",          FIELD_ROMOF         },
+		{ "flags",          FIELD_FLAGS         },
+		{ "status",         FIELD_STATUS        },
+		{ "roms",           FIELD_ROMS          },
+		{ "devices",        FIELD_DEVICES       } };
+
+
+//**************************************************************************
+//  ANONYMOUS NAMESPACE IMPLEMENTATION
+//**************************************************************************
+
+//-------------------------------------------------
+//  json_escape - escape a string for use as a
+//  JSON string value
+//-------------------------------------------------
+
+std::string json_escape(const char *string)
+{
+	std::string result;
+	for (const char *ptr = string; *ptr; ptr++)
+	{
+		char const ch = *ptr;
+		if (ch == '"' || ch == '\\')
+		{
+			result += '\\';
+			result += ch;
+		}
+		else if (uint8_t(ch) < 0x20)
+		{
+			result += util::string_format("\\u%04x", unsigned(uint8_t(ch)));
+		}
+		else
+		{
+			result += ch;
+		}
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  parse_fields - convert a comma-separated
+//  field list to a selection mask
+//-------------------------------------------------
+
+uint32_t parse_fields(std::string const &fields)
+{
+	// an empty list selects the cheap default set
+	if (fields.empty())
+		return FIELDS_DEFAULT;
+
+	uint32_t result = 0;
+	std::string::size_type pos = 0;
+	while (pos <= fields.length())
+	{
+		std::string::size_type const comma = fields.find(',', pos);
+		std::string const token = fields.substr(pos, (comma == std::string::npos) ? std::string::npos : (comma - pos));
+		pos = (comma == std::string::npos) ? (fields.length() + 1) : (comma + 1);
+
+		if (token == "all")
+		{
+			result |= FIELDS_ALL;
+			continue;
+		}
+		auto const found = std::find_if(
+				std::begin(f_field_names),
+				std::end(f_field_names),
+				[&token] (auto const &entry) { return token == entry.first; });
+		if (std::end(f_field_names) == found)
+			throw emu_fatalerror(EMU_ERR_INVALID_CONFIG, "Unknown JSON field '%s' (use \"all\" or a comma-separated subset of the documented field names)", token);
+		result |= found->second;
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  output_one - print the JSON record for one
+//  particular machine driver; config is only
+//  supplied when config-derived fields are
+//  selected
+//-------------------------------------------------
+
+void output_one(std::ostream &out, const game_driver &driver, uint32_t fields, machine_config *config)
+{
+	// the name is always emitted first so records can be keyed without
+	// knowing which fields were selected
+	util::stream_format(out, "{\"name\":\"%s\"", json_escape(driver.name));
+
+	if (fields & FIELD_DESCRIPTION)
+		util::stream_format(out, ",\"description\":\"%s\"", json_escape(driver.type.fullname()));
+	if (fields & FIELD_YEAR)
+		util::stream_format(out, ",\"year\":\"%s\"", json_escape(driver.year));
+	if (fields & FIELD_MANUFACTURER)
+		util::stream_format(out, ",\"manufacturer\":\"%s\"", json_escape(driver.manufacturer));
+
+	if (fields & FIELD_SOURCEFILE)
+	{
+		// strip away any path information from the source file, as -listxml does
+		const char *start = strrchr(driver.type.source(), '/');
+		if (!start)
+			start = strrchr(driver.type.source(), '\\');
+		start = start ? (start + 1) : driver.type.source();
+		util::stream_format(out, ",\"sourcefile\":\"%s\"", json_escape(start));
+	}
+
+	if (fields & (FIELD_CLONEOF | FIELD_ROMOF))
+	{
+		// cloneof suppresses BIOS root parents while romof reports them,
+		// matching the -listxml attributes of the same names
+		int const clone_of = driver_list::find(driver.parent);
+		if ((fields & FIELD_CLONEOF) && (clone_of != -1) && !(driver_list::driver(clone_of).flags & machine_flags::IS_BIOS_ROOT))
+			util::stream_format(out, ",\"cloneof\":\"%s\"", json_escape(driver_list::driver(clone_of).name));
+		if ((fields & FIELD_ROMOF) && (clone_of != -1))
+			util::stream_format(out, ",\"romof\":\"%s\"", json_escape(driver_list::driver(clone_of).name));
+	}
+
+	if (fields & FIELD_FLAGS)
+	{
+		util::stream_format(out, ",\"isbios\":%s", (driver.flags & machine_flags::IS_BIOS_ROOT) ? "true" : "false");
+		util::stream_format(out, ",\"ismechanical\":%s", (driver.flags & machine_flags::MECHANICAL) ? "true" : "false");
+		util::stream_format(out, ",\"notworking\":%s", (driver.flags & machine_flags::NOT_WORKING) ? "true" : "false");
+		util::stream_format(out, ",\"supportssave\":%s", (driver.flags & machine_flags::SUPPORTS_SAVE) ? "true" : "false");
+	}
+
+	if (fields & FIELD_STATUS)
+	{
+		// build overall emulation status over all devices, using the same
+		// classification as the -listxml driver element
+		device_t::feature_type overall_unemulated(driver.type.unemulated_features());
+		device_t::feature_type overall_imperfect(driver.type.imperfect_features());
+		for (device_t &device : device_enumerator(config->root_device()))
+		{
+			overall_unemulated |= device.type().unemulated_features();
+			overall_imperfect |= device.type().imperfect_features();
+		}
+
+		bool const machine_preliminary(driver.flags & (machine_flags::NOT_WORKING | machine_flags::MECHANICAL));
+		bool const unemulated_preliminary(overall_unemulated & (device_t::feature::PALETTE | device_t::feature::GRAPHICS | device_t::feature::SOUND | device_t::feature::KEYBOARD));
+		bool const imperfect_preliminary((overall_unemulated | overall_imperfect) & device_t::feature::PROTECTION);
+
+		char const *status;
+		if (machine_preliminary || unemulated_preliminary || imperfect_preliminary)
+			status = "preliminary";
+		else if (overall_imperfect)
+			status = "imperfect";
+		else
+			status = "good";
+		util::stream_format(out, ",\"status\":\"%s\"", status);
+	}
+
+	if (fields & FIELD_ROMS)
+	{
+		out << ",\"roms\":[";
+		bool first = true;
+		for (device_t const &device : device_enumerator(config->root_device()))
+		{
+			for (const rom_entry *region = rom_first_region(device); region; region = rom_next_region(region))
+			{
+				for (const rom_entry *rom = rom_first_file(region); rom; rom = rom_next_file(rom))
+				{
+					util::stream_format(out, "%s{\"name\":\"%s\"", first ? "" : ",", json_escape(rom->name().c_str()));
+					first = false;
+
+					// CHDs have no meaningful size, so only ROM data regions report one
+					if (ROMREGION_ISROMDATA(region))
+						util::stream_format(out, ",\"size\":%u", unsigned(rom_file_size(rom)));
+
+					util::hash_collection const hashes(rom->hashdata());
+					if (!hashes.flag(util::hash_collection::FLAG_NO_DUMP))
+					{
+						uint32_t crc;
+						util::sha1_t sha1;
+						if (hashes.crc(crc))
+							util::stream_format(out, ",\"crc\":\"%08x\"", crc);
+						if (hashes.sha1(sha1))
+							util::stream_format(out, ",\"sha1\":\"%s\"", sha1.as_string());
+					}
+					out << '}';
+				}
+			}
+		}
+		out << ']';
+	}
+
+	if (fields & FIELD_DEVICES)
+	{
+		// referenced device shortnames, deduplicated and sorted for stable diffs
+		std::set<std::string_view> devnames;
+		for (device_t const &device : device_enumerator(config->root_device()))
+			if (device.owner())
+				devnames.insert(device.shortname());
+
+		out << ",\"devices\":[";
+		bool first = true;
+		for (std::string_view const &devname : devnames)
+		{
+			util::stream_format(out, "%s\"%s\"", first ? "" : ",", devname);
+			first = false;
+		}
+		out << ']';
+	}
+
+	out << "}\n";
+}
+
+} // anonymous namespace
+
+
+//-------------------------------------------------
+//  info_json_creator - constructor
+//-------------------------------------------------
+
+info_json_creator::info_json_creator(emu_options const &options, std::string const &fields)
+	: m_fields(parse_fields(fields))
+{
+}
+
+
+//-------------------------------------------------
+//  output - print one JSON record per line for
+//  all known machines matching a pattern
+//-------------------------------------------------
+
+void info_json_creator::output(std::ostream &out, const std::vector<std::string> &patterns)
+{
+	// collect the drivers matching the patterns in list order
+	driver_enumerator drivlist(m_lookup_options);
+	std::vector<std::reference_wrapper<const game_driver>> drivers;
+	std::vector<bool> matched(patterns.size(), false);
+	while (drivlist.next())
+	{
+		bool match = patterns.empty();
+		auto it = matched.begin();
+		for (const std::string &pat : patterns)
+		{
+			if (!core_strwildcmp(pat.c_str(), drivlist.driver().name))
+			{
+				match = true;
+				*it = true;
+			}
+			++it;
+		}
+		if (match)
+			drivers.emplace_back(drivlist.driver());
+	}
+
+	// throw an error if there were unmatched patterns
+	auto const iter = std::find(matched.begin(), matched.end(), false);
+	if (iter != matched.end())
+		throw emu_fatalerror(EMU_ERR_NO_SUCH_SYSTEM, "No matching machines found for '%s'", patterns[iter - matched.begin()]);
+
+	// if no selected field needs a machine config, emit the records
+	// directly - the driver list is all in static data and spinning up
+	// worker tasks would only add overhead
+	if (!(m_fields & FIELDS_CONFIG))
+	{
+		std::ostringstream stream;
+		stream.imbue(std::locale::classic());
+		for (const game_driver &driver : drivers)
+		{
+			stream.str("");
+			output_one(stream, driver, m_fields, nullptr);
+			out << stream.str();
+		}
+		return;
+	}
+
+	// otherwise split the list into packets and construct the machine
+	// configs on worker tasks, emitting the fragments in order as the
+	// front of the queue completes - the same scheme -listxml uses
+	constexpr std::size_t PACKET_COUNT = 20;
+	std::queue<std::future<std::string>> tasks;
+	std::atomic<unsigned int> active_task_count = 0;
+	unsigned int const maximum_active_task_count = std::thread::hardware_concurrency() + 10;
+	unsigned int const maximum_outstanding_task_count = maximum_active_task_count + 20;
+	std::size_t pos = 0;
+	while ((pos < drivers.size()) || !tasks.empty())
+	{
+		// keep as many tasks outstanding as possible
+		while ((pos < drivers.size())
+			&& (active_task_count < maximum_active_task_count)
+			&& (tasks.size() < maximum_outstanding_task_count))
+		{
+			// grab a packet of drivers to process
+			std::size_t const last = (std::min)(pos + PACKET_COUNT, drivers.size());
+			std::vector<std::reference_wrapper<const game_driver>> packet(drivers.begin() + pos, drivers.begin() + last);
+			pos = last;
+
+			// do the dirty work asynchronously
+			auto task_proc = [this, packet{ std::move(packet) }, &active_task_count]
+			{
+				std::ostringstream stream;
+				stream.imbue(std::locale::classic());
+
+				// each driver gets its own machine config so construction
+				// doesn't interfere between threads
+				for (const game_driver &driver : packet)
+				{
+					machine_config config(driver, m_lookup_options);
+					output_one(stream, driver, m_fields, &config);
+				}
+
+				// we're done with the task; decrement the counter and return
+				active_task_count--;
+				return stream.str();
+			};
+
+			// add this task to the queue
+			active_task_count++;
+			tasks.emplace(std::async(std::launch::async, std::move(task_proc)));
+		}
+
+		// wait for the task at the front of the queue and emit its records
+		if (!tasks.empty())
+		{
+			out << tasks.front().get();
+			tasks.pop();
+		}
+	}
+}
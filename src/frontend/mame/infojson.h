@@ -0,0 +1,46 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    infojson.h
+
+    Dumps a selectable subset of the MAME internal data as
+    newline-delimited JSON.
+
+***************************************************************************/
+
+#ifndef MAME_FRONTEND_MAME_INFOJSON_H
+#define MAME_FRONTEND_MAME_INFOJSON_H
+
+#pragma once
+
+#include "emuopts.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+
+//**************************************************************************
+//  FUNCTION PROTOTYPES
+//**************************************************************************
+
+// helper class to output newline-delimited JSON machine records
+class info_json_creator
+{
+public:
+	// construction/destruction - fields is a comma-separated list of field
+	// names ("all" for everything, empty for the cheap default set)
+	info_json_creator(emu_options const &options, std::string const &fields);
+
+	// output
+	void output(std::ostream &out, const std::vector<std::string> &patterns);
+
+private:
+	// internal state
+	emu_options     m_lookup_options;
+	uint32_t        m_fields;
+};
+
+#endif // MAME_FRONTEND_MAME_INFOJSON_H
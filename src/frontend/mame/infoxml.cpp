@@ -879,37 +879,84 @@ void output_one_device(std::ostream &out, machine_config &config, device_t &devi
 
 void output_devices(std::ostream &out, emu_options &lookup_options, device_type_set const *filter)
 {
-	// get config for empty machine
-	machine_config config(GAME_NAME(___empty), lookup_options);
+	// collect the device types to emit
+	std::vector<std::add_pointer_t<device_type> > types;
+	if (filter)
+	{
+		types.assign(filter->begin(), filter->end());
+	}
+	else
+	{
+		for (device_type type : registered_device_types)
+			types.push_back(&type);
+	}
+
+	// split the list into packets and process them asynchronously, emitting
+	// the results in order; each task builds its own dummy machine config so
+	// device construction doesn't interfere between threads, and uses a
+	// classic-imbued local stream so the caller's stream is left alone
+	constexpr std::size_t PACKET_COUNT = 20;
+	std::queue<std::future<std::string> > tasks;
+	std::atomic<unsigned int> active_task_count = 0;
+	unsigned int const maximum_active_task_count = std::thread::hardware_concurrency() + 10;
+	unsigned int const maximum_outstanding_task_count = maximum_active_task_count + 20;
+	std::size_t pos = 0;
+	while ((pos < types.size()) || !tasks.empty())
+	{
+		// keep as many tasks outstanding as possible
+		while ((pos < types.size())
+			&& (active_task_count < maximum_active_task_count)
+			&& (tasks.size() < maximum_outstanding_task_count))
+		{
+			// grab a packet of device types to process
+			std::size_t const last = (std::min)(pos + PACKET_COUNT, types.size());
+			std::vector<std::add_pointer_t<device_type> > packet(types.begin() + pos, types.begin() + last);
+			pos = last;
 
-	auto const action = [&config, &out] (device_type type)
+			// do the dirty work asynchronously
+			auto task_proc = [&lookup_options, packet{ std::move(packet) }, &active_task_count]
 			{
-				// add it at the root of the machine config
-				device_t *dev;
+				std::ostringstream stream;
+				stream.imbue(std::locale::classic());
+
+				// get config for empty machine
+				machine_config config(GAME_NAME(___empty), lookup_options);
+				for (std::add_pointer_t<device_type> type : packet)
 				{
+					// add it at the root of the machine config
+					device_t *dev;
+					{
+						machine_config::token const tok(config.begin_configuration(config.root_device()));
+						dev = config.device_add("_tmp", *type, 0);
+					}
+
+					// notify this device and all its subdevices that they are now configured
+					for (device_t &device : device_enumerator(*dev))
+						if (!device.configured())
+							device.config_complete();
+
+					// print details and remove it
+					output_one_device(stream, config, *dev, dev->tag());
 					machine_config::token const tok(config.begin_configuration(config.root_device()));
-					dev = config.device_add("_tmp", type, 0);
+					config.device_remove("_tmp");
 				}
 
-				// notify this device and all its subdevices that they are now configured
-				for (device_t &device : device_enumerator(*dev))
-					if (!device.configured())
-						device.config_complete();
-
-				// print details and remove it
-				output_one_device(out, config, *dev, dev->tag());
-				machine_config::token const tok(config.begin_configuration(config.root_device()));
-				config.device_remove("_tmp");
+				// we're done with the task; decrement the counter and return
+				active_task_count--;
+				return stream.str();
 			};
 
-	// run through devices
-	if (filter)
-	{
-		for (std::add_pointer_t<device_type> type : *filter) action(*type);
-	}
-	else
-	{
-		for (device_type type : registered_device_types) action(type);
+			// add this task to the queue
+			active_task_count++;
+			tasks.emplace(std::async(std::launch::async, std::move(task_proc)));
+		}
+
+		// wait for the task at the front of the queue and emit its XML
+		if (!tasks.empty())
+		{
+			out << tasks.front().get();
+			tasks.pop();
+		}
 	}
 }
 
@@ -2076,23 +2123,30 @@ void output_slots(std::ostream &out, machine_config &config, device_t &device, c
 			{
 				if (devtypes || (listed && option.second->selectable()))
 				{
-					device_t *const dev = config.device_add("_dummy", option.second->devtype(), option.second->clock());
-					if (!dev->configured())
-						dev->config_complete();
+					// instantiating the card is only needed to walk its
+					// subdevice types; a type already in the set had its
+					// tree walked when it was first seen, and the XML
+					// attributes come from static type metadata anyway
+					device_type const &devtype(option.second->devtype());
+					if (devtypes && (devtypes->find(&devtype) == devtypes->end()))
+					{
+						device_t *const dev = config.device_add("_dummy", devtype, option.second->clock());
+						if (!dev->configured())
+							dev->config_complete();
 
-					if (devtypes)
 						for (device_t &subdevice : device_enumerator(*dev)) devtypes->insert(&subdevice.type());
 
+						config.device_remove("_dummy");
+					}
+
 					if (listed && option.second->selectable())
 					{
 						util::stream_format(out, "\t\t\t<slotoption name=\"%s\"", normalize_string(option.second->name()));
-						util::stream_format(out, " devname=\"%s\"", normalize_string(dev->shortname()));
+						util::stream_format(out, " devname=\"%s\"", normalize_string(devtype.shortname()));
 						if (slot.default_option() && !strcmp(slot.default_option(), option.second->name()))
 							out << " default=\"yes\"";
 						out << "/>\n";
 					}
-
-					config.device_remove("_dummy");
 				}
 			}
 
@@ -528,6 +528,32 @@ void lua_engine::on_periodic()
 	execute_function("LUA_ON_PERIODIC");
 }
 
+//-------------------------------------------------
+//  on_idle - run queued plugin work in slices
+//  during throttle waits; stops invoking further
+//  callbacks once the tick budget is spent, and
+//  returns true while any callback wants more time
+//-------------------------------------------------
+
+bool lua_engine::on_idle(uint64_t budget)
+{
+	uint64_t const deadline = osd_ticks() + budget;
+	bool pending = false;
+	enumerate_functions("LUA_ON_IDLE", [this, deadline, &pending] (const sol::protected_function &func)
+	{
+		auto ret = invoke(func);
+		if (!ret.valid())
+		{
+			sol::error err = ret;
+			osd_printf_error("[LUA ERROR] in on_idle: %s\n", err.what());
+		}
+		else if (ret.get_type() == sol::type::boolean && ret.get<bool>())
+			pending = true;
+		return osd_ticks() < deadline;
+	});
+	return pending;
+}
+
 bool lua_engine::on_missing_mandatory_image(const std::string &instance_name)
 {
 	bool handled = false;
@@ -566,10 +592,11 @@ void lua_engine::attach_notifiers()
 void lua_engine::initialize()
 {
 
-	static const enum_parser<movie_recording::format, 2> s_movie_recording_format_parser =
+	static const enum_parser<movie_recording::format, 3> s_movie_recording_format_parser =
 	{
 		{ "avi", movie_recording::format::AVI },
-		{ "mng", movie_recording::format::MNG }
+		{ "mng", movie_recording::format::MNG },
+		{ "raw", movie_recording::format::RAW }
 	};
 
 
@@ -610,6 +637,7 @@ void lua_engine::initialize()
  * emu.register_frame_done(callback) - register callback after frame is drawn to screen (for overlays)
  * emu.register_sound_update(callback) - register callback after sound update has generated new samples
  * emu.register_periodic(callback) - register periodic callback while program is running
+ * emu.register_idle(callback) - register callback run in slices during throttle waits; return true for more work
  * emu.register_callback(callback, name) - register callback to be used by MAME via lua_engine::call_plugin()
  * emu.register_menu(event_callback, populate_callback, name) - register callbacks for plugin menu
  * emu.register_mandatory_file_manager_override(callback) - register callback invoked to override mandatory file manager
@@ -663,6 +691,7 @@ void lua_engine::initialize()
 	emu["register_frame_done"] = [this] (sol::function func) { register_function(func, "LUA_ON_FRAME_DONE"); };
 	emu["register_sound_update"] = [this] (sol::function func) { register_function(func, "LUA_ON_SOUND_UPDATE"); };
 	emu["register_periodic"] = [this] (sol::function func) { register_function(func, "LUA_ON_PERIODIC"); };
+	emu["register_idle"] = [this] (sol::function func) { register_function(func, "LUA_ON_IDLE"); };
 	emu["register_mandatory_file_manager_override"] = [this] (sol::function func) { register_function(func, "LUA_ON_MANDATORY_FILE_MANAGER_OVERRIDE"); };
 	emu["register_before_load_settings"] = [this](sol::function func) { register_function(func, "LUA_ON_BEFORE_LOAD_SETTINGS"); };
 	emu["register_menu"] =
@@ -1403,6 +1432,36 @@ void lua_engine::initialize()
 				}
 				return table;
 			});
+	device_type["execution_profiling"] = sol::property(
+			[] (device_t &dev)
+			{
+				device_execute_interface *exec;
+				return dev.interface(exec) && exec->cost_accounting();
+			},
+			[] (device_t &dev, bool enable)
+			{
+				device_execute_interface *exec;
+				if (dev.interface(exec))
+					exec->set_cost_accounting(enable);
+			});
+	device_type["execution_cost"] = sol::property(
+			[] (device_t &dev, sol::this_state s) -> sol::object
+			{
+				device_execute_interface *exec;
+				if (!dev.interface(exec))
+					return sol::lua_nil;
+				return sol::make_object(s, exec->run_cost_per_second());
+			});
+	device_type["execution_cost_history"] = sol::property(
+			[this] (device_t &dev)
+			{
+				sol::table table = sol().create_table();
+				device_execute_interface *exec;
+				if (dev.interface(exec))
+					for (int index = 0; index < device_execute_interface::RUN_COST_HISTORY; index++)
+						table[index + 1] = exec->run_cost_history(index);
+				return table;
+			});
 	// FIXME: this is useless in its current form
 	device_type["roms"] = sol::property(
 			[this] (device_t &dev)
@@ -1604,6 +1663,7 @@ void lua_engine::initialize()
 	image_type["is_creatable"] = sol::property(&device_image_interface::is_creatable);
 	image_type["must_be_loaded"] = sol::property(&device_image_interface::must_be_loaded);
 	image_type["is_reset_on_load"] = sol::property(&device_image_interface::is_reset_on_load);
+	image_type["hot_mount_supported"] = sol::property(&device_image_interface::hot_mount_supported);
 	image_type["image_type_name"] = sol::property(&device_image_interface::image_type_name);
 	image_type["instance_name"] = sol::property(&device_image_interface::instance_name);
 	image_type["brief_instance_name"] = sol::property(&device_image_interface::brief_instance_name);
@@ -1924,11 +1984,34 @@ void lua_engine::run(sol::load_result res)
 }
 
 //-------------------------------------------------
-//  execute - load and execute script
+//  execute - load and execute script; compiled
+//  chunks are cached so scripts reloaded across
+//  machine restarts skip recompilation
 //-------------------------------------------------
 
 void lua_engine::load_script(const char *filename)
 {
+	auto const entry = osd_stat(filename);
+	if (entry)
+	{
+		// reuse the compiled chunk if the file is unchanged
+		script_cache_entry &cached = m_script_cache[filename];
+		if (!cached.bytecode.empty() && (cached.mtime == entry->last_modified))
+		{
+			run(sol().load_buffer(reinterpret_cast<char const *>(cached.bytecode.data()), cached.bytecode.size(), filename, sol::load_mode::binary));
+			return;
+		}
+
+		// compile it, stashing the bytecode for the next load
+		sol::load_result res = sol().load_file(filename);
+		if (res.valid())
+		{
+			cached.mtime = entry->last_modified;
+			cached.bytecode = res.get<sol::function>().dump();
+		}
+		run(std::move(res));
+		return;
+	}
 	run(sol().load_file(filename));
 }
 
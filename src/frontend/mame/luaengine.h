@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <map>
@@ -57,6 +58,7 @@ public:
 	void on_frame_done();
 	void on_sound_update();
 	void on_periodic();
+	bool on_idle(uint64_t budget);
 	bool on_missing_mandatory_image(const std::string &instance_name);
 	void on_machine_before_load_settings();
 
@@ -140,10 +142,18 @@ private:
 		bool yield;
 	};
 
+	// compiled script chunks, kept across machine restarts
+	struct script_cache_entry
+	{
+		std::chrono::system_clock::time_point mtime;
+		sol::bytecode bytecode;
+	};
+
 	// internal state
 	lua_State *m_lua_state;
 	std::unique_ptr<sol::state_view> m_sol_state;
 	running_machine *m_machine;
+	std::map<std::string, script_cache_entry> m_script_cache;
 
 	std::vector<std::string> m_menu;
 
@@ -30,6 +30,7 @@
 
 #include "osdepend.h"
 
+#include <chrono>
 #include <ctime>
 
 
@@ -73,6 +74,11 @@ mame_machine_manager::mame_machine_manager(emu_options &options,osd_interface &o
 
 mame_machine_manager::~mame_machine_manager()
 {
+	if (m_cache_warmer.joinable())
+	{
+		m_cache_warmer_abort.store(true, std::memory_order_relaxed);
+		m_cache_warmer.join();
+	}
 	m_lua.reset();
 	s_manager = nullptr;
 }
@@ -209,6 +215,74 @@ void mame_machine_manager::start_luaengine()
 }
 
 
+//-------------------------------------------------
+//  start_cache_warmer - pre-read the ROM archives
+//  and CHD headers for upcoming playlist entries
+//  in the background, so the next launch finds
+//  them in the OS file cache
+//-------------------------------------------------
+
+namespace {
+
+void prewarm_read(std::string const &path, std::vector<u8> &buffer, u64 limit, std::atomic<bool> const &abort)
+{
+	osd_file::ptr file;
+	u64 size = 0;
+	if (osd_file::open(path, OPEN_FLAG_READ, file, size))
+		return;
+
+	size = (std::min)(size, limit);
+	u64 offset = 0;
+	while ((offset < size) && !abort.load(std::memory_order_relaxed))
+	{
+		u32 actual = 0;
+		if (file->read(&buffer[0], offset, u32((std::min)(u64(buffer.size()), size - offset)), actual) || !actual)
+			break;
+		offset += actual;
+
+		// pause between chunks so the running emulation always wins the disk
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+}
+
+} // anonymous namespace
+
+void mame_machine_manager::start_cache_warmer()
+{
+	char const *const names = options().prewarm();
+	if (!names || !*names || m_cache_warmer.joinable())
+		return;
+
+	m_cache_warmer_abort.store(false, std::memory_order_relaxed);
+	m_cache_warmer = std::thread(
+			[this, roots = std::string(options().media_path()), systems = split(names, ',')] ()
+			{
+				std::vector<u8> buffer(1024 * 1024);
+				path_iterator path(roots);
+				std::string root;
+				while (path.next(root) && !m_cache_warmer_abort.load(std::memory_order_relaxed))
+				{
+					for (std::string const &system : systems)
+					{
+						// the next launch reads whole archives, so warm them end-to-end
+						prewarm_read(root + PATH_SEPARATOR + system + ".zip", buffer, ~u64(0), m_cache_warmer_abort);
+						prewarm_read(root + PATH_SEPARATOR + system + ".7z", buffer, ~u64(0), m_cache_warmer_abort);
+
+						// for loose CHDs only the header is probed at startup
+						std::string const chddir = root + PATH_SEPARATOR + system;
+						osd::directory::ptr dir = osd::directory::open(chddir);
+						if (dir)
+						{
+							for (osd::directory::entry const *entry = dir->read(); entry; entry = dir->read())
+								if ((entry->type == osd::directory::entry::entry_type::FILE) && core_filename_ends_with(entry->name, ".chd"))
+									prewarm_read(chddir + PATH_SEPARATOR + entry->name, buffer, 4096, m_cache_warmer_abort);
+						}
+					}
+				}
+			});
+}
+
+
 //-------------------------------------------------
 //  execute - run the core emulation
 //-------------------------------------------------
@@ -265,6 +339,9 @@ int mame_machine_manager::execute()
 
 		set_machine(&machine);
 
+		// begin warming the cache for upcoming playlist entries, if configured
+		start_cache_warmer();
+
 		// run the machine
 		error = machine.run(is_empty);
 		m_firstrun = false;
@@ -421,6 +498,11 @@ bool emulator_info::frame_hook()
 	return mame_machine_manager::instance()->lua()->frame_hook();
 }
 
+bool emulator_info::idle_hook(uint64_t budget)
+{
+	return mame_machine_manager::instance()->lua()->on_idle(budget);
+}
+
 void emulator_info::sound_hook()
 {
 	return mame_machine_manager::instance()->lua()->on_sound_update();
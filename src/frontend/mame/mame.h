@@ -12,6 +12,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <thread>
+
 class plugin_options;
 class osd_interface;
 
@@ -57,6 +60,7 @@ public:
 	/* execute as configured by the OPTION_SYSTEMNAME option on the specified options */
 	int execute();
 	void start_luaengine();
+	void start_cache_warmer();
 	void schedule_new_driver(const game_driver &driver);
 	mame_ui_manager& ui() const { assert(m_ui != nullptr); return *m_ui; }
 	cheat_manager &cheat() const { assert(m_cheat != nullptr); return *m_cheat; }
@@ -83,6 +87,8 @@ private:
 	std::unique_ptr<cheat_manager> m_cheat;            // internal data from cheat.cpp
 	std::unique_ptr<inifile_manager>   m_inifile;      // internal data from inifile.c for INIs
 	std::unique_ptr<favorite_manager>  m_favorite;     // internal data from inifile.c for favorites
+	std::thread             m_cache_warmer;         // background thread pre-reading upcoming playlist media
+	std::atomic<bool>       m_cache_warmer_abort;   // tells the cache warmer to stop early
 
 };
 
@@ -340,8 +340,43 @@ void media_identifier::match_hashes(std::vector<file_info> &info)
 	if (info.empty())
 		return;
 
+	// build an inverted index of the collected files by CRC so each known
+	// dump is checked only against candidate files instead of every file;
+	// files without a CRC (e.g. CHDs) can still match on SHA-1 and must be
+	// offered every dump
+	std::unordered_multimap<u32, file_info *> crc_index;
+	std::vector<file_info *> nocrc;
+	for (file_info &file : info)
+	{
+		u32 crc;
+		if (file.hashes().crc(crc))
+			crc_index.emplace(crc, &file);
+		else
+			nocrc.push_back(&file);
+	}
+
+	auto const match_candidates =
+			[&info, &crc_index, &nocrc] (util::hash_collection const &romhashes, auto const &apply)
+			{
+				u32 crc;
+				if (romhashes.crc(crc))
+				{
+					auto const range = crc_index.equal_range(crc);
+					for (auto it = range.first; it != range.second; ++it)
+						apply(*it->second);
+					for (file_info *file : nocrc)
+						apply(*file);
+				}
+				else
+				{
+					// no CRC on the dump, fall back to checking everything
+					for (file_info &file : info)
+						apply(file);
+				}
+			};
+
 	auto match_device =
-			[&info, listnames = std::unordered_set<std::string>()] (device_t &device) mutable
+			[&match_candidates, listnames = std::unordered_set<std::string>()] (device_t &device) mutable
 			{
 				// iterate over regions and files within the region
 				for (romload::region const &region : romload::entries(device.rom_region()).get_regions())
@@ -351,8 +386,9 @@ void media_identifier::match_hashes(std::vector<file_info> &info)
 						util::hash_collection const romhashes(rom.get_hashdata());
 						if (!romhashes.flag(util::hash_collection::FLAG_NO_DUMP))
 						{
-							for (file_info &file : info)
-								file.match(device, rom, romhashes);
+							match_candidates(
+									romhashes,
+									[&device, &rom, &romhashes] (file_info &file) { file.match(device, rom, romhashes); });
 						}
 					}
 				}
@@ -374,8 +410,9 @@ void media_identifier::match_hashes(std::vector<file_info> &info)
 									util::hash_collection romhashes(rom->hashdata());
 									if (!romhashes.flag(util::hash_collection::FLAG_NO_DUMP))
 									{
-										for (file_info &file : info)
-											file.match(swlistdev.list_name(), swinfo, *rom, romhashes);
+										match_candidates(
+												romhashes,
+												[&swlistdev, &swinfo, rom, &romhashes] (file_info &file) { file.match(swlistdev.list_name(), swinfo, *rom, romhashes); });
 									}
 								}
 							}
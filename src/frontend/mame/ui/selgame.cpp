@@ -56,6 +56,7 @@ menu_select_game::menu_select_game(mame_ui_manager &mui, render_container &conta
 	, m_icons(MAX_ICONS_RENDER)
 	, m_icon_paths()
 	, m_displaylist()
+	, m_icon_stop(false)
 	, m_searchlist()
 	, m_searched_fields(system_list::AVAIL_NONE)
 	, m_populated_favorites(false)
@@ -121,6 +122,17 @@ menu_select_game::menu_select_game(mame_ui_manager &mui, render_container &conta
 
 menu_select_game::~menu_select_game()
 {
+	// shut down the icon loader thread if it was ever started
+	if (m_icon_thread)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_icon_mutex);
+			m_icon_stop = true;
+		}
+		m_icon_condition.notify_one();
+		m_icon_thread->join();
+	}
+
 	std::string error_string, last_driver;
 	ui_system_info const *system;
 	ui_software_info const *swinfo;
@@ -828,10 +840,17 @@ void menu_select_game::populate_search()
 	if (m_persistent_data.is_available(system_list::AVAIL_UCS_MANUF_DFLT_DESC))
 		m_searched_fields |= system_list::AVAIL_UCS_MANUF_DFLT_DESC;
 
+	// use the trigram index to skip scoring systems that can't plausibly match -
+	// they keep the worst possible penalty and sort to the end of the list
+	std::vector<bool> candidates;
+	bool const filtered(m_persistent_data.trigram_candidates(ucs_search, candidates));
+
 	for (std::pair<double, std::reference_wrapper<ui_system_info const> > &info : m_searchlist)
 	{
 		info.first = 1.0;
 		ui_system_info const &sys(info.second);
+		if (filtered && !candidates[sys.index])
+			continue;
 
 		// match shortnames
 		if (m_searched_fields & system_list::AVAIL_UCS_SHORTNAME)
@@ -874,6 +893,38 @@ void menu_select_game::populate_search()
 }
 
 
+//-------------------------------------------------
+//  load and decode an icon file - called on the
+//  worker thread, must not touch render objects
+//-------------------------------------------------
+
+bitmap_argb32 menu_select_game::load_icon_bitmap(game_driver const &driver) const
+{
+	// set clone status
+	bool cloneof = strcmp(driver.parent, "0");
+	if (cloneof)
+	{
+		auto cx = driver_list::find(driver.parent);
+		if ((cx >= 0) && (driver_list::driver(cx).flags & machine_flags::IS_BIOS_ROOT))
+			cloneof = false;
+	}
+
+	bitmap_argb32 tmp;
+	emu_file snapfile(std::string(m_icon_paths), OPEN_FLAG_READ);
+	if (!snapfile.open(std::string(driver.name) + ".ico"))
+	{
+		render_load_ico_highest_detail(snapfile, tmp);
+		snapfile.close();
+	}
+	if (!tmp.valid() && cloneof && !snapfile.open(std::string(driver.parent) + ".ico"))
+	{
+		render_load_ico_highest_detail(snapfile, tmp);
+		snapfile.close();
+	}
+	return tmp;
+}
+
+
 //-------------------------------------------------
 //  get (possibly cached) icon texture
 //-------------------------------------------------
@@ -886,46 +937,73 @@ render_texture *menu_select_game::get_icon_texture(int linenum, void *selectedre
 	assert(driver);
 
 	icon_cache::iterator icon(m_icons.find(driver));
-	if ((m_icons.end() == icon) || !icon->second.texture)
-	{
-		if (m_icon_paths.empty())
-			m_icon_paths = make_icon_paths(nullptr);
+	if ((m_icons.end() != icon) && icon->second.texture)
+		return icon->second.bitmap.valid() ? icon->second.texture.get() : nullptr;
 
-		// allocate an entry or allocate a texture on forced redraw
-		if (m_icons.end() == icon)
-		{
-			icon = m_icons.emplace(driver, texture_ptr(machine().render().texture_alloc(), machine().render())).first;
-		}
-		else
-		{
-			assert(!icon->second.texture);
-			icon->second.texture.reset(machine().render().texture_alloc());
-		}
+	if (m_icon_paths.empty())
+		m_icon_paths = make_icon_paths(nullptr);
 
-		// set clone status
-		bool cloneof = strcmp(driver->parent, "0");
-		if (cloneof)
+	// collect a finished decode or hand the driver to the worker thread
+	bitmap_argb32 tmp;
+	bool decoded = false;
+	{
+		std::lock_guard<std::mutex> lock(m_icon_mutex);
+		auto const result(m_icon_results.find(driver));
+		if (m_icon_results.end() != result)
 		{
-			auto cx = driver_list::find(driver->parent);
-			if ((cx >= 0) && (driver_list::driver(cx).flags & machine_flags::IS_BIOS_ROOT))
-				cloneof = false;
+			tmp = std::move(result->second);
+			m_icon_results.erase(result);
+			m_icon_pending.erase(driver);
+			decoded = true;
 		}
-
-		bitmap_argb32 tmp;
-		emu_file snapfile(std::string(m_icon_paths), OPEN_FLAG_READ);
-		if (!snapfile.open(std::string(driver->name) + ".ico"))
+		else if (m_icon_pending.insert(driver).second)
 		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
+			m_icon_requests.push_back(driver);
 		}
-		if (!tmp.valid() && cloneof && !snapfile.open(std::string(driver->parent) + ".ico"))
+	}
+	if (!decoded)
+	{
+		// start the worker on demand and let the icon pop in when it's ready
+		if (!m_icon_thread)
 		{
-			render_load_ico_highest_detail(snapfile, tmp);
-			snapfile.close();
+			m_icon_thread = std::make_unique<std::thread>(
+					[this] ()
+					{
+						while (true)
+						{
+							game_driver const *request;
+							{
+								std::unique_lock<std::mutex> lock(m_icon_mutex);
+								m_icon_condition.wait(lock, [this] () { return m_icon_stop || !m_icon_requests.empty(); });
+								if (m_icon_stop)
+									return;
+								request = m_icon_requests.front();
+								m_icon_requests.pop_front();
+							}
+							bitmap_argb32 bitmap(load_icon_bitmap(*request));
+							{
+								std::lock_guard<std::mutex> lock(m_icon_mutex);
+								m_icon_results.emplace(request, std::move(bitmap));
+							}
+						}
+					});
 		}
+		m_icon_condition.notify_one();
+		return nullptr;
+	}
 
-		scale_icon(std::move(tmp), icon->second);
+	// allocate an entry or allocate a texture on forced redraw
+	if (m_icons.end() == icon)
+	{
+		icon = m_icons.emplace(driver, texture_ptr(machine().render().texture_alloc(), machine().render())).first;
 	}
+	else
+	{
+		assert(!icon->second.texture);
+		icon->second.texture.reset(machine().render().texture_alloc());
+	}
+
+	scale_icon(std::move(tmp), icon->second);
 
 	return icon->second.bitmap.valid() ? icon->second.texture.get() : nullptr;
 }
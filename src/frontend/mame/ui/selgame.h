@@ -15,7 +15,14 @@
 #include "ui/selmenu.h"
 #include "ui/utils.h"
 
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 
 
 namespace ui {
@@ -49,6 +56,15 @@ private:
 	std::string m_icon_paths;
 	std::vector<std::reference_wrapper<ui_system_info const> > m_displaylist;
 
+	// icons are decoded on a worker thread so scrolling doesn't stall on file I/O
+	std::mutex m_icon_mutex;
+	std::condition_variable m_icon_condition;
+	std::deque<game_driver const *> m_icon_requests;
+	std::set<game_driver const *> m_icon_pending;
+	std::map<game_driver const *, bitmap_argb32> m_icon_results;
+	bool m_icon_stop;
+	std::unique_ptr<std::thread> m_icon_thread;
+
 	std::vector<std::pair<double, std::reference_wrapper<ui_system_info const> > > m_searchlist;
 	unsigned m_searched_fields;
 	bool m_populated_favorites;
@@ -77,6 +93,8 @@ private:
 	virtual void inkey_export() override;
 
 	// internal methods
+	bitmap_argb32 load_icon_bitmap(game_driver const &driver) const;
+
 	void change_info_pane(int delta);
 
 	void build_available_list();
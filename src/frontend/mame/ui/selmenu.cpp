@@ -155,6 +155,72 @@ void load_driver_image(bitmap_argb32 &bitmap, emu_file &file, game_driver const
 	}
 }
 
+
+// persistent sidecar of aggregated system flags - computing these means
+// instantiating an entire machine configuration, which is slow enough to be
+// noticeable when it happens for thousands of systems while scrolling or
+// filtering the full list; entries are tied to the build version since
+// device features change between builds
+struct sysflags_cache
+{
+	struct entry
+	{
+		uint32_t    flags;          // machine_flags::type
+		uint32_t    unemulated;     // device_t::feature_type
+		uint32_t    imperfect;      // device_t::feature_type
+		uint32_t    color;          // status colour as ARGB
+		int         keyboard;
+		int         analog;
+	};
+
+	static constexpr char const *FILENAME = "sysflags.cache";
+
+	bool loaded = false;
+	bool dirty = false;
+	std::unordered_map<std::string, entry> entries;
+
+	void load(ui_options &options)
+	{
+		if (loaded)
+			return;
+		loaded = true;
+
+		emu_file file(options.ui_path(), OPEN_FLAG_READ);
+		if (file.open(FILENAME))
+			return;
+
+		// the first line must match the current build
+		char buffer[256];
+		if (!file.gets(buffer, std::size(buffer)) || (strtrimspace(buffer) != emulator_info::get_build_version()))
+			return;
+
+		while (file.gets(buffer, std::size(buffer)))
+		{
+			char name[128];
+			entry e;
+			if (sscanf(buffer, "%127s %x %x %x %x %d %d", name, &e.flags, &e.unemulated, &e.imperfect, &e.color, &e.keyboard, &e.analog) == 7)
+				entries.emplace(name, e);
+		}
+	}
+
+	void save(ui_options &options)
+	{
+		if (!dirty)
+			return;
+
+		emu_file file(options.ui_path(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (file.open(FILENAME))
+			return;
+
+		file.printf("%s\n", emulator_info::get_build_version());
+		for (auto const &e : entries)
+			file.printf("%s %x %x %x %x %d %d\n", e.first, e.second.flags, e.second.unemulated, e.second.imperfect, e.second.color, e.second.keyboard, e.second.analog);
+		dirty = false;
+	}
+};
+
+sysflags_cache f_sysflags_cache;
+
 } // anonymous namespace
 
 constexpr std::size_t menu_select_launch::MAX_VISIBLE_SEARCH; // stupid non-inline semantics
@@ -221,6 +287,23 @@ menu_select_launch::system_flags::system_flags(machine_static_info const &info)
 }
 
 
+menu_select_launch::system_flags::system_flags(
+		::machine_flags::type flags,
+		device_t::feature_type unemulated,
+		device_t::feature_type imperfect,
+		bool keyboard,
+		bool analog,
+		rgb_t color)
+	: m_machine_flags(flags)
+	, m_unemulated_features(unemulated)
+	, m_imperfect_features(imperfect)
+	, m_has_keyboard(keyboard)
+	, m_has_analog(analog)
+	, m_status_color(color)
+{
+}
+
+
 void menu_select_launch::reselect_last::reset()
 {
 	s_driver.clear();
@@ -510,6 +593,8 @@ void menu_select_launch::cache::cache_toolbar(running_machine &machine, float wi
 
 menu_select_launch::~menu_select_launch()
 {
+	// write back any newly-computed system flags
+	f_sysflags_cache.save(ui().options());
 }
 
 
@@ -591,15 +676,44 @@ void menu_select_launch::set_error(reset_options ropt, std::string &&message)
 
 menu_select_launch::system_flags const &menu_select_launch::get_system_flags(game_driver const &driver)
 {
-	// try the cache
+	// try the session cache
 	flags_cache::const_iterator const found(m_flags.find(&driver));
 	if (m_flags.end() != found)
 		return found->second;
 
-	// aggregate flags
+	// then the persistent sidecar, which saves instantiating a machine
+	// configuration just to answer status queries
+	f_sysflags_cache.load(ui().options());
+	auto const cached(f_sysflags_cache.entries.find(driver.name));
+	if (f_sysflags_cache.entries.end() != cached)
+	{
+		sysflags_cache::entry const &e(cached->second);
+		return m_flags.emplace(
+				&driver,
+				system_flags(
+					::machine_flags::type(e.flags),
+					device_t::feature_type(e.unemulated),
+					device_t::feature_type(e.imperfect),
+					e.keyboard != 0,
+					e.analog != 0,
+					rgb_t(e.color))).first->second;
+	}
+
+	// aggregate flags and remember the result
 	emu_options clean_options;
 	machine_config const mconfig(driver, clean_options);
-	return m_flags.emplace(&driver, machine_static_info(ui().options(), mconfig)).first->second;
+	machine_static_info const info(ui().options(), mconfig);
+	f_sysflags_cache.entries.emplace(
+			driver.name,
+			sysflags_cache::entry{
+				uint32_t(info.machine_flags()),
+				uint32_t(info.unemulated_features()),
+				uint32_t(info.imperfect_features()),
+				uint32_t(info.status_color()),
+				info.has_keyboard() ? 1 : 0,
+				info.has_analog() ? 1 : 0 });
+	f_sysflags_cache.dirty = true;
+	return m_flags.emplace(&driver, system_flags(info)).first->second;
 }
 
 
@@ -69,6 +69,13 @@ protected:
 	{
 	public:
 		system_flags(machine_static_info const &info);
+		system_flags(
+				::machine_flags::type flags,
+				device_t::feature_type unemulated,
+				device_t::feature_type imperfect,
+				bool keyboard,
+				bool analog,
+				rgb_t color);
 		system_flags(system_flags const &) = default;
 		system_flags(system_flags &&) = default;
 		system_flags &operator=(system_flags const &) = default;
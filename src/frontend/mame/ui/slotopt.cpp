@@ -104,6 +104,9 @@ void menu_slot_devices::set_slot_device(device_slot_interface &slot, std::string
 	while (try_refresh_current_options())
 		;
 
+	// the cached machine configuration no longer reflects the options
+	m_config.reset();
+
 	// changing the options may result in options changing; we need to reset
 	reset(reset_options::REMEMBER_POSITION);
 }
@@ -172,9 +175,12 @@ bool menu_slot_devices::try_refresh_current_options()
 
 void menu_slot_devices::populate(float &customtop, float &custombottom)
 {
-	// we need to keep our own copy of the machine_config because we
-	// can change this out from under the caller
-	m_config = std::make_unique<machine_config>(machine().system(), machine().options());
+	// we need to keep our own copy of the machine_config because we can
+	// change this out from under the caller; constructing it instantiates
+	// every device in the system (seconds on bus-rich machines), so it is
+	// only rebuilt after a slot option has actually been changed
+	if (!m_config)
+		m_config = std::make_unique<machine_config>(machine().system(), machine().options());
 
 	// cycle through all devices for this system
 	for (device_slot_interface &slot : slot_interface_enumerator(m_config->root_device()))
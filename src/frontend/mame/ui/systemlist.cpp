@@ -58,6 +58,44 @@ void system_list::reset_cache()
 	m_sorted_list.clear();
 	m_filter_data = machine_filter_data();
 	m_bios_count = 0;
+	m_trigram_index.clear();
+}
+
+
+bool system_list::trigram_candidates(std::u32string const &search, std::vector<bool> &candidates)
+{
+	// degrade to an unfiltered scan rather than stalling on the caching thread
+	if (!is_available(AVAIL_TRIGRAM_INDEX))
+		return false;
+
+	std::vector<uint64_t> keys;
+	add_trigrams(search, keys);
+	std::sort(keys.begin(), keys.end());
+	keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+	if (keys.empty())
+		return false;
+
+	// tolerate roughly one edit - a single substitution destroys up to three trigrams
+	std::size_t const needed((keys.size() > 4) ? (keys.size() - 3) : 1);
+
+	std::vector<uint16_t> counts(driver_list::total(), 0);
+	for (uint64_t const key : keys)
+	{
+		auto const found(m_trigram_index.find(key));
+		if (m_trigram_index.end() != found)
+		{
+			for (uint32_t const pos : found->second)
+				++counts[pos];
+		}
+	}
+
+	candidates.assign(driver_list::total(), false);
+	for (std::size_t i = 0; counts.size() > i; ++i)
+	{
+		if (counts[i] >= needed)
+			candidates[i] = true;
+	}
+	return true;
 }
 
 
@@ -255,6 +293,43 @@ void system_list::do_cache_data(std::string const &datpath, std::string const &t
 		}
 	}
 	notify_available(AVAIL_UCS_MANUF_DFLT_DESC);
+
+	// build the trigram index once all searchable strings are final
+	build_trigram_index();
+	notify_available(AVAIL_TRIGRAM_INDEX);
+}
+
+
+void system_list::build_trigram_index()
+{
+	// trigrams of "<manufacturer> <description>" cover the description alone,
+	// so only the composite strings and the shortname need to be indexed
+	std::vector<uint64_t> keys;
+	for (ui_system_info const &info : m_sorted_list)
+	{
+		keys.clear();
+		add_trigrams(info.ucs_shortname, keys);
+		add_trigrams(info.ucs_manufacturer_description, keys);
+		add_trigrams(info.ucs_manufacturer_reading_description, keys);
+		add_trigrams(info.ucs_manufacturer_default_description, keys);
+		std::sort(keys.begin(), keys.end());
+		keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+		for (uint64_t const key : keys)
+			m_trigram_index[key].emplace_back(uint32_t(info.index));
+	}
+}
+
+
+void system_list::add_trigrams(std::u32string const &str, std::vector<uint64_t> &keys)
+{
+	// pack three characters into a key - 21 bits covers the Unicode range
+	for (std::size_t i = 0; (str.length() >= 3) && ((str.length() - 2) > i); ++i)
+	{
+		keys.emplace_back(
+				(uint64_t(str[i] & 0x1fffff) << 42) |
+				(uint64_t(str[i + 1] & 0x1fffff) << 21) |
+				uint64_t(str[i + 2] & 0x1fffff));
+	}
 }
 
 
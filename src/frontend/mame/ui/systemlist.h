@@ -16,11 +16,13 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 
@@ -43,7 +45,8 @@ public:
 		AVAIL_UCS_MANUF_DESC        = 1U << 5,
 		AVAIL_UCS_DFLT_DESC         = 1U << 6,
 		AVAIL_UCS_MANUF_DFLT_DESC   = 1U << 7,
-		AVAIL_FILTER_DATA           = 1U << 8
+		AVAIL_FILTER_DATA           = 1U << 8,
+		AVAIL_TRIGRAM_INDEX         = 1U << 9
 	};
 
 	using system_vector = std::vector<ui_system_info>;
@@ -91,6 +94,11 @@ public:
 		return m_filter_data;
 	}
 
+	// sets flags indexed by driver list position for systems sharing enough
+	// trigrams with the search string to be plausible fuzzy matches; returns
+	// false when the query is too short to filter or the index isn't built yet
+	bool trigram_candidates(std::u32string const &search, std::vector<bool> &candidates);
+
 	static system_list &instance();
 
 private:
@@ -102,6 +110,9 @@ private:
 	void populate_list(bool copydesc);
 	void load_titles(util::core_file &file);
 	void populate_parents();
+	void build_trigram_index();
+
+	static void add_trigrams(std::u32string const &str, std::vector<uint64_t> &keys);
 
 	// synchronisation
 	std::mutex                      m_mutex;
@@ -115,6 +126,9 @@ private:
 	system_reference_vector         m_sorted_list;
 	machine_filter_data             m_filter_data;
 	int                             m_bios_count;
+
+	// maps packed character trigrams to driver list positions for search filtering
+	std::unordered_map<uint64_t, std::vector<uint32_t> > m_trigram_index;
 };
 
 } // namespace ui
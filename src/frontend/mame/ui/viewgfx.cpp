@@ -66,6 +66,8 @@ struct ui_gfx_state
 	bool            bitmap_dirty;   // is the bitmap dirty?
 	bitmap_rgb32    bitmap;         // bitmap for drawing gfx and tilemaps
 	render_texture *texture;        // texture for rendering the above bitmap
+	uint32_t        gfx_dirtyseq;   // gfx element dirty sequence at the last gfx set redraw
+	std::unique_ptr<palette_client> palclient; // tracks palette changes for the gfx set viewer
 
 	// palette-specific data
 	struct
@@ -160,6 +162,8 @@ void ui_gfx_init(running_machine &machine)
 	state.bitmap_dirty = false;
 	state.bitmap.reset();
 	state.texture = nullptr;
+	state.gfx_dirtyseq = 0;
+	state.palclient.reset();
 	state.gfxset.devcount = 0;
 	state.gfxset.devindex = 0;
 	state.gfxset.set = 0;
@@ -263,6 +267,9 @@ static void ui_gfx_exit(running_machine &machine)
 
 	// free the bitmap
 	ui_gfx.bitmap.reset();
+
+	// release the palette dirty client before the palette goes away
+	ui_gfx.palclient.reset();
 }
 
 
@@ -300,8 +307,10 @@ uint32_t ui_gfx_ui_handler(render_container &container, mame_ui_manager &mui, bo
 	if (!ui_gfx_is_relevant(mui.machine()))
 		goto cancel;
 
-	// if we're not paused, mark the bitmap dirty
-	if (!mui.machine().paused())
+	// if we're not paused, mark the bitmap dirty; the gfx set viewer
+	// tracks element and palette dirty state itself so its decoded page
+	// is not redrawn every frame while browsing large sets
+	if (!mui.machine().paused() && state.mode != UI_GFX_GFXSET)
 		state.bitmap_dirty = true;
 
 	// switch off the state to display something
@@ -934,6 +943,26 @@ static void gfxset_update_bitmap(running_machine &machine, ui_gfx_state &state,
 		state.bitmap_dirty = true;
 	}
 
+	// follow the palette of the current set so we notice entries changing
+	palette_t *palette = info.palette[set]->palette();
+	if (!state.palclient || &state.palclient->palette() != palette)
+	{
+		state.palclient = std::make_unique<palette_client>(*palette);
+		state.bitmap_dirty = true;
+	}
+
+	// pick up changes to the underlying elements or to the displayed
+	// palette entries; otherwise the previously decoded page is reused
+	if (!state.bitmap_dirty && gfx.dirtyseq() != state.gfx_dirtyseq)
+		state.bitmap_dirty = true;
+	uint32_t mindirty, maxdirty;
+	if (state.palclient->dirty_list(mindirty, maxdirty))
+	{
+		const uint32_t colorbase = gfx.colorbase() + info.color[set] * gfx.granularity();
+		if (mindirty < colorbase + gfx.granularity() && maxdirty >= colorbase)
+			state.bitmap_dirty = true;
+	}
+
 	// handle the redraw
 	if (state.bitmap_dirty)
 	{
@@ -965,6 +994,7 @@ static void gfxset_update_bitmap(running_machine &machine, ui_gfx_state &state,
 
 		// reset the texture to force an update
 		state.texture->set_bitmap(state.bitmap, state.bitmap.cliprect(), TEXFORMAT_ARGB32);
+		state.gfx_dirtyseq = gfx.dirtyseq();
 		state.bitmap_dirty = false;
 	}
 }
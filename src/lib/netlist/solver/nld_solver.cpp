@@ -71,9 +71,10 @@ namespace devices
 			m_queue.pop();
 		}
 
-		// FIXME: Disabled for now since parallel processing will decrease performance
-		//        for tested applications. More testing required here
-		if (true || nthreads < 2)
+		// Parallel processing is opt-in via the PARALLEL parameter.  Even then
+		// it only pays off when enough independent groups are due in this batch
+		// to amortise the fork/join overhead, so small batches stay serial.
+		if (nthreads < 2 || p < nthreads * 2)
 		{
 			if (!KEEP_STATS)
 			{
@@ -101,11 +102,26 @@ namespace devices
 		}
 		else
 		{
+			if (KEEP_STATS)
+				stats()->m_stat_total_time.stop();
 			plib::omp::set_num_threads(nthreads);
+			// each group is handled by exactly one thread, so the per-solver
+			// statistics can be updated without synchronisation
 			plib::omp::for_static(static_cast<std::size_t>(0), p, [&tmp, &nt,now](std::size_t i)
 				{
-					nt[i] = tmp[i]->solve(now, "parallel");
+					if (KEEP_STATS)
+					{
+						tmp[i]->stats()->m_stat_call_count.inc();
+						auto g(tmp[i]->stats()->m_stat_total_time.guard());
+						nt[i] = tmp[i]->solve(now, "parallel");
+					}
+					else
+						nt[i] = tmp[i]->solve(now, "parallel");
 				});
+			if (KEEP_STATS)
+				stats()->m_stat_total_time.start();
+			// the implicit join above is the fence at the coupling points;
+			// rescheduling and input propagation happen on the main thread only
 			for (std::size_t i = 0; i < p; i++)
 			{
 				if (nt[i] != netlist_time::zero())
@@ -0,0 +1,137 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    arena.h
+
+    Chunked bump allocator for objects that share a common lifetime.
+
+***************************************************************************/
+
+#ifndef MAME_LIB_UTIL_ARENA_H
+#define MAME_LIB_UTIL_ARENA_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace util {
+
+// ======================> arena
+
+/// \brief Bump allocator for objects sharing a common lifetime
+///
+/// Carves small allocations out of large chunks and releases all of
+/// them at once when destroyed or released, running any registered
+/// destructors in reverse order of construction.  Individual objects
+/// cannot be freed early, so this is only suitable for objects whose
+/// lifetime matches the arena itself (e.g. machine-lifetime bookkeeping
+/// allocated in bulk during startup).
+class arena
+{
+public:
+	arena(std::size_t chunk_size = 0x10000) : m_chunk_size(chunk_size) { }
+	arena(const arena &) = delete;
+	arena &operator=(const arena &) = delete;
+	~arena() { release(); }
+
+	/// \brief Allocate raw storage
+	///
+	/// Returns uninitialised storage of the requested size and
+	/// alignment.  The storage is freed when the arena is released.
+	void *alloc(std::size_t size, std::size_t align = alignof(std::max_align_t))
+	{
+		// oversized requests get a dedicated chunk; the current bump chunk stays active
+		if (size > (m_chunk_size / 2))
+		{
+			m_chunks.emplace_back(new unsigned char [size + align]);
+			uintptr_t addr = (reinterpret_cast<uintptr_t>(m_chunks.back().get()) + (align - 1)) & ~uintptr_t(align - 1);
+			return reinterpret_cast<void *>(addr);
+		}
+
+		// align the bump offset, starting a fresh chunk if this one is exhausted
+		std::size_t offset = (m_offset + (align - 1)) & ~(align - 1);
+		if (m_current == nullptr || (offset + size) > m_chunk_size)
+		{
+			m_chunks.emplace_back(new unsigned char [m_chunk_size]);
+			m_current = m_chunks.back().get();
+			offset = 0;
+		}
+		void *result = m_current + offset;
+		m_offset = offset + size;
+		return result;
+	}
+
+	/// \brief Construct an object in the arena
+	///
+	/// Allocates storage for a \p T and constructs it with the given
+	/// arguments.  If \p T is not trivially destructible, its
+	/// destructor is run when the arena is released.
+	template <typename T, typename... Params>
+	T *make(Params &&... args)
+	{
+		T *result = new (alloc(sizeof(T), alignof(T))) T(std::forward<Params>(args)...);
+		if (!std::is_trivially_destructible<T>::value)
+		{
+			finalizer *fin = static_cast<finalizer *>(alloc(sizeof(finalizer), alignof(finalizer)));
+			fin->destroy = [] (void *object) { static_cast<T *>(object)->~T(); };
+			fin->object = result;
+			fin->next = m_finalizers;
+			m_finalizers = fin;
+		}
+		return result;
+	}
+
+	/// \brief Copy a string into the arena
+	///
+	/// Returns a NUL-terminated copy of \p str allocated from the
+	/// arena, freed along with everything else when the arena is
+	/// released.
+	const char *intern(std::string_view str)
+	{
+		char *result = static_cast<char *>(alloc(str.length() + 1, 1));
+		std::memcpy(result, str.data(), str.length());
+		result[str.length()] = 0;
+		return result;
+	}
+
+	/// \brief Destroy all objects and free all storage
+	void release()
+	{
+		// run destructors in reverse order of construction, then drop the memory
+		for (finalizer *fin = m_finalizers; fin != nullptr; fin = fin->next)
+			(*fin->destroy)(fin->object);
+		m_finalizers = nullptr;
+		m_chunks.clear();
+		m_current = nullptr;
+		m_offset = 0;
+	}
+
+private:
+	// record of a non-trivial destructor to run at release time
+	struct finalizer
+	{
+		void (*destroy)(void *object);
+		void *object;
+		finalizer *next;
+	};
+
+	std::size_t         m_chunk_size;           // size of each bump chunk
+	std::vector<std::unique_ptr<unsigned char []>> m_chunks; // all allocated chunks
+	unsigned char *     m_current = nullptr;    // current bump chunk
+	std::size_t         m_offset = 0;           // bump offset within the current chunk
+	finalizer *         m_finalizers = nullptr; // destructors to run at release, newest first
+};
+
+} // namespace util
+
+#endif // MAME_LIB_UTIL_ARENA_H
@@ -847,6 +847,85 @@ avhuff_error avhuff_decoder::decode_data(const uint8_t *source, uint32_t complen
 	return AVHERR_NONE;
 }
 
+/**
+ * @fn  avhuff_error avhuff_decoder::unpack_data(const uint8_t *source, uint32_t sourcelength)
+ *
+ * @brief   -------------------------------------------------
+ *            unpack_data - copy an already-decoded raw A/V
+ *            stream into the configured outputs
+ *          -------------------------------------------------.
+ *
+ * @param   source          Source for the.
+ * @param   sourcelength    The sourcelength.
+ *
+ * @return  An avhuff_error.
+ */
+
+avhuff_error avhuff_decoder::unpack_data(const uint8_t *source, uint32_t sourcelength)
+{
+	// extract and validate the raw stream header
+	if (sourcelength < 12 || source[0] != 'c' || source[1] != 'h' || source[2] != 'a' || source[3] != 'v')
+		return AVHERR_INVALID_DATA;
+	uint32_t metasize = source[4];
+	uint32_t channels = source[5];
+	uint32_t samples = (source[6] << 8) + source[7];
+	uint32_t width = (source[8] << 8) + source[9];
+	uint32_t height = (source[10] << 8) + source[11];
+	if (uint64_t(sourcelength) < 12 + uint64_t(metasize) + uint64_t(channels) * samples * 2 + uint64_t(width) * height * 2)
+		return AVHERR_INVALID_DATA;
+	source += 12;
+
+	// verify against the configured sizes
+	if (m_video.valid() && (m_video.width() < width || m_video.height() < height))
+		return AVHERR_VIDEO_TOO_LARGE;
+	for (int chnum = 0; chnum < channels; chnum++)
+		if (m_config.audio[chnum] != nullptr && m_config.maxsamples < samples)
+			return AVHERR_AUDIO_TOO_LARGE;
+	if (m_config.metadata != nullptr && m_config.maxmetalength < metasize)
+		return AVHERR_METADATA_TOO_LARGE;
+
+	// set the output values
+	if (m_config.actsamples != nullptr)
+		*m_config.actsamples = samples;
+	if (m_config.actmetalength != nullptr)
+		*m_config.actmetalength = metasize;
+
+	// raw data is big-endian; the configured outputs are native-endian
+	uint16_t betest = 0;
+	*(uint8_t *)&betest = 1;
+	uint32_t const dxor = (betest == 1) ? 1 : 0;
+
+	// copy the metadata
+	if (metasize > 0)
+	{
+		if (m_config.metadata != nullptr)
+			memcpy(m_config.metadata, source, metasize);
+		source += metasize;
+	}
+
+	// copy the audio channels
+	for (int chnum = 0; chnum < channels; chnum++)
+	{
+		uint8_t *const dest = reinterpret_cast<uint8_t *>(m_config.audio[chnum]);
+		if (dest != nullptr)
+			for (uint32_t offs = 0; offs < samples * 2; offs++)
+				dest[offs ^ dxor] = source[offs];
+		source += samples * 2;
+	}
+
+	// copy the video, one row at a time
+	if (m_video.valid())
+		for (uint32_t y = 0; y < height; y++)
+		{
+			uint8_t *const dest = reinterpret_cast<uint8_t *>(&m_video.pix(y));
+			for (uint32_t offs = 0; offs < width * 2; offs++)
+				dest[offs ^ dxor] = source[offs];
+			source += width * 2;
+		}
+
+	return AVHERR_NONE;
+}
+
 /**
  * @fn  avhuff_error avhuff_decoder::decode_audio(int channels, int samples, const uint8_t *source, uint8_t **dest, uint32_t dxor, const uint8_t *sizes)
  *
@@ -143,6 +143,7 @@ public:
 
 	// encode/decode
 	avhuff_error decode_data(const uint8_t *source, uint32_t complength, uint8_t *dest);
+	avhuff_error unpack_data(const uint8_t *source, uint32_t sourcelength);
 
 private:
 	// delta-RLE Huffman decoder
@@ -15,6 +15,15 @@
 #include <new>
 
 
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+// alignment guaranteed for allocated pixel storage; keeps the base cache
+// line aligned for the benefit of vectorized blitters
+constexpr uint32_t BITMAP_ALLOCATION_ALIGN = 64;
+
+
 //**************************************************************************
 //  INLINE HELPERS
 //**************************************************************************
@@ -36,7 +45,11 @@ inline int32_t bitmap_t::compute_rowpixels(int width, int xslop)
 
 inline void bitmap_t::compute_base(int xslop, int yslop)
 {
-	m_base = m_alloc.get() + (m_rowpixels * yslop + xslop) * (m_bpp / 8);
+	// the allocation is padded so the start of pixel storage can be rounded
+	// up to the guaranteed alignment
+	uint8_t *const aligned = reinterpret_cast<uint8_t *>(
+			(uintptr_t(m_alloc.get()) + (BITMAP_ALLOCATION_ALIGN - 1)) & ~uintptr_t(BITMAP_ALLOCATION_ALIGN - 1));
+	m_base = aligned + (m_rowpixels * yslop + xslop) * (m_bpp / 8);
 }
 
 
@@ -243,12 +256,12 @@ void bitmap_t::allocate(int width, int height, int xslop, int yslop)
 	m_height = height;
 	m_cliprect.set(0, width - 1, 0, height - 1);
 
-	// allocate memory for the bitmap itself
+	// allocate memory for the bitmap itself, padded for alignment
 	m_allocbytes = m_rowpixels * (m_height + 2 * yslop) * m_bpp / 8;
-	m_alloc.reset(new uint8_t[m_allocbytes]);
+	m_alloc.reset(new uint8_t[m_allocbytes + BITMAP_ALLOCATION_ALIGN - 1]);
 
 	// clear to 0 by default
-	memset(m_alloc.get(), 0, m_allocbytes);
+	memset(m_alloc.get(), 0, m_allocbytes + BITMAP_ALLOCATION_ALIGN - 1);
 
 	// compute the base
 	compute_base(xslop, yslop);
@@ -117,6 +117,8 @@ struct cdrom_file
 	chdcd_track_input_info track_info;      /* track info */
 	/** @brief  The fhandle[ CD maximum tracks]. */
 	util::core_file::ptr fhandle[CD_MAX_TRACKS];/* file handle */
+	/** @brief  The last CHD sector read, for detecting sequential access. */
+	uint64_t            lastchdsector = ~uint64_t(0);
 };
 
 
@@ -337,6 +339,10 @@ cdrom_file *cdrom_open(chd_file *chd)
 	/* fill in the data */
 	file->chd = chd;
 
+	/* CDs are streamed sequentially most of the time - keep a few hunks of
+	   background decode ahead of the reader */
+	chd->set_readahead(4);
+
 	/* read the CD-ROM metadata */
 	std::error_condition err = cdrom_parse_metadata(chd, &file->cdtoc);
 	if (err)
@@ -491,6 +497,12 @@ std::error_condition read_partial_sector(cdrom_file *file, void *dest, uint32_t
 
 		result = file->chd->read_bytes(uint64_t(chdsector) * uint64_t(CD_FRAME_SIZE) + startoffs, dest, length);
 
+		// on sequential access, hint the readahead pipeline at the upcoming hunks
+		// so background decoding stays ahead of streaming reads
+		if (uint64_t(chdsector) == file->lastchdsector + 1)
+			file->chd->hint_readahead((uint64_t(chdsector) + 1) * CD_FRAME_SIZE / file->chd->hunk_bytes());
+		file->lastchdsector = chdsector;
+
 		// swap CDDA in the case of LE GDROMs
 		if ((file->cdtoc.flags & CD_FLAG_GDROMLE) && (file->cdtoc.tracks[tracknum].trktype == CD_TRACK_AUDIO))
 			needswap = true;
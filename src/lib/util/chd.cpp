@@ -21,6 +21,7 @@
 
 #include <zlib.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
@@ -312,6 +313,9 @@ inline uint8_t chd_file::bits_for_value(uint64_t value)
  */
 
 chd_file::chd_file()
+	: m_async_queue(nullptr)
+	, m_readahead(0)
+	, m_decoded_cache(DECODED_CACHE_HUNKS)
 {
 	// reset state
 	close();
@@ -867,12 +871,274 @@ void chd_file::close()
 	// reset caching
 	m_cache.clear();
 	m_cachehunk = ~0;
+
+	// tear down the readahead pipeline
+	if (m_async_queue != nullptr)
+	{
+		osd_work_queue_wait(m_async_queue, osd_ticks_per_second());
+		osd_work_queue_free(m_async_queue);
+		m_async_queue = nullptr;
+	}
+	m_readahead = 0;
+	m_async_pending.clear();
+	m_async_contexts.clear();
+	m_decoded_cache.clear();
+}
+
+/**
+ * @fn  void chd_file::set_readahead(uint32_t hunks)
+ *
+ * @brief   -------------------------------------------------
+ *            set_readahead - configure the background
+ *            readahead pipeline
+ *          -------------------------------------------------.
+ *
+ * @param   hunks   Number of hunks to decode ahead of each read; 0 disables
+ *                  the pipeline.
+ */
+
+void chd_file::set_readahead(uint32_t hunks)
+{
+	// flush any decodes in flight before reconfiguring
+	if (m_async_queue != nullptr)
+		osd_work_queue_wait(m_async_queue, osd_ticks_per_second());
+
+	// lazily allocate the queue the first time readahead is enabled
+	m_readahead = (std::min)(hunks, DECODED_CACHE_HUNKS);
+	if (m_readahead != 0 && m_async_queue == nullptr)
+		m_async_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+}
+
+/**
+ * @fn  void chd_file::hint_readahead(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            hint_readahead - hint that reads are about to
+ *            happen at the given hunk, queuing background
+ *            decodes of the hunks that follow it
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ */
+
+void chd_file::hint_readahead(uint32_t hunknum)
+{
+	if (m_readahead == 0 || m_async_queue == nullptr)
+		return;
+
+	// queue any hunks in the readahead range that aren't decoded or pending
+	unsigned queued = 0;
+	{
+		std::lock_guard<std::mutex> lock(m_async_lock);
+		for (uint32_t curhunk = hunknum; curhunk < hunknum + m_readahead && curhunk < m_hunkcount; curhunk++)
+			if (m_decoded_cache.find(curhunk) == m_decoded_cache.end() && std::find(m_async_pending.begin(), m_async_pending.end(), curhunk) == m_async_pending.end())
+			{
+				m_async_pending.push_back(curhunk);
+				queued++;
+			}
+	}
+
+	// kick one worker per queued hunk so decodes can proceed in parallel
+	for ( ; queued != 0; queued--)
+		osd_work_item_queue(m_async_queue, async_readahead_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+/**
+ * @fn  void *chd_file::async_readahead_static(void *param, int threadid)
+ *
+ * @brief   Static trampoline for the readahead worker.
+ */
+
+void *chd_file::async_readahead_static(void *param, int threadid)
+{
+	reinterpret_cast<chd_file *>(param)->async_readahead();
+	return nullptr;
+}
+
+/**
+ * @fn  void chd_file::async_readahead()
+ *
+ * @brief   Drain the pending list, decoding hunks into the LRU cache.
+ */
+
+void chd_file::async_readahead()
+{
+	// grab an idle decode context, or set up a fresh one for this worker
+	std::unique_ptr<async_decode_context> context;
+	{
+		std::lock_guard<std::mutex> lock(m_async_lock);
+		if (!m_async_contexts.empty())
+		{
+			context = std::move(m_async_contexts.back());
+			m_async_contexts.pop_back();
+		}
+	}
+	if (!context)
+		context.reset(new (std::nothrow) async_decode_context);
+	if (!context)
+		return;
+
+	std::vector<uint8_t> buffer(m_hunkbytes);
+	for ( ; ; )
+	{
+		// pull the next pending hunk, skipping any already decoded
+		uint32_t hunknum;
+		{
+			std::lock_guard<std::mutex> lock(m_async_lock);
+			if (m_async_pending.empty())
+				break;
+			hunknum = m_async_pending.front();
+			m_async_pending.pop_front();
+			if (m_decoded_cache.find(hunknum) != m_decoded_cache.end())
+				continue;
+		}
+
+		// decode with this worker's private codecs where possible, falling
+		// back to the shared machinery for map entries they can't handle
+		bool handled;
+		std::error_condition err = async_decode_hunk(hunknum, *context, &buffer[0], handled);
+		if (!handled)
+		{
+			std::lock_guard<std::mutex> lock(m_decode_lock);
+			err = read_hunk_internal(hunknum, &buffer[0]);
+		}
+
+		// publish the result on success; errors are left for the foreground
+		// read to rediscover and report
+		if (!err)
+		{
+			std::lock_guard<std::mutex> lock(m_async_lock);
+			m_decoded_cache[hunknum].assign(buffer.begin(), buffer.end());
+		}
+	}
+
+	// leave the context for the next worker
+	std::lock_guard<std::mutex> lock(m_async_lock);
+	m_async_contexts.emplace_back(std::move(context));
+}
+
+/**
+ * @fn  std::error_condition chd_file::async_decode_hunk(uint32_t hunknum, async_decode_context &context, uint8_t *dest, bool &handled)
+ *
+ * @brief   -------------------------------------------------
+ *            async_decode_hunk - decode a simple compressed
+ *            hunk using a worker's private codecs, with only
+ *            the file access serialized
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum             The hunknum.
+ * @param [in,out]  context     The worker's decode context.
+ * @param [in,out]  dest        Destination for the decoded hunk.
+ * @param [out]     handled     Set when this path applies; when clear the
+ *                              caller must use the shared machinery.
+ *
+ * @return  The hunk.
+ */
+
+std::error_condition chd_file::async_decode_hunk(uint32_t hunknum, async_decode_context &context, uint8_t *dest, bool &handled)
+{
+	// only plain compressed v5 map entries can be decoded independently
+	handled = false;
+	if (m_version != 5 || !compressed() || hunknum >= m_hunkcount)
+		return std::error_condition();
+	uint8_t const *const rawmap = &m_rawmap[m_mapentrybytes * hunknum];
+	if (rawmap[0] > COMPRESSION_TYPE_3)
+		return std::error_condition();
+
+	// create this worker's codec instance on first use
+	chd_decompressor::ptr &decomp = context.decompressor[rawmap[0]];
+	if (decomp == nullptr)
+		decomp = chd_codec_list::new_decompressor(m_compression[rawmap[0]], *this);
+	if (decomp == nullptr)
+		return std::error_condition();
+	handled = true;
+
+	// wrap this for clean reporting
+	try
+	{
+		uint32_t const blocklen = be_read(&rawmap[1], 3);
+		uint64_t const blockoffs = be_read(&rawmap[4], 6);
+		util::crc32_t const blockcrc = be_read(&rawmap[10], 2);
+
+		// file access still serializes with the foreground reader
+		context.compressed.resize(blocklen);
+		{
+			std::lock_guard<std::mutex> lock(m_decode_lock);
+			file_read(blockoffs, &context.compressed[0], blocklen);
+		}
+
+		decomp->decompress(&context.compressed[0], blocklen, dest, m_hunkbytes);
+		if (!decomp->lossy() && util::crc16_creator::simple(dest, m_hunkbytes) != blockcrc)
+			throw std::error_condition(error::DECOMPRESSION_ERROR);
+		if (decomp->lossy() && util::crc16_creator::simple(&context.compressed[0], blocklen) != blockcrc)
+			throw std::error_condition(error::DECOMPRESSION_ERROR);
+		return std::error_condition();
+	}
+	catch (std::error_condition const &err)
+	{
+		// just return errors
+		return err;
+	}
 }
 
 /**
  * @fn  std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
  *
  * @brief   -------------------------------------------------
+ *            read - read a single hunk from the CHD file,
+ *            serving from the readahead cache when enabled
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [in,out]  buffer  If non-null, the buffer.
+ *
+ * @return  The hunk.
+ */
+
+std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
+{
+	// bypass the cache entirely when readahead is off
+	if (m_readahead == 0 || buffer == nullptr)
+		return read_hunk_internal(hunknum, buffer);
+
+	// check the decoded cache first
+	bool hit = false;
+	{
+		std::lock_guard<std::mutex> lock(m_async_lock);
+		auto cached = m_decoded_cache.find(hunknum);
+		if (cached != m_decoded_cache.end())
+		{
+			memcpy(buffer, &cached->second[0], m_hunkbytes);
+			hit = true;
+		}
+	}
+
+	// on a miss, decode in the foreground and publish the result
+	std::error_condition err;
+	if (!hit)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_decode_lock);
+			err = read_hunk_internal(hunknum, buffer);
+		}
+		if (!err)
+		{
+			std::lock_guard<std::mutex> lock(m_async_lock);
+			auto *dest = reinterpret_cast<uint8_t *>(buffer);
+			m_decoded_cache[hunknum].assign(dest, dest + m_hunkbytes);
+		}
+	}
+
+	// keep the pipeline primed past this read
+	if (!err)
+		hint_readahead(hunknum + 1);
+	return err;
+}
+
+/**
+ * @fn  std::error_condition chd_file::read_hunk_internal(uint32_t hunknum, void *buffer)
+ *
+ * @brief   -------------------------------------------------
  *            read - read a single hunk from the CHD file
  *          -------------------------------------------------.
  *
@@ -892,7 +1158,7 @@ void chd_file::close()
  * @return  The hunk.
  */
 
-std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
+std::error_condition chd_file::read_hunk_internal(uint32_t hunknum, void *buffer)
 {
 	// wrap this for clean reporting
 	try
@@ -944,7 +1210,7 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return std::error_condition();
 
 					case V34_MAP_ENTRY_TYPE_SELF_HUNK:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_internal(blockoffs, dest);
 
 					case V34_MAP_ENTRY_TYPE_PARENT_HUNK:
 						if (m_parent_missing)
@@ -997,7 +1263,7 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return std::error_condition();
 
 					case COMPRESSION_SELF:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_internal(blockoffs, dest);
 
 					case COMPRESSION_PARENT:
 						if (m_parent_missing)
@@ -3003,12 +3269,20 @@ std::error_condition chd_file_compressor::compress_continue(double &progress, do
 		progress = double(m_write_hunk) / double(m_hunkcount);
 	ratio = (m_total_in == 0) ? 1.0 : double(m_total_out) / double(m_total_in);
 
-	// if we're waiting for work, wait
+	// if we're waiting for work, help with outstanding compression rather
+	// than blocking idle - the multi work queue reserves a worker slot for
+	// the calling thread, so this is what keeps the last core busy while
+	// the writer has nothing to flush
 	// sometimes code can get here with .m_status == WS_READY and .m_osd != nullptr, TODO find out why this happens
 	while (m_work_item[m_write_hunk % WORK_BUFFER_HUNKS].m_status != WS_READY &&
 		m_work_item[m_write_hunk % WORK_BUFFER_HUNKS].m_status != WS_COMPLETE &&
 		m_work_item[m_write_hunk % WORK_BUFFER_HUNKS].m_osd != nullptr)
-		osd_work_item_wait(m_work_item[m_write_hunk % WORK_BUFFER_HUNKS].m_osd, osd_ticks_per_second());
+	{
+		if (osd_work_queue_items(m_work_queue) != 0)
+			osd_work_queue_wait(m_work_queue, osd_ticks_per_second());
+		else
+			osd_work_item_wait(m_work_item[m_write_hunk % WORK_BUFFER_HUNKS].m_osd, osd_ticks_per_second());
+	}
 
 	return m_walking_parent ? error::WALKING_PARENT : error::COMPRESSING;
 }
@@ -15,10 +15,13 @@
 #include "chdcodec.h"
 #include "hashing.h"
 #include "ioprocs.h"
+#include "lrucache.h"
 
 #include "osdcore.h"
 
 #include <atomic>
+#include <deque>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -258,6 +261,7 @@ class chd_file
 	static constexpr uint32_t V4_HEADER_SIZE = 108;
 	static constexpr uint32_t V5_HEADER_SIZE = 124;
 	static constexpr uint32_t MAX_HEADER_SIZE = V5_HEADER_SIZE;
+	static constexpr uint32_t DECODED_CACHE_HUNKS = 64;
 
 public:
 	// error types
@@ -327,6 +331,10 @@ public:
 	// file close
 	void close();
 
+	// asynchronous readahead
+	void set_readahead(uint32_t hunks);
+	void hint_readahead(uint32_t hunknum);
+
 	// read/write
 	std::error_condition read_hunk(uint32_t hunknum, void *buffer);
 	std::error_condition write_hunk(uint32_t hunknum, const void *buffer);
@@ -367,6 +375,17 @@ private:
 	uint8_t bits_for_value(uint64_t value);
 
 	// internal helpers
+	std::error_condition read_hunk_internal(uint32_t hunknum, void *buffer);
+	// per-worker decode state so parallel readahead decodes don't contend
+	struct async_decode_context
+	{
+		chd_decompressor::ptr   decompressor[4];    // private decompression codecs
+		std::vector<uint8_t>    compressed;         // private compressed data buffer
+	};
+
+	static void *async_readahead_static(void *param, int threadid);
+	void async_readahead();
+	std::error_condition async_decode_hunk(uint32_t hunknum, async_decode_context &context, uint8_t *dest, bool &handled);
 	uint32_t guess_unitbytes();
 	void parse_v3_header(uint8_t *rawheader, util::sha1_t &parentsha1);
 	void parse_v4_header(uint8_t *rawheader, util::sha1_t &parentsha1);
@@ -421,6 +440,15 @@ private:
 	// caching
 	std::vector<uint8_t>    m_cache;            // single-hunk cache for partial reads/writes
 	uint32_t                m_cachehunk;        // which hunk is in the cache?
+
+	// asynchronous readahead
+	osd_work_queue *        m_async_queue;      // work queue for background decodes
+	uint32_t                m_readahead;        // number of hunks to decode ahead (0 = disabled)
+	std::mutex              m_decode_lock;      // serializes use of the decode machinery
+	std::mutex              m_async_lock;       // protects the decoded cache and pending list
+	std::deque<uint32_t>    m_async_pending;    // hunks queued for background decoding
+	std::vector<std::unique_ptr<async_decode_context> > m_async_contexts; // idle per-worker decode contexts
+	util::lru_cache_map<uint32_t, std::vector<uint8_t> > m_decoded_cache; // LRU cache of decoded hunks
 };
 
 
@@ -8,7 +8,122 @@
 #include <new>
 
 
-#ifdef MAME_DEBUG
+#if defined(MAME_ALLOC_TRACKING)
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+constexpr int MAX_ALLOC_SCOPES = 64;
+
+struct scope_stats
+{
+	char const *name;                   // scope name; nullptr for the untracked slot
+	std::atomic<std::uint64_t> count;   // number of allocations attributed here
+	std::atomic<std::uint64_t> bytes;   // total bytes attributed here
+};
+
+// static storage duration zero-initializes everything; slot 0 collects
+// allocations made outside any scope marker
+scope_stats s_scopes[MAX_ALLOC_SCOPES];
+std::atomic<int> s_scope_count(1);
+thread_local int t_current_scope = 0;
+
+int find_scope(char const *name) noexcept
+{
+	int const count = (std::min)(s_scope_count.load(std::memory_order_acquire), MAX_ALLOC_SCOPES);
+	for (int i = 1; i < count; i++)
+		if (!std::strcmp(s_scopes[i].name, name))
+			return i;
+	int const index = s_scope_count.fetch_add(1, std::memory_order_acq_rel);
+	if (index >= MAX_ALLOC_SCOPES)
+		return 0;
+	s_scopes[index].name = name;
+	return index;
+}
+
+inline void record_allocation(std::size_t n) noexcept
+{
+	scope_stats &stats = s_scopes[t_current_scope];
+	stats.count.fetch_add(1, std::memory_order_relaxed);
+	stats.bytes.fetch_add(n, std::memory_order_relaxed);
+}
+
+} // anonymous namespace
+
+
+namespace util {
+
+alloc_scope::alloc_scope(char const *name) noexcept : m_previous(t_current_scope)
+{
+	t_current_scope = find_scope(name);
+}
+
+alloc_scope::~alloc_scope() noexcept
+{
+	t_current_scope = m_previous;
+}
+
+void alloc_tracking_dump() noexcept
+{
+	std::fprintf(stderr, "Allocations by scope:\n");
+	int const count = (std::min)(s_scope_count.load(std::memory_order_acquire), MAX_ALLOC_SCOPES);
+	for (int i = 0; i < count; i++)
+	{
+		scope_stats const &stats = s_scopes[i];
+		std::fprintf(
+				stderr,
+				"  %-32s %12llu allocations %16llu bytes\n",
+				stats.name ? stats.name : "(untracked)",
+				static_cast<unsigned long long>(stats.count.load(std::memory_order_relaxed)),
+				static_cast<unsigned long long>(stats.bytes.load(std::memory_order_relaxed)));
+	}
+}
+
+} // namespace util
+
+
+void *operator new(std::size_t n)
+{
+	void *const result(std::malloc(n));
+	if (!result)
+		throw std::bad_alloc();
+	record_allocation(n);
+	return result;
+}
+
+void *operator new[](std::size_t n)
+{
+	void *const result(std::malloc(n));
+	if (!result)
+		throw std::bad_alloc();
+	record_allocation(n);
+	return result;
+}
+
+void operator delete(void *ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+#elif defined(MAME_DEBUG)
 
 std::uint8_t g_mame_new_prefill_byte(0xcd);
 
@@ -31,4 +146,4 @@ void operator delete(void *ptr) noexcept
 	std::free(ptr);
 }
 
-#endif // MAME_DEBUG
+#endif // defined(MAME_ALLOC_TRACKING)/defined(MAME_DEBUG)
@@ -63,4 +63,44 @@ inline typename MakeUniqClearT<Tp>::array make_unique_clear(size_t num)
 template<typename Tp, typename... Params>
 inline typename MakeUniqClearT<Tp>::invalid_type make_unique_clear(Params&&...) = delete;
 
+
+// opt-in allocation tracking (compile with -DMAME_ALLOC_TRACKING); global
+// operator new is hooked and allocations are attributed to the innermost
+// live scope marker on the current thread
+
+#if defined(MAME_ALLOC_TRACKING)
+
+namespace util {
+
+/// RAII marker attributing allocations on this thread to the named
+/// subsystem scope while it is alive; scope names must be string
+/// literals or otherwise outlive the program
+class alloc_scope
+{
+public:
+	alloc_scope(char const *name) noexcept;
+	~alloc_scope() noexcept;
+
+	alloc_scope(alloc_scope const &) = delete;
+	alloc_scope &operator=(alloc_scope const &) = delete;
+
+private:
+	int m_previous;
+};
+
+/// dump per-scope allocation counts and bytes to standard error
+void alloc_tracking_dump() noexcept;
+
+} // namespace util
+
+#define MAME_ALLOC_SCOPE(name) util::alloc_scope const mame_alloc_scope_marker(name)
+#define MAME_ALLOC_DUMP() util::alloc_tracking_dump()
+
+#else // defined(MAME_ALLOC_TRACKING)
+
+#define MAME_ALLOC_SCOPE(name) ((void)0)
+#define MAME_ALLOC_DUMP() ((void)0)
+
+#endif // defined(MAME_ALLOC_TRACKING)
+
 #endif  // MAME_LIB_UTIL_COREALLOC_H
@@ -139,6 +139,17 @@ public:
 		}
 	}
 
+	// empty buffer that grows as it is written
+	core_in_memory_file(std::uint32_t openflags) noexcept
+		: core_text_file(openflags)
+		, m_data_allocated(false)
+		, m_data(nullptr)
+		, m_offset(0)
+		, m_length(0)
+		, m_expandable(true)
+	{
+	}
+
 	~core_in_memory_file() override { purge(); }
 
 	virtual std::error_condition seek(std::int64_t offset, int whence) noexcept override;
@@ -150,8 +161,8 @@ public:
 
 	virtual std::error_condition finalize() noexcept override { return std::error_condition(); }
 	virtual std::error_condition flush() noexcept override { clear_putback(); return std::error_condition(); }
-	virtual std::error_condition write(void const *buffer, std::size_t length, std::size_t &actual) noexcept override { actual = 0; return std::errc::bad_file_descriptor; }
-	virtual std::error_condition write_at(std::uint64_t offset, void const *buffer, std::size_t length, std::size_t &actual) noexcept override { actual = 0; return std::errc::bad_file_descriptor; }
+	virtual std::error_condition write(void const *buffer, std::size_t length, std::size_t &actual) noexcept override;
+	virtual std::error_condition write_at(std::uint64_t offset, void const *buffer, std::size_t length, std::size_t &actual) noexcept override;
 
 	virtual bool eof() const override;
 
@@ -206,6 +217,8 @@ private:
 	void const *    m_data;             // file data, if RAM-based
 	std::uint64_t   m_offset;           // current file offset
 	std::uint64_t   m_length;           // total file length
+	bool            m_expandable = false;   // does the buffer grow on write?
+	std::size_t     m_capacity = 0;     // allocated size of an expandable buffer
 };
 
 
@@ -649,6 +662,52 @@ std::error_condition core_in_memory_file::read_at(std::uint64_t offset, void *bu
 }
 
 
+/*-------------------------------------------------
+    write - write to an expandable RAM-based file
+-------------------------------------------------*/
+
+std::error_condition core_in_memory_file::write(void const *buffer, std::size_t length, std::size_t &actual) noexcept
+{
+	std::error_condition const err = write_at(m_offset, buffer, length, actual);
+	m_offset += actual;
+	return err;
+}
+
+std::error_condition core_in_memory_file::write_at(std::uint64_t offset, void const *buffer, std::size_t length, std::size_t &actual) noexcept
+{
+	clear_putback();
+
+	// only buffers we own can be written
+	actual = 0U;
+	if (!m_expandable)
+		return std::errc::bad_file_descriptor;
+
+	// grow the buffer as needed
+	std::uint64_t const end = offset + length;
+	if (std::uint64_t(std::size_t(end)) != end)
+		return std::errc::file_too_large;
+	if (end > m_capacity)
+	{
+		std::size_t const newcapacity = std::max<std::size_t>(std::max<std::size_t>(m_capacity * 2, 256), std::size_t(end));
+		void *const newdata = std::realloc(const_cast<void *>(m_data), newcapacity);
+		if (!newdata)
+			return std::errc::not_enough_memory;
+		m_data_allocated = true;
+		m_data = newdata;
+		m_capacity = newcapacity;
+	}
+
+	// zero-fill any gap left by a seek past the end, then store the data
+	std::uint8_t *const base = reinterpret_cast<std::uint8_t *>(const_cast<void *>(m_data));
+	if (offset > m_length)
+		std::memset(base + m_length, 0, std::size_t(offset - m_length));
+	std::memcpy(base + offset, buffer, length);
+	actual = length;
+	m_length = (std::max)(m_length, end);
+	return std::error_condition();
+}
+
+
 /*-------------------------------------------------
     truncate - truncate a file
 -------------------------------------------------*/
@@ -988,6 +1047,27 @@ std::error_condition core_file::open_ram_copy(void const *data, std::size_t leng
 }
 
 
+/*-------------------------------------------------
+    open_ram_write - open an empty, growable
+    RAM-based buffer for write access and return
+    an error code
+-------------------------------------------------*/
+
+std::error_condition core_file::open_ram_write(std::uint32_t openflags, ptr &file) noexcept
+{
+	// can only do this for write access
+	if (!(openflags & OPEN_FLAG_WRITE))
+		return std::errc::invalid_argument;
+
+	ptr result(new (std::nothrow) core_in_memory_file(openflags));
+	if (!result)
+		return std::errc::not_enough_memory;
+
+	file = std::move(result);
+	return std::error_condition();
+}
+
+
 /*-------------------------------------------------
     open_proxy - open a proxy to an existing file
     object and return an error code
@@ -52,6 +52,10 @@ public:
 	// open a RAM-based "file" using the given data and length (read-only), copying the data
 	static std::error_condition open_ram_copy(const void *data, std::size_t length, std::uint32_t openflags, ptr &file) noexcept;
 
+	// creates an empty RAM-based "file" that grows as it is written; the
+	// contents can be retrieved through buffer()
+	static std::error_condition open_ram_write(std::uint32_t openflags, ptr &file) noexcept;
+
 	// open a proxy "file" that forwards requests to another file object
 	static std::error_condition open_proxy(core_file &file, ptr &proxy) noexcept;
 
@@ -18,11 +18,13 @@
 #include <array>
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <numeric>
 #include <stdexcept>
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 // ======================> simple_list
 
@@ -292,6 +294,9 @@ public:
 	// construction/destruction
 	fixed_allocator() { }
 
+	// getters
+	bool empty() const noexcept { return m_freelist.empty(); }
+
 	// allocate a new item, either by recycling an old one, or by allocating a new one
 	ItemType *alloc()
 	{
@@ -314,6 +319,52 @@ private:
 };
 
 
+// ======================> chunked_allocator
+
+// a chunked_allocator works like a fixed_allocator, but carves objects out of
+// larger blocks so that items allocated together stay contiguous in memory;
+// storage is only returned to the system when the allocator is destroyed
+template<class ItemType, int BlockSize = 64>
+class chunked_allocator
+{
+	// we don't support deep copying
+	chunked_allocator(const chunked_allocator &);
+	chunked_allocator &operator=(const chunked_allocator &);
+
+public:
+	// construction/destruction
+	chunked_allocator() { }
+	~chunked_allocator() { m_freelist.detach_all(); }
+
+	// allocate a new item, either by recycling an old one, or by carving up a fresh block
+	ItemType *alloc()
+	{
+		ItemType *result = m_freelist.detach_head();
+		if (result == nullptr)
+		{
+			m_blocks.push_back(std::make_unique<ItemType []>(BlockSize));
+			ItemType *block = m_blocks.back().get();
+			for (int index = 1; index < BlockSize; index++)
+				m_freelist.append(block[index]);
+			result = &block[0];
+		}
+		return result;
+	}
+
+	// reclaim an item by adding it to the free list
+	void reclaim(ItemType *item) { if (item != nullptr) m_freelist.append(*item); }
+	void reclaim(ItemType &item) { m_freelist.append(item); }
+
+	// reclaim all items from a list
+	void reclaim_all(simple_list<ItemType> &_list) { m_freelist.append_list(_list); }
+
+private:
+	// internal state
+	std::vector<std::unique_ptr<ItemType []>> m_blocks; // blocks of allocated storage
+	simple_list<ItemType>   m_freelist;     // list of free objects
+};
+
+
 // ======================> contiguous_sequence_wrapper
 
 namespace util {
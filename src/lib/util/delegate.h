@@ -757,6 +757,10 @@ public:
 	}
 
 	// call the function
+	// note that binding resolves virtual member function dispatch and any
+	// this-pointer adjustment up front, so invocation is a single indirect
+	// call through a raw function pointer with a pre-adjusted object - there
+	// is no per-call thunk or adjustor overhead left to strip
 	ReturnType operator()(Params... args) const
 	{
 		if ((MAME_DELEGATE_DIFFERENT_MEMBER_ABI) && is_mfp())
@@ -13,6 +13,19 @@
 #include "ioprocs.h"
 
 #include <cstdlib>
+#include <cstring>
+#include <vector>
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+// maximum number of hunks held in the write-back cache for a CHD-backed disk
+static constexpr uint32_t WRITE_CACHE_HUNKS = 64;
+
+// number of dirty hunks that triggers a group commit back to the CHD
+static constexpr uint32_t WRITE_CACHE_DIRTY_MAX = 32;
 
 
 /***************************************************************************
@@ -21,12 +34,113 @@
 
 struct hard_disk_file
 {
+	// one whole hunk of the CHD held in RAM; sector writes are coalesced
+	// here and committed in groups instead of one hunk update per sector
+	struct cached_hunk
+	{
+		uint32_t                hunknum;    // hunk index in the CHD
+		bool                    dirty;      // hunk has uncommitted writes
+		uint64_t                last_use;   // timestamp for LRU eviction
+		std::vector<uint8_t>    data;       // hunk contents
+	};
+
 	chd_file *                  chd;        // CHD file
 	util::random_read_write *   fhandle;    // file if not a CHD
 	hard_disk_info              info;       // hard disk info
+	std::vector<cached_hunk>    cache;      // write-back hunk cache (CHD only)
+	uint64_t                    use_counter; // LRU clock for the cache
+	uint32_t                    dirty_count; // dirty hunks pending commit
 };
 
 
+/***************************************************************************
+    WRITE-BACK CACHE HELPERS
+***************************************************************************/
+
+/*-------------------------------------------------
+    cache_find - return the cached copy of a hunk,
+    or nullptr if it is not resident
+-------------------------------------------------*/
+
+static hard_disk_file::cached_hunk *cache_find(hard_disk_file *file, uint32_t hunknum)
+{
+	for (hard_disk_file::cached_hunk &entry : file->cache)
+		if (entry.hunknum == hunknum)
+		{
+			entry.last_use = ++file->use_counter;
+			return &entry;
+		}
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    cache_flush - commit all dirty hunks back to
+    the CHD in one group
+-------------------------------------------------*/
+
+static bool cache_flush(hard_disk_file *file)
+{
+	bool success = true;
+	for (hard_disk_file::cached_hunk &entry : file->cache)
+		if (entry.dirty)
+		{
+			if (file->chd->write_hunk(entry.hunknum, &entry.data[0]))
+				success = false;
+			else
+				entry.dirty = false;
+		}
+	file->dirty_count = 0;
+	return success;
+}
+
+
+/*-------------------------------------------------
+    cache_fetch - bring a hunk into the cache,
+    evicting the least recently used entry once
+    the cache is full
+-------------------------------------------------*/
+
+static hard_disk_file::cached_hunk *cache_fetch(hard_disk_file *file, uint32_t hunknum)
+{
+	hard_disk_file::cached_hunk *entry;
+	if (file->cache.size() < WRITE_CACHE_HUNKS)
+	{
+		file->cache.emplace_back();
+		entry = &file->cache.back();
+		entry->data.resize(file->chd->hunk_bytes());
+	}
+	else
+	{
+		entry = &file->cache[0];
+		for (hard_disk_file::cached_hunk &candidate : file->cache)
+			if (candidate.last_use < entry->last_use)
+				entry = &candidate;
+		if (entry->dirty)
+		{
+			if (file->chd->write_hunk(entry->hunknum, &entry->data[0]))
+				return nullptr;
+			entry->dirty = false;
+			file->dirty_count--;
+		}
+	}
+
+	if (file->chd->read_hunk(hunknum, &entry->data[0]))
+	{
+		// leave the entry clean and reusable on a failed fill
+		entry->hunknum = ~uint32_t(0);
+		entry->dirty = false;
+		entry->last_use = 0;
+		return nullptr;
+	}
+
+	entry->hunknum = hunknum;
+	entry->dirty = false;
+	entry->last_use = ++file->use_counter;
+	return entry;
+}
+
+
 
 /***************************************************************************
     CORE IMPLEMENTATION
@@ -58,7 +172,7 @@ hard_disk_file *hard_disk_open(chd_file *chd)
 		return nullptr;
 
 	/* allocate memory for the hard disk file */
-	file = (hard_disk_file *)malloc(sizeof(hard_disk_file));
+	file = new (std::nothrow) hard_disk_file;
 	if (file == nullptr)
 		return nullptr;
 
@@ -70,6 +184,8 @@ hard_disk_file *hard_disk_open(chd_file *chd)
 	file->info.sectors = sectors;
 	file->info.sectorbytes = sectorbytes;
 	file->info.fileoffset = 0;
+	file->use_counter = 0;
+	file->dirty_count = 0;
 	return file;
 }
 
@@ -83,7 +199,7 @@ hard_disk_file *hard_disk_open(util::random_read_write &corefile, uint32_t skipo
 	hard_disk_file *file;
 
 	// allocate memory for the hard disk file
-	file = (hard_disk_file *)malloc(sizeof(hard_disk_file));
+	file = new (std::nothrow) hard_disk_file;
 	if (file == nullptr)
 		return nullptr;
 
@@ -94,6 +210,8 @@ hard_disk_file *hard_disk_open(util::random_read_write &corefile, uint32_t skipo
 	file->info.heads = 0;
 	file->info.sectors = 0;
 	file->info.fileoffset = skipoffs;
+	file->use_counter = 0;
+	file->dirty_count = 0;
 
 	// attempt to guess geometry in case this is an ATA situation
 	for (uint32_t totalsectors = (length - skipoffs) / file->info.sectorbytes; ; totalsectors++)
@@ -122,10 +240,40 @@ hard_disk_file *hard_disk_open(util::random_read_write &corefile, uint32_t skipo
 
 void hard_disk_close(hard_disk_file *file)
 {
+	if (file->chd)
+	{
+		if (!cache_flush(file))
+			osd_printf_error("Error flushing hard disk write cache\n");
+	}
+
 	if (file->fhandle)
 		file->fhandle->flush();
 
-	free(file);
+	delete file;
+}
+
+
+/*-------------------------------------------------
+    hard_disk_flush - commit any cached writes
+    back to the underlying CHD
+-------------------------------------------------*/
+
+/**
+ * @fn  bool hard_disk_flush(hard_disk_file *file)
+ *
+ * @brief   Hard disk flush.
+ *
+ * @param [in,out]  file    The hard disk file object to operate on.
+ *
+ * @return  True if the operation succeeded
+ */
+
+bool hard_disk_flush(hard_disk_file *file)
+{
+	if (file->chd)
+		return cache_flush(file);
+
+	return !file->fhandle->flush();
 }
 
 
@@ -136,6 +284,9 @@ void hard_disk_close(hard_disk_file *file)
 
 chd_file *hard_disk_get_chd(hard_disk_file *file)
 {
+	// make sure the caller sees the committed state
+	if (file->chd)
+		cache_flush(file);
 	return file->chd;
 }
 
@@ -183,6 +334,15 @@ bool hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer)
 	std::error_condition err;
 	if (file->chd)
 	{
+		// a cached copy of the hunk supersedes what is in the CHD
+		const uint32_t units_per_hunk = file->chd->hunk_bytes() / file->chd->unit_bytes();
+		hard_disk_file::cached_hunk *entry = cache_find(file, lbasector / units_per_hunk);
+		if (entry != nullptr)
+		{
+			memcpy(buffer, &entry->data[(lbasector % units_per_hunk) * file->chd->unit_bytes()], file->chd->unit_bytes());
+			return true;
+		}
+
 		err = file->chd->read_units(lbasector, buffer);
 		return !err;
 	}
@@ -216,20 +376,40 @@ bool hard_disk_read(hard_disk_file *file, uint32_t lbasector, void *buffer)
 
 bool hard_disk_write(hard_disk_file *file, uint32_t lbasector, const void *buffer)
 {
-	std::error_condition err;
 	if (file->chd)
 	{
-		err = file->chd->write_units(lbasector, buffer);
-		return !err;
-	}
-	else
-	{
-		size_t actual = 0;
-		err = file->fhandle->seek(file->info.fileoffset + (lbasector * file->info.sectorbytes), SEEK_SET);
-		if (!err)
-			err = file->fhandle->write(buffer, file->info.sectorbytes, actual);
-		return !err && (actual == file->info.sectorbytes);
+		// coalesce the write into a cached copy of the whole hunk; the
+		// expensive read-modify-write of the CHD happens once per group
+		// commit instead of once per sector
+		const uint32_t units_per_hunk = file->chd->hunk_bytes() / file->chd->unit_bytes();
+		const uint32_t hunknum = lbasector / units_per_hunk;
+		hard_disk_file::cached_hunk *entry = cache_find(file, hunknum);
+		if (entry == nullptr)
+		{
+			entry = cache_fetch(file, hunknum);
+			if (entry == nullptr)
+				return false;
+		}
+
+		memcpy(&entry->data[(lbasector % units_per_hunk) * file->chd->unit_bytes()], buffer, file->chd->unit_bytes());
+		if (!entry->dirty)
+		{
+			entry->dirty = true;
+			file->dirty_count++;
+		}
+
+		// bound the amount of uncommitted data
+		if (file->dirty_count >= WRITE_CACHE_DIRTY_MAX)
+			return cache_flush(file);
+		return true;
 	}
+
+	std::error_condition err;
+	size_t actual = 0;
+	err = file->fhandle->seek(file->info.fileoffset + (lbasector * file->info.sectorbytes), SEEK_SET);
+	if (!err)
+		err = file->fhandle->write(buffer, file->info.sectorbytes, actual);
+	return !err && (actual == file->info.sectorbytes);
 }
 
 
@@ -45,6 +45,8 @@ hard_disk_file *hard_disk_open(util::random_read_write &corefile, uint32_t skipo
 
 void hard_disk_close(hard_disk_file *file);
 
+bool hard_disk_flush(hard_disk_file *file);
+
 chd_file *hard_disk_get_chd(hard_disk_file *file);
 hard_disk_info *hard_disk_get_info(hard_disk_file *file);
 
@@ -16,6 +16,14 @@
 #include <iomanip>
 #include <sstream>
 
+// x86 SHA-NI and carry-less multiply paths; these are compiled with
+// per-function target attributes and selected at runtime, so the rest
+// of the binary keeps its baseline instruction set
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MAME_HASHING_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
 
 namespace util {
 
@@ -86,8 +94,305 @@ inline void sha1_r4(uint32_t *data, std::array<uint32_t, 5> &d, unsigned i)
 	d[(i + 3) % 5] = sha1_rol(d[(i + 3) % 5], 30);
 }
 
+#ifdef MAME_HASHING_X86_SIMD
+
+const bool f_have_sha_ni = __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+const bool f_have_pclmul = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+
+//-------------------------------------------------
+//  sha1_process_sha_ni - compress one 64-byte
+//  block using the SHA extensions; the caller has
+//  already byte-swapped the message words, so only
+//  the lane order needs reversing on load
+//-------------------------------------------------
+
+__attribute__((target("sha,sse4.1")))
+void sha1_process_sha_ni(std::array<uint32_t, 5> &st, const uint32_t *data)
+{
+	// the accumulator array is stored E/D/C/B/A
+	__m128i abcd = _mm_set_epi32(st[4], st[3], st[2], st[1]);
+	__m128i e0 = _mm_set_epi32(st[0], 0, 0, 0);
+	__m128i e1;
+	__m128i const abcd_save = abcd;
+	__m128i const e0_save = e0;
+
+	__m128i msg0 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0)), 0x1b);
+	__m128i msg1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 4)), 0x1b);
+	__m128i msg2 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 8)), 0x1b);
+	__m128i msg3 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 12)), 0x1b);
+
+	// rounds 0-3
+	e0 = _mm_add_epi32(e0, msg0);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+	// rounds 4-7
+	e1 = _mm_sha1nexte_epu32(e1, msg1);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+	msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+	// rounds 8-11
+	e0 = _mm_sha1nexte_epu32(e0, msg2);
+	e1 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+	msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+	msg0 = _mm_xor_si128(msg0, msg2);
+
+	// rounds 12-15
+	e1 = _mm_sha1nexte_epu32(e1, msg3);
+	e0 = abcd;
+	msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+	msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+	msg1 = _mm_xor_si128(msg1, msg3);
+
+	// rounds 16-19
+	e0 = _mm_sha1nexte_epu32(e0, msg0);
+	e1 = abcd;
+	msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+	msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+	msg2 = _mm_xor_si128(msg2, msg0);
+
+	// rounds 20-23
+	e1 = _mm_sha1nexte_epu32(e1, msg1);
+	e0 = abcd;
+	msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+	msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+	msg3 = _mm_xor_si128(msg3, msg1);
+
+	// rounds 24-27
+	e0 = _mm_sha1nexte_epu32(e0, msg2);
+	e1 = abcd;
+	msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+	msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+	msg0 = _mm_xor_si128(msg0, msg2);
+
+	// rounds 28-31
+	e1 = _mm_sha1nexte_epu32(e1, msg3);
+	e0 = abcd;
+	msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+	msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+	msg1 = _mm_xor_si128(msg1, msg3);
+
+	// rounds 32-35
+	e0 = _mm_sha1nexte_epu32(e0, msg0);
+	e1 = abcd;
+	msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+	msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+	msg2 = _mm_xor_si128(msg2, msg0);
+
+	// rounds 36-39
+	e1 = _mm_sha1nexte_epu32(e1, msg1);
+	e0 = abcd;
+	msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+	msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+	msg3 = _mm_xor_si128(msg3, msg1);
+
+	// rounds 40-43
+	e0 = _mm_sha1nexte_epu32(e0, msg2);
+	e1 = abcd;
+	msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+	msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+	msg0 = _mm_xor_si128(msg0, msg2);
+
+	// rounds 44-47
+	e1 = _mm_sha1nexte_epu32(e1, msg3);
+	e0 = abcd;
+	msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+	msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+	msg1 = _mm_xor_si128(msg1, msg3);
+
+	// rounds 48-51
+	e0 = _mm_sha1nexte_epu32(e0, msg0);
+	e1 = abcd;
+	msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+	msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+	msg2 = _mm_xor_si128(msg2, msg0);
+
+	// rounds 52-55
+	e1 = _mm_sha1nexte_epu32(e1, msg1);
+	e0 = abcd;
+	msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+	msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+	msg3 = _mm_xor_si128(msg3, msg1);
+
+	// rounds 56-59
+	e0 = _mm_sha1nexte_epu32(e0, msg2);
+	e1 = abcd;
+	msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+	msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+	msg0 = _mm_xor_si128(msg0, msg2);
+
+	// rounds 60-63
+	e1 = _mm_sha1nexte_epu32(e1, msg3);
+	e0 = abcd;
+	msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+	msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+	msg1 = _mm_xor_si128(msg1, msg3);
+
+	// rounds 64-67
+	e0 = _mm_sha1nexte_epu32(e0, msg0);
+	e1 = abcd;
+	msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+	msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+	msg2 = _mm_xor_si128(msg2, msg0);
+
+	// rounds 68-71
+	e1 = _mm_sha1nexte_epu32(e1, msg1);
+	e0 = abcd;
+	msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+	msg3 = _mm_xor_si128(msg3, msg1);
+
+	// rounds 72-75
+	e0 = _mm_sha1nexte_epu32(e0, msg2);
+	e1 = abcd;
+	msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+	abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+	// rounds 76-79
+	e1 = _mm_sha1nexte_epu32(e1, msg3);
+	e0 = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+	// add back the previous state
+	e0 = _mm_sha1nexte_epu32(e0, e0_save);
+	abcd = _mm_add_epi32(abcd, abcd_save);
+
+	st[4] = _mm_extract_epi32(abcd, 3);
+	st[3] = _mm_extract_epi32(abcd, 2);
+	st[2] = _mm_extract_epi32(abcd, 1);
+	st[1] = _mm_extract_epi32(abcd, 0);
+	st[0] = _mm_extract_epi32(e0, 3);
+}
+
+
+//-------------------------------------------------
+//  crc32_fold_pclmul - fold a buffer into a raw
+//  (pre-inverted) CRC using carry-less multiplies;
+//  constants are from Intel's "Fast CRC Computation
+//  for Generic Polynomials Using PCLMULQDQ" paper
+//  for the reflected 0xedb88320 polynomial; length
+//  must be a multiple of 16 and at least 64
+//-------------------------------------------------
+
+__attribute__((target("pclmul,sse4.1")))
+uint32_t crc32_fold_pclmul(uint32_t crc, const uint8_t *buf, size_t len)
+{
+	__m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+	// load the initial 64 bytes and XOR in the running CRC
+	x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x00));
+	x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x10));
+	x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x20));
+	x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+
+	x0 = _mm_set_epi64x(0x00000001c6e41596, 0x0000000154442bd4); // k1k2
+	buf += 0x40;
+	len -= 0x40;
+
+	// fold parallel blocks of 64 bytes
+	while (len >= 0x40)
+	{
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+		y5 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x00));
+		y6 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x10));
+		y7 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x20));
+		y8 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x30));
+
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+
+		buf += 0x40;
+		len -= 0x40;
+	}
+
+	// fold the four accumulators down to one
+	x0 = _mm_set_epi64x(0x00000000ccaa009e, 0x00000001751997d0); // k3k4
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+	x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+	x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+	// fold remaining blocks of 16 bytes
+	while (len >= 0x10)
+	{
+		x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf));
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+		buf += 0x10;
+		len -= 0x10;
+	}
+
+	// fold 128 bits to 64 bits
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+	x1 = _mm_srli_si128(x1, 8);
+	x1 = _mm_xor_si128(x1, x2);
+
+	x0 = _mm_set_epi64x(0, 0x0000000163cd6124); // k5
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, x3);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	// Barrett reduce to 32 bits
+	x0 = _mm_set_epi64x(0x00000001f7011641, 0x00000001db710641); // poly
+	x2 = _mm_and_si128(x1, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+	x2 = _mm_and_si128(x2, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	return _mm_extract_epi32(x1, 1);
+}
+
+#endif // MAME_HASHING_X86_SIMD
+
+
 inline void sha1_process(std::array<uint32_t, 5> &st, uint32_t *data)
 {
+#ifdef MAME_HASHING_X86_SIMD
+	if (f_have_sha_ni)
+	{
+		sha1_process_sha_ni(st, data);
+		return;
+	}
+#endif
 	std::array<uint32_t, 5> d = st;
 	unsigned i = 0U;
 	while (i < 16U)
@@ -329,6 +634,19 @@ std::string crc32_t::as_string() const
 
 void crc32_creator::append(const void *data, uint32_t length)
 {
+#ifdef MAME_HASHING_X86_SIMD
+	if (f_have_pclmul && length >= 64)
+	{
+		// fold as much as possible with carry-less multiplies, then
+		// hand any sub-16-byte tail to the table-driven implementation
+		const uint8_t *src = reinterpret_cast<const uint8_t *>(data);
+		uint32_t const folded = length & ~uint32_t(15);
+		m_accum.m_raw = ~crc32_fold_pclmul(~m_accum.m_raw, src, folded);
+		if (length != folded)
+			m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(src + folded), length - folded);
+		return;
+	}
+#endif
 	m_accum.m_raw = crc32(m_accum, reinterpret_cast<const Bytef *>(data), length);
 }
 
@@ -18,9 +18,14 @@
 #include <algorithm>
 #include <cassert>
 #include <cerrno>
+#include <condition_variable>
 #include <cstdint>
+#include <cstring>
 #include <limits>
+#include <mutex>
+#include <new>
 #include <system_error>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -657,6 +662,130 @@ private:
 	}
 };
 
+// filter that reads ahead of the consumer on a worker thread
+
+class read_ahead_filter : public read_stream, protected filter_base<read_stream>
+{
+public:
+	read_ahead_filter(std::unique_ptr<read_stream> &&stream, std::size_t window) noexcept :
+		filter_base<read_stream>(std::move(stream)),
+		m_window(window)
+	{
+		assert(window);
+	}
+
+	read_ahead_filter(read_stream &stream, std::size_t window) noexcept :
+		filter_base<read_stream>(stream),
+		m_window(window)
+	{
+		assert(window);
+	}
+
+	~read_ahead_filter()
+	{
+		if (m_started)
+		{
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				m_stop = true;
+			}
+			m_space_condition.notify_all();
+			m_thread.join();
+		}
+	}
+
+	virtual std::error_condition read(void *buffer, std::size_t length, std::size_t &actual) noexcept override
+	{
+		actual = 0U;
+
+		if (!m_started)
+		{
+			std::error_condition err = start();
+			if (err)
+				return err;
+		}
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (length > actual)
+		{
+			m_data_condition.wait(lock, [this] () { return m_used || m_finished; });
+			if (!m_used)
+				return m_error;
+
+			// copy out the contiguous chunk at the head of the ring
+			std::size_t const chunk((std::min)({ length - actual, m_used, m_window - m_head }));
+			std::memcpy(reinterpret_cast<std::uint8_t *>(buffer) + actual, &m_buffer[m_head], chunk);
+			m_head = (m_head + chunk) % m_window;
+			m_used -= chunk;
+			actual += chunk;
+			m_space_condition.notify_one();
+		}
+		return std::error_condition();
+	}
+
+private:
+	std::error_condition start() noexcept
+	{
+		m_buffer.reset(new (std::nothrow) std::uint8_t [m_window]);
+		if (!m_buffer)
+			return std::errc::not_enough_memory;
+		try
+		{
+			m_thread = std::thread([this] () { fill(); });
+		}
+		catch (...)
+		{
+			m_buffer.reset();
+			return std::errc::resource_unavailable_try_again;
+		}
+		m_started = true;
+		return std::error_condition();
+	}
+
+	void fill() noexcept
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (true)
+		{
+			m_space_condition.wait(lock, [this] () { return m_stop || (m_window > m_used); });
+			if (m_stop)
+				return;
+
+			// the region past the tail is untouched by the consumer, so it's
+			// safe to read into it without holding the lock
+			std::size_t const tail((m_head + m_used) % m_window);
+			std::size_t const chunk((std::min)(m_window - m_used, m_window - tail));
+			lock.unlock();
+			std::size_t filled = 0;
+			std::error_condition err = this->object().read(&m_buffer[tail], chunk, filled);
+			lock.lock();
+
+			m_used += filled;
+			if (err || !filled)
+			{
+				m_error = err;
+				m_finished = true;
+				m_data_condition.notify_all();
+				return;
+			}
+			m_data_condition.notify_all();
+		}
+	}
+
+	std::size_t const m_window;
+	std::unique_ptr<std::uint8_t []> m_buffer;
+	std::size_t m_head = 0U;
+	std::size_t m_used = 0U;
+	bool m_started = false;
+	bool m_finished = false;
+	bool m_stop = false;
+	std::error_condition m_error;
+	std::mutex m_mutex;
+	std::condition_variable m_space_condition;
+	std::condition_variable m_data_condition;
+	std::thread m_thread;
+};
+
 } // anonymous namespace
 
 
@@ -789,4 +918,20 @@ write_stream::ptr zlib_write(write_stream &stream, int level, std::size_t buffer
 	return write_stream::ptr(new (std::nothrow) zlib_write_filter(stream, level, buffer_size));
 }
 
+
+// creating read-ahead filters
+
+read_stream::ptr read_stream_read_ahead(read_stream::ptr &&stream, std::size_t window) noexcept
+{
+	read_stream::ptr result;
+	if (stream)
+		result.reset(new (std::nothrow) read_ahead_filter(std::move(stream), window));
+	return result;
+}
+
+read_stream::ptr read_stream_read_ahead(read_stream &stream, std::size_t window) noexcept
+{
+	return read_stream::ptr(new (std::nothrow) read_ahead_filter(stream, window));
+}
+
 } // namespace util
@@ -38,6 +38,9 @@ std::unique_ptr<read_stream> zlib_read(random_read &stream, std::size_t read_chu
 std::unique_ptr<write_stream> zlib_write(std::unique_ptr<write_stream> &&stream, int level, std::size_t buffer_size) noexcept;
 std::unique_ptr<write_stream> zlib_write(write_stream &stream, int level, std::size_t buffer_size) noexcept;
 
+std::unique_ptr<read_stream> read_stream_read_ahead(std::unique_ptr<read_stream> &&stream, std::size_t window) noexcept;
+std::unique_ptr<read_stream> read_stream_read_ahead(read_stream &stream, std::size_t window) noexcept;
+
 } // namespace util
 
 #endif // MAME_LIB_UTIL_IOPROCSFILTER_H
@@ -218,6 +218,7 @@ palette_t::palette_t(uint32_t numcolors, uint32_t numgroups)
 		m_adjusted_rgb15(numcolors * numgroups + 2),
 		m_group_bright(numgroups),
 		m_group_contrast(numgroups),
+		m_group_ramp(numgroups * 256),
 		m_client_list(nullptr)
 {
 	// initialize gamma map
@@ -236,6 +237,7 @@ palette_t::palette_t(uint32_t numcolors, uint32_t numgroups)
 	{
 		m_group_bright[index] = 0.0f;
 		m_group_contrast[index] = 1.0f;
+		update_group_ramp(index);
 	}
 
 	// initialize the expanded data
@@ -290,8 +292,11 @@ void palette_t::set_brightness(float brightness)
 
 	// update across all indices in all groups
 	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
+	{
+		update_group_ramp(groupnum);
 		for (int index = 0; index < m_numcolors; index++)
 			update_adjusted_color(groupnum, index);
+	}
 }
 
 
@@ -309,8 +314,11 @@ void palette_t::set_contrast(float contrast)
 
 	// update across all indices in all groups
 	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
+	{
+		update_group_ramp(groupnum);
 		for (int index = 0; index < m_numcolors; index++)
 			update_adjusted_color(groupnum, index);
+	}
 }
 
 
@@ -337,8 +345,11 @@ void palette_t::set_gamma(float gamma)
 
 	// update across all indices in all groups
 	for (int groupnum = 0; groupnum < m_numgroups; groupnum++)
+	{
+		update_group_ramp(groupnum);
 		for (int index = 0; index < m_numcolors; index++)
 			update_adjusted_color(groupnum, index);
+	}
 }
 
 
@@ -472,6 +483,7 @@ void palette_t::group_set_brightness(uint32_t group, float brightness)
 	m_group_bright[group] = brightness;
 
 	// update across all colors
+	update_group_ramp(group);
 	for (int index = 0; index < m_numcolors; index++)
 		update_adjusted_color(group, index);
 }
@@ -494,6 +506,7 @@ void palette_t::group_set_contrast(uint32_t group, float contrast)
 	m_group_contrast[group] = contrast;
 
 	// update across all colors
+	update_group_ramp(group);
 	for (int index = 0; index < m_numcolors; index++)
 		update_adjusted_color(group, index);
 }
@@ -552,11 +565,21 @@ void palette_t::normalize_range(uint32_t start, uint32_t end, int lum_min, int l
 
 void palette_t::update_adjusted_color(uint32_t group, uint32_t index)
 {
-	// compute the adjusted value
-	rgb_t adjusted = adjust_palette_entry(m_entry_color[index],
-											m_group_bright[group] + m_brightness,
-											m_group_contrast[group] * m_entry_contrast[index] * m_contrast,
-											m_gamma_map);
+	// compute the adjusted value; entries with the default contrast (the
+	// common case) go through the precomputed per-group channel ramp,
+	// which already folds gamma, brightness and group/global contrast
+	rgb_t const entry = m_entry_color[index];
+	rgb_t adjusted;
+	if (m_entry_contrast[index] == 1.0f)
+	{
+		const uint8_t *ramp = &m_group_ramp[group * 256];
+		adjusted = rgb_t(entry.a(), ramp[entry.r()], ramp[entry.g()], ramp[entry.b()]);
+	}
+	else
+		adjusted = adjust_palette_entry(entry,
+										m_group_bright[group] + m_brightness,
+										m_group_contrast[group] * m_entry_contrast[index] * m_contrast,
+										m_gamma_map);
 
 	// if not different, ignore
 	uint32_t finalindex = group * m_numcolors + index;
@@ -571,3 +594,20 @@ void palette_t::update_adjusted_color(uint32_t group, uint32_t index)
 	for (palette_client *client = m_client_list; client != nullptr; client = client->next())
 		client->mark_dirty(finalindex);
 }
+
+
+//-------------------------------------------------
+//  update_group_ramp - rebuild the channel ramp
+//  for one group, folding the gamma map and the
+//  global and group brightness/contrast into a
+//  single 256-entry lookup
+//-------------------------------------------------
+
+void palette_t::update_group_ramp(uint32_t group)
+{
+	const float brightness = m_group_bright[group] + m_brightness;
+	const float contrast = m_group_contrast[group] * m_contrast;
+	uint8_t *ramp = &m_group_ramp[group * 256];
+	for (uint32_t level = 0; level < 256; level++)
+		ramp[level] = rgb_t::clamp(float(m_gamma_map[level]) * contrast + brightness);
+}
@@ -84,8 +84,15 @@ namespace webpp {
 				SendData(const std::shared_ptr<SendStream> &header_stream, const std::shared_ptr<SendStream> &message_stream,
 						const std::function<void(const std::error_code)> &callback) :
 						header_stream(header_stream), message_stream(message_stream), callback(callback) {}
+				SendData(const std::shared_ptr<SendStream> &header_stream, const std::shared_ptr<const std::string> &shared_message,
+						const std::function<void(const std::error_code)> &callback) :
+						header_stream(header_stream), shared_message(shared_message), callback(callback) {}
 				std::shared_ptr<SendStream> header_stream;
 				std::shared_ptr<SendStream> message_stream;
+				// alternative payload shared between connections; unlike the
+				// streambuf above it is not consumed by the write, so one
+				// instance can be queued to any number of clients
+				std::shared_ptr<const std::string> shared_message;
 				std::function<void(const std::error_code)> callback;
 			};
 
@@ -100,8 +107,7 @@ namespace webpp {
 					asio::async_write(*socket, send_queue.begin()->header_stream->streambuf,
 							strand.wrap([this, connection](const std::error_code& ec, size_t /*bytes_transferred*/) {
 						if(!ec) {
-							asio::async_write(*socket, send_queue.begin()->message_stream->streambuf,
-									strand.wrap([this, connection]
+							auto on_written = strand.wrap([this, connection]
 									(const std::error_code& ec, size_t /*bytes_transferred*/) {
 								auto send_queued=send_queue.begin();
 								if(send_queued->callback)
@@ -113,7 +119,11 @@ namespace webpp {
 								}
 								else
 									send_queue.clear();
-							}));
+							});
+							if(send_queue.begin()->shared_message)
+								asio::async_write(*socket, asio::buffer(*send_queue.begin()->shared_message), on_written);
+							else
+								asio::async_write(*socket, send_queue.begin()->message_stream->streambuf, on_written);
 						}
 						else {
 							auto send_queued=send_queue.begin();
@@ -248,21 +258,10 @@ namespace webpp {
 				p.second.connections.clear();
 		}
 
-		///fin_rsv_opcode: 129=one fragment, text, 130=one fragment, binary, 136=close connection.
-		///See http://tools.ietf.org/html/rfc6455#section-5.2 for more information
-		void send(std::shared_ptr<webpp::Connection> conn, const std::shared_ptr<SendStream> &message_stream,
-				const std::function<void(const std::error_code&)>& callback=nullptr,
-				unsigned char fin_rsv_opcode=129) const {
-			std::shared_ptr<Connection> connection = std::dynamic_pointer_cast<Connection> (conn);
-			if (!connection) return;
-
-			if(fin_rsv_opcode!=136)
-				timer_idle_reset(connection);
-
+		///Build an unmasked frame header for a payload of the given length
+		static std::shared_ptr<SendStream> make_header(size_t length, unsigned char fin_rsv_opcode) {
 			auto header_stream = std::make_shared<SendStream>();
 
-			size_t length=message_stream->size();
-
 			header_stream->put(fin_rsv_opcode);
 			//unmasked (first length byte<128)
 			if(length>=126) {
@@ -283,6 +282,22 @@ namespace webpp {
 			else
 				header_stream->put(static_cast<unsigned char>(length));
 
+			return header_stream;
+		}
+
+		///fin_rsv_opcode: 129=one fragment, text, 130=one fragment, binary, 136=close connection.
+		///See http://tools.ietf.org/html/rfc6455#section-5.2 for more information
+		void send(std::shared_ptr<webpp::Connection> conn, const std::shared_ptr<SendStream> &message_stream,
+				const std::function<void(const std::error_code&)>& callback=nullptr,
+				unsigned char fin_rsv_opcode=129) const {
+			std::shared_ptr<Connection> connection = std::dynamic_pointer_cast<Connection> (conn);
+			if (!connection) return;
+
+			if(fin_rsv_opcode!=136)
+				timer_idle_reset(connection);
+
+			auto header_stream = make_header(message_stream->size(), fin_rsv_opcode);
+
 			connection->strand.post([connection, header_stream, message_stream, callback]() {
 				connection->send_queue.emplace_back(header_stream, message_stream, callback);
 				if(connection->send_queue.size()==1)
@@ -290,6 +305,27 @@ namespace webpp {
 			});
 		}
 
+		///Like send(), but the payload buffer is shared rather than copied into a
+		///per-connection stream and is not consumed by the write, so the same
+		///instance can be passed for every connection when broadcasting.
+		void send_shared(std::shared_ptr<webpp::Connection> conn, const std::shared_ptr<const std::string> &payload,
+				const std::function<void(const std::error_code&)>& callback=nullptr,
+				unsigned char fin_rsv_opcode=129) const {
+			std::shared_ptr<Connection> connection = std::dynamic_pointer_cast<Connection> (conn);
+			if (!connection) return;
+
+			if(fin_rsv_opcode!=136)
+				timer_idle_reset(connection);
+
+			auto header_stream = make_header(payload->size(), fin_rsv_opcode);
+
+			connection->strand.post([connection, header_stream, payload, callback]() {
+				connection->send_queue.emplace_back(header_stream, payload, callback);
+				if(connection->send_queue.size()==1)
+					connection->send_from_queue(connection);
+			});
+		}
+
 		void send_close(std::shared_ptr<webpp::Connection> conn, int status, const std::string& reason="",
 				const std::function<void(const std::error_code&)>& callback=nullptr) const {
 			std::shared_ptr<Connection> connection = std::dynamic_pointer_cast<Connection> (conn);
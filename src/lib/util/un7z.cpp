@@ -127,8 +127,11 @@ public:
 
 	virtual ~m7z_file_impl()
 	{
-		if (m_out_buffer)
-			IAlloc_Free(&m_alloc_imp, m_out_buffer);
+		for (solid_block &block : m_blocks)
+		{
+			if (block.m_out_buffer)
+				IAlloc_Free(&m_alloc_imp, block.m_out_buffer);
+		}
 		if (m_inited)
 			SzArEx_Free(&m_db, &m_alloc_imp);
 	}
@@ -236,10 +239,18 @@ private:
 	ISzAlloc                                m_alloc_temp_imp;
 	bool                                    m_inited;
 
-	// cached stuff for solid blocks
-	UInt32                                  m_block_index;
-	Byte *                                  m_out_buffer;
-	std::size_t                             m_out_buffer_size;
+	// cached decoded solid blocks - multiple slots so reads that alternate
+	// between blocks don't force the same block to be decoded repeatedly
+	struct solid_block
+	{
+		UInt32          m_block_index = 0;
+		Byte *          m_out_buffer = nullptr;
+		std::size_t     m_out_buffer_size = 0;
+		unsigned        m_age = 0;
+	};
+
+	static constexpr std::size_t            BLOCK_CACHE_SIZE = 4;
+	std::array<solid_block, BLOCK_CACHE_SIZE> m_blocks;
 };
 
 
@@ -304,9 +315,7 @@ m7z_file_impl::m7z_file_impl(std::string &&filename) noexcept
 	, m_uchar_buf()
 	, m_utf8_buf()
 	, m_inited(false)
-	, m_block_index(0)
-	, m_out_buffer(nullptr)
-	, m_out_buffer_size(0)
+	, m_blocks()
 {
 	m_alloc_imp.Alloc = &SzAlloc;
 	m_alloc_imp.Free = &SzFree;
@@ -455,11 +464,36 @@ std::error_condition m7z_file_impl::decompress(void *buffer, std::size_t length)
 		osd_printf_verbose("un7z: reopened archive file %s\n", m_filename);
 	}
 
+	// select the cached slot holding this file's solid block, an empty slot,
+	// or failing that recycle the least recently used one
+	UInt32 const folder(m_db.FileToFolder[m_curr_file_idx]);
+	solid_block *slot = nullptr;
+	for (solid_block &block : m_blocks)
+	{
+		if (block.m_out_buffer && (block.m_block_index == folder))
+		{
+			slot = &block;
+			break;
+		}
+		else if (!block.m_out_buffer)
+		{
+			if (!slot || slot->m_out_buffer)
+				slot = &block;
+		}
+		else if (!slot || (slot->m_out_buffer && (block.m_age > slot->m_age)))
+		{
+			slot = &block;
+		}
+	}
+	for (solid_block &block : m_blocks)
+		++block.m_age;
+	slot->m_age = 0;
+
 	std::size_t offset(0);
 	std::size_t out_size_processed(0);
 	SRes const res = SzArEx_Extract(
 			&m_db, &m_look_stream.s, m_curr_file_idx,           // requested file
-			&m_block_index, &m_out_buffer, &m_out_buffer_size,  // solid block caching
+			&slot->m_block_index, &slot->m_out_buffer, &slot->m_out_buffer_size, // solid block caching
 			&offset, &out_size_processed,                       // data size/offset
 			&m_alloc_imp, &m_alloc_temp_imp);                   // allocator helpers
 	if (res != SZ_OK)
@@ -475,7 +509,7 @@ std::error_condition m7z_file_impl::decompress(void *buffer, std::size_t length)
 	}
 
 	// copy to destination buffer
-	std::memcpy(buffer, m_out_buffer + offset, (std::min<std::size_t>)(length, out_size_processed));
+	std::memcpy(buffer, slot->m_out_buffer + offset, (std::min<std::size_t>)(length, out_size_processed));
 	return std::error_condition();
 }
 
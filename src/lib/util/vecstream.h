@@ -10,7 +10,8 @@
     text and you need to use it like a character array or character
     pointer, as you get read-only access to it without copying.  The
     storage is always guaranteed to be contiguous.  Writing to the
-    stream may invalidate pointers to storage.
+    stream may invalidate pointers to storage.  When finished writing,
+    release() moves the contents out without copying.
 
 ***************************************************************************/
 
@@ -101,6 +102,14 @@ public:
 		setup();
 	}
 
+	vector_type release()
+	{
+		vec(); // trims spare capacity so the contents end at the write threshold
+		vector_type result(std::move(m_storage));
+		clear();
+		return result;
+	}
+
 	void clear()
 	{
 		m_storage.clear();
@@ -326,6 +335,7 @@ public:
 	vector_type const &vec() const { return rdbuf()->vec(); }
 	void vec(const vector_type &content) { rdbuf()->vec(content); }
 	void vec(vector_type &&content) { rdbuf()->vec(std::move(content)); }
+	vector_type release() { return rdbuf()->release(); }
 
 	void swap(basic_ivectorstream &that) { std::basic_istream<CharT, Traits>::swap(that); rdbuf()->swap(*that.rdbuf()); }
 
@@ -348,6 +358,7 @@ public:
 	vector_type const &vec() const { return rdbuf()->vec(); }
 	void vec(const vector_type &content) { rdbuf()->vec(content); }
 	void vec(vector_type &&content) { rdbuf()->vec(std::move(content)); }
+	vector_type release() { return rdbuf()->release(); }
 	basic_ovectorstream &reserve(typename vector_type::size_type size) { rdbuf()->reserve(size); return *this; }
 
 	void swap(basic_ovectorstream &that) { std::basic_ostream<CharT, Traits>::swap(that); rdbuf()->swap(*that.rdbuf()); }
@@ -371,6 +382,7 @@ public:
 	vector_type const &vec() const { return rdbuf()->vec(); }
 	void vec(const vector_type &content) { rdbuf()->vec(content); }
 	void vec(vector_type &&content) { rdbuf()->vec(std::move(content)); }
+	vector_type release() { return rdbuf()->release(); }
 	basic_vectorstream &reserve(typename vector_type::size_type size) { rdbuf()->reserve(size); return *this; }
 
 	void swap(basic_vectorstream &that) { std::basic_iostream<CharT, Traits>::swap(that); rdbuf()->swap(*that.rdbuf()); }
@@ -90,6 +90,9 @@ struct parse_info
 //**************************************************************************
 
 // expat interfaces
+static void *expat_malloc(size_t size);
+static void *expat_realloc(void *ptr, size_t size);
+static void expat_free(void *ptr);
 static bool expat_setup_parser(parse_info &info, parse_options const *opts);
 static void expat_element_start(void *data, const XML_Char *name, const XML_Char **attributes);
 static void expat_data(void *data, const XML_Char *s, int len);
@@ -200,6 +203,147 @@ file::ptr file::string_read(const char *string, parse_options const *opts)
 }
 
 
+
+//**************************************************************************
+//  STREAMING PARSER
+//**************************************************************************
+
+//-------------------------------------------------
+//  parser - constructor
+//-------------------------------------------------
+
+parser::parser() :
+	m_parser(nullptr)
+{
+}
+
+
+//-------------------------------------------------
+//  ~parser - destructor
+//-------------------------------------------------
+
+parser::~parser()
+{
+}
+
+
+//-------------------------------------------------
+//  parse - scan a stream, invoking the handlers
+//  as elements and content are encountered
+//-------------------------------------------------
+
+bool parser::parse(read_stream &stream, parse_options const *opts)
+{
+	// reset error information
+	if (opts != nullptr && opts->error != nullptr)
+	{
+		opts->error->error_message = nullptr;
+		opts->error->error_line = 0;
+		opts->error->error_column = 0;
+	}
+
+	// create the XML parser with the same tracked allocators as DOM mode
+	XML_Memory_Handling_Suite memcallbacks;
+	memcallbacks.malloc_fcn = expat_malloc;
+	memcallbacks.realloc_fcn = expat_realloc;
+	memcallbacks.free_fcn = expat_free;
+	m_parser = XML_ParserCreate_MM(nullptr, &memcallbacks, nullptr);
+	if (m_parser == nullptr)
+		return false;
+
+	// configure the parser
+	XML_SetElementHandler(m_parser, &parser::start_handler, &parser::end_handler);
+	XML_SetCharacterDataHandler(m_parser, &parser::data_handler);
+	XML_SetUserData(m_parser, this);
+
+	// optional parser initialization step
+	if (opts != nullptr && opts->init_parser != nullptr)
+		(*opts->init_parser)(m_parser);
+
+	// stream the data through the parser without building any nodes
+	bool done, failed = false;
+	do
+	{
+		char tempbuf[TEMP_BUFFER_SIZE];
+
+		// read as much as we can
+		size_t bytes;
+		stream.read(tempbuf, sizeof(tempbuf), bytes); // TODO: better error handling
+		done = !bytes;
+
+		// parse the data
+		if (XML_Parse(m_parser, tempbuf, bytes, done) == XML_STATUS_ERROR)
+		{
+			// a handler stopping the scan early is not an error
+			if (XML_GetErrorCode(m_parser) != XML_ERROR_ABORTED)
+			{
+				if (opts != nullptr && opts->error != nullptr)
+				{
+					opts->error->error_message = XML_ErrorString(XML_GetErrorCode(m_parser));
+					opts->error->error_line = XML_GetCurrentLineNumber(m_parser);
+					opts->error->error_column = XML_GetCurrentColumnNumber(m_parser);
+				}
+				failed = true;
+			}
+			break;
+		}
+	}
+	while (!done);
+
+	// free the parser
+	XML_ParserFree(m_parser);
+	m_parser = nullptr;
+	return !failed;
+}
+
+
+//-------------------------------------------------
+//  start_handler - expat callback for a new
+//  element
+//-------------------------------------------------
+
+void parser::start_handler(void *data, const char *name, const char **attributes)
+{
+	parser &state = *reinterpret_cast<parser *>(data);
+	if (!state.element_start)
+		return;
+
+	// hand the attributes over as string_views into expat's buffers
+	state.m_attributes.clear();
+	for (int attr = 0; attributes[attr]; attr += 2)
+		state.m_attributes.emplace_back(attributes[attr + 0], attributes[attr + 1]);
+
+	if (!state.element_start(name, state.m_attributes))
+		XML_StopParser(state.m_parser, XML_FALSE);
+}
+
+
+//-------------------------------------------------
+//  data_handler - expat callback for element
+//  content
+//-------------------------------------------------
+
+void parser::data_handler(void *data, const char *s, int len)
+{
+	parser &state = *reinterpret_cast<parser *>(data);
+	if (state.content && !state.content(std::string_view(s, len)))
+		XML_StopParser(state.m_parser, XML_FALSE);
+}
+
+
+//-------------------------------------------------
+//  end_handler - expat callback for the end of
+//  an element
+//-------------------------------------------------
+
+void parser::end_handler(void *data, const char *name)
+{
+	parser &state = *reinterpret_cast<parser *>(data);
+	if (state.element_end && !state.element_end(name))
+		XML_StopParser(state.m_parser, XML_FALSE);
+}
+
+
 //-------------------------------------------------
 //  file_write - write an XML tree to a file
 //-------------------------------------------------
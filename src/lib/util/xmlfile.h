@@ -14,9 +14,12 @@
 
 #include "corefile.h"
 
+#include <functional>
 #include <list>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 
 // forward type declarations
@@ -62,6 +65,36 @@ struct parse_options
 };
 
 
+// a streaming parser for consumers that only need to scan a document; no
+// DOM is built, and the string_views passed to the handlers point into the
+// parser's buffers and are only valid for the duration of the call
+class parser
+{
+public:
+	using attribute_list = std::vector<std::pair<std::string_view, std::string_view> >;
+
+	parser();
+	~parser();
+
+	// handlers invoked as the document is scanned; returning false stops
+	// the scan early, which is not treated as an error
+	std::function<bool (std::string_view name, attribute_list const &attributes)> element_start;
+	std::function<bool (std::string_view name)> element_end;
+	std::function<bool (std::string_view data)> content;
+
+	// scan a stream, returning false on a parse error
+	bool parse(read_stream &stream, parse_options const *opts = nullptr);
+
+private:
+	static void start_handler(void *data, const char *name, const char **attributes);
+	static void data_handler(void *data, const char *s, int len);
+	static void end_handler(void *data, const char *name);
+
+	struct XML_ParserStruct *   m_parser;
+	attribute_list              m_attributes;
+};
+
+
 // a node representing a data item and its relationships
 class data_node
 {
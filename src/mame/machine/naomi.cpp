@@ -203,7 +203,7 @@ void naomi_state::create_pic_from_retdat()
 
 void naomi_state::set_drc_options()
 {
-	m_maincpu->sh2drc_set_options(SH2DRC_STRICT_VERIFY | SH2DRC_STRICT_PCREL);
+	m_maincpu->sh2drc_set_options(SH2DRC_STRICT_VERIFY | SH2DRC_STRICT_PCREL | SH2DRC_IDLE_LOOPS);
 	m_maincpu->sh2drc_add_fastram(0x00000000, 0x001fffff, true, m_rombase);
 	m_maincpu->sh2drc_add_fastram(0x0c000000, 0x0dffffff, false, dc_ram);
 }
@@ -49,6 +49,112 @@ inline bool _addu_64x64_co(uint64_t a, uint64_t b, uint64_t &sum)
 #endif
 
 
+#ifdef __SIZEOF_INT128__
+
+/*-------------------------------------------------
+    madd_64x64 - perform a signed 64 bit x 64 bit
+    multiply and accumulate the full 128 bit
+    product into hi:lo, returning the low half
+-------------------------------------------------*/
+
+#ifndef madd_64x64
+#define madd_64x64 _madd_64x64
+inline int64_t _madd_64x64(int64_t a, int64_t b, int64_t lo, int64_t &hi)
+{
+	unsigned __int128 const sum = (unsigned __int128)((__int128)a * b) + (((unsigned __int128)uint64_t(hi) << 64) | uint64_t(lo));
+	hi = int64_t(uint64_t(sum >> 64));
+	return int64_t(uint64_t(sum));
+}
+#endif
+
+
+/*-------------------------------------------------
+    maddu_64x64 - perform an unsigned 64 bit x 64
+    bit multiply and accumulate the full 128 bit
+    product into hi:lo, returning the low half
+-------------------------------------------------*/
+
+#ifndef maddu_64x64
+#define maddu_64x64 _maddu_64x64
+inline uint64_t _maddu_64x64(uint64_t a, uint64_t b, uint64_t lo, uint64_t &hi)
+{
+	unsigned __int128 const sum = ((unsigned __int128)a * b) + (((unsigned __int128)hi << 64) | lo);
+	hi = uint64_t(sum >> 64);
+	return uint64_t(sum);
+}
+#endif
+
+#endif // __SIZEOF_INT128__
+
+
+/*-------------------------------------------------
+    add_sat_32 - perform a signed 32 bit + 32 bit
+    addition, saturating the result on overflow
+-------------------------------------------------*/
+
+#ifndef add_sat_32
+#define add_sat_32 _add_sat_32
+inline int32_t _add_sat_32(int32_t a, int32_t b)
+{
+	int32_t sum;
+	if (!__builtin_add_overflow(a, b, &sum))
+		return sum;
+	return (a < 0) ? INT32_MIN : INT32_MAX;
+}
+#endif
+
+
+/*-------------------------------------------------
+    sub_sat_32 - perform a signed 32 bit - 32 bit
+    subtraction, saturating the result on overflow
+-------------------------------------------------*/
+
+#ifndef sub_sat_32
+#define sub_sat_32 _sub_sat_32
+inline int32_t _sub_sat_32(int32_t a, int32_t b)
+{
+	int32_t diff;
+	if (!__builtin_sub_overflow(a, b, &diff))
+		return diff;
+	return (a < 0) ? INT32_MIN : INT32_MAX;
+}
+#endif
+
+
+/*-------------------------------------------------
+    add_sat_64 - perform a signed 64 bit + 64 bit
+    addition, saturating the result on overflow
+-------------------------------------------------*/
+
+#ifndef add_sat_64
+#define add_sat_64 _add_sat_64
+inline int64_t _add_sat_64(int64_t a, int64_t b)
+{
+	int64_t sum;
+	if (!__builtin_add_overflow(a, b, &sum))
+		return sum;
+	return (a < 0) ? INT64_MIN : INT64_MAX;
+}
+#endif
+
+
+/*-------------------------------------------------
+    sub_sat_64 - perform a signed 64 bit - 64 bit
+    subtraction, saturating the result on overflow
+-------------------------------------------------*/
+
+#ifndef sub_sat_64
+#define sub_sat_64 _sub_sat_64
+inline int64_t _sub_sat_64(int64_t a, int64_t b)
+{
+	int64_t diff;
+	if (!__builtin_sub_overflow(a, b, &diff))
+		return diff;
+	return (a < 0) ? INT64_MIN : INT64_MAX;
+}
+#endif
+
+
 
 /***************************************************************************
     INLINE BIT MANIPULATION FUNCTIONS
@@ -348,6 +348,156 @@ inline bool addu_64x64_co(uint64_t a, uint64_t b, uint64_t &sum)
 #endif
 
 
+/*-------------------------------------------------
+    madd_64x64 - perform a signed 64 bit x 64 bit
+    multiply and accumulate the full 128 bit
+    product into hi:lo, returning the low half
+-------------------------------------------------*/
+
+#ifndef madd_64x64
+inline int64_t madd_64x64(int64_t a, int64_t b, int64_t lo, int64_t &hi)
+{
+	int64_t prod_hi;
+	int64_t const prod_lo = mul_64x64(a, b, prod_hi);
+	uint64_t sum;
+	hi += prod_hi + (addu_64x64_co(uint64_t(lo), uint64_t(prod_lo), sum) ? 1 : 0);
+	return int64_t(sum);
+}
+#endif
+
+
+/*-------------------------------------------------
+    maddu_64x64 - perform an unsigned 64 bit x 64
+    bit multiply and accumulate the full 128 bit
+    product into hi:lo, returning the low half
+-------------------------------------------------*/
+
+#ifndef maddu_64x64
+inline uint64_t maddu_64x64(uint64_t a, uint64_t b, uint64_t lo, uint64_t &hi)
+{
+	uint64_t prod_hi;
+	uint64_t const prod_lo = mulu_64x64(a, b, prod_hi);
+	uint64_t sum;
+	hi += prod_hi + (addu_64x64_co(lo, prod_lo, sum) ? 1 : 0);
+	return sum;
+}
+#endif
+
+
+/*-------------------------------------------------
+    add_sat_32 - perform a signed 32 bit + 32 bit
+    addition, saturating the result on overflow
+-------------------------------------------------*/
+
+#ifndef add_sat_32
+constexpr int32_t add_sat_32(int32_t a, int32_t b)
+{
+	int64_t const sum = int64_t(a) + int64_t(b);
+	return int32_t((sum < INT32_MIN) ? INT32_MIN : (sum > INT32_MAX) ? INT32_MAX : sum);
+}
+#endif
+
+
+/*-------------------------------------------------
+    sub_sat_32 - perform a signed 32 bit - 32 bit
+    subtraction, saturating the result on overflow
+-------------------------------------------------*/
+
+#ifndef sub_sat_32
+constexpr int32_t sub_sat_32(int32_t a, int32_t b)
+{
+	int64_t const diff = int64_t(a) - int64_t(b);
+	return int32_t((diff < INT32_MIN) ? INT32_MIN : (diff > INT32_MAX) ? INT32_MAX : diff);
+}
+#endif
+
+
+/*-------------------------------------------------
+    add_sat_64 - perform a signed 64 bit + 64 bit
+    addition, saturating the result on overflow
+-------------------------------------------------*/
+
+#ifndef add_sat_64
+inline int64_t add_sat_64(int64_t a, int64_t b)
+{
+	uint64_t const sum = uint64_t(a) + uint64_t(b);
+	if (((a ^ b) >= 0) && ((a ^ int64_t(sum)) < 0))
+		return (a < 0) ? INT64_MIN : INT64_MAX;
+	return int64_t(sum);
+}
+#endif
+
+
+/*-------------------------------------------------
+    sub_sat_64 - perform a signed 64 bit - 64 bit
+    subtraction, saturating the result on overflow
+-------------------------------------------------*/
+
+#ifndef sub_sat_64
+inline int64_t sub_sat_64(int64_t a, int64_t b)
+{
+	uint64_t const diff = uint64_t(a) - uint64_t(b);
+	if (((a ^ b) < 0) && ((a ^ int64_t(diff)) < 0))
+		return (a < 0) ? INT64_MIN : INT64_MAX;
+	return int64_t(diff);
+}
+#endif
+
+
+/*-------------------------------------------------
+    addu_sat_32 - perform an unsigned 32 bit + 32
+    bit addition, saturating the result on carry
+    out
+-------------------------------------------------*/
+
+#ifndef addu_sat_32
+constexpr uint32_t addu_sat_32(uint32_t a, uint32_t b)
+{
+	return ((a + b) < a) ? ~uint32_t(0) : (a + b);
+}
+#endif
+
+
+/*-------------------------------------------------
+    subu_sat_32 - perform an unsigned 32 bit - 32
+    bit subtraction, saturating the result at zero
+-------------------------------------------------*/
+
+#ifndef subu_sat_32
+constexpr uint32_t subu_sat_32(uint32_t a, uint32_t b)
+{
+	return (a < b) ? 0U : (a - b);
+}
+#endif
+
+
+/*-------------------------------------------------
+    addu_sat_64 - perform an unsigned 64 bit + 64
+    bit addition, saturating the result on carry
+    out
+-------------------------------------------------*/
+
+#ifndef addu_sat_64
+constexpr uint64_t addu_sat_64(uint64_t a, uint64_t b)
+{
+	return ((a + b) < a) ? ~uint64_t(0) : (a + b);
+}
+#endif
+
+
+/*-------------------------------------------------
+    subu_sat_64 - perform an unsigned 64 bit - 64
+    bit subtraction, saturating the result at zero
+-------------------------------------------------*/
+
+#ifndef subu_sat_64
+constexpr uint64_t subu_sat_64(uint64_t a, uint64_t b)
+{
+	return (a < b) ? 0U : (a - b);
+}
+#endif
+
+
 
 /***************************************************************************
     INLINE BIT MANIPULATION FUNCTIONS
@@ -222,7 +222,13 @@ public:
 	}
 
 	// Destructor
-	virtual ~device_info() { }
+	virtual ~device_info()
+	{
+		// report the measured queue latency so input lag can be quantified with -verbose
+		if (m_latency_count != 0)
+			osd_printf_verbose("Input: %s: %u events, average queue-to-poll latency %.2f ms, worst %.2f ms\n",
+					m_name, m_latency_count, average_latency_ms(), max_latency_ms());
+	}
 
 	// Getters
 	running_machine &         machine() const { return m_machine; }
@@ -232,9 +238,30 @@ public:
 	input_module &            module() const { return m_module; }
 	input_device_class        deviceclass() const { return m_deviceclass; }
 
+	// latency statistics; time spent by events between OSD receipt and
+	// being drained into the emulated input state by the per-frame poll
+	uint32_t                  latency_events() const { return m_latency_count; }
+	double                    average_latency_ms() const { return (m_latency_count != 0) ? ticks_to_ms(m_latency_total / m_latency_count) : 0.0; }
+	double                    max_latency_ms() const { return ticks_to_ms(m_latency_max); }
+
 	// Poll and reset methods
 	virtual void poll() { }
 	virtual void reset() = 0;
+
+protected:
+	void track_latency(osd_ticks_t latency)
+	{
+		m_latency_total += latency;
+		m_latency_max = std::max(m_latency_max, latency);
+		m_latency_count++;
+	}
+
+private:
+	static double ticks_to_ms(osd_ticks_t ticks) { return double(ticks) * 1000.0 / double(osd_ticks_per_second()); }
+
+	osd_ticks_t             m_latency_total = 0;
+	osd_ticks_t             m_latency_max = 0;
+	uint32_t                m_latency_count = 0;
 };
 
 //============================================================
@@ -247,7 +274,15 @@ template <class TEvent>
 class event_based_device : public device_info
 {
 private:
-	std::queue<TEvent>   m_event_queue;
+	// events are stamped on arrival so the poll can account the time they
+	// spend waiting in the queue
+	struct stamped_event
+	{
+		TEvent      event;
+		osd_ticks_t queued;
+	};
+
+	std::queue<stamped_event>   m_event_queue;
 
 protected:
 	std::mutex           m_device_lock;
@@ -262,9 +297,10 @@ public:
 
 	void queue_events(const TEvent *events, int count)
 	{
+		osd_ticks_t const now = osd_ticks();
 		std::lock_guard<std::mutex> scope_lock(m_device_lock);
 		for (int i = 0; i < count; i++)
-			m_event_queue.push(events[i]);
+			m_event_queue.push(stamped_event{ events[i], now });
 
 		// If we've gone over the size, remove old events from the queue
 		while (m_event_queue.size() > DEFAULT_EVENT_QUEUE_SIZE)
@@ -276,10 +312,12 @@ public:
 		std::lock_guard<std::mutex> scope_lock(m_device_lock);
 
 		// Process each event until the queue is empty
+		osd_ticks_t const now = osd_ticks();
 		while (!m_event_queue.empty())
 		{
-			TEvent &next_event = m_event_queue.front();
-			process_event(next_event);
+			stamped_event &next_event = m_event_queue.front();
+			track_latency(now - next_event.queued);
+			process_event(next_event.event);
 			m_event_queue.pop();
 		}
 	}
@@ -64,6 +64,10 @@ namespace osd {
 
 bool invalidate_instruction_cache(void const *start, std::size_t size);
 
+// restrict the calling thread to the given host CPUs; threads created
+// afterwards inherit the mask on platforms that support inheritance
+bool set_thread_affinity(std::vector<int> const &cpus);
+
 
 class virtual_memory_allocation
 {
@@ -21,7 +21,11 @@
 #include <memory>
 
 #include <dlfcn.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -102,6 +106,70 @@ int osd_getpid()
 	return getpid();
 }
 
+//============================================================
+//  osd_shared_mem_map
+//============================================================
+
+void *osd_shared_mem_map(const char *name, size_t size, bool &created)
+{
+	std::string path("/");
+	path += name;
+
+	// try to create the object; exclusive so exactly one process wins
+	created = false;
+	int fd = ::shm_open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0660);
+	if (fd >= 0)
+	{
+		// new object: size it and map it writable for the creator to fill
+		created = true;
+		if (::ftruncate(fd, off_t(size)) < 0)
+		{
+			::close(fd);
+			::shm_unlink(path.c_str());
+			return nullptr;
+		}
+		void *const ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		return (ptr == MAP_FAILED) ? nullptr : ptr;
+	}
+
+	// existing object: map it copy-on-write so local writes stay private
+	fd = ::shm_open(path.c_str(), O_RDONLY, 0);
+	if (fd < 0)
+		return nullptr;
+
+	struct stat st;
+	if ((::fstat(fd, &st) < 0) || (size_t(st.st_size) < size))
+	{
+		::close(fd);
+		return nullptr;
+	}
+
+	void *const ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	return (ptr == MAP_FAILED) ? nullptr : ptr;
+}
+
+//============================================================
+//  osd_shared_mem_unmap
+//============================================================
+
+void osd_shared_mem_unmap(void *ptr, size_t size)
+{
+	::munmap(ptr, size);
+}
+
+//============================================================
+//  osd_shared_mem_remove
+//============================================================
+
+void osd_shared_mem_remove(const char *name)
+{
+	std::string path("/");
+	path += name;
+	::shm_unlink(path.c_str());
+}
+
 
 namespace osd {
 
@@ -172,6 +240,22 @@ bool invalidate_instruction_cache(void const *start, std::size_t size)
 }
 
 
+bool set_thread_affinity(std::vector<int> const &cpus)
+{
+#if defined(__linux__)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (int cpu : cpus)
+		if ((cpu >= 0) && (cpu < CPU_SETSIZE))
+			CPU_SET(cpu, &set);
+	return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+	// no portable affinity interface on the BSDs
+	return false;
+#endif
+}
+
+
 void *virtual_memory_allocation::do_alloc(std::initializer_list<std::size_t> blocks, unsigned intent, std::size_t &size, std::size_t &page_size)
 {
 	long const p(sysconf(_SC_PAGE_SIZE));
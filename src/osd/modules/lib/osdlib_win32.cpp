@@ -20,6 +20,8 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <map>
+#include <mutex>
 
 #include <windows.h>
 #include <memoryapi.h>
@@ -191,6 +193,65 @@ int osd_getpid()
 	return GetCurrentProcessId();
 }
 
+//============================================================
+//  osd_shared_mem_map
+//============================================================
+
+// a named mapping only stays visible to other processes while at least
+// one handle to it is open, so remember the handle behind each view
+static std::mutex s_shared_mem_lock;
+static std::map<void *, HANDLE> s_shared_mem_handles;
+
+void *osd_shared_mem_map(const char *name, size_t size, bool &created)
+{
+	created = false;
+	HANDLE const handle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+			DWORD(std::uint64_t(size) >> 32), DWORD(size), name);
+	if (handle == nullptr)
+		return nullptr;
+
+	// an existing object is mapped copy-on-write so local writes stay
+	// private; a new one is mapped writable for the creator to fill
+	bool const existed = (GetLastError() == ERROR_ALREADY_EXISTS);
+	created = !existed;
+	void *const ptr = MapViewOfFile(handle, existed ? FILE_MAP_COPY : FILE_MAP_WRITE, 0, 0, size);
+	if (ptr == nullptr)
+	{
+		CloseHandle(handle);
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(s_shared_mem_lock);
+	s_shared_mem_handles.emplace(ptr, handle);
+	return ptr;
+}
+
+//============================================================
+//  osd_shared_mem_unmap
+//============================================================
+
+void osd_shared_mem_unmap(void *ptr, size_t size)
+{
+	UnmapViewOfFile(ptr);
+
+	std::lock_guard<std::mutex> lock(s_shared_mem_lock);
+	auto const handle = s_shared_mem_handles.find(ptr);
+	if (handle != s_shared_mem_handles.end())
+	{
+		CloseHandle(handle->second);
+		s_shared_mem_handles.erase(handle);
+	}
+}
+
+//============================================================
+//  osd_shared_mem_remove
+//============================================================
+
+void osd_shared_mem_remove(const char *name)
+{
+	// named mappings disappear with their last handle; nothing to do
+}
+
 //============================================================
 //  osd_dynamic_bind
 //============================================================
@@ -263,6 +324,16 @@ bool invalidate_instruction_cache(void const *start, std::size_t size)
 }
 
 
+bool set_thread_affinity(std::vector<int> const &cpus)
+{
+	DWORD_PTR mask = 0;
+	for (int cpu : cpus)
+		if ((cpu >= 0) && (cpu < int(8 * sizeof(mask))))
+			mask |= DWORD_PTR(1) << cpu;
+	return mask && (SetThreadAffinityMask(GetCurrentThread(), mask) != 0);
+}
+
+
 void *virtual_memory_allocation::do_alloc(std::initializer_list<std::size_t> blocks, unsigned intent, std::size_t &size, std::size_t &page_size)
 {
 	SYSTEM_INFO info;
@@ -11,10 +11,45 @@
 
 #include "emu.h"
 #include "osdepend.h"
+#include "modules/lib/osdlib.h"
 #include "modules/lib/osdobj_common.h"
 
 #include <iostream>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+
+namespace {
+
+// layout of the performance counter block published through -statsfile; the
+// block is updated in place once per frame, so external watchers can poll it
+// without attaching to the process. Readers should verify magic/version and
+// retry whenever sequence is odd or changes across the read.
+struct osd_stats_block
+{
+	uint32_t    magic;              // OSD_STATS_MAGIC
+	uint32_t    version;            // OSD_STATS_VERSION; bumped on any layout change
+	uint32_t    size;               // size of this structure in bytes
+	uint32_t    sequence;           // incremented before and after each update (odd = update in progress)
+	uint64_t    frame;              // total frame updates since startup
+	double      emulated_seconds;   // emulated time
+	double      speed_percent;      // most recent speed percentage (1.0 = 100%)
+	uint32_t    paused;             // nonzero if the machine is paused
+	uint32_t    timers_live;        // scheduler timers currently allocated
+	uint32_t    timers_live_peak;   // high-water mark of live timers
+	uint32_t    timers_allocated;   // total timer initializations
+	uint32_t    timers_recycled;    // initializations served from the free list
+};
+
+constexpr uint32_t OSD_STATS_MAGIC = 0x4d535430;    // 'MST0'
+constexpr uint32_t OSD_STATS_VERSION = 1;
+
+} // anonymous namespace
+
 
 const options_entry osd_options::s_option_entries[] =
 {
@@ -50,7 +85,9 @@ const options_entry osd_options::s_option_entries[] =
 
 	{ nullptr,                                nullptr,          OPTION_HEADER,    "OSD PERFORMANCE OPTIONS" },
 	{ OSDOPTION_NUMPROCESSORS ";np",          OSDOPTVAL_AUTO,   OPTION_STRING,    "number of processors; this overrides the number the system reports" },
+	{ OSDOPTION_THREADAFFINITY,               OSDOPTVAL_AUTO,   OPTION_STRING,    "comma-separated list of host CPUs (ranges allowed) to restrict threads to; on NUMA hosts list one node's CPUs to keep memory node-local" },
 	{ OSDOPTION_BENCH,                        "0",              OPTION_INTEGER,   "benchmark for the given number of emulated seconds; implies -video none -sound none -nothrottle" },
+	{ OSDOPTION_STATSFILE,                    OSDOPTVAL_NONE,   OPTION_STRING,    "file to publish per-frame performance counters into via a shared mapping (e.g. /dev/shm/mame.stats)" },
 
 	{ nullptr,                                nullptr,          OPTION_HEADER,    "OSD VIDEO OPTIONS" },
 // OS X can be trusted to have working hardware OpenGL, so default to it on for the best user experience
@@ -161,6 +198,7 @@ const options_entry osd_options::s_option_entries[] =
 	{ OSDOPTION_BGFX_SHADOW_MASK,             "slot-mask.png",   OPTION_STRING, "shadow mask texture name" },
 	{ OSDOPTION_BGFX_LUT,                     "",                OPTION_STRING, "LUT texture name" },
 	{ OSDOPTION_BGFX_AVI_NAME,                OSDOPTVAL_AUTO,    OPTION_STRING, "filename for BGFX output logging" },
+	{ OSDOPTION_BGFX_LOWLATENCY,              "0",               OPTION_BOOLEAN, "flip immediately after rendering and keep a single frame in flight to minimize presentation latency" },
 
 		// End of list
 	{ nullptr }
@@ -463,6 +501,40 @@ void osd_common_t::init(running_machine &machine)
 		m_watchdog = std::make_unique<osd_watchdog>();
 		m_watchdog->setTimeout(watchdog_timeout);
 	}
+
+	// set up the shared performance counter block if requested
+	stats_init();
+
+	// restrict our threads to the requested host CPUs; worker threads are
+	// created later and inherit the mask, and first-touch allocation then
+	// keeps large regions local to the node those CPUs belong to
+	if (strcmp(options.thread_affinity(), OSDOPTVAL_AUTO) != 0)
+	{
+		std::vector<int> cpus;
+		char const *s = options.thread_affinity();
+		while (*s != 0)
+		{
+			char *end;
+			long first = strtol(s, &end, 10);
+			long last = first;
+			if (end == s)
+				break;
+			s = end;
+			if (*s == '-')
+			{
+				last = strtol(s + 1, &end, 10);
+				s = end;
+			}
+			for (long cpu = first; cpu <= last; cpu++)
+				cpus.push_back(int(cpu));
+			if (*s == ',')
+				s++;
+		}
+		if (cpus.empty() || (*s != 0) || !osd::set_thread_affinity(cpus))
+			osd_printf_warning("Unable to apply thread_affinity value '%s'\n", options.thread_affinity());
+		else
+			osd_printf_verbose("Restricted threads to %d host CPU(s)\n", int(cpus.size()));
+	}
 }
 
 
@@ -483,11 +555,104 @@ void osd_common_t::update(bool skip_redraw)
 	if (m_watchdog != nullptr)
 		m_watchdog->reset();
 
+	stats_update();
+
 	update_slider_list();
 
 }
 
 
+//-------------------------------------------------
+//  stats_init - map the shared performance
+//  counter block if -statsfile is configured
+//-------------------------------------------------
+
+void osd_common_t::stats_init()
+{
+#ifndef _WIN32
+	const char *path = m_options.stats_file();
+	if ((*path == 0) || (strcmp(path, OSDOPTVAL_NONE) == 0))
+		return;
+
+	int fd = ::open(path, O_CREAT | O_RDWR, 0644);
+	if (fd < 0)
+	{
+		osd_printf_error("Unable to open performance stats file %s\n", path);
+		return;
+	}
+	if (ftruncate(fd, sizeof(osd_stats_block)) < 0)
+	{
+		osd_printf_error("Unable to size performance stats file %s\n", path);
+		::close(fd);
+		return;
+	}
+	void *block = mmap(nullptr, sizeof(osd_stats_block), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (block == MAP_FAILED)
+	{
+		osd_printf_error("Unable to map performance stats file %s\n", path);
+		::close(fd);
+		return;
+	}
+
+	osd_stats_block &stats = *reinterpret_cast<osd_stats_block *>(block);
+	memset(&stats, 0, sizeof(stats));
+	stats.version = OSD_STATS_VERSION;
+	stats.size = sizeof(stats);
+	stats.magic = OSD_STATS_MAGIC;
+
+	m_stats_block = block;
+	m_stats_fd = fd;
+	osd_printf_verbose("Publishing performance stats to %s\n", path);
+#endif
+}
+
+
+//-------------------------------------------------
+//  stats_update - publish the current counters;
+//  called once per frame from update()
+//-------------------------------------------------
+
+void osd_common_t::stats_update()
+{
+	if (m_stats_block == nullptr)
+		return;
+
+	osd_stats_block &stats = *reinterpret_cast<osd_stats_block *>(m_stats_block);
+	stats.sequence++;
+	stats.frame = machine().video().frame_update_count();
+	stats.emulated_seconds = machine().time().as_double();
+	stats.speed_percent = machine().video().speed_percent();
+	stats.paused = machine().paused() ? 1 : 0;
+	stats.timers_live = machine().scheduler().timers_live();
+	stats.timers_live_peak = machine().scheduler().timers_live_peak();
+	stats.timers_allocated = machine().scheduler().timers_allocated();
+	stats.timers_recycled = machine().scheduler().timers_recycled();
+	stats.sequence++;
+}
+
+
+//-------------------------------------------------
+//  stats_exit - tear down the shared performance
+//  counter block
+//-------------------------------------------------
+
+void osd_common_t::stats_exit()
+{
+#ifndef _WIN32
+	if (m_stats_block != nullptr)
+	{
+		munmap(m_stats_block, sizeof(osd_stats_block));
+		m_stats_block = nullptr;
+	}
+	if (m_stats_fd >= 0)
+	{
+		::close(m_stats_fd);
+		m_stats_fd = -1;
+	}
+#endif
+}
+
+
 //-------------------------------------------------
 //  init_debugger - perform debugger-specific
 //  initialization
@@ -748,6 +913,8 @@ void osd_common_t::window_exit()
 
 void osd_common_t::osd_exit()
 {
+	stats_exit();
+
 	m_mod_man.exit();
 
 	exit_subsystems();
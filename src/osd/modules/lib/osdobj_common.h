@@ -44,7 +44,9 @@
 #define OSDOPTION_WATCHDOG              "watchdog"
 
 #define OSDOPTION_NUMPROCESSORS         "numprocessors"
+#define OSDOPTION_THREADAFFINITY        "thread_affinity"
 #define OSDOPTION_BENCH                 "bench"
+#define OSDOPTION_STATSFILE             "statsfile"
 
 #define OSDOPTION_VIDEO                 "video"
 #define OSDOPTION_NUMSCREENS            "numscreens"
@@ -92,6 +94,7 @@
 #define OSDOPTION_BGFX_SHADOW_MASK      "bgfx_shadow_mask"
 #define OSDOPTION_BGFX_LUT              "bgfx_lut"
 #define OSDOPTION_BGFX_AVI_NAME         "bgfx_avi_name"
+#define OSDOPTION_BGFX_LOWLATENCY       "bgfx_lowlatency"
 
 //============================================================
 //  TYPE DEFINITIONS
@@ -115,7 +118,9 @@ public:
 
 	// performance options
 	const char *numprocessors() const { return value(OSDOPTION_NUMPROCESSORS); }
+	const char *thread_affinity() const { return value(OSDOPTION_THREADAFFINITY); }
 	int bench() const { return int_value(OSDOPTION_BENCH); }
+	const char *stats_file() const { return value(OSDOPTION_STATSFILE); }
 
 	// video options
 	const char *video() const { return value(OSDOPTION_VIDEO); }
@@ -168,6 +173,7 @@ public:
 	const char *bgfx_shadow_mask() const { return value(OSDOPTION_BGFX_SHADOW_MASK); }
 	const char *bgfx_lut() const { return value(OSDOPTION_BGFX_LUT); }
 	const char *bgfx_avi_name() const { return value(OSDOPTION_BGFX_AVI_NAME); }
+	bool bgfx_lowlatency() const { return bool_value(OSDOPTION_BGFX_LOWLATENCY); }
 
 	// PortAudio options
 	const char *pa_api() const { return value(OSDOPTION_PA_API); }
@@ -306,8 +312,16 @@ protected:
 	std::vector<ui::menu_item> m_sliders;
 
 private:
+	void stats_init();
+	void stats_update();
+	void stats_exit();
+
 	std::vector<const char *> m_video_names;
 	std::unordered_map<std::string, std::string> m_option_descs;
+
+	// shared performance counter block (see -statsfile)
+	void *  m_stats_block = nullptr;
+	int     m_stats_fd = -1;
 };
 
 
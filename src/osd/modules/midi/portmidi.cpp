@@ -11,6 +11,7 @@
 #ifndef NO_USE_MIDI
 
 #include <portmidi.h>
+#include <porttime.h>
 #include "osdcore.h"
 #include "modules/osdmodule.h"
 #include "midi_module.h"
@@ -34,13 +35,17 @@ public:
 
 static const int RX_EVENT_BUF_SIZE = 512;
 
+// nonzero output latency makes portmidi honor event timestamps, delivering
+// scheduled writes from its timer thread instead of the caller
+static const int TX_LATENCY_MS = 2;
+
 #define MIDI_SYSEX  0xf0
 #define MIDI_EOX    0xf7
 
 class osd_midi_device_pm : public osd_midi_device
 {
 public:
-	osd_midi_device_pm(): pmStream(nullptr), xmit_cnt(0), last_status(0), rx_sysex(false) { }
+	osd_midi_device_pm(): pmStream(nullptr), xmit_stamp(0), xmit_cnt(0), last_status(0), rx_sysex(false) { }
 	virtual ~osd_midi_device_pm() { }
 	virtual bool open_input(const char *devname) override;
 	virtual bool open_output(const char *devname) override;
@@ -48,10 +53,12 @@ public:
 	virtual bool poll() override;
 	virtual int read(uint8_t *pOut) override;
 	virtual void write(uint8_t data) override;
+	virtual void write_at(uint8_t data, int delay_ms) override;
 
 private:
 	PortMidiStream *pmStream;
 	PmEvent rx_evBuf[RX_EVENT_BUF_SIZE];
+	PmTimestamp xmit_stamp;
 	uint8_t xmit_in[4]; // Pm_Messages mean we can at most have 3 residue bytes
 	int xmit_cnt;
 	uint8_t last_status;
@@ -188,7 +195,7 @@ bool osd_midi_device_pm::open_output(const char *devname)
 
 	if (found_dev >= 0)
 	{
-		if (Pm_OpenOutput(&stm, found_dev, nullptr, 100, nullptr, nullptr, 0) == pmNoError)
+		if (Pm_OpenOutput(&stm, found_dev, nullptr, 100, nullptr, nullptr, TX_LATENCY_MS) == pmNoError)
 		{
 			pmStream = stm;
 			return true;
@@ -342,7 +349,7 @@ void osd_midi_device_pm::write(uint8_t data)
 {
 	int bytes_needed = 0;
 	PmEvent ev;
-	ev.timestamp = 0;   // use the current time
+	ev.timestamp = xmit_stamp;  // 0 = the current time
 
 //  printf("write: %02x (%d)\n", data, xmit_cnt);
 
@@ -463,6 +470,13 @@ void osd_midi_device_pm::write(uint8_t data)
 	}
 
 }
+
+void osd_midi_device_pm::write_at(uint8_t data, int delay_ms)
+{
+	xmit_stamp = Pt_Time() + delay_ms;
+	write(data);
+	xmit_stamp = 0;
+}
 #else
 	#include "modules/osdmodule.h"
 	#include "midi_module.h"
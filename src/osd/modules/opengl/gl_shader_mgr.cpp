@@ -27,6 +27,12 @@ static char const *const glsl_mamebm_fsh_files [GLSL_SHADER_FEAT_INT_NUMBER] =
 	"/tmp/glsl_bicubic_rgb32_dir.fsh",                         // rgb32 dir bicubic
 };
 
+static char const *const glsl_mamebm_lut_fsh_files [2] =
+{
+	"/tmp/glsl_plain_idx16_lut.fsh",                           // idx16 lut plain
+	"/tmp/glsl_bilinear_idx16_lut.fsh"                         // idx16 lut bilinear
+};
+
 #else // GLSL_SOURCE_ON_DISK
 
 #include "shader/glsl_general.vsh.c"
@@ -35,6 +41,9 @@ static char const *const glsl_mamebm_fsh_files [GLSL_SHADER_FEAT_INT_NUMBER] =
 #include "shader/glsl_bilinear_rgb32_dir.fsh.c"
 #include "shader/glsl_bicubic_rgb32_dir.fsh.c"
 
+#include "shader/glsl_plain_idx16_lut.fsh.c"
+#include "shader/glsl_bilinear_idx16_lut.fsh.c"
+
 static char const *const glsl_mamebm_vsh_sources [GLSL_VERTEX_SHADER_INT_NUMBER] =
 {
 	glsl_general_vsh_src                                    // general
@@ -47,6 +56,12 @@ static char const *const glsl_mamebm_fsh_sources [GLSL_SHADER_FEAT_INT_NUMBER] =
 	glsl_bicubic_rgb32_dir_fsh_src,                          // rgb32 dir bicubic
 };
 
+static char const *const glsl_mamebm_lut_fsh_sources [2] =
+{
+	glsl_plain_idx16_lut_fsh_src,                            // idx16 lut plain
+	glsl_bilinear_idx16_lut_fsh_src                          // idx16 lut bilinear
+};
+
 #endif // GLSL_SOURCE_ON_DISK
 
 static char const *const glsl_mamebm_filter_names [GLSL_SHADER_FEAT_MAX_NUMBER] =
@@ -62,6 +77,11 @@ static GLhandleARB glsl_mamebm_programs [GLSL_SHADER_FEAT_MAX_NUMBER+9] =
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0  /* rgb32 dir: plain, bilinear, bicubic, custom0-9, .. */
 };
 
+static GLhandleARB glsl_mamebm_lut_programs [2] =
+{
+	0, 0                                    /* idx16 lut: plain, bilinear */
+};
+
 /**
  * fragment shader -> vertex shader mapping
  */
@@ -83,6 +103,11 @@ static GLhandleARB glsl_mamebm_fsh_shader [GLSL_SHADER_FEAT_MAX_NUMBER+9] =
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0  /* rgb32 dir: plain, bilinear, bicubic, custom0-9 */
 };
 
+static GLhandleARB glsl_mamebm_lut_fsh_shader [2] =
+{
+	0, 0                                    /* idx16 lut: plain, bilinear */
+};
+
 static GLhandleARB glsl_scrn_programs [10] =
 {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0  /* rgb32: custom0-9, .. */
@@ -114,6 +139,14 @@ GLhandleARB glsl_shader_get_program_mamebm(int glslShaderFeature, int idx)
 	return glsl_mamebm_programs[glslShaderFeature+idx];
 }
 
+GLhandleARB glsl_shader_get_program_mamebm_lut(int glslShaderFeature)
+{
+	if ( !(GLSL_SHADER_FEAT_PLAIN == glslShaderFeature || GLSL_SHADER_FEAT_BILINEAR == glslShaderFeature) )
+		return 0;
+
+	return glsl_mamebm_lut_programs[glslShaderFeature];
+}
+
 GLhandleARB glsl_shader_get_program_scrn(int idx)
 {
 	if ( !(0 <= idx && idx < 10) )
@@ -161,6 +194,24 @@ glsl_shader_info *glsl_shader_init(osd_gl_context *gl_ctx)
 	#endif
 	}
 	if (err) return nullptr;
+
+	for (j=0; !err && j<2; j++)
+	{
+	#ifdef GLSL_SOURCE_ON_DISK
+		if(glsl_mamebm_lut_fsh_files[j])
+			err = gl_compile_shader_files  (&glsl_mamebm_lut_programs[j],
+							&glsl_mamebm_vsh_shader[glsl_mamebm_fsh2vsh[j]],
+							&glsl_mamebm_lut_fsh_shader[j],
+							nullptr /*precompiled*/, glsl_mamebm_lut_fsh_files[j], 0);
+	#else
+		if(glsl_mamebm_lut_fsh_sources[j])
+			err = gl_compile_shader_sources(&glsl_mamebm_lut_programs[j],
+							&glsl_mamebm_vsh_shader[glsl_mamebm_fsh2vsh[j]],
+							&glsl_mamebm_lut_fsh_shader[j],
+							nullptr /*precompiled*/, glsl_mamebm_lut_fsh_sources[j]);
+	#endif
+	}
+	if (err) return nullptr;
 	return new glsl_shader_info{ 0 };
 }
 
@@ -187,6 +238,14 @@ int glsl_shader_free(glsl_shader_info *shinfo)
 			(void) gl_delete_shader( &glsl_mamebm_programs[j], nullptr, nullptr);
 	}
 
+	for (int j=0; j<2; j++)
+	{
+		if ( glsl_mamebm_lut_fsh_shader[j] )
+			(void) gl_delete_shader(nullptr, nullptr, &glsl_mamebm_lut_fsh_shader[j]);
+		if ( glsl_mamebm_lut_programs[j] )
+			(void) gl_delete_shader( &glsl_mamebm_lut_programs[j], nullptr, nullptr);
+	}
+
 	for (int i=0; i<10; i++)
 	{
 		if ( glsl_scrn_vsh_shader[i] )
@@ -41,6 +41,12 @@ int glsl_shader_free(glsl_shader_info *shinfo);
  */
 GLhandleARB glsl_shader_get_program_mamebm(int glslShaderFeature, int idx);
 
+/**
+ * idx16 LUT variant doing the palette lookup in the fragment shader;
+ * only available for the plain and bilinear filters, otherwise 0
+ */
+GLhandleARB glsl_shader_get_program_mamebm_lut(int glslShaderFeature);
+
 const char * glsl_shader_get_filter_name_mamebm(int glslShaderFeature);
 
 int glsl_shader_add_mamebm(glsl_shader_info *shinfo, const char * custShaderPrefix, int idx);
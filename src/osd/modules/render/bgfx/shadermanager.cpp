@@ -19,8 +19,17 @@
 
 #include "shadermanager.h"
 
+std::mutex shader_manager::s_file_cache_lock;
+std::map<std::string, std::vector<uint8_t> > shader_manager::s_file_cache;
+
 shader_manager::~shader_manager()
 {
+	if (m_prefetch_queue != nullptr)
+	{
+		osd_work_queue_wait(m_prefetch_queue, osd_ticks_per_second() * 10);
+		osd_work_queue_free(m_prefetch_queue);
+	}
+
 	for (std::pair<std::string, bgfx::ShaderHandle> shader : m_shaders)
 	{
 		bgfx::destroy(shader.second);
@@ -39,9 +48,9 @@ bgfx::ShaderHandle shader_manager::shader(std::string name)
 	return load_shader(name);
 }
 
-bgfx::ShaderHandle shader_manager::load_shader(std::string name)
+std::string shader_manager::shader_directory(osd_options& options)
 {
-	std::string shader_path(m_options.bgfx_path());
+	std::string shader_path(options.bgfx_path());
 	shader_path += PATH_SEPARATOR "shaders" PATH_SEPARATOR;
 	switch (bgfx::getRendererType())
 	{
@@ -80,6 +89,12 @@ bgfx::ShaderHandle shader_manager::load_shader(std::string name)
 	}
 	shader_path += PATH_SEPARATOR;
 	osd_subst_env(shader_path, shader_path);
+	return shader_path;
+}
+
+bgfx::ShaderHandle shader_manager::load_shader(std::string name)
+{
+	std::string shader_path = shader_directory(m_options);
 
 	const bgfx::Memory* mem = load_mem(shader_path + name + ".bin");
 	if (mem != nullptr)
@@ -94,8 +109,79 @@ bgfx::ShaderHandle shader_manager::load_shader(std::string name)
 	return BGFX_INVALID_HANDLE;
 }
 
+void shader_manager::prefetch_binaries()
+{
+	if (m_prefetch_queue == nullptr)
+	{
+		m_prefetch_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	}
+	osd_work_item_queue(m_prefetch_queue, prefetch_binaries_callback, new std::string(shader_directory(m_options)), WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+void* shader_manager::prefetch_binaries_callback(void* param, int threadid)
+{
+	std::unique_ptr<std::string> shader_path(reinterpret_cast<std::string*>(param));
+
+	osd::directory::ptr directory = osd::directory::open(*shader_path);
+	if (directory == nullptr)
+	{
+		return nullptr;
+	}
+
+	for (const osd::directory::entry* entry = directory->read(); entry != nullptr; entry = directory->read())
+	{
+		if (entry->type != osd::directory::entry::entry_type::FILE)
+		{
+			continue;
+		}
+
+		std::string name(entry->name);
+		std::string extension(".bin");
+
+		// Does the name have at least one character in addition to ".bin"?
+		if (name.length() <= extension.length() || name.substr(name.length() - extension.length()) != extension)
+		{
+			continue;
+		}
+
+		std::string path = *shader_path + name;
+		{
+			std::lock_guard<std::mutex> lock(s_file_cache_lock);
+			if (s_file_cache.find(path) != s_file_cache.end())
+			{
+				continue;
+			}
+		}
+
+		bx::FileReader reader;
+		if (bx::open(&reader, path.c_str()))
+		{
+			std::vector<uint8_t> data(bx::getSize(&reader));
+			bx::read(&reader, &data[0], uint32_t(data.size()));
+			bx::close(&reader);
+
+			std::lock_guard<std::mutex> lock(s_file_cache_lock);
+			s_file_cache.emplace(std::move(path), std::move(data));
+		}
+	}
+	return nullptr;
+}
+
 const bgfx::Memory* shader_manager::load_mem(std::string name)
 {
+	// the prefetch pass caches binaries across machine restarts
+	{
+		std::lock_guard<std::mutex> lock(s_file_cache_lock);
+		auto cached = s_file_cache.find(name);
+		if (cached != s_file_cache.end())
+		{
+			const bgfx::Memory* mem = bgfx::alloc(uint32_t(cached->second.size()) + 1);
+			memcpy(mem->data, &cached->second[0], cached->second.size());
+			mem->data[mem->size - 1] = '\0';
+			return mem;
+		}
+	}
+
 	bx::FileReader reader;
 	if (bx::open(&reader, name.c_str()))
 	{
@@ -105,6 +191,10 @@ const bgfx::Memory* shader_manager::load_mem(std::string name)
 		bx::close(&reader);
 
 		mem->data[mem->size - 1] = '\0';
+
+		// remember the binary for later sessions
+		std::lock_guard<std::mutex> lock(s_file_cache_lock);
+		s_file_cache.emplace(std::move(name), std::vector<uint8_t>(mem->data, mem->data + size));
 		return mem;
 	}
 	else
@@ -19,23 +19,37 @@
 #include "modules/lib/osdobj_common.h"
 
 #include <map>
+#include <mutex>
 #include <string>
+#include <vector>
 
 
 class shader_manager {
 public:
-	shader_manager(osd_options& options) : m_options(options) { }
+	shader_manager(osd_options& options) : m_options(options), m_prefetch_queue(nullptr) { }
 	~shader_manager();
 
 	// Getters
 	bgfx::ShaderHandle shader(std::string name);
 
+	// queues a background read of every shader binary for the active
+	// backend, so the first frame of a chain doesn't wait on the disk
+	void prefetch_binaries();
+
 private:
 	bgfx::ShaderHandle load_shader(std::string name);
 	static const bgfx::Memory* load_mem(std::string name);
+	static std::string shader_directory(osd_options& options);
+	static void* prefetch_binaries_callback(void* param, int threadid);
 
 	std::map<std::string, bgfx::ShaderHandle>   m_shaders;
 	osd_options&                                m_options;
+	osd_work_queue*                             m_prefetch_queue;
+
+	// raw shader binaries, kept across machine restarts so every machine
+	// swap after the first reloads its chains from memory
+	static std::mutex                                   s_file_cache_lock;
+	static std::map<std::string, std::vector<uint8_t> > s_file_cache;
 };
 
 #endif // __DRAWBGFX_SHADER_MANAGER__
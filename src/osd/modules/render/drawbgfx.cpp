@@ -244,7 +244,9 @@ int renderer_bgfx::create()
 		init.vendorId = BGFX_PCI_ID_NONE;
 		init.resolution.width = wdim.width();
 		init.resolution.height = wdim.height();
-		init.resolution.reset = BGFX_RESET_NONE;
+		init.resolution.reset = reset_flags();
+		if (m_options.bgfx_lowlatency())
+			init.resolution.maxFrameLatency = 1;
 		if (backend == "auto")
 		{
 		}
@@ -281,7 +283,7 @@ int renderer_bgfx::create()
 			printf("Unknown backend type '%s', going with auto-detection\n", backend.c_str());
 		}
 		bgfx::init(init);
-		bgfx::reset(m_width[win->index()], m_height[win->index()], video_config.waitvsync ? BGFX_RESET_VSYNC : BGFX_RESET_NONE);
+		bgfx::reset(m_width[win->index()], m_height[win->index()], reset_flags());
 		// Enable debug text.
 		bgfx::setDebug(m_options.bgfx_debug() ? BGFX_DEBUG_STATS : BGFX_DEBUG_TEXT);
 		m_dimensions = osd_dim(m_width[0], m_height[0]);
@@ -293,6 +295,10 @@ int renderer_bgfx::create()
 	m_shaders = new shader_manager(m_options);
 	m_effects = new effect_manager(m_options, *m_shaders);
 
+	// start reading the shader binaries for this backend in the background
+	// so the chains don't hit the disk when they load on the first frame
+	m_shaders->prefetch_binaries();
+
 	if (win->index() != 0)
 	{
 #ifdef OSD_WINDOWS
@@ -954,6 +960,21 @@ void renderer_bgfx::add_audio_to_recording(const int16_t *buffer, int samples_th
 	}
 }
 
+//============================================================
+//  reset_flags
+//============================================================
+
+uint32_t renderer_bgfx::reset_flags() const
+{
+	uint32_t flags = video_config.waitvsync ? BGFX_RESET_VSYNC : BGFX_RESET_NONE;
+
+	// flip as soon as rendering is submitted rather than on the next frame's
+	// submit, trading a frame of CPU/GPU overlap for a frame less of latency
+	if (m_options.bgfx_lowlatency())
+		flags |= BGFX_RESET_FLIP_AFTER_RENDER | BGFX_RESET_FLUSH_AFTER_RENDER;
+	return flags;
+}
+
 bool renderer_bgfx::update_dimensions()
 {
 	std::shared_ptr<osd_window> win = assert_window();
@@ -966,7 +987,7 @@ bool renderer_bgfx::update_dimensions()
 	{
 		if ((m_dimensions != osd_dim(width, height)))
 		{
-			bgfx::reset(width, height, video_config.waitvsync ? BGFX_RESET_VSYNC : BGFX_RESET_NONE);
+			bgfx::reset(width, height, reset_flags());
 			m_dimensions = osd_dim(width, height);
 		}
 	}
@@ -974,7 +995,7 @@ bool renderer_bgfx::update_dimensions()
 	{
 		if ((m_dimensions != osd_dim(width, height)))
 		{
-			bgfx::reset(win->main_window()->get_size().width(), win->main_window()->get_size().height(), video_config.waitvsync ? BGFX_RESET_VSYNC : BGFX_RESET_NONE);
+			bgfx::reset(win->main_window()->get_size().width(), win->main_window()->get_size().height(), reset_flags());
 			m_dimensions = osd_dim(width, height);
 
 			delete m_framebuffer;
@@ -113,6 +113,7 @@ private:
 	void put_line(float x0, float y0, float x1, float y1, float r, uint32_t rgba, ScreenVertex* vertex, float fth = 1.0f);
 
 	void set_bgfx_state(uint32_t blend);
+	uint32_t reset_flags() const;
 
 	static uint32_t u32Color(uint32_t r, uint32_t g, uint32_t b, uint32_t a);
 
@@ -690,6 +690,10 @@ void renderer_ogl::destroy_all_textures()
 			}
 
 			glDeleteTextures(1, (GLuint *)&texture->texture);
+			if ( texture->lut_texture )
+			{
+				glDeleteTextures(1, (GLuint *)&texture->lut_texture);
+			}
 			if ( texture->data_own )
 			{
 				free(texture->data);
@@ -1504,6 +1508,18 @@ void renderer_ogl::texture_compute_type_subroutine(const render_texinfo *texsour
 		texture->nocopy = true;
 	}
 
+	// paletted screen bitmaps can skip the copy step as well when the
+	// fragment shader does the palette lookup from a LUT texture
+	if ( texture->type == TEXTURE_TYPE_SHADER &&
+			texture->format == SDL_TEXFORMAT_PALETTE16 &&
+			m_glsl_program_num == 1 &&
+			!texture->borderpix && texsource->palette_length > 0 &&
+			glsl_shader_get_program_mamebm_lut(glsl_shader_feature) )
+	{
+		texture->lut = true;
+		texture->nocopy = true;
+	}
+
 	if( texture->type == TEXTURE_TYPE_NONE &&
 		m_usepbo && !texture->nocopy )
 	{
@@ -1753,7 +1769,54 @@ int renderer_ogl::texture_shader_create(const render_texinfo *texsource, ogl_tex
 		texture->mpass_textureunit[1] = GL_TEXTURE2;
 	}
 
-	for(i=0; i<m_glsl_program_num; i++)
+	if ( texture->lut )
+	{
+		// single-pass idx16 path; the program stays with the texture so
+		// mixed-format screens each bind their own
+		assert( m_glsl_program_num == 1 );
+
+		texture->lut_table_width = 256;
+		texture->lut_table_height = (texsource->palette_length + 255) / 256;
+		texture->lut_table_height_create = get_valid_pow2_value (texture->lut_table_height, texture->texpow2);
+
+		texture->lut_program = glsl_shader_get_program_mamebm_lut(glsl_shader_feature);
+		pfn_glUseProgramObjectARB(texture->lut_program);
+
+		uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "color_texture");
+		pfn_glUniform1iARB(uniform_location, 0);
+		uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "colortable_texture");
+		pfn_glUniform1iARB(uniform_location, 1);
+		GL_CHECK_ERROR_NORMAL();
+
+		{
+			GLfloat color_texture_sz[2] = { (GLfloat)texture->rawwidth, (GLfloat)texture->rawheight };
+			uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "color_texture_sz");
+			pfn_glUniform2fvARB(uniform_location, 1, &(color_texture_sz[0]));
+			GL_CHECK_ERROR_NORMAL();
+		}
+
+		{
+			GLfloat color_texture_pow2_sz[2] = { (GLfloat)texture->rawwidth_create, (GLfloat)texture->rawheight_create };
+			uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "color_texture_pow2_sz");
+			pfn_glUniform2fvARB(uniform_location, 1, &(color_texture_pow2_sz[0]));
+			GL_CHECK_ERROR_NORMAL();
+		}
+
+		{
+			GLfloat colortable_sz[2] = { (GLfloat)texture->lut_table_width, (GLfloat)texture->lut_table_height };
+			uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "colortable_sz");
+			pfn_glUniform2fvARB(uniform_location, 1, &(colortable_sz[0]));
+			GL_CHECK_ERROR_NORMAL();
+		}
+
+		{
+			GLfloat colortable_pow2_sz[2] = { (GLfloat)texture->lut_table_width, (GLfloat)texture->lut_table_height_create };
+			uniform_location = pfn_glGetUniformLocationARB(texture->lut_program, "colortable_pow2_sz");
+			pfn_glUniform2fvARB(uniform_location, 1, &(colortable_pow2_sz[0]));
+			GL_CHECK_ERROR_NORMAL();
+		}
+	}
+	else for(i=0; i<m_glsl_program_num; i++)
 	{
 		if ( i<=m_glsl_program_mb2sc )
 		{
@@ -1794,7 +1857,8 @@ int renderer_ogl::texture_shader_create(const render_texinfo *texsource, ogl_tex
 		GL_CHECK_ERROR_NORMAL();
 	}
 
-	pfn_glUseProgramObjectARB(m_glsl_program[0]); // start with 1st shader
+	if ( !texture->lut )
+		pfn_glUseProgramObjectARB(m_glsl_program[0]); // start with 1st shader
 
 	if( m_glsl_program_num > 1 )
 	{
@@ -1865,18 +1929,25 @@ int renderer_ogl::texture_shader_create(const render_texinfo *texsource, ogl_tex
 
 	dummy = (uint32_t *) malloc(texture->rawwidth_create * texture->rawheight_create * sizeof(uint32_t));
 	memset(dummy, 0, texture->rawwidth_create * texture->rawheight_create * sizeof(uint32_t));
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8,
-			texture->rawwidth_create, texture->rawheight_create,
-			0,
-			GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, dummy);
-			glFinish(); // should not be necessary, .. but make sure we won't access the memory after free
+	if ( texture->lut )
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA16,
+				texture->rawwidth_create, texture->rawheight_create,
+				0,
+				GL_ALPHA, GL_UNSIGNED_SHORT, dummy);
+	else
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8,
+				texture->rawwidth_create, texture->rawheight_create,
+				0,
+				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, dummy);
+	glFinish(); // should not be necessary, .. but make sure we won't access the memory after free
 	free(dummy);
 
-	if ((PRIMFLAG_GET_SCREENTEX(flags)) && video_config.filter)
+	if ((PRIMFLAG_GET_SCREENTEX(flags)) && video_config.filter && !texture->lut)
 	{
 		assert( glsl_shader_feature == GLSL_SHADER_FEAT_PLAIN );
 
-		// screen textures get the user's choice of filtering
+		// screen textures get the user's choice of filtering; raw indices
+		// must never be filtered, the LUT shaders handle that themselves
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	}
@@ -1899,6 +1970,28 @@ int renderer_ogl::texture_shader_create(const render_texinfo *texsource, ogl_tex
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 	}
 
+	if ( texture->lut )
+	{
+		// GL_TEXTURE1: the palette LUT the fragment shader indexes into
+		glGenTextures(1, (GLuint *)&texture->lut_texture);
+		pfn_glActiveTexture(GL_TEXTURE1);
+		glBindTexture(GL_TEXTURE_2D, texture->lut_texture);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->lut_table_width);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8,
+				texture->lut_table_width, texture->lut_table_height_create,
+				0,
+				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		pfn_glActiveTexture(GL_TEXTURE0);
+
+		osd_printf_verbose("GL texture: lut %dx%d (pow2 %dx%d)\n",
+			texture->lut_table_width, texture->lut_table_height,
+			texture->lut_table_width, texture->lut_table_height_create);
+	}
+
 	GL_CHECK_ERROR_NORMAL();
 
 	return 0;
@@ -2420,9 +2513,29 @@ static void texture_set_data(ogl_texture_info *texture, const render_texinfo *te
 		else
 			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
-		// and upload the image
-		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
-				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		// and upload the image; LUT textures take the raw indices
+		if (texture->lut)
+			glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
+					GL_ALPHA, GL_UNSIGNED_SHORT, texture->data);
+		else
+			glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
+					GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+
+		// refresh the LUT along with the pixels in case palette entries
+		// changed since the last frame
+		if (texture->lut)
+		{
+			std::vector<uint32_t> lut(texture->lut_table_width * texture->lut_table_height, 0);
+			for (uint32_t i = 0; i < texsource->palette_length; i++)
+				lut[i] = 0xff000000 | uint32_t(texsource->palette[i]);
+
+			pfn_glActiveTexture(GL_TEXTURE1);
+			glBindTexture(GL_TEXTURE_2D, texture->lut_texture);
+			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->lut_table_width);
+			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texture->lut_table_width, texture->lut_table_height,
+					GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, &lut[0]);
+			pfn_glActiveTexture(GL_TEXTURE0);
+		}
 	}
 	else if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 	{
@@ -2660,7 +2773,7 @@ void renderer_ogl::texture_shader_update(ogl_texture_info *texture, render_conta
 		vid_attributes[1] = settings.m_contrast;
 		vid_attributes[2] = settings.m_brightness;
 		vid_attributes[3] = 0.0f;
-		uniform_location = pfn_glGetUniformLocationARB(m_glsl_program[shaderIdx], "vid_attributes");
+		uniform_location = pfn_glGetUniformLocationARB(texture->lut ? texture->lut_program : m_glsl_program[shaderIdx], "vid_attributes");
 		pfn_glUniform4fvARB(uniform_location, 1, &(vid_attributes[shaderIdx]));
 		if ( GL_CHECK_ERROR_QUIET() ) {
 			osd_printf_verbose("GLSL: could not set 'vid_attributes' for shader prog idx %d\n", shaderIdx);
@@ -2682,7 +2795,7 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 	{
 		if ( texture->type == TEXTURE_TYPE_SHADER )
 		{
-			pfn_glUseProgramObjectARB(m_glsl_program[shaderIdx]); // back to our shader
+			pfn_glUseProgramObjectARB(texture->lut ? texture->lut_program : m_glsl_program[shaderIdx]); // back to our shader
 		}
 		else if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 		{
@@ -2722,6 +2835,12 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 		if (!texBound) {
 			glBindTexture(texture->texTarget, texture->texture);
 		}
+		if (texture->lut) {
+			// texture_all_disable unbinds GL_TEXTURE1 after each frame
+			pfn_glActiveTexture(GL_TEXTURE1);
+			glBindTexture(GL_TEXTURE_2D, texture->lut_texture);
+			pfn_glActiveTexture(GL_TEXTURE0);
+		}
 		texture_coord_update(texture, prim, shaderIdx);
 
 		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
@@ -46,6 +46,8 @@ public:
 	:   hash(0), flags(0), rawwidth(0), rawheight(0),
 		rawwidth_create(0), rawheight_create(0),
 		type(0), format(0), borderpix(0), xprescale(0), yprescale(0), nocopy(0),
+		lut(0), lut_program(0), lut_texture(0), lut_table_width(0), lut_table_height(0),
+		lut_table_height_create(0),
 		texture(0), texTarget(0), texpow2(0), mpass_dest_idx(0), pbo(0), data(nullptr),
 		data_own(0), texCoordBufferName(0)
 	{
@@ -73,6 +75,12 @@ public:
 	int                 xprescale;          // what is our X prescale factor?
 	int                 yprescale;          // what is our Y prescale factor?
 	int                 nocopy;             // must the texture date be copied?
+	int                 lut;                // palette lookup in the fragment shader?
+	GLhandleARB         lut_program;        // idx16 LUT program (single pass only)
+	uint32_t              lut_texture;        // OpenGL texture "name"/ID of the palette LUT
+	int                 lut_table_width;    // columns in the LUT table
+	int                 lut_table_height;   // rows in the LUT table
+	int                 lut_table_height_create;    // rows allocated, pow2 compatible, if needed
 
 	uint32_t              texture;            // OpenGL texture "name"/ID
 
@@ -23,6 +23,7 @@
 #include "../../sdl/osdsdl.h"
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <memory>
 
@@ -45,8 +46,8 @@ public:
 
 	sound_sdl() :
 		osd_module(OSD_SOUND_PROVIDER, "sdl"), sound_module(),
-		stream_in_initialized(0),
-		attenuation(0), buf_locked(0), stream_buffer(nullptr), stream_buffer_size(0), buffer_underflows(0), buffer_overflows(0)
+		audio_device(0), stream_in_initialized(0),
+		attenuation(0), stream_buffer(nullptr), stream_buffer_size(0), buffer_underflows(0), buffer_overflows(0)
 {
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
 	}
@@ -59,38 +60,39 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual double latency() const override;
 
 private:
+	// lock-free single-producer/single-consumer ring: the emulation thread
+	// only ever advances the tail and the audio callback only the head
 	class ring_buffer
 	{
 	public:
 		ring_buffer(size_t size);
 
-		size_t data_size() const { return (tail - head + buffer_size) % buffer_size; }
-		size_t free_size() const { return (head - tail - 1 + buffer_size) % buffer_size; }
+		size_t data_size() const { return (tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire) + buffer_size) % buffer_size; }
+		size_t free_size() const { return (head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire) - 1 + buffer_size) % buffer_size; }
 		int append(const void *data, size_t size);
 		int pop(void *data, size_t size);
 
 	private:
 		std::unique_ptr<int8_t []> const buffer;
 		size_t const buffer_size;
-		int head = 0, tail = 0;
+		std::atomic<size_t> head{ 0 }, tail{ 0 };
 	};
 
 	static void sdl_callback(void *userdata, Uint8 *stream, int len);
 
-	void lock_buffer();
-	void unlock_buffer();
 	void attenuate(int16_t *data, int bytes);
 	void copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy);
 	int sdl_create_buffers();
 	void sdl_destroy_buffers();
 
+	SDL_AudioDeviceID audio_device;
 	int sdl_xfer_samples;
 	int stream_in_initialized;
 	int attenuation;
 
-	int              buf_locked;
 	std::unique_ptr<ring_buffer> stream_buffer;
 	uint32_t         stream_buffer_size;
 
@@ -132,14 +134,17 @@ int sound_sdl::ring_buffer::append(const void *data, size_t size)
 		return -1;
 
 	int8_t const *const data8 = reinterpret_cast<int8_t const *>(data);
-	size_t sz = buffer_size - tail;
+	size_t const writepos = tail.load(std::memory_order_relaxed);
+	size_t sz = buffer_size - writepos;
 	if (size <= sz)
 		sz = size;
 	else
 		std::copy_n(&data8[sz], size - sz, &buffer[0]);
 
-	std::copy_n(data8, sz, &buffer[tail]);
-	tail = (tail + size) % buffer_size;
+	std::copy_n(data8, sz, &buffer[writepos]);
+
+	// publish the data before it becomes visible to the consumer
+	tail.store((writepos + size) % buffer_size, std::memory_order_release);
 
 	return 0;
 }
@@ -154,7 +159,8 @@ int sound_sdl::ring_buffer::pop(void *data, size_t size)
 		return -1;
 
 	int8_t *const data8 = reinterpret_cast<int8_t *>(data);
-	size_t sz = buffer_size - head;
+	size_t const readpos = head.load(std::memory_order_relaxed);
+	size_t sz = buffer_size - readpos;
 	if (size <= sz)
 		sz = size;
 	else
@@ -163,42 +169,13 @@ int sound_sdl::ring_buffer::pop(void *data, size_t size)
 		std::fill_n(&buffer[0], size - sz, 0);
 	}
 
-	std::copy_n(&buffer[head], sz, data8);
-	std::fill_n(&buffer[head], sz, 0);
-	head = (head + size) % buffer_size;
-
-	return 0;
-}
-
-//============================================================
-//  sound_sdl - destructor
-//============================================================
-
-//============================================================
-//  lock_buffer
-//============================================================
-void sound_sdl::lock_buffer()
-{
-	if (!buf_locked)
-		SDL_LockAudio();
-	buf_locked++;
-
-	if (LOG_SOUND)
-		*sound_log << "locking\n";
-}
-
-//============================================================
-//  unlock_buffer
-//============================================================
-void sound_sdl::unlock_buffer()
-{
-	buf_locked--;
-	if (!buf_locked)
-		SDL_UnlockAudio();
+	std::copy_n(&buffer[readpos], sz, data8);
+	std::fill_n(&buffer[readpos], sz, 0);
 
-	if (LOG_SOUND)
-		*sound_log << "unlocking\n";
+	// release the space back to the producer
+	head.store((readpos + size) % buffer_size, std::memory_order_release);
 
+	return 0;
 }
 
 //============================================================
@@ -223,9 +200,8 @@ void sound_sdl::attenuate(int16_t *data, int bytes_to_copy)
 
 void sound_sdl::copy_sample_data(bool is_throttled, const int16_t *data, int bytes_to_copy)
 {
-	lock_buffer();
+	// the ring is single-producer/single-consumer, so no audio lock is needed
 	int const err = stream_buffer->append(data, bytes_to_copy);
-	unlock_buffer();
 
 	if (LOG_SOUND && err)
 		*sound_log << "Late detection of overflow. This shouldn't happen.\n";
@@ -252,7 +228,7 @@ void sound_sdl::update_audio_stream(bool is_throttled, const int16_t *buffer, in
 			stream_buffer->append(&zero, 1);
 
 		// start playing
-		SDL_PauseAudio(0);
+		SDL_PauseAudioDevice(audio_device, 0);
 		stream_in_initialized = 1;
 	}
 
@@ -289,12 +265,24 @@ void sound_sdl::set_mastervolume(int _attenuation)
 	if (stream_in_initialized)
 	{
 		if (attenuation == -32)
-			SDL_PauseAudio(1);
+			SDL_PauseAudioDevice(audio_device, 1);
 		else
-			SDL_PauseAudio(0);
+			SDL_PauseAudioDevice(audio_device, 0);
 	}
 }
 
+//============================================================
+//  latency
+//============================================================
+
+double sound_sdl::latency() const
+{
+	if (sample_rate() == 0 || !stream_buffer)
+		return 0.0;
+
+	return double(stream_buffer->data_size()) / (2 * sizeof(int16_t) * sample_rate());
+}
+
 //============================================================
 //  sdl_callback
 //============================================================
@@ -363,7 +351,11 @@ int sound_sdl::init(const osd_options &options)
 		aspec.callback = sdl_callback;
 		aspec.userdata = this;
 
-		if (SDL_OpenAudio(&aspec, &obtained) < 0)
+		// negotiate the device into our native rate and format; SDL only
+		// converts if the hardware truly cannot run them, where previously
+		// a device that refused the rate silently played at the wrong pitch
+		audio_device = SDL_OpenAudioDevice(nullptr, 0, &aspec, &obtained, SDL_AUDIO_ALLOW_SAMPLES_CHANGE);
+		if (audio_device == 0)
 			goto cant_start_audio;
 
 		osd_printf_verbose("Audio: frequency: %d, channels: %d, samples: %d\n",
@@ -413,7 +405,8 @@ void sound_sdl::exit()
 		return;
 
 	osd_printf_verbose("sdl_kill: closing audio\n");
-	SDL_CloseAudio();
+	SDL_CloseAudioDevice(audio_device);
+	audio_device = 0;
 
 	SDL_QuitSubSystem(SDL_INIT_AUDIO);
 
@@ -442,7 +435,6 @@ int sound_sdl::sdl_create_buffers()
 	osd_printf_verbose("sdl_create_buffers: creating stream buffer of %u bytes\n", stream_buffer_size);
 
 	stream_buffer = std::make_unique<ring_buffer>(stream_buffer_size);
-	buf_locked = 0;
 	return 0;
 }
 
@@ -27,6 +27,9 @@ public:
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
 
+	// seconds of audio queued between the emulated stream and the device
+	virtual double latency() const { return 0.0; }
+
 	int sample_rate() const { return m_sample_rate; }
 
 	int m_sample_rate;
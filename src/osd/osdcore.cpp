@@ -168,10 +168,30 @@ osd_ticks_t osd_ticks_per_second()
 //  osd_sleep
 //============================================================
 
+#if defined(_WIN32) && !defined(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION)
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
 void osd_sleep(osd_ticks_t duration)
 {
 #ifdef _WIN32
-// sleep_for appears to oversleep on Windows with gcc 8
+	// prefer a high-resolution waitable timer (Windows 10 1803 onwards);
+	// Sleep() quantizes to the scheduler period, which forces the throttle
+	// to burn the remainder of every frame spinning
+	static thread_local HANDLE const timer = CreateWaitableTimerExW(
+			nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (timer != nullptr)
+	{
+		LARGE_INTEGER due;
+		due.QuadPart = -LONGLONG((duration * 10'000'000) / osd_ticks_per_second()); // relative, 100ns units
+		if (SetWaitableTimer(timer, &due, 0, nullptr, nullptr, FALSE))
+		{
+			WaitForSingleObject(timer, INFINITE);
+			return;
+		}
+	}
+
+	// sleep_for appears to oversleep on Windows with gcc 8
 	Sleep(duration / (osd_ticks_per_second() / 1000));
 #else
 	std::this_thread::sleep_for(std::chrono::high_resolution_clock::duration(duration));
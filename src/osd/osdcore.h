@@ -129,6 +129,62 @@ osd_ticks_t osd_ticks_per_second();
 -----------------------------------------------------------------------------*/
 void osd_sleep(osd_ticks_t duration);
 
+
+/*-----------------------------------------------------------------------------
+    osd_shared_mem_map: map a named shared memory object
+
+    Parameters:
+
+        name - name of the shared memory object; a short alphanumeric
+            identifier without path separators
+
+        size - size of the object, in bytes
+
+        created - set to true if the object did not exist yet and was
+            created by this call, false if an existing object was attached
+
+    Return value:
+
+        a pointer to the mapped memory, or nullptr on failure
+
+    Notes:
+
+        A newly created object is mapped writable and shared so the caller
+        can fill it in. An existing object is mapped copy-on-write, so
+        local modifications stay private to the calling process. Callers
+        should verify the contents of an attached object, since another
+        process may still be filling it.
+-----------------------------------------------------------------------------*/
+void *osd_shared_mem_map(const char *name, size_t size, bool &created);
+
+
+/*-----------------------------------------------------------------------------
+    osd_shared_mem_unmap: release a mapping obtained from osd_shared_mem_map
+
+    Parameters:
+
+        ptr - pointer returned by osd_shared_mem_map
+
+        size - size passed to the original osd_shared_mem_map call
+-----------------------------------------------------------------------------*/
+void osd_shared_mem_unmap(void *ptr, size_t size);
+
+
+/*-----------------------------------------------------------------------------
+    osd_shared_mem_remove: remove a named shared memory object
+
+    Parameters:
+
+        name - name of the shared memory object
+
+    Notes:
+
+        Existing mappings remain valid; the name just stops resolving for
+        new osd_shared_mem_map calls. On hosts where named objects vanish
+        with their last mapping this may be a no-op.
+-----------------------------------------------------------------------------*/
+void osd_shared_mem_remove(const char *name);
+
 /***************************************************************************
     WORK ITEM INTERFACES
 ***************************************************************************/
@@ -156,6 +212,17 @@ struct osd_work_item;
 /* osd_work_callback is a callback function that does work */
 typedef void *(*osd_work_callback)(void *param, int threadid);
 
+/* osd_work_queue_stats is a lightweight snapshot of a queue's activity */
+struct osd_work_queue_stats
+{
+	int32_t         items;          /* number of items currently pending */
+	int32_t         peakitems;      /* high-water mark of pending items */
+	int32_t         itemsqueued;    /* total items queued since creation */
+	int32_t         itemsdone;      /* total items completed since creation */
+	int32_t         threads;        /* number of worker threads */
+	int32_t         livethreads;    /* number of threads currently processing work */
+};
+
 
 /*-----------------------------------------------------------------------------
     osd_work_queue_alloc: create a new work queue
@@ -206,6 +273,31 @@ osd_work_queue *osd_work_queue_alloc(int flags);
 int osd_work_queue_items(osd_work_queue *queue);
 
 
+/*-----------------------------------------------------------------------------
+    osd_work_queue_stats_get: fetch activity counters for a live work queue
+
+    Parameters:
+
+        index - zero-based index into the set of currently allocated work
+            queues, in creation order
+
+        stats - an osd_work_queue_stats structure to be filled in
+
+    Return value:
+
+        true if a queue exists at the given index and stats was filled in;
+        false once the index is past the last live queue.
+
+    Notes:
+
+        This exists so diagnostic displays can enumerate queue activity
+        without holding pointers to queues owned by other subsystems. The
+        counters are maintained with relaxed atomics and are approximate
+        under concurrent activity.
+-----------------------------------------------------------------------------*/
+bool osd_work_queue_stats_get(int index, osd_work_queue_stats &stats);
+
+
 /*-----------------------------------------------------------------------------
     osd_work_queue_wait: wait for the queue to be empty
 
@@ -375,6 +467,10 @@ public:
 	virtual bool poll() = 0;
 	virtual int read(uint8_t *pOut) = 0;
 	virtual void write(uint8_t data) = 0;
+	// schedule a byte for transmission the given number of milliseconds
+	// ahead on the host clock; modules without timestamped output fall
+	// back to an immediate write
+	virtual void write_at(uint8_t data, int delay_ms) { write(data); }
 };
 
 //FIXME: really needed here?
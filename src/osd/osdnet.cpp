@@ -38,8 +38,9 @@ class osd_netdev *open_netdev(int id, class device_network_interface *ifdev, int
 osd_netdev::osd_netdev(class device_network_interface *ifdev, int rate)
 {
 	m_dev = ifdev;
+	m_poll_period = attotime::from_hz(rate);
 	m_timer = ifdev->device().machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(osd_netdev::recv), this));
-	m_timer->adjust(attotime::from_hz(rate), 0, attotime::from_hz(rate));
+	m_timer->adjust(m_poll_period, 0, m_poll_period);
 }
 
 osd_netdev::~osd_netdev()
@@ -48,7 +49,11 @@ osd_netdev::~osd_netdev()
 
 void osd_netdev::start()
 {
-	m_timer->enable(true);
+	// the device stops us while it processes a frame; when it is ready
+	// again, poll immediately rather than waiting out the remainder of the
+	// period so back-to-back frames are delivered wire-rate instead of one
+	// per poll tick
+	m_timer->adjust(attotime::zero, 0, m_poll_period);
 }
 
 void osd_netdev::stop()
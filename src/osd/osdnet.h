@@ -48,6 +48,7 @@ private:
 
 	class device_network_interface *m_dev;
 	emu_timer *m_timer;
+	attotime m_poll_period;
 };
 
 class osd_netdev *open_netdev(int id, class device_network_interface *ifdev, int rate);
@@ -145,6 +145,9 @@ struct osd_work_queue
 	, threads(0)
 	, flags(0)
 	, doneevent(true, true)     // manual reset, signalled
+	, totalqueued(0)
+	, totaldone(0)
+	, peakitems(0)
 #if KEEP_STATISTICS
 	, itemsqueued(0)
 	, setevents(0)
@@ -167,6 +170,11 @@ struct osd_work_queue
 	std::vector<work_thread_info *>  thread;         // array of thread information
 	osd_event           doneevent;      // event signalled when work is complete
 
+	// always-on lightweight counters, exposed via osd_work_queue_stats_get
+	std::atomic<int32_t>  totalqueued;    // total items queued since creation
+	std::atomic<int32_t>  totaldone;      // total items completed since creation
+	std::atomic<int32_t>  peakitems;      // high-water mark of pending items
+
 #if KEEP_STATISTICS
 	std::atomic<int32_t>  itemsqueued;    // total items queued
 	std::atomic<int32_t>  setevents;      // number of times we called SetEvent
@@ -206,6 +214,10 @@ struct osd_work_item
 
 int osd_num_processors = 0;
 
+// list of live queues so diagnostic code can enumerate their stats
+static std::mutex queue_list_lock;
+static std::vector<osd_work_queue *> queue_list;
+
 //============================================================
 //  FUNCTION PROTOTYPES
 //============================================================
@@ -263,6 +275,12 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	queue->tailptr = (osd_work_item **)&queue->list;
 	queue->flags = flags;
 
+	// make the queue visible to osd_work_queue_stats_get
+	{
+		std::lock_guard<std::mutex> lock(queue_list_lock);
+		queue_list.push_back(queue);
+	}
+
 	// determine how many threads to create...
 	// on a single-CPU system, create 1 thread for I/O queues, and 0 threads for everything else
 	if (numprocs == 1)
@@ -337,6 +355,30 @@ int osd_work_queue_items(osd_work_queue *queue)
 }
 
 
+//============================================================
+//  osd_work_queue_stats_get
+//============================================================
+
+bool osd_work_queue_stats_get(int index, osd_work_queue_stats &stats)
+{
+	std::lock_guard<std::mutex> lock(queue_list_lock);
+
+	// walk off the end of the list once all queues have been reported
+	if (index < 0 || index >= int(queue_list.size()))
+		return false;
+
+	// snapshot the counters; they are only approximate under concurrency
+	osd_work_queue *queue = queue_list[index];
+	stats.items = queue->items;
+	stats.peakitems = queue->peakitems;
+	stats.itemsqueued = queue->totalqueued;
+	stats.itemsdone = queue->totaldone;
+	stats.threads = queue->threads;
+	stats.livethreads = queue->livethreads;
+	return true;
+}
+
+
 //============================================================
 //  osd_work_queue_wait
 //============================================================
@@ -393,6 +435,12 @@ bool osd_work_queue_wait(osd_work_queue *queue, osd_ticks_t timeout)
 
 void osd_work_queue_free(osd_work_queue *queue)
 {
+	// remove the queue from the stats enumeration before tearing it down
+	{
+		std::lock_guard<std::mutex> lock(queue_list_lock);
+		queue_list.erase(std::find(queue_list.begin(), queue_list.end(), queue));
+	}
+
 	// stop the timer for "waittime" on the main thread
 	if (queue->flags & WORK_QUEUE_FLAG_MULTI)
 	{
@@ -531,8 +579,14 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 
 	// increment the number of items in the queue
 	queue->items += numitems;
+	queue->totalqueued += numitems;
 	add_to_stat(queue->itemsqueued, numitems);
 
+	// track the high-water mark of pending items
+	int32_t curitems = queue->items;
+	int32_t peakitems = queue->peakitems;
+	while (curitems > peakitems && !queue->peakitems.compare_exchange_weak(peakitems, curitems)) { }
+
 	// look for free threads to do the work
 	if (queue->livethreads < queue->threads)
 	{
@@ -773,6 +827,7 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 
 			// decrement the item count after we are done
 			--queue->items;
+			++queue->totaldone;
 			item->done = true;
 			add_to_stat(thread->itemsdone, 1);
 
@@ -1267,21 +1267,32 @@ static void compress_common(chd_file_compressor &chd)
 	// begin compressing
 	chd.compress_begin();
 
-	// loop until done
+	// loop until done, tracking input throughput as we go
+	osd_ticks_t const start_ticks = osd_ticks();
+	osd_ticks_t compress_start_ticks = start_ticks;
 	double complete, ratio;
 	std::error_condition err;
 	while ((err = chd.compress_continue(complete, ratio)) == chd_file::error::WALKING_PARENT || err == chd_file::error::COMPRESSING)
 		if (err == chd_file::error::WALKING_PARENT)
+		{
 			progress(false, "Examining parent, %.1f%% complete...  \r", 100.0 * complete);
+			compress_start_ticks = osd_ticks();
+		}
 		else
-			progress(false, "Compressing, %.1f%% complete... (ratio=%.1f%%)  \r", 100.0 * complete, 100.0 * ratio);
+		{
+			double const elapsed = double(osd_ticks() - compress_start_ticks) / double(osd_ticks_per_second());
+			double const rate = (elapsed > 0.0) ? (complete * double(chd.logical_bytes())) / (elapsed * 1024.0 * 1024.0) : 0.0;
+			progress(false, "Compressing, %.1f%% complete... (ratio=%.1f%%, %.1f MB/s)  \r", 100.0 * complete, 100.0 * ratio, rate);
+		}
 
 	// handle errors
 	if (err)
 		report_error(1, "Error during compression: %-40s", err.message());
 
-	// final progress update
-	progress(true, "Compression complete ... final ratio = %.1f%%            \n", 100.0 * ratio);
+	// final progress update with overall throughput
+	double const elapsed = double(osd_ticks() - start_ticks) / double(osd_ticks_per_second());
+	double const rate = (elapsed > 0.0) ? double(chd.logical_bytes()) / (elapsed * 1024.0 * 1024.0) : 0.0;
+	progress(true, "Compression complete ... final ratio = %.1f%% (%s processed in %.1f seconds, %.1f MB/s)  \n", 100.0 * ratio, big_int_string(chd.logical_bytes()).c_str(), elapsed, rate);
 }
 
 
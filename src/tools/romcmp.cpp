@@ -15,9 +15,14 @@
 #include "osdfile.h"
 #include "osdcomm.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdarg>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <thread>
+#include <vector>
 
 
 #define MAX_FILES 1000
@@ -105,6 +110,12 @@ struct fileinfo
 	std::unique_ptr<unsigned char []> buf; // file is read in here
 	int listed;
 
+	// CRCs of the bytes each mode extracts, filled in lazily by
+	// section_crc(); identical sections must have identical CRCs, so a
+	// mismatch proves two sections differ without touching the data
+	uint32_t seccrc[TOTAL_MODES];
+	bool seccrc_valid[TOTAL_MODES];
+
 
 	static constexpr bool is_ascii_char(int ch)
 	{
@@ -379,6 +390,35 @@ struct fileinfo
 		}
 	}
 
+	uint32_t section_crc(int mode)
+	{
+		if (!seccrc_valid[mode])
+		{
+			int base = 0, mult = 0, mask = 0;
+			basemultmask(mode, base, mult, mask);
+			int const secsize = usedbytes(mode);
+
+			// accumulate the masked bytes a block at a time
+			util::crc32_creator crc;
+			if (buf)
+			{
+				unsigned char block[4096];
+				int pos = 0;
+				while (pos < secsize)
+				{
+					int const chunk = std::min(int(sizeof(block)), secsize - pos);
+					for (int i = 0; i < chunk; i++)
+						block[i] = buf[base + mult * (pos + i)] & mask;
+					crc.append(block, chunk);
+					pos += chunk;
+				}
+			}
+			seccrc[mode] = crc.finish();
+			seccrc_valid[mode] = true;
+		}
+		return seccrc[mode];
+	}
+
 	float compare(const fileinfo &file2, int mode1, int mode2) const
 	{
 		if (!buf || !file2.buf)
@@ -399,9 +439,28 @@ struct fileinfo
 		{
 			if (mask1 == 0xff)
 			{
-				// normal compare
-				for (int i = 0; i < size1; i++)
-					if (buf[base1 + mult1 * i] == file2.buf[base2 + mult2 * i]) match++;
+				if (mult1 == 1 && mult2 == 1)
+				{
+					// contiguous sections - compare a block at a time so
+					// identical stretches go through memcmp instead of the
+					// byte-counting loop
+					constexpr int BLOCK = 4096;
+					for (int i = 0; i < size1; i += BLOCK)
+					{
+						int const chunk = std::min(BLOCK, size1 - i);
+						if (!memcmp(&buf[base1 + i], &file2.buf[base2 + i], chunk))
+							match += chunk;
+						else
+							for (int j = i; j < i + chunk; j++)
+								if (buf[base1 + j] == file2.buf[base2 + j]) match++;
+					}
+				}
+				else
+				{
+					// normal compare
+					for (int i = 0; i < size1; i++)
+						if (buf[base1 + mult1 * i] == file2.buf[base2 + mult2 * i]) match++;
+				}
 			}
 			else
 			{
@@ -640,6 +699,11 @@ int CLIB_DECL main(int argc,char *argv[])
 					{
 						for (int mode2 = 0;mode2 < total_modes;mode2++)
 						{
+							// only identical matches are reported here, and
+							// differing section CRCs rule that out cheaply
+							if (files[0][i].section_crc(mode1) != files[0][j].section_crc(mode2))
+								continue;
+
 							if (files[0][i].compare(files[0][j],mode1,mode2) == 1.0f)
 								printname(&files[0][i],&files[0][j],1.0,mode1,mode2);
 						}
@@ -649,21 +713,37 @@ int CLIB_DECL main(int argc,char *argv[])
 		}
 		else
 		{
-			// compare two dirs
-			for (int i = 0;i < found[0];i++)
+			// compare two dirs - every cell of the match matrix is
+			// independent, so hand out rows of the first file list to a
+			// pool of worker threads
+			std::atomic<int> nextrow(0);
+			std::atomic<int> donerows(0);
+			unsigned const threadcount = std::max(1U, std::min(std::thread::hardware_concurrency(), unsigned(found[0])));
+			std::vector<std::thread> workers;
+			workers.reserve(threadcount);
+			for (unsigned t = 0; t < threadcount; t++)
 			{
-				for (int j = 0;j < found[1];j++)
-				{
-					fprintf(stderr,"%2d%%\r",100*(i*found[1]+j)/(found[0]*found[1]));
-					for (int mode1 = 0;mode1 < total_modes;mode1++)
-					{
-						for (int mode2 = 0;mode2 < total_modes;mode2++)
+				workers.emplace_back(
+						[&nextrow, &donerows, &found, total_modes] ()
 						{
-							matchscore[i][j][mode1][mode2] = files[0][i].compare(files[1][j],mode1,mode2);
-						}
-					}
-				}
+							for (int i = nextrow++; i < found[0]; i = nextrow++)
+							{
+								for (int j = 0;j < found[1];j++)
+								{
+									for (int mode1 = 0;mode1 < total_modes;mode1++)
+									{
+										for (int mode2 = 0;mode2 < total_modes;mode2++)
+										{
+											matchscore[i][j][mode1][mode2] = files[0][i].compare(files[1][j],mode1,mode2);
+										}
+									}
+								}
+								fprintf(stderr,"%2d%%\r",100*(++donerows)/found[0]);
+							}
+						});
 			}
+			for (std::thread &worker : workers)
+				worker.join();
 			fprintf(stderr,"   \r");
 
 			int besti;
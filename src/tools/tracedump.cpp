@@ -0,0 +1,78 @@
+// license:BSD-3-Clause
+// copyright-holders:Aaron Giles
+/***************************************************************************
+
+    tracedump.c
+
+    Render the binary execution traces produced by the debugger's
+    "trace <file>,<CPU>,bin" command into readable text.  Each record
+    holds the program counter, the raw opcode bytes and the total cycle
+    count at the time of the fetch; pipe the output through unidasm to
+    recover mnemonics.
+
+****************************************************************************/
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+
+/***************************************************************************
+    CONSTANTS & DEFINES
+***************************************************************************/
+
+// layout must match device_debug::tracer::trace_record in
+// src/emu/debug/debugcpu.h
+struct trace_record
+{
+	uint64_t        pc;                 // program counter
+	uint64_t        cycles;             // total cycles at the time of the fetch
+	uint8_t         length;             // opcode length in bytes
+	uint8_t         opbytes[15];        // raw opcode bytes, zero-padded
+};
+
+
+/***************************************************************************
+    MAIN
+***************************************************************************/
+
+/*-------------------------------------------------
+    main - main entry point
+-------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+	// validate arguments
+	if (argc != 2)
+	{
+		fprintf(stderr, "Usage:\n  tracedump <binary trace file>\n");
+		return 1;
+	}
+
+	// open the trace file
+	FILE *file = fopen(argv[1], "rb");
+	if (file == nullptr)
+	{
+		fprintf(stderr, "Unable to open file '%s'\n", argv[1]);
+		return 1;
+	}
+
+	// render one line per record
+	trace_record record;
+	while (fread(&record, sizeof(record), 1, file) == 1)
+	{
+		printf("%016llX: %20llu  ", (unsigned long long)record.pc, (unsigned long long)record.cycles);
+		int length = (record.length <= sizeof(record.opbytes)) ? record.length : sizeof(record.opbytes);
+		for (int byte = 0; byte < length; byte++)
+			printf("%02X ", record.opbytes[byte]);
+		printf("\n");
+	}
+
+	// a partial record at the end indicates truncation
+	if (!feof(file))
+		fprintf(stderr, "Warning: trailing partial record ignored\n");
+
+	fclose(file);
+	return 0;
+}